@@ -235,6 +235,19 @@ void CodeGenerator::generateKeywordList() {
 }
 
 
+/*! Returns the signature of the binary data layout of a class as hexadecimal literal (FNV-1a hash of the string
+	with member types and names).
+*/
+static std::string binaryLayoutSignature(const std::string & layout) {
+	unsigned int hash = 2166136261u;
+	for (char c : layout)
+		hash = (hash ^ (unsigned char)c) * 16777619u;
+	std::stringstream strm;
+	strm << "0x" << std::hex << std::setw(8) << std::setfill('0') << hash << "u";
+	return strm.str();
+}
+
+
 void CodeGenerator::generateReadWriteCode() {
 	FUNCID(CodeGenerator::generateReadWriteCode);
 
@@ -247,6 +260,8 @@ void CodeGenerator::generateReadWriteCode() {
 	// - if parent dir doesn't exist -> create it
 	// - start writing file by writing header
 	// - write writeXML() or writeXMLPrivate() function
+	// - write readXML() or readXMLPrivate() function
+	// - write readBinary()/writeBinary() or readBinaryPrivate()/writeBinaryPrivate() functions
 	for (const ClassInfo & ci : m_classInfo) {
 		try {
 
@@ -1682,6 +1697,45 @@ void CodeGenerator::generateReadWriteCode() {
 			readCode = IBK::replace_string(readCode, "${CHILD_ELEMENTS}", elements, IBK::ReplaceFirst);
 
 
+			// *** Generate readBinary() and writeBinary() content ****
+
+			// Binary data contains all XML-annotated members in order of declaration, preceded by a signature of the
+			// data layout (member types and names). When members are changed, binary data written with the old layout
+			// is rejected by readBinary().
+			// Same as with XML, undefined values (enumeration values NUM_xxx, empty parameters) do not overwrite
+			// existing values when reading.
+			std::string layout = ci.m_className;
+			std::string readBinaryMembers;
+			std::string writeBinaryMembers;
+			for (const ClassInfo::XMLInfo & xmlInfo : ci.m_xmlInfo) {
+				layout += ";" + xmlInfo.typeStr + " " + xmlInfo.varName;
+				// arrays are written element-wise, so we only need the variable name without dimension
+				std::string varName = xmlInfo.varName.substr(0, xmlInfo.varName.find("["));
+				std::string enumNUM;
+				for (const ClassInfo::EnumInfo & einfo : ci.m_enumInfo) {
+					if (einfo.enumType() == xmlInfo.typeStr) {
+						enumNUM = einfo.enumNUM;
+						break;
+					}
+				}
+				if (!enumNUM.empty() && varName == xmlInfo.varName)
+					readBinaryMembers += "	NANDRAD::readBinaryEnum(in, m_" + varName + ", " + enumNUM + ");\n";
+				else
+					readBinaryMembers += "	NANDRAD::readBinary(in, m_" + varName + ");\n";
+				writeBinaryMembers += "	NANDRAD::writeBinary(out, m_" + varName + ");\n";
+			}
+			includes.insert(m_prefix+"_BinaryIO.h");
+
+			std::string binaryCode = IBK::replace_string(CPP_READBINARY, "${MEMBERS}", readBinaryMembers, IBK::ReplaceFirst) + "\n" +
+					IBK::replace_string(CPP_WRITEBINARY, "${MEMBERS}", writeBinaryMembers, IBK::ReplaceFirst);
+			binaryCode = IBK::replace_string(binaryCode, "${CLASSNAME}", ci.m_className);
+			binaryCode = IBK::replace_string(binaryCode, "${LAYOUT}", binaryLayoutSignature(layout));
+			if (ci.m_requirePrivateReadWrite)
+				binaryCode = IBK::replace_string(binaryCode, "${PRIVATE}", "Private");
+			else
+				binaryCode = IBK::replace_string(binaryCode, "${PRIVATE}", "");
+
+
 			// *** Add header and footer and write file ****
 
 			includes.erase(m_prefix+"_Constants.h"); // is always added anyways
@@ -1697,6 +1751,7 @@ void CodeGenerator::generateReadWriteCode() {
 			out << fileHeader;
 			out << readCode << std::endl;
 			out << writeCode << std::endl;
+			out << binaryCode << std::endl;
 
 			out << "} // namespace "+m_prefix+"\n";
 			out.close();
@@ -442,4 +442,14 @@ const char * const CPP_READXML =
 		"	}\n"
 		"}\n";
 
+const char * const CPP_READBINARY =
+		"void ${CLASSNAME}::readBinary${PRIVATE}(std::istream & in) {\n"
+		"	NANDRAD::readBinaryLayout(in, ${LAYOUT}, \"${CLASSNAME}\");\n"
+		"${MEMBERS}"
+		"}\n";
 
+const char * const CPP_WRITEBINARY =
+		"void ${CLASSNAME}::writeBinary${PRIVATE}(std::ostream & out) const {\n"
+		"	NANDRAD::writeBinary(out, ${LAYOUT});\n"
+		"${MEMBERS}"
+		"}\n";
@@ -12,6 +12,8 @@ extern const char * const CPP_FOOTER;
 extern const char * const CPP_READWRITE_HEADER;
 extern const char * const CPP_WRITEXML;
 extern const char * const CPP_READXML;
+extern const char * const CPP_READBINARY;
+extern const char * const CPP_WRITEBINARY;
 
 
 #endif // CONSTANTS_H
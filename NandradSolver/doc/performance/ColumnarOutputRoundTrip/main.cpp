@@ -0,0 +1,202 @@
+/*	Round-trip test for NANDRAD_MODEL::ColumnarOutputFile (binary columnar output format, bcf).
+
+	Writes synthetic output data (constant, slowly changing and random columns as well as special values
+	like NaN, infinity and negative zero) in several chunks with and without column compression, reads the
+	files back with readIndex()/readColumn() and checks that all values are bitwise identical. Times for
+	reading a single column and all columns are reported.
+
+	With option -c, a bcf file written by the solver (flag 'ColumnarFormat' in Outputs) is compared with
+	the tsv file written by another solver run of the same project (without the flag). Values must match
+	within the precision of the tsv file.
+
+	Usage: ColumnarOutputRoundTrip [number of columns] [number of rows] [rows per chunk]
+		   ColumnarOutputRoundTrip -c <bcf file> <tsv file>
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <IBK_Path.h>
+#include <IBK_Exception.h>
+#include <IBK_StopWatch.h>
+#include <IBK_CSVReader.h>
+#include <IBK_FileUtils.h>
+
+#include <NM_ColumnarOutputFile.h>
+
+using namespace NANDRAD_MODEL;
+
+/*! Value of synthetic column j in row i. */
+double syntheticValue(std::mt19937 & rng, unsigned int i, unsigned int j) {
+	if (j == 0)
+		return i*3600.0; // time column
+	switch (j % 4) {
+		case 0 : return 20.0 + j; // constant
+		case 1 : return 20.0 + 5*std::sin(i*0.01 + j); // slowly changing
+		case 2 : return std::uniform_real_distribution<double>(-1e6, 1e6)(rng); // random
+		default : {
+			// special values
+			const double special[] = { 0.0, -0.0, std::numeric_limits<double>::quiet_NaN(),
+									   std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+									   std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::max(), 1.0 };
+			return special[(i + j) % 8];
+		}
+	}
+}
+
+
+/*! Writes synthetic data into file, reads it back and compares all values bitwise.
+	Returns number of differing values.
+*/
+unsigned int roundTrip(const IBK::Path & fname, bool compressed, unsigned int nCols, unsigned int nRows, unsigned int chunkRows) {
+	std::mt19937 rng(42);
+	std::vector<std::vector<double> > data(nCols, std::vector<double>(nRows));
+	for (unsigned int i=0; i<nRows; ++i)
+		for (unsigned int j=0; j<nCols; ++j)
+			data[j][i] = syntheticValue(rng, i, j);
+
+	std::vector<ColumnarOutputFile::Column> columns;
+	columns.push_back(ColumnarOutputFile::Column("Time [h]", "Time", "h"));
+	for (unsigned int j=1; j<nCols; ++j)
+		columns.push_back(ColumnarOutputFile::Column("Zone(" + std::to_string(j) + ").AirTemperature [C]", "AirTemperature", "C"));
+
+	IBK::StopWatch w;
+	{
+		std::ofstream out;
+		if (!IBK::open_ofstream(out, fname, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+			throw IBK::Exception(IBK::FormatString("Cannot create file '%1'.").arg(fname), "roundTrip");
+		ColumnarOutputFile::writeHeader(out, 2019, compressed, columns);
+		std::vector<std::vector<double> > rows;
+		std::vector<char> buffer;
+		for (unsigned int i=0; i<nRows; ++i) {
+			rows.push_back(std::vector<double>(nCols));
+			for (unsigned int j=0; j<nCols; ++j)
+				rows.back()[j] = data[j][i];
+			if (rows.size() == chunkRows || i+1 == nRows) {
+				ColumnarOutputFile::writeChunk(out, compressed, rows, buffer);
+				rows.clear();
+			}
+		}
+	}
+	double tWrite = w.difference();
+
+	// read index and a single column
+	w.start();
+	ColumnarOutputFile f;
+	f.readIndex(fname);
+	std::vector<double> values;
+	f.readColumn(nCols/2, values);
+	double tSingle = w.difference();
+
+	unsigned int differences = 0;
+	if (f.m_startYear != 2019 || f.m_compressed != compressed || f.m_nRows != nRows || f.m_columns.size() != nCols) {
+		std::cerr << "Header data differs." << std::endl;
+		++differences;
+	}
+	for (unsigned int j=0; j<f.m_columns.size() && j<nCols; ++j) {
+		if (f.m_columns[j].m_label != columns[j].m_label || f.m_columns[j].m_quantity != columns[j].m_quantity ||
+			f.m_columns[j].m_unit != columns[j].m_unit)
+		{
+			std::cerr << "Column meta data of column #" << j << " differs." << std::endl;
+			++differences;
+		}
+	}
+
+	// read all columns
+	w.start();
+	std::vector<std::vector<double> > colValues(nCols);
+	for (unsigned int j=0; j<nCols; ++j)
+		f.readColumn(j, colValues[j]);
+	double tAll = w.difference();
+
+	for (unsigned int j=0; j<nCols; ++j) {
+		if (colValues[j].size() != nRows) {
+			std::cerr << "Wrong number of values in column #" << j << std::endl;
+			++differences;
+			continue;
+		}
+		// compare bitwise, NaN values must be preserved
+		for (unsigned int i=0; i<nRows; ++i)
+			if (std::memcmp(&colValues[j][i], &data[j][i], sizeof(double)) != 0)
+				++differences;
+	}
+
+	std::cout << (compressed ? "compressed  " : "uncompressed")
+			  << std::setw(12) << fname.fileSize() << " bytes"
+			  << std::setw(10) << tWrite << " ms write"
+			  << std::setw(10) << tSingle << " ms index+1 column"
+			  << std::setw(10) << tAll << " ms all columns"
+			  << "  differences: " << differences << std::endl;
+	return differences;
+}
+
+
+/*! Compares bcf file with tsv file, returns number of differing values. */
+unsigned int compareWithTsv(const IBK::Path & bcfFile, const IBK::Path & tsvFile) {
+	ColumnarOutputFile f;
+	f.readIndex(bcfFile);
+	IBK::CSVReader tsv;
+	tsv.readColumns(tsvFile);
+
+	unsigned int differences = 0;
+	if (tsv.m_nColumns != f.m_columns.size() || tsv.m_nRows != f.m_nRows) {
+		std::cerr << "Table dimensions differ: bcf " << f.m_columns.size() << "x" << f.m_nRows
+				  << ", tsv " << tsv.m_nColumns << "x" << tsv.m_nRows << std::endl;
+		return 1;
+	}
+	std::vector<double> values;
+	for (unsigned int j=0; j<tsv.m_nColumns; ++j) {
+		if (tsv.m_captions[j] != f.m_columns[j].m_label) {
+			std::cerr << "Caption of column #" << j << " differs: '" << f.m_columns[j].m_label << "' vs. '"
+					  << tsv.m_captions[j] << "'" << std::endl;
+			++differences;
+		}
+		f.readColumn(j, values);
+		for (unsigned int i=0; i<tsv.m_nRows; ++i) {
+			// tsv files are written with 6 significant digits (time column with 10 digits)
+			double tol = 1e-5*std::max(1.0, std::fabs(values[i]));
+			if (!(std::fabs(values[i] - tsv.m_colValues[j][i]) <= tol))
+				++differences;
+		}
+	}
+	std::cout << "Compared " << tsv.m_nColumns << " columns with " << tsv.m_nRows << " rows, differences: "
+			  << differences << std::endl;
+	return differences;
+}
+
+
+int main(int argc, char * argv[]) {
+	try {
+		if (argc == 4 && std::strcmp(argv[1], "-c") == 0)
+			return compareWithTsv(IBK::Path(argv[2]), IBK::Path(argv[3])) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+		unsigned int nCols = 2000;
+		unsigned int nRows = 8760;
+		unsigned int chunkRows = 1000;
+		if (argc > 1)
+			nCols = (unsigned int)std::atoi(argv[1]);
+		if (argc > 2)
+			nRows = (unsigned int)std::atoi(argv[2]);
+		if (argc > 3)
+			chunkRows = (unsigned int)std::max(1, std::atoi(argv[3]));
+
+		std::cout << "Columns: " << nCols << ", rows: " << nRows << ", rows per chunk: " << chunkRows << std::endl;
+		std::cout << std::fixed << std::setprecision(1);
+		IBK::Path fname("ColumnarOutputRoundTrip.bcf");
+		unsigned int differences = roundTrip(fname, false, nCols, nRows, chunkRows);
+		differences += roundTrip(fname, true, nCols, nRows, chunkRows);
+		IBK::Path::remove(fname);
+		return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		return EXIT_FAILURE;
+	}
+}
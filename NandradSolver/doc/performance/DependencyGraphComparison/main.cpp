@@ -0,0 +1,294 @@
+/*	Comparison of ZEPPELIN::DependencyGraph with its former implementation.
+
+	Initializes the solver model for each given NANDRAD project and extracts the state dependency graph
+	(see NandradModel::initModelGraph()). The graph is then clustered and ordered with the current
+	implementation of ZEPPELIN::DependencyGraph and with the former implementation (copy in namespace
+	ZEPPELIN_REFERENCE). Groups (type, members, dependencies, parents), orderedObjects() and
+	orderedParallelObjects() must be identical. Afterwards, the same check is done for random graphs and
+	times are reported for a few large graphs.
+
+	Solver output directories are created below the directory given with -o (default: current directory).
+
+	Usage: DependencyGraphComparison [-o <output directory>] <project1.nandrad> [<project2.nandrad> ...]
+
+	To check all test projects:
+
+		find data/tests -name "*.nandrad" | xargs DependencyGraphComparison -o /tmp/dgc
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <list>
+#include <map>
+#include <random>
+#include <algorithm>
+#include <cstring>
+
+#include <IBK_Path.h>
+#include <IBK_Exception.h>
+#include <IBK_StopWatch.h>
+#include <IBK_messages.h>
+#include <IBK_MessageHandlerRegistry.h>
+
+#include <NANDRAD_ArgsParser.h>
+
+#include <NM_NandradModel.h>
+#include <NM_AbstractStateDependency.h>
+
+#include <ZEPPELIN_DependencyGraph.h>
+
+#include "ZEPPELIN_REFERENCE_DependencyGraph.h"
+
+/*! Index based copy of a dependency graph.
+	Nodes 0...n-1 are the graph objects, nodes n...total-1 are objects referenced by graph objects only.
+*/
+struct Graph {
+	unsigned int							m_n = 0;
+	unsigned int							m_total = 0;
+	std::vector<std::vector<unsigned int> >	m_dependencies;
+	std::vector<std::vector<unsigned int> >	m_parents;
+};
+
+
+/*! Creates index based copy of a graph given by its objects. */
+Graph graphFromObjects(const std::vector<ZEPPELIN::DependencyObject*> & objects) {
+	Graph g;
+	g.m_n = objects.size();
+	std::map<const ZEPPELIN::DependencyObject*, unsigned int> indexes;
+	for (unsigned int i=0; i<objects.size(); ++i)
+		indexes[objects[i]] = i;
+	// returns index of object, objects outside the graph get new indexes
+	auto index = [&indexes](const ZEPPELIN::DependencyObject * o) {
+		std::map<const ZEPPELIN::DependencyObject*, unsigned int>::const_iterator it = indexes.find(o);
+		if (it != indexes.end())
+			return it->second;
+		unsigned int idx = indexes.size();
+		indexes[o] = idx;
+		return idx;
+	};
+	g.m_dependencies.resize(g.m_n);
+	g.m_parents.resize(g.m_n);
+	for (unsigned int i=0; i<objects.size(); ++i) {
+		for (const ZEPPELIN::DependencyObject * o : objects[i]->dependencies())
+			g.m_dependencies[i].push_back(index(o));
+		for (const ZEPPELIN::DependencyObject * o : objects[i]->parents())
+			g.m_parents[i].push_back(index(o));
+	}
+	g.m_total = indexes.size();
+	return g;
+}
+
+
+/*! Creates random graph with n nodes and extra nodes outside the graph.
+	Chain graphs resemble the state dependencies of the solver (long sequences with few branches and cycles).
+*/
+Graph randomGraph(std::mt19937 & rng, unsigned int n, double p, unsigned int extra, bool chain) {
+	Graph g;
+	g.m_n = n;
+	g.m_total = n + extra;
+	g.m_dependencies.resize(n);
+	g.m_parents.resize(n);
+	std::vector<std::vector<unsigned int> > parents(n + extra);
+	std::uniform_real_distribution<double> u(0, 1);
+	std::uniform_int_distribution<unsigned int> pick(0, n + extra - 1);
+	for (unsigned int i=0; i<n; ++i) {
+		std::vector<unsigned int> & deps = g.m_dependencies[i];
+		if (chain) {
+			if (i + 1 < n && u(rng) < 0.7)
+				deps.push_back(i + 1);
+			if (u(rng) < p)
+				deps.push_back(pick(rng));
+			// self references
+			if (!deps.empty() && u(rng) < 0.02)
+				deps.push_back(i);
+		}
+		else {
+			unsigned int k = std::poisson_distribution<unsigned int>(p)(rng);
+			for (unsigned int j=0; j<k; ++j) {
+				unsigned int d = pick(rng);
+				if (d == i && deps.empty())
+					continue;
+				if (std::find(deps.begin(), deps.end(), d) == deps.end())
+					deps.push_back(d);
+			}
+		}
+		for (unsigned int d : deps)
+			if (std::find(parents[d].begin(), parents[d].end(), i) == parents[d].end())
+				parents[d].push_back(i);
+	}
+	for (unsigned int i=0; i<n; ++i)
+		g.m_parents[i] = parents[i];
+	return g;
+}
+
+
+/*! Clusters and orders graph with the implementation given by the template arguments.
+	Returns text description of the result with objects named by their index, groups by their position.
+*/
+template <typename DependencyObject, typename DependencyGraph, typename DependencyGroup>
+std::string clusterGraph(const Graph & g, double & seconds) {
+	struct Node : public DependencyObject {
+		void addDependency(DependencyObject * o) { this->m_childs.push_back(o); }
+		void addParent(DependencyObject * o) { this->m_parents.push_back(o); }
+	};
+	std::vector<Node> nodes(g.m_total);
+	for (unsigned int i=0; i<g.m_n; ++i) {
+		for (unsigned int d : g.m_dependencies[i])
+			nodes[i].addDependency(&nodes[d]);
+		for (unsigned int p : g.m_parents[i])
+			nodes[i].addParent(&nodes[p]);
+	}
+	std::vector<DependencyObject*> objects;
+	for (unsigned int i=0; i<g.m_n; ++i)
+		objects.push_back(&nodes[i]);
+
+	std::list<DependencyGroup> groups;
+	DependencyGraph graph;
+	IBK::StopWatch w;
+	graph.setObjects(objects, groups);
+	seconds = w.difference()*1e-3;
+
+	std::map<const DependencyObject*, std::string> names;
+	for (unsigned int i=0; i<g.m_total; ++i)
+		names[&nodes[i]] = "n" + IBK::val2string(i);
+	unsigned int groupIdx = 0;
+	for (const DependencyGroup & group : groups)
+		names[&group] = "g" + IBK::val2string(groupIdx++);
+	auto name = [&names](const DependencyObject * o) {
+		typename std::map<const DependencyObject*, std::string>::const_iterator it = names.find(o);
+		return it == names.end() ? std::string("?") : it->second;
+	};
+
+	std::stringstream strm;
+	for (const DependencyGroup & group : groups) {
+		strm << (group.type() == DependencyGroup::CYCLIC ? "C [" : "S [");
+		for (const DependencyObject * o : group.depObjects())
+			strm << name(o) << " ";
+		strm << "] dependencies (";
+		for (const DependencyObject * o : group.dependencies())
+			strm << name(o) << " ";
+		strm << ") parents (";
+		for (const DependencyObject * o : group.parents())
+			strm << name(o) << " ";
+		strm << ")\n";
+	}
+	for (const typename DependencyGraph::ParallelObjects & parallelObjects : graph.orderedParallelObjects()) {
+		strm << "parallel: ";
+		for (const DependencyObject * o : parallelObjects)
+			strm << name(o) << " ";
+		strm << "\n";
+	}
+	strm << "ordered: ";
+	for (const DependencyObject * o : graph.orderedObjects())
+		strm << name(o) << " ";
+	strm << "\n";
+	return strm.str();
+}
+
+
+/*! Results of all comparisons. */
+struct Statistics {
+	unsigned int	m_identical = 0;
+	unsigned int	m_different = 0;
+	/*! The former implementation fails for some graphs (std::bad_alloc). */
+	unsigned int	m_referenceFailed = 0;
+};
+
+
+/*! Compares results of both implementations for graph g.
+	The former implementation only searches sources and sinks in graphs with up to 10000 objects (larger graphs
+	yield one cyclic group per object). Pass checkResults = false for larger graphs to report times only.
+*/
+void compare(const Graph & g, const std::string & label, Statistics & stats, bool printTimes = false, bool checkResults = true) {
+	double tReference, tCurrent;
+	std::string reference;
+	try {
+		reference = clusterGraph<ZEPPELIN_REFERENCE::DependencyObject, ZEPPELIN_REFERENCE::DependencyGraph,
+				ZEPPELIN_REFERENCE::DependencyGroup>(g, tReference);
+	}
+	catch (std::bad_alloc &) {
+		++stats.m_referenceFailed;
+		return;
+	}
+	std::string current = clusterGraph<ZEPPELIN::DependencyObject, ZEPPELIN::DependencyGraph,
+			ZEPPELIN::DependencyGroup>(g, tCurrent);
+	if (printTimes)
+		std::cout << std::setw(30) << std::left << label << " " << std::setw(8) << std::right << g.m_n << " objects, former "
+				  << std::setw(10) << tReference << " s, current " << std::setw(10) << tCurrent << " s" << std::endl;
+	if (!checkResults)
+		return;
+	if (reference == current) {
+		++stats.m_identical;
+	}
+	else {
+		++stats.m_different;
+		std::cout << "Results differ for " << label << "\n--- former implementation\n" << reference
+				  << "--- current implementation\n" << current << std::endl;
+	}
+}
+
+
+int main(int argc, char * argv[]) {
+	IBK::MessageHandlerRegistry::instance().messageHandler()->setConsoleVerbosityLevel(IBK::VL_SPECIAL); // no solver initialization messages
+
+	IBK::Path outputDir(".");
+	std::vector<IBK::Path> projects;
+	for (int i=1; i<argc; ++i) {
+		if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			outputDir = IBK::Path(argv[++i]);
+		else
+			projects.push_back(IBK::Path(argv[i]));
+	}
+
+	// *** state dependency graphs of projects ***
+
+	Statistics projectStats;
+	unsigned int failedProjects = 0;
+	for (const IBK::Path & project : projects) {
+		Graph g;
+		try {
+			std::string outputDirOption = "--output-dir=" + (outputDir / project.withoutExtension().filename()).str();
+			const char * args[] = { argv[0], outputDirOption.c_str(), project.c_str() };
+			NANDRAD::ArgsParser argParser;
+			argParser.parse(3, args);
+			NANDRAD_MODEL::NandradModel model;
+			model.setupDirectories(argParser);
+			model.init(argParser);
+			std::vector<ZEPPELIN::DependencyObject*> objects(model.stateDependencies().begin(), model.stateDependencies().end());
+			g = graphFromObjects(objects);
+		}
+		catch (IBK::Exception & ex) {
+			std::cout << "Cannot initialize model of '" << project.filename() << "': " << ex.what() << std::endl;
+			++failedProjects;
+			continue;
+		}
+		compare(g, project.filename().str(), projectStats);
+	}
+	std::cout << projects.size() << " projects, " << failedProjects << " failed to initialize, graphs identical: "
+			  << projectStats.m_identical << ", different: " << projectStats.m_different
+			  << ", failed with former implementation: " << projectStats.m_referenceFailed << std::endl;
+
+	// *** random graphs ***
+
+	Statistics randomStats;
+	std::mt19937 rng(42);
+	for (unsigned int i=0; i<3000; ++i) {
+		unsigned int n = 1 + rng() % 60;
+		double p = (i % 3 == 0) ? 0.15 : 0.5 + (rng() % 30)/10.0;
+		Graph g = randomGraph(rng, n, p, (i % 5 == 0) ? 3 : 0, i % 3 == 0);
+		compare(g, "random graph #" + IBK::val2string(i), randomStats);
+	}
+	std::cout << "3000 random graphs, identical: " << randomStats.m_identical << ", different: " << randomStats.m_different
+			  << ", failed with former implementation: " << randomStats.m_referenceFailed << std::endl;
+
+	// *** timing for large graphs ***
+
+	Statistics largeStats;
+	for (unsigned int n : { 2000u, 8000u, 20000u })
+		compare(randomGraph(rng, n, 0.05, 0, true), "chain graph", largeStats, true, n <= 10000);
+	compare(randomGraph(rng, 8000, 1.2, 0, false), "sparse graph", largeStats, true);
+
+	return (projectStats.m_different + randomStats.m_different + largeStats.m_different) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
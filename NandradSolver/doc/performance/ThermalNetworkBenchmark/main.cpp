@@ -0,0 +1,144 @@
+/*	Benchmark for NANDRAD_MODEL::ThermalNetworkModelImpl::update().
+
+	Generates a synthetic district heating network (supply and return line with consumers between them,
+	about 5000 flow elements) and evaluates the nodal temperatures many times, like during RHS and Jacobian
+	evaluations of the solver. Mass fluxes change sign in some branches. Results are compared with the former
+	implementation that works on the Node/Element connectivity directly (must be identical).
+
+	Usage: ThermalNetworkBenchmark [number of flow elements] [number of updates]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+
+#include <IBK_StopWatch.h>
+
+#include <NANDRAD_HydraulicFluid.h>
+
+#include <NM_HydraulicNetworkModelPrivate.h>
+#include <NM_ThermalNetworkPrivate.h>
+
+using namespace NANDRAD_MODEL;
+
+/*! Former implementation of ThermalNetworkModelImpl::update() for plain nodes, working on the Node/Element
+	connectivity directly.
+*/
+void referenceUpdate(const Network & nw, const std::vector<ThermalNetworkAbstractFlowElement*> & flowElements,
+					 const double * massFluxes, const NANDRAD::HydraulicFluid & fluid, std::vector<double> & nodalTemperatures)
+{
+	for (unsigned int i = 0; i < flowElements.size(); ++i)
+		flowElements[i]->setMassFlux(massFluxes[i]);
+	for (unsigned int i = 0; i < nw.m_nodes.size(); ++i) {
+		double enthalpyFluxInlet = 0;
+		std::vector<unsigned int> inletIdxs = nw.m_nodes[i].m_elementIndexesInlet;
+		std::vector<unsigned int> outletIdxs = nw.m_nodes[i].m_elementIndexesOutlet;
+		double massFluxInlet = 0.0;
+		for (unsigned int idx : inletIdxs) {
+			const double massFlux = massFluxes[idx];
+			if (massFlux > 0) {
+				massFluxInlet += massFlux;
+				double temp = flowElements[idx]->outflowTemperature();
+				enthalpyFluxInlet += massFlux * fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value * temp;
+			}
+		}
+		for (unsigned int idx : outletIdxs) {
+			const double massFlux = massFluxes[idx];
+			if (massFlux < 0) {
+				massFluxInlet -= massFlux;
+				double temp = flowElements[idx]->outflowTemperature();
+				enthalpyFluxInlet += -massFlux * fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value * temp;
+			}
+		}
+		if (massFluxInlet != 0.0)
+			nodalTemperatures[i] = enthalpyFluxInlet/(massFluxInlet * fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value);
+	}
+	for (unsigned int i = 0; i < flowElements.size(); ++i) {
+		const Element & fe = nw.m_elements[i];
+		if (massFluxes[i] >= 0)
+			flowElements[i]->setInflowTemperature(nodalTemperatures[fe.m_nodeIndexInlet]);
+		else
+			flowElements[i]->setInflowTemperature(nodalTemperatures[fe.m_nodeIndexOutlet]);
+	}
+}
+
+
+int main(int argc, char * argv[]) {
+	unsigned int elementCount = 5000;
+	unsigned int updates = 20000;
+	if (argc > 1)
+		elementCount = (unsigned int)std::atoi(argv[1]);
+	if (argc > 2)
+		updates = (unsigned int)std::atoi(argv[2]);
+
+	// consumers k = 0...n-1, each with a supply pipe (s_k -> s_k+1), a consumer (s_k+1 -> r_k+1) and
+	// a return pipe (r_k+1 -> r_k); supply node s_0 and return node r_0 are connected by the source
+	const unsigned int n = elementCount/3;
+	Network nw;
+	nw.m_nodes.resize(2*(n+1));
+	std::vector<ThermalNetworkAbstractFlowElement*> flowElements;
+	for (unsigned int k = 0; k <= n; ++k) {
+		unsigned int s = 2*k;
+		unsigned int r = 2*k + 1;
+		if (k == 0)
+			nw.m_elements.push_back(Element(r, s)); // source
+		else {
+			nw.m_elements.push_back(Element(s - 2, s)); // supply pipe
+			nw.m_elements.push_back(Element(s, r)); // consumer
+			nw.m_elements.push_back(Element(r, r - 2)); // return pipe
+		}
+	}
+	for (unsigned int i = 0; i < nw.m_elements.size(); ++i) {
+		nw.m_nodes[nw.m_elements[i].m_nodeIndexOutlet].m_elementIndexesInlet.push_back(i);
+		nw.m_nodes[nw.m_elements[i].m_nodeIndexInlet].m_elementIndexesOutlet.push_back(i);
+		ThermalNetworkAbstractFlowElement * fe = new ThermalNetworkAbstractFlowElement;
+		fe->setInitialTemperature(273.15 + 10 + 60.0*std::rand()/RAND_MAX);
+		flowElements.push_back(fe);
+	}
+
+	// several sets of mass fluxes, some of them with reversed flow
+	const unsigned int FLUX_SETS = 16;
+	std::vector<std::vector<double> > massFluxes(FLUX_SETS, std::vector<double>(nw.m_elements.size()));
+	for (unsigned int j = 0; j < FLUX_SETS; ++j)
+		for (unsigned int i = 0; i < nw.m_elements.size(); ++i)
+			massFluxes[j][i] = 0.5*std::rand()/RAND_MAX - (i % 17 == 0 ? 0.3 : 0.0);
+
+	NANDRAD::HydraulicFluid fluid;
+	fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].set("HeatCapacity", 4180, "J/kgK");
+
+	ThermalNetworkModelImpl impl;
+	impl.m_flowElements = flowElements; // takes ownership
+	impl.setup(nw, fluid);
+
+	std::cout << "Flow elements: " << nw.m_elements.size() << ", nodes: " << nw.m_nodes.size()
+			  << ", updates: " << updates << std::endl;
+
+	std::vector<double> refTemperatures(nw.m_nodes.size(), 293.15);
+	IBK::StopWatch w;
+	for (unsigned int u = 0; u < updates; ++u)
+		referenceUpdate(nw, flowElements, massFluxes[u % FLUX_SETS].data(), fluid, refTemperatures);
+	double tReference = w.stop();
+
+	impl.m_nodalTemperatures.assign(nw.m_nodes.size(), 293.15);
+	w.start();
+	for (unsigned int u = 0; u < updates; ++u) {
+		impl.m_fluidMassFluxes = massFluxes[u % FLUX_SETS].data();
+		impl.update();
+	}
+	double tUpdate = w.stop();
+
+	unsigned int differences = 0;
+	for (unsigned int i = 0; i < nw.m_nodes.size(); ++i)
+		if (refTemperatures[i] != impl.m_nodalTemperatures[i])
+			++differences;
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Former update()   " << std::setw(10) << tReference << " ms  "
+			  << std::setw(8) << tReference*1e3/updates << " us/update" << std::endl;
+	std::cout << "update()          " << std::setw(10) << tUpdate << " ms  "
+			  << std::setw(8) << tUpdate*1e3/updates << " us/update" << std::endl;
+	std::cout << "Differences to reference: " << differences << std::endl;
+
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
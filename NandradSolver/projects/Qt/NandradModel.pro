@@ -74,6 +74,7 @@ SOURCES += \
 	../../src/NM_NaturalVentilationModel.cpp \
 	../../src/NM_NetworkInterfaceAdapterModel.cpp \
 	../../src/NM_OutputFile.cpp \
+	../../src/NM_ColumnarOutputFile.cpp \
 	../../src/NM_OutputHandler.cpp \
 	../../src/NM_Physics.cpp \
 	../../src/NM_QuantityName.cpp \
@@ -89,6 +90,7 @@ SOURCES += \
 	../../src/NM_ThermalNetworkAbstractFlowElementWithHeatLoss.cpp \
 	../../src/NM_ThermalNetworkBalanceModel.cpp \
 	../../src/NM_ThermalNetworkFlowElements.cpp \
+	../../src/NM_ThermalNetworkPipeGroups.cpp \
 	../../src/NM_ThermalNetworkPrivate.cpp \
 	../../src/NM_ThermalNetworkStatesModel.cpp \
 	../../src/NM_ThermostatModel.cpp \
@@ -124,6 +126,7 @@ HEADERS += \
 	../../src/NM_NaturalVentilationModel.h \
 	../../src/NM_NetworkInterfaceAdapterModel.h \
 	../../src/NM_OutputFile.h \
+	../../src/NM_ColumnarOutputFile.h \
 	../../src/NM_OutputHandler.h \
 	../../src/NM_Physics.h \
 	../../src/NM_QuantityDescription.h \
@@ -146,6 +149,7 @@ HEADERS += \
 	../../src/NM_ThermalNetworkPrivate.h \
 	../../src/NM_ThermalNetworkAbstractFlowElement.h \
 	../../src/NM_ThermalNetworkFlowElements.h \
+	../../src/NM_ThermalNetworkPipeGroups.h \
 	../../src/NM_AbstractController.h \
 	../../src/NM_Controller.h \
 	../../src/NM_ShadingControlModel.h \
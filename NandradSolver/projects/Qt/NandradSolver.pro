@@ -32,6 +32,10 @@ contains( OPTIONS, lapack ) {
 	LIBS += -llapack
 }
 
+unix {
+	LIBS += -lpthread
+}
+
 INCLUDEPATH = \
 	../../src \
 	../../../externals/CCM/src \
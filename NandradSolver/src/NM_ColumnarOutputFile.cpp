@@ -0,0 +1,250 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_ColumnarOutputFile.h"
+
+#include <fstream>
+#include <memory>
+#include <cstring>
+
+#include <IBK_Exception.h>
+#include <IBK_FormatString.h>
+#include <IBK_FileUtils.h>
+#include <IBK_InputOutput.h>
+
+namespace NANDRAD_MODEL {
+
+const char * const COLUMNAR_FILE_MAGIC = "BCOLNDR1";
+const char * const COLUMNAR_CHUNK_MAGIC = "CHNK";
+
+/*! Maximum string length accepted when reading column meta data (protects against corrupt files). */
+const uint32_t COLUMNAR_MAX_STRING_LENGTH = 10000;
+
+/*! Writes zero bytes until the stream position is a multiple of 8. */
+static void writePadding(std::ostream & out, uint64_t size) {
+	const char zeros[8] = {0,0,0,0,0,0,0,0};
+	unsigned int padding = (8 - size % 8) % 8;
+	if (padding != 0)
+		out.write(zeros, padding);
+}
+
+
+void ColumnarOutputFile::writeHeader(std::ostream & out, unsigned int startYear, bool compressed, const std::vector<Column> & columns) {
+	out.write(COLUMNAR_FILE_MAGIC, 8);
+	IBK::write_uint32_binary(out, startYear);
+	IBK::write_uint32_binary(out, compressed ? 1 : 0);
+	IBK::write_uint32_binary(out, (uint32_t)columns.size());
+	uint64_t size = 8 + 3*sizeof(uint32_t);
+	for (const Column & c : columns) {
+		IBK::write_string_binary(out, c.m_label);
+		IBK::write_string_binary(out, c.m_quantity);
+		IBK::write_string_binary(out, c.m_unit);
+		size += 3*sizeof(uint32_t) + c.m_label.size() + c.m_quantity.size() + c.m_unit.size();
+	}
+	writePadding(out, size);
+}
+
+
+void ColumnarOutputFile::writeChunk(std::ostream & out, bool compressed, const std::vector<std::vector<double> > & rows,
+									std::vector<char> & buffer)
+{
+	if (rows.empty())
+		return;
+	unsigned int nCols = (unsigned int)rows[0].size();
+	uint32_t nRows = (uint32_t)rows.size();
+
+	// compose all column blocks in buffer first, since the chunk header holds the block sizes
+	buffer.clear();
+	std::vector<uint64_t> sizes(nCols);
+	for (unsigned int j=0; j<nCols; ++j) {
+		std::size_t start = buffer.size();
+		if (compressed) {
+			compressColumn(rows, j, buffer);
+		}
+		else {
+			buffer.resize(start + nRows*sizeof(double));
+			double * vals = reinterpret_cast<double*>(&buffer[start]);
+			for (unsigned int i=0; i<nRows; ++i)
+				std::memcpy(vals + i, &rows[i][j], sizeof(double)); // buffer may not be aligned
+		}
+		sizes[j] = buffer.size() - start;
+		// pad block to 8 bytes
+		buffer.resize(start + (sizes[j] + 7)/8*8, 0);
+	}
+
+	out.write(COLUMNAR_CHUNK_MAGIC, 4);
+	IBK::write_uint32_binary(out, nRows);
+	out.write(reinterpret_cast<const char*>(sizes.data()), nCols*sizeof(uint64_t));
+	out.write(buffer.data(), (std::streamsize)buffer.size());
+}
+
+
+void ColumnarOutputFile::readIndex(const IBK::Path & fname) {
+	FUNCID(ColumnarOutputFile::readIndex);
+
+	m_filename = fname;
+	m_columns.clear();
+	m_chunks.clear();
+	m_nRows = 0;
+
+	std::unique_ptr<std::ifstream> in( IBK::create_ifstream(fname, std::ios_base::binary) );
+	if (!in || !in->good())
+		throw IBK::Exception(IBK::FormatString("Cannot open file '%1'.").arg(fname), FUNC_ID);
+
+	char magic[8];
+	in->read(magic, 8);
+	if (!*in || std::strncmp(magic, COLUMNAR_FILE_MAGIC, 8) != 0)
+		throw IBK::Exception(IBK::FormatString("File '%1' is not a columnar output file.").arg(fname), FUNC_ID);
+
+	uint32_t startYear, flags, nCols;
+	IBK::read_uint32_binary(*in, startYear);
+	IBK::read_uint32_binary(*in, flags);
+	IBK::read_uint32_binary(*in, nCols);
+	m_startYear = startYear;
+	m_compressed = (flags & 1) != 0;
+	try {
+		m_columns.resize(nCols);
+		for (Column & c : m_columns) {
+			IBK::read_string_binary(*in, c.m_label, COLUMNAR_MAX_STRING_LENGTH);
+			IBK::read_string_binary(*in, c.m_quantity, COLUMNAR_MAX_STRING_LENGTH);
+			IBK::read_string_binary(*in, c.m_unit, COLUMNAR_MAX_STRING_LENGTH);
+		}
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading header of file '%1'.").arg(fname), FUNC_ID);
+	}
+	uint64_t pos = (uint64_t)in->tellg();
+	pos = (pos + 7)/8*8;
+
+	// read chunk headers and skip column data
+	std::vector<uint64_t> sizes(nCols);
+	while (true) {
+		in->seekg((std::streamoff)pos);
+		char chunkMagic[4];
+		in->read(chunkMagic, 4);
+		if (in->eof())
+			break;
+		uint32_t nRows = 0;
+		IBK::read_uint32_binary(*in, nRows);
+		if (nCols != 0)
+			in->read(reinterpret_cast<char*>(sizes.data()), nCols*sizeof(uint64_t));
+		if (!*in || std::strncmp(chunkMagic, COLUMNAR_CHUNK_MAGIC, 4) != 0)
+			throw IBK::Exception(IBK::FormatString("Invalid data chunk #%1 in file '%2'.")
+								 .arg(m_chunks.size()).arg(fname), FUNC_ID);
+		Chunk chunk;
+		chunk.m_nRows = nRows;
+		chunk.m_sizes = sizes;
+		pos += 8 + nCols*sizeof(uint64_t);
+		for (unsigned int j=0; j<nCols; ++j) {
+			chunk.m_offsets.push_back(pos);
+			pos += (sizes[j] + 7)/8*8;
+		}
+		m_chunks.push_back(chunk);
+		m_nRows += nRows;
+	}
+}
+
+
+void ColumnarOutputFile::readColumn(unsigned int colIdx, std::vector<double> & values) const {
+	FUNCID(ColumnarOutputFile::readColumn);
+
+	if (colIdx >= m_columns.size())
+		throw IBK::Exception(IBK::FormatString("Invalid column index %1.").arg(colIdx), FUNC_ID);
+
+	std::unique_ptr<std::ifstream> in( IBK::create_ifstream(m_filename, std::ios_base::binary) );
+	if (!in || !in->good())
+		throw IBK::Exception(IBK::FormatString("Cannot open file '%1'.").arg(m_filename), FUNC_ID);
+
+	values.clear();
+	values.reserve(m_nRows);
+	std::vector<char> data;
+	for (const Chunk & chunk : m_chunks) {
+		in->seekg((std::streamoff)chunk.m_offsets[colIdx]);
+		data.resize(chunk.m_sizes[colIdx]);
+		if (!data.empty())
+			in->read(data.data(), (std::streamsize)data.size());
+		if (!*in)
+			throw IBK::Exception(IBK::FormatString("Error reading column data from file '%1'.").arg(m_filename), FUNC_ID);
+		if (m_compressed) {
+			decompressColumn(data, chunk.m_nRows, values);
+		}
+		else {
+			if (data.size() != chunk.m_nRows*sizeof(double))
+				throw IBK::Exception(IBK::FormatString("Invalid column data size in file '%1'.").arg(m_filename), FUNC_ID);
+			std::size_t start = values.size();
+			values.resize(start + chunk.m_nRows);
+			if (chunk.m_nRows != 0)
+				std::memcpy(&values[start], data.data(), data.size());
+		}
+	}
+}
+
+
+void ColumnarOutputFile::compressColumn(const std::vector<std::vector<double> > & rows, unsigned int colIdx, std::vector<char> & buffer) {
+	uint64_t last = 0;
+	for (const std::vector<double> & row : rows) {
+		uint64_t bits;
+		std::memcpy(&bits, &row[colIdx], sizeof(double));
+		uint64_t x = bits ^ last;
+		last = bits;
+		// count zero bytes at high (leading) and low (trailing) end
+		unsigned int leading = 0;
+		while (leading < 8 && ((x >> (56 - 8*leading)) & 0xff) == 0)
+			++leading;
+		unsigned int trailing = 0;
+		if (leading < 8) {
+			while (((x >> (8*trailing)) & 0xff) == 0)
+				++trailing;
+		}
+		buffer.push_back((char)((leading << 4) | trailing));
+		// store remaining bytes, lowest first
+		for (unsigned int k=trailing; k<8-leading; ++k)
+			buffer.push_back((char)((x >> (8*k)) & 0xff));
+	}
+}
+
+
+void ColumnarOutputFile::decompressColumn(const std::vector<char> & data, unsigned int nRows, std::vector<double> & values) {
+	FUNCID(ColumnarOutputFile::decompressColumn);
+	uint64_t last = 0;
+	std::size_t pos = 0;
+	for (unsigned int i=0; i<nRows; ++i) {
+		if (pos >= data.size())
+			throw IBK::Exception("Compressed column data is truncated.", FUNC_ID);
+		unsigned char ctrl = (unsigned char)data[pos++];
+		unsigned int leading = ctrl >> 4;
+		unsigned int trailing = ctrl & 0x0f;
+		if (leading > 8 || (leading < 8 && leading + trailing > 8) || pos + 8 - leading - (leading < 8 ? trailing : 0) > data.size())
+			throw IBK::Exception("Invalid compressed column data.", FUNC_ID);
+		uint64_t x = 0;
+		if (leading < 8) {
+			for (unsigned int k=trailing; k<8-leading; ++k)
+				x |= (uint64_t)(unsigned char)data[pos++] << (8*k);
+		}
+		uint64_t bits = x ^ last;
+		last = bits;
+		double val;
+		std::memcpy(&val, &bits, sizeof(double));
+		values.push_back(val);
+	}
+}
+
+} // namespace NANDRAD_MODEL
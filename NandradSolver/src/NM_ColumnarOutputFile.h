@@ -0,0 +1,146 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_ColumnarOutputFileH
+#define NM_ColumnarOutputFileH
+
+#include <string>
+#include <vector>
+#include <iosfwd>
+#include <cstdint>
+
+#include <IBK_Path.h>
+
+namespace NANDRAD_MODEL {
+
+/*! Writes and reads output files in binary columnar format (file extension bcf).
+
+	The file consists of a header followed by any number of data chunks. Each chunk holds
+	the rows cached between two flushes of the output file, stored column by column.
+	All integer values are little-endian, all blocks start at 8-byte aligned file offsets.
+
+	\code
+	Header:
+	  char[8]       magic "BCOLNDR1"
+	  uint32        start year of simulation
+	  uint32        flags (bit 0 set: columns are compressed)
+	  uint32        number of columns nCols (including the time column)
+	  per column:   3 strings (label, quantity, unit), each as uint32 length + characters
+	  padding       zero bytes up to the next multiple of 8
+
+	Chunk:
+	  char[4]       magic "CHNK"
+	  uint32        number of rows nRows
+	  uint64[nCols] size of each column block in bytes (without padding)
+	  per column:   column block, followed by zero bytes up to the next multiple of 8
+	\endcode
+
+	An uncompressed column block holds nRows doubles, so that the file can be memory-mapped
+	and column data accessed directly. A compressed column block holds the values XOR'ed with
+	the previous value of the column. Each XOR'ed value is stored as a control byte (high nibble: number
+	of leading zero bytes, low nibble: number of trailing zero bytes) followed by the remaining bytes.
+	Constant or slowly changing values thus need only one or very few bytes per value.
+
+	A reader can collect the file offsets of all column blocks by reading only the chunk headers
+	(see readIndex()) and afterwards read single columns without touching the data of other columns.
+*/
+class ColumnarOutputFile {
+public:
+	/*! Meta data of a column. */
+	struct Column {
+		Column() = default;
+		Column(const std::string & label, const std::string & quantity, const std::string & unit) :
+			m_label(label), m_quantity(quantity), m_unit(unit)
+		{}
+
+		/*! Column header label (same as in tsv files, including unit). */
+		std::string		m_label;
+		/*! Quantity name. */
+		std::string		m_quantity;
+		/*! Unit of the values stored in the column. */
+		std::string		m_unit;
+	};
+
+	// *** Writing ***
+
+	/*! Writes file header.
+		\param out Output stream, opened in binary mode.
+	*/
+	static void writeHeader(std::ostream & out, unsigned int startYear, bool compressed, const std::vector<Column> & columns);
+
+	/*! Writes a data chunk with the given rows.
+		\param out Output stream, opened in binary mode and positioned at the end of the file.
+		\param compressed If true, columns are compressed.
+		\param rows Row data, all rows must have the same size (number of columns).
+		\param buffer Work buffer, re-used between calls to avoid memory allocations.
+	*/
+	static void writeChunk(std::ostream & out, bool compressed, const std::vector<std::vector<double> > & rows,
+						   std::vector<char> & buffer);
+
+	// *** Reading ***
+
+	/*! Reads header and chunk index of the file.
+		Only chunk headers are read, column data is skipped.
+		Throws an IBK::Exception in case of error.
+	*/
+	void readIndex(const IBK::Path & fname);
+
+	/*! Reads all values of a single column (from all chunks).
+		Requires a previous call to readIndex().
+		Throws an IBK::Exception in case of error.
+	*/
+	void readColumn(unsigned int colIdx, std::vector<double> & values) const;
+
+	/*! Start year of simulation. */
+	unsigned int				m_startYear = 0;
+	/*! If true, column data is compressed. */
+	bool						m_compressed = false;
+	/*! Column meta data. */
+	std::vector<Column>			m_columns;
+	/*! Total number of rows in all chunks. */
+	unsigned int				m_nRows = 0;
+
+private:
+	/*! Location of a chunk within the file. */
+	struct Chunk {
+		/*! Number of rows in chunk. */
+		unsigned int			m_nRows;
+		/*! File offset of each column block. */
+		std::vector<uint64_t>	m_offsets;
+		/*! Size of each column block in bytes (without padding). */
+		std::vector<uint64_t>	m_sizes;
+	};
+
+	/*! Encodes column values into buffer (appends data). */
+	static void compressColumn(const std::vector<std::vector<double> > & rows, unsigned int colIdx, std::vector<char> & buffer);
+	/*! Decodes compressed column block and appends nRows values. */
+	static void decompressColumn(const std::vector<char> & data, unsigned int nRows, std::vector<double> & values);
+
+	/*! File read in last call to readIndex(). */
+	IBK::Path					m_filename;
+	/*! Chunk index collected in readIndex(). */
+	std::vector<Chunk>			m_chunks;
+};
+
+} // namespace NANDRAD_MODEL
+
+
+#endif // NM_ColumnarOutputFileH
@@ -61,8 +61,8 @@ void DigitalHysteresisController::stepCompleted(double /*t*/) {
 
 
 std::size_t DigitalHysteresisController::serializationSize() const {
-	// controlValue
-	return sizeof(double);
+	// controlValue, nextControlValue
+	return 2 * sizeof(double);
 }
 
 
@@ -70,6 +70,9 @@ void DigitalHysteresisController::serialize(void *& dataPtr) const {
 	// cache controlValue for hysteresis
 	*(double*)dataPtr = m_controlValue;
 	dataPtr = (char*)dataPtr + sizeof(double);
+	// cache controlValue to be set in next stepCompleted() call
+	*(double*)dataPtr = m_nextControlValue;
+	dataPtr = (char*)dataPtr + sizeof(double);
 }
 
 
@@ -77,6 +80,9 @@ void DigitalHysteresisController::deserialize(void *& dataPtr) {
 	// update cached controlValue
 	m_controlValue = *(double*)dataPtr;
 	dataPtr = (char*)dataPtr + sizeof(double);
+	// update cached nextControlValue
+	m_nextControlValue = *(double*)dataPtr;
+	dataPtr = (char*)dataPtr + sizeof(double);
 }
 
 
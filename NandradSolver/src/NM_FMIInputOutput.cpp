@@ -24,7 +24,12 @@
 #include "NANDRAD_FMIVariableDefinition.h"
 #include "NANDRAD_Project.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
+
 #include <IBK_StringUtils.h>
+#include <IBK_Exception.h>
 
 namespace NANDRAD_MODEL {
 
@@ -33,18 +38,42 @@ void FMIInputOutput::setup(const NANDRAD::Project & prj) {
 	// store pointer to fmi description
 	m_fmiDescription = &prj.m_fmiDescription;
 
-	// process all FMI input variables, create an element in the m_FMIInputValues map for each
+	// determine range of fmi id numbers of all input and output variables
+	unsigned int minValueRef = std::numeric_limits<unsigned int>::max();
+	unsigned int maxValueRef = 0;
+	for (const std::vector<NANDRAD::FMIVariableDefinition> * vars : {&m_fmiDescription->m_inputVariables, &m_fmiDescription->m_outputVariables}) {
+		for (const NANDRAD::FMIVariableDefinition &variable : *vars) {
+			minValueRef = std::min(minValueRef, variable.m_fmiValueRef);
+			maxValueRef = std::max(maxValueRef, variable.m_fmiValueRef);
+		}
+	}
+	m_FMIInputValues.clear();
+	m_inputValueTable.clear();
+	m_outputValueTable.clear();
+	if (minValueRef > maxValueRef)
+		return; // no fmi variables
+	m_valueRefOffset = minValueRef;
+	m_inputValueTable.resize(maxValueRef - minValueRef + 1, nullptr);
+	m_outputValueTable.resize(maxValueRef - minValueRef + 1, nullptr);
+
+	// process all FMI input variables, create an element in m_FMIInputValues for each
 	// *different* value reference and set start value
+	std::map<unsigned int, double> startValues;
 	for(const NANDRAD::FMIVariableDefinition &variable : m_fmiDescription->m_inputVariables) {
-		std::map<unsigned int, double>::const_iterator valIt = m_FMIInputValues.find(variable.m_fmiValueRef);
 		// if already an input var with this value ref exists in the map (more than one
 		// input variable with the same reference id are allowed), skip it
-		if (valIt != m_FMIInputValues.end())
+		if (startValues.find(variable.m_fmiValueRef) != startValues.end())
 			continue;
-
 		// insert into map with its start value given in project file
-		m_FMIInputValues[variable.m_fmiValueRef] = variable.m_fmiStartValue;
+		startValues[variable.m_fmiValueRef] = variable.m_fmiStartValue;
 	}
+	// store input values sorted via fmi id number and create lookup table
+	m_FMIInputValues.reserve(startValues.size());
+	for (const std::pair<const unsigned int, double> & startValue : startValues)
+		m_FMIInputValues.push_back(startValue.second);
+	unsigned int i = 0;
+	for (const std::pair<const unsigned int, double> & startValue : startValues)
+		m_inputValueTable[startValue.first - m_valueRefOffset] = &m_FMIInputValues[i++];
 }
 
 
@@ -99,12 +128,11 @@ const double * FMIInputOutput::resolveResultReference(const NANDRAD_MODEL::Input
 	quantityDesc.m_unit = variable.m_unit;
 	quantityDesc.m_constant = true; // with respect to other models, this is a constant value during integration
 
-	// find suitable value reference (access via FMI reference ids)
-	std::map<unsigned int, double>::const_iterator valIt = m_FMIInputValues.find(variable.m_fmiValueRef);
-	// value reference must! exist
-	IBK_ASSERT(valIt != m_FMIInputValues.end());
+	// find suitable value reference (access via FMI reference ids), value reference must! exist
+	const double * value = m_inputValueTable[variable.m_fmiValueRef - m_valueRefOffset];
+	IBK_ASSERT(value != nullptr);
 
-	return &(valIt->second);
+	return value;
 }
 
 
@@ -142,30 +170,53 @@ void FMIInputOutput::inputReferences(std::vector<InputReference> & inputRefs) co
 
 void FMIInputOutput::setInputValueRefs(const std::vector<QuantityDescription> & /*resultDescriptions*/, const std::vector<const double *> & resultValueRefs) {
 	IBK_ASSERT(resultValueRefs.size() == m_fmiDescription->m_outputVariables.size());
-	// value refs are sorted in same order as output variables -> we store them in map based on fmiValueRef
+	// value refs are sorted in same order as output variables -> we store them in table based on fmiValueRef
 	for (unsigned int i=0; i<resultValueRefs.size(); ++i)
-		m_FMIOutputValueRefs[m_fmiDescription->m_outputVariables[i].m_fmiValueRef] = resultValueRefs[i];
+		m_outputValueTable[m_fmiDescription->m_outputVariables[i].m_fmiValueRef - m_valueRefOffset] = resultValueRefs[i];
 
 }
 
 
 void FMIInputOutput::setFMIInputValue(unsigned int varID, double value) {
-	std::map<unsigned int, double>::iterator inputVarIt = m_FMIInputValues.find(varID);
-	// non-existent variable id is a progammer error (error in FMU export)
-	IBK_ASSERT(inputVarIt != m_FMIInputValues.end());
-	// set value
-	inputVarIt->second = value;
+	*inputValue(varID) = value;
 }
 
 
 void FMIInputOutput::getFMIOutputValue(unsigned int varID, double & value) const {
-	std::map<unsigned int, const double*>::const_iterator outputVarIt = m_FMIOutputValueRefs.find(varID);
-	// non-existent variable id is a progammer error (error in FMU export)
-	IBK_ASSERT(outputVarIt != m_FMIOutputValueRefs.end());
-	// get value
-	value = *outputVarIt->second;
+	value = *outputValue(varID);
 }
 
 
+void FMIInputOutput::setFMIInputValues(const unsigned int * varIDs, std::size_t n, const double * values) {
+	for (std::size_t i=0; i<n; ++i)
+		*inputValue(varIDs[i]) = values[i];
+}
+
+
+void FMIInputOutput::getFMIOutputValues(const unsigned int * varIDs, std::size_t n, double * values) const {
+	for (std::size_t i=0; i<n; ++i)
+		values[i] = *outputValue(varIDs[i]);
+}
+
+
+double * FMIInputOutput::inputValue(unsigned int varID) const {
+	FUNCID(FMIInputOutput::inputValue);
+	// unsigned difference wraps around for id numbers below offset
+	unsigned int idx = varID - m_valueRefOffset;
+	if (idx >= m_inputValueTable.size() || m_inputValueTable[idx] == nullptr)
+		throw IBK::Exception(IBK::FormatString("No input variable with FMI id %1.").arg(varID), FUNC_ID);
+	return m_inputValueTable[idx];
+}
+
+
+const double * FMIInputOutput::outputValue(unsigned int varID) const {
+	FUNCID(FMIInputOutput::outputValue);
+	// unsigned difference wraps around for id numbers below offset
+	unsigned int idx = varID - m_valueRefOffset;
+	if (idx >= m_outputValueTable.size() || m_outputValueTable[idx] == nullptr)
+		throw IBK::Exception(IBK::FormatString("No output variable with FMI id %1.").arg(varID), FUNC_ID);
+	return m_outputValueTable[idx];
+}
+
 
 } // namespace NANDRAD_MODEL
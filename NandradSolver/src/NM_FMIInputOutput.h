@@ -88,6 +88,12 @@ public:
 	/*! Gets output value for a given single id number. */
 	void getFMIOutputValue(unsigned int varID, double &value) const;
 
+	/*! Sets new input values for n id numbers (bulk version of setFMIInputValue()). */
+	void setFMIInputValues(const unsigned int * varIDs, std::size_t n, const double * values);
+
+	/*! Gets output values for n id numbers (bulk version of getFMIOutputValue()). */
+	void getFMIOutputValues(const unsigned int * varIDs, std::size_t n, double * values) const;
+
 	/*! Retrieves reference pointer to a requested input reference.
 
 		This function looks through the list of published FMI input variables and parameters and
@@ -116,13 +122,32 @@ public:
 
 private:
 
-	/*! Stored value references for input quantities (pointers to internal result variables that contain
-		via FMI imported values), sorted via fmi id number. */
-	std::map<unsigned int, double>				m_FMIInputValues;
+	/*! Returns pointer to the input value for an id number, throws an exception for unknown id numbers. */
+	double * inputValue(unsigned int varID) const;
+
+	/*! Returns pointer to the output value for an id number, throws an exception for unknown id numbers. */
+	const double * outputValue(unsigned int varID) const;
+
+	/*! Values of input quantities, one entry for each *different* fmi id number, sorted via fmi id number.
+		Other models store pointers to these values, so the vector must not be resized after setup().
+	*/
+	std::vector<double>							m_FMIInputValues;
+
+	/*! Smallest fmi id number of all input and output quantities, offset for m_inputValueTable and
+		m_outputValueTable.
+	*/
+	unsigned int								m_valueRefOffset = 0;
+
+	/*! Pointers to input values in m_FMIInputValues, indexed via (fmi id number - m_valueRefOffset).
+		Contains nullptr for id numbers that are not used by input quantities.
+	*/
+	std::vector<double*>						m_inputValueTable;
 
 	/*! Stored value references for output quantities (pointers to result variables exported via FMI),
-		sorted via fmi id number. */
-	std::map<unsigned int, const double *>		m_FMIOutputValueRefs;
+		indexed via (fmi id number - m_valueRefOffset). Contains nullptr for id numbers that are not used by
+		output quantities.
+	*/
+	std::vector<const double *>					m_outputValueTable;
 
 	/*! Stored constant reference to FMI description. */
 	const NANDRAD::FMIDescription				*m_fmiDescription = nullptr;
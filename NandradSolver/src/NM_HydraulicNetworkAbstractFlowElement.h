@@ -48,7 +48,12 @@ public:
 	*/
 	virtual double systemFunction(double mdot, double p_inlet, double p_outlet) const = 0;
 
-	/*! Returns partial derivatives of the system functions w.r.t. the three dependent variables. */
+	/*! Returns partial derivatives of the system functions w.r.t. the three dependent variables.
+		Derivatives should be computed analytically. Where this is not possible (e.g. with controllers
+		that depend on the mass flux), a difference quotient of systemFunction() may be used.
+		The results are assembled directly into the Jacobian matrix of the network solver, when
+		analytic Jacobian generation is enabled.
+	*/
 	virtual void partials(double mdot, double p_inlet, double p_outlet,
 						  double & df_dmdot, double & df_dp_inlet, double & df_dp_outlet) const = 0;
 
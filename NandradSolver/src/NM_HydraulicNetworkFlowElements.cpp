@@ -171,15 +171,13 @@ double  HNPipeElement::systemFunction(double mdot, double p_inlet, double p_outl
 void HNPipeElement::partials(double mdot, double p_inlet, double p_outlet,
 							 double & df_dmdot, double & df_dp_inlet, double & df_dp_outlet) const
 {
+	(void)p_inlet; (void)p_outlet;
 	// partial derivatives of the system function to pressures are constants
 	df_dp_inlet = 1;
 	df_dp_outlet = -1;
 
-	// generic DQ approximation of partial derivative
-	const double EPS = 1e-5; // in kg/s
-	double f_eps = systemFunction(mdot+EPS, p_inlet, p_outlet);
-	double f = systemFunction(mdot, p_inlet, p_outlet);
-	df_dmdot = (f_eps - f)/EPS;
+	// f = p_inlet - p_outlet - deltaP(mdot/nParallelPipes)
+	df_dmdot = -pressureLossFrictionDerivative(mdot/m_nParallelPipes)/m_nParallelPipes;
 }
 
 
@@ -187,6 +185,9 @@ double HNPipeElement::pressureLossFriction(const double &mdot) const {
 	// for negative mass flow: Reynolds number is positive, velocity and pressure loss are negative
 	double fluidDensity = m_fluid->m_para[NANDRAD::HydraulicFluid::P_Density].value;
 	double velocity = mdot / (fluidDensity * m_diameter * m_diameter * PI / 4.0);
+	// no flow, no pressure loss (avoids division by zero in laminar friction factor)
+	if (velocity == 0.0)
+		return 0.0;
 	double Re = std::abs(velocity) * m_diameter / m_fluid->m_kinematicViscosity.m_values.value(*m_fluidTemperatureRef);
 	double zeta = m_length / m_diameter * IBK::FrictionFactorSwamee(Re, m_diameter, m_roughness);
 
@@ -198,6 +199,37 @@ double HNPipeElement::pressureLossFriction(const double &mdot) const {
 }
 
 
+double HNPipeElement::pressureLossFrictionDerivative(const double &mdot) const {
+	// deltaP = rho/2 * (L/D * lambda(Re) + zetaControlled) * |v| * v
+	double fluidDensity = m_fluid->m_para[NANDRAD::HydraulicFluid::P_Density].value;
+	double area = m_diameter * m_diameter * PI / 4.0;
+	double velocity = mdot / (fluidDensity * area);
+	double kinVis = m_fluid->m_kinematicViscosity.m_values.value(*m_fluidTemperatureRef);
+	double dv_dmdot = 1.0 / (fluidDensity * area);
+
+	// derivative of friction term lambda(Re) * |v| * v
+	double dFriction_dv;
+	if (velocity == 0.0) {
+		// laminar limit (Hagen-Poiseuille): lambda * |v| * v = 64 * kinVis/D * v
+		dFriction_dv = 64.0 * kinVis / m_diameter;
+	}
+	else {
+		double Re = std::abs(velocity) * m_diameter / kinVis;
+		double lambda = IBK::FrictionFactorSwamee(Re, m_diameter, m_roughness);
+		double dlambda_dRe = IBK::FrictionFactorSwameeDerivative(Re, m_diameter, m_roughness);
+		// dRe/dv = sign(v) * D/kinVis and sign(v) * |v| * v = v^2
+		dFriction_dv = dlambda_dRe * m_diameter / kinVis * velocity * velocity + 2 * lambda * std::abs(velocity);
+	}
+	double dDeltaP_dv = m_length / m_diameter * dFriction_dv;
+
+	// add controlled zeta (independent of mass flow)
+	if (m_controlElement != nullptr)
+		dDeltaP_dv += zetaControlled() * 2 * std::abs(velocity);
+
+	return fluidDensity / 2.0 * dDeltaP_dv * dv_dmdot;
+}
+
+
 double HNPipeElement::zetaControlled() const {
 	// valve is closed by default
 	double heatingControlValue = m_controlElement->m_maximumControllerResultValue;
@@ -517,8 +549,17 @@ void HNPressureLossCoeffElement::partials(double mdot, double p_inlet, double p_
 	// partial derivatives of the system function to pressures are constants
 	df_dp_inlet = 1;
 	df_dp_outlet = -1;
-	// generic DQ approximation of partial derivative
-	const double EPS = 1e-5; // in kg/s
+	if (m_controlElement == nullptr) {
+		// dp = zeta * rho/2 * |v| * v  ->  d(dp)/d(mdot) = zeta * rho * |v| * dv/d(mdot)
+		double area = PI / 4 * m_diameter * m_diameter;
+		double velocity = mdot / (m_fluidDensity * area * m_numberParallelElements);
+		df_dmdot = -m_zeta * std::abs(velocity) / (area * m_numberParallelElements);
+		return;
+	}
+	// controlled zeta value depends on mass flux in controller-specific ways
+	// -> generic DQ approximation of partial derivative
+	// Note: perturbation relative to mass flux, to keep truncation error small also for small mass fluxes
+	const double EPS = std::fabs(mdot)*1e-6 + 1e-9; // in kg/s
 	double f_eps = systemFunction(mdot+EPS, p_inlet, p_outlet);
 	double f = systemFunction(mdot, p_inlet, p_outlet);
 	df_dmdot = (f_eps - f)/EPS;
@@ -694,6 +735,32 @@ double HNAbstractPowerLimitedPumpModel::maximumPressureHead(double mdot) const {
 }
 
 
+double HNAbstractPowerLimitedPumpModel::maximumPressureHeadDerivative(double mdot) const {
+	mdot = mdot / m_numberParallelPumps;
+
+	if (!m_isPowerLimited)
+		return 0;
+
+	double Vdot = mdot/m_density;
+	// d(Vdot)/d(mdot), mind the parallel pumps
+	double dVdot_dmdot = 1.0 / (m_density * m_numberParallelPumps);
+
+	// polynomial for dp_max
+	if (!m_coefficientsDpMax.empty())
+		return (2 * m_coefficientsDpMax[0] * Vdot + m_coefficientsDpMax[1]) * dVdot_dmdot;
+
+	// simple linear model
+	if (m_maxPressureHeadAtZeroFlow == 0. || m_maxElectricalPower == 0. )
+		return 0;
+	else {
+		// maximum pressure head is clipped at zero
+		if (maximumPressureHead(mdot * m_numberParallelPumps) <= 0)
+			return 0;
+		return -m_maxPressureHeadAtZeroFlow * m_maxPressureHeadAtZeroFlow / (4 * m_maxElectricalPower * m_maxEfficiency) * dVdot_dmdot;
+	}
+}
+
+
 double HNAbstractPowerLimitedPumpModel::efficiency(double mdot, double dp) const {
 	mdot = mdot / m_numberParallelPumps;
 
@@ -786,13 +853,22 @@ double HNConstantPressurePump::systemFunction(double mdot, double p_inlet, doubl
 }
 
 
-void HNConstantPressurePump::partials(double /*mdot*/, double /*p_inlet*/, double /*p_outlet*/,
+void HNConstantPressurePump::partials(double mdot, double /*p_inlet*/, double /*p_outlet*/,
 							 double & df_dmdot, double & df_dp_inlet, double & df_dp_outlet) const
 {
 	// partial derivatives of the system function to pressures are constants
 	df_dp_inlet = 1;
 	df_dp_outlet = -1;
-	df_dmdot = 0;
+	// pump turned off: f = p_inlet - p_outlet - mdot_1 * |mdot_1| * 1e10 with mdot_1 = mdot/n
+	if (!m_pumpIsOn) {
+		df_dmdot = -2 * std::abs(mdot / m_numberParallelPumps) * 1e10 / m_numberParallelPumps;
+		return;
+	}
+	// pressure head only depends on mass flux, if clipped by maximum pressure head
+	if (*m_pressureHeadRef > maximumPressureHead(mdot))
+		df_dmdot = maximumPressureHeadDerivative(mdot);
+	else
+		df_dmdot = 0;
 }
 
 
@@ -916,7 +992,8 @@ double HNConstantMassFluxPump::systemFunction(double mdot, double /*p_inlet*/, d
 void HNConstantMassFluxPump::partials(double /*mdot*/, double /*p_inlet*/, double /*p_outlet*/,
 									  double & df_dmdot, double & df_dp_inlet, double & df_dp_outlet) const
 {
-	df_dmdot = 1;
+	// system function is scaled with MASS_FLUX_SCALE
+	df_dmdot = MASS_FLUX_SCALE;
 	df_dp_inlet = 0.0;
 	df_dp_outlet = 0.0;
 }
@@ -1143,7 +1220,8 @@ void HNControlledPump::partials(double mdot, double p_inlet, double p_outlet,
 	df_dp_inlet = 1;
 	df_dp_outlet = -1;
 	// generic DQ approximation of partial derivative
-	const double EPS = 1e-5; // in kg/s
+	// Note: perturbation relative to mass flux, to keep truncation error small also for small mass fluxes
+	const double EPS = std::fabs(mdot)*1e-6 + 1e-9; // in kg/s
 	double f_eps = systemFunction(mdot+EPS, p_inlet, p_outlet);
 	double f = systemFunction(mdot, p_inlet, p_outlet);
 	df_dmdot = (f_eps - f)/EPS;
@@ -1340,13 +1418,26 @@ double HNVariablePressureHeadPump::systemFunction(double mdot, double p_inlet, d
 }
 
 
-void HNVariablePressureHeadPump::partials(double /*mdot*/, double /*p_inlet*/, double /*p_outlet*/,
+void HNVariablePressureHeadPump::partials(double mdot, double /*p_inlet*/, double /*p_outlet*/,
 							 double & df_dmdot, double & df_dp_inlet, double & df_dp_outlet) const
 {
 	// partial derivatives of the system function to pressures are constants
 	df_dp_inlet = 1;
 	df_dp_outlet = -1;
-	df_dmdot = 0;
+
+	// constant pressure head below cut-off mass flux, see pressureHead()
+	double mdot_cut = 0.1 * m_designMassFlux;
+	if (mdot / m_numberParallelPumps < mdot_cut) {
+		df_dmdot = 0;
+		return;
+	}
+	// linear dp-v curve, unless clipped by maximum pressure head
+	double slope = (m_designPressureHead - m_minimumPressureHead) / m_designMassFlux;
+	double pressureHead = m_minimumPressureHead + slope * mdot / m_numberParallelPumps;
+	if (pressureHead > maximumPressureHead(mdot))
+		df_dmdot = maximumPressureHeadDerivative(mdot);
+	else
+		df_dmdot = slope / m_numberParallelPumps;
 }
 
 
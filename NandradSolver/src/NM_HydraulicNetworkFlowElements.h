@@ -85,6 +85,11 @@ private:
 	 */
 	double pressureLossFriction(const double &mdot) const;
 
+	/*! Derivative of pressureLossFriction() with respect to mass flow in [Pa s/kg].
+		\param mdot Mass flow in [kg/s]
+	 */
+	double pressureLossFrictionDerivative(const double &mdot) const;
+
 	/*! Computes the controlled zeta-value if a control-model is implemented.
 		Otherwise returns 0.
 	*/
@@ -280,6 +285,8 @@ protected:
 
 	/*! Calculates actual maximum pressure head [Pa] which linear decreases with mass flux */
 	double maximumPressureHead(double mdot) const;
+	/*! Calculates derivative of maximumPressureHead() with respect to mass flux [Pa s/kg] */
+	double maximumPressureHeadDerivative(double mdot) const;
 	/*! Calculates actual efficiency */
 	double efficiency(double mdot, double dp) const;
 	/*! Calculates the elctrical power demand based on given efficiency. */
@@ -25,6 +25,7 @@
 #include <NANDRAD_HydraulicNetworkComponent.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Thermostat.h>
+#include <NANDRAD_SolverParameter.h>
 
 #include <IBK_messages.h>
 #include <IBK_Exception.h>
@@ -40,13 +41,24 @@ namespace NANDRAD_MODEL {
 const double JACOBIAN_EPS_RELTOL = 1e-6;
 const double JACOBIAN_EPS_ABSTOL = 1e-8; // in Pa and scaled kg/s
 
+// constants that control Jacobian re-use (modified Newton method)
+/*! If residual norm is not reduced by at least this factor in a Newton iteration with a re-used
+	Jacobian, the Jacobian is updated. */
+const double JACOBIAN_REUSE_MAX_CONVERGENCE_RATE = 0.3;
+/*! If reciprocal condition estimate (min/max of diag(U)) falls below this limit after a refactorization
+	with stored pivot ordering, a full factorization is done. Corresponds to eps^(2/3). */
+const double KLU_REFACTOR_RCOND_LIMIT = 3.7e-11;
+/*! Analytic and finite-difference Jacobian elements are considered different, if their relative deviation
+	exceeds this limit (verification mode). */
+const double JACOBIAN_CHECK_RELTOL = 1e-3;
+
 
 // *** HydraulicNetworkModel members ***
 
 HydraulicNetworkModel::HydraulicNetworkModel(const NANDRAD::HydraulicNetwork & nw,
 											 const std::vector<NANDRAD::Thermostat> &thermostats,
 											 unsigned int id, const std::string &displayName,
-											 double solverAbsTol, double solverMassFluxScale) :
+											 const NANDRAD::SolverParameter & solverParameter) :
 	m_id(id), m_displayName(displayName),m_hydraulicNetwork(&nw), m_thermostats(thermostats)
 {
 
@@ -104,7 +116,7 @@ HydraulicNetworkModel::HydraulicNetworkModel(const NANDRAD::HydraulicNetwork & n
 	unsigned int refElemeIdx = std::distance(nw.m_elements.begin(), refFeIt);
 
 	// create implementation instance
-	m_p = new HydraulicNetworkModelImpl(elems, refElemeIdx, solverAbsTol, solverMassFluxScale); // we take ownership
+	m_p = new HydraulicNetworkModelImpl(elems, refElemeIdx, solverParameter); // we take ownership
 }
 
 
@@ -317,6 +329,38 @@ void HydraulicNetworkModel::setup() {
 }
 
 
+void HydraulicNetworkModel::writeMetrics(std::ostream * metricsFile) const {
+	FUNCID(HydraulicNetworkModel::writeMetrics);
+
+	const HydraulicNetworkModelImpl::Statistics & stats = m_p->m_statistics;
+	std::string prefix = IBK::FormatString("Hydraulic network #%1: ").arg(m_id).str();
+	IBK::IBK_Message(IBK::FormatString("%1Newton solves / iterations = %2 / %3\n")
+		.arg(prefix).arg(stats.m_nSolves).arg(stats.m_nIterations),
+		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("%1Jacobian evaluations       = %2\n")
+		.arg(prefix).arg(stats.m_nJacobianEvaluations),
+		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("%1Factorizations / refactorizations = %2 / %3\n")
+		.arg(prefix).arg(stats.m_nFactorizations).arg(stats.m_nRefactorizations),
+		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	if (stats.m_nJacobianChecks > 0) {
+		IBK::IBK_Message(IBK::FormatString("%1Jacobian checks / max. rel. deviation = %2 / %3\n")
+			.arg(prefix).arg(stats.m_nJacobianChecks).arg(stats.m_maxJacobianDeviation),
+			IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	}
+	if (metricsFile != nullptr) {
+		std::string key = IBK::FormatString("HydraulicNetwork[%1].").arg(m_id).str();
+		*metricsFile << key << "NewtonSolves=" << stats.m_nSolves << std::endl;
+		*metricsFile << key << "NewtonIterations=" << stats.m_nIterations << std::endl;
+		*metricsFile << key << "JacobianEvaluations=" << stats.m_nJacobianEvaluations << std::endl;
+		*metricsFile << key << "Factorizations=" << stats.m_nFactorizations << std::endl;
+		*metricsFile << key << "Refactorizations=" << stats.m_nRefactorizations << std::endl;
+		if (stats.m_nJacobianChecks > 0)
+			*metricsFile << key << "MaxJacobianDeviation=" << stats.m_maxJacobianDeviation << std::endl;
+	}
+}
+
+
 void HydraulicNetworkModel::resultDescriptions(std::vector<QuantityDescription> & resDesc) const {
 	// mass flux vector is a result
 	QuantityDescription desc("FluidMassFluxes", "kg/s", "Fluid mass flux trough all flow elements", false);
@@ -707,12 +751,17 @@ void HydraulicNetworkModel::setFollowingElementId(HydraulicNetworkAbstractFlowEl
 // *** HydraulicNetworkModelImpl members ***
 
 HydraulicNetworkModelImpl::HydraulicNetworkModelImpl(const std::vector<Element> &elems, unsigned int referenceElemIdx,
-													 double solverAbsTol, double solverMassFluxScale) {
+													 const NANDRAD::SolverParameter & solverParameter) {
 	FUNCID(HydraulicNetworkModelImpl::HydraulicNetworkModelImpl);
 
 	// solver parameter
-	m_residualTolerance = solverAbsTol;
-	m_massFluxScale = solverMassFluxScale;
+	m_residualTolerance = solverParameter.m_para[NANDRAD::SolverParameter::P_HydraulicNetworkAbsTol].value;
+	m_massFluxScale = solverParameter.m_para[NANDRAD::SolverParameter::P_HydraulicNetworkMassFluxScale].value;
+	m_reuseJacobian = solverParameter.m_flag[NANDRAD::SolverParameter::F_HydraulicNetworkJacobianReuse].isEnabled();
+	if (solverParameter.m_flag[NANDRAD::SolverParameter::F_HydraulicNetworkVerifyJacobian].isEnabled())
+		m_jacobianMethod = JM_AnalyticVerified;
+	else if (solverParameter.m_flag[NANDRAD::SolverParameter::F_HydraulicNetworkAnalyticJacobian].isEnabled())
+		m_jacobianMethod = JM_Analytic;
 
 	// copy elements vector
 	m_network.m_elements = elems;
@@ -971,10 +1020,14 @@ int HydraulicNetworkModelImpl::solve() {
 		m_y[i] = 10;
 #endif
 
+	++m_statistics.m_nSolves;
+
 	// NOTE: 20 iterations is enough, if we take more iterations than that, we just bail out and let
 	//       the outer Newton deal with the sub-optimal solution.
 	const int MAX_ITERATIONS = 30;
 	int iterations = MAX_ITERATIONS;
+	// residual norm of last iteration, used to monitor convergence rate when re-using the Jacobian
+	double resNormLast = 0;
 	// now start the Newton iteration
 	while (--iterations > 0) {
 		// evaluate system function for current guess
@@ -996,17 +1049,29 @@ int HydraulicNetworkModelImpl::solve() {
 			break;
 		}
 
-		// now compose Jacobian with FD quotients
-
-		// perform jacobian update
-		int res = jacobianSetup();
-		// error signaled:
-		// may be result of a diverging Newton iteration
-		// -> regsiter a recoverable error and allow a retry
-		if (res != 0) {
-			IBK_FastMessage(IBK::VL_DETAILED)("Error during Jacobian setup.", IBK::MSG_ERROR, FUNC_ID, IBK::VL_DETAILED);
-			return 1;
+		// when re-using the Jacobian from previous iterations/steps, check the convergence rate
+		// and request a Jacobian update if the residual is not reduced sufficiently
+		if (m_jacobianValid && resNormLast > 0 && resNorm > JACOBIAN_REUSE_MAX_CONVERGENCE_RATE*resNormLast)
+			m_jacobianValid = false;
+		resNormLast = resNorm;
+
+		int res = 0;
+		if (!m_reuseJacobian || !m_jacobianValid) {
+			// now compose Jacobian with FD quotients
+
+			// perform jacobian update
+			res = jacobianSetup();
+			// error signaled:
+			// may be result of a diverging Newton iteration
+			// -> regsiter a recoverable error and allow a retry
+			if (res != 0) {
+				m_jacobianValid = false;
+				IBK_FastMessage(IBK::VL_DETAILED)("Error during Jacobian setup.", IBK::MSG_ERROR, FUNC_ID, IBK::VL_DETAILED);
+				return 1;
+			}
+			m_jacobianValid = true;
 		}
+		++m_statistics.m_nIterations;
 
 
 //		jacobianWrite(rhs);
@@ -1091,8 +1156,7 @@ void HydraulicNetworkModelImpl::serialize(void *& dataPtr) const {
 	std::size_t dataSize = m_yLast.size() * sizeof (double);
 	std::memcpy(dataPtr, m_yLast.data(), dataSize);
 	dataPtr = (char*)dataPtr + dataSize;
-	// note: at the moment jacobian is setup every solution step
-	// thus, there is no need for serialization of jacobian
+	// note: jacobian is not serialized, a re-used jacobian is marked outdated in deserialize() instead
 }
 
 
@@ -1101,6 +1165,8 @@ void HydraulicNetworkModelImpl::deserialize(void *& dataPtr) {
 	std::size_t dataSize = m_yLast.size() * sizeof (double);
 	std::memcpy(m_yLast.data(), dataPtr, dataSize);
 	dataPtr = (char*)dataPtr + dataSize;
+	// the stored jacobian may belong to a completely different state, compute a new one in next solve()
+	m_jacobianValid = false;
 }
 
 
@@ -1255,6 +1321,88 @@ void HydraulicNetworkModelImpl::jacobianInit() {
 
 int HydraulicNetworkModelImpl::jacobianSetup() {
 
+	++m_statistics.m_nJacobianEvaluations;
+
+	// compute jacobian elements
+	switch (m_jacobianMethod) {
+		case JM_FiniteDifferences :
+			jacobianFD();
+		break;
+
+		case JM_Analytic :
+			jacobianAnalytic();
+		break;
+
+		case JM_AnalyticVerified : {
+			jacobianFD();
+			std::vector<double> fdValues;
+			if (m_denseSolver.m_jacobian.n() > 0)
+				fdValues = m_denseSolver.m_jacobian.data();
+			else
+				fdValues.assign(m_sparseSolver.m_jacobian.data(), m_sparseSolver.m_jacobian.data() + m_sparseSolver.m_jacobian.nnz());
+			// restore G(y) and flow element states of unmodified y
+			updateG();
+			jacobianAnalytic();
+			jacobianCompare(fdValues);
+		} break;
+	}
+
+	if (m_denseSolver.m_jacobian.n() > 0) {
+		IBKMK::DenseMatrix &jacobian = m_denseSolver.m_jacobian;
+		IBKMK::DenseMatrix &jacobianFac = m_denseSolver.m_jacobianFactorized;
+		// copy jacobian
+		std::copy(jacobian.data().begin(), jacobian.data().end(),
+				  jacobianFac.data().begin());
+		// factorize matrix
+		int res = jacobianFac.lu(); // Note: might be singular!!!
+		// singular
+		if( res != 0)
+			return 1;
+		++m_statistics.m_nFactorizations;
+	}
+	// we use a sparse jacobian representation
+	else if(m_sparseSolver.m_jacobian.nnz() > 0) {
+		IBKMK::SparseMatrixCSR &jacobian = m_sparseSolver.m_jacobian;
+
+		// in modified Newton mode, refactorize using the pivot ordering of the last factorization
+		if (m_reuseJacobian && m_sparseSolver.m_KLUNumeric != nullptr) {
+			int success = klu_refactor((int*) jacobian.ia(),
+						(int*) jacobian.ja(),
+						 jacobian.data(),
+						 m_sparseSolver.m_KLUSymbolic,
+						 m_sparseSolver.m_KLUNumeric,
+						 &(m_sparseSolver.m_KLUParas));
+			// check quality of pivots, with poor pivots we rather compute a new pivot ordering
+			if (success)
+				success = klu_rcond(m_sparseSolver.m_KLUSymbolic, m_sparseSolver.m_KLUNumeric, &(m_sparseSolver.m_KLUParas));
+			if (success && m_sparseSolver.m_KLUParas.rcond > KLU_REFACTOR_RCOND_LIMIT) {
+				++m_statistics.m_nRefactorizations;
+				return 0;
+			}
+		}
+
+		// calculate lu composition for klu object (creating a new pivit ordering)
+		if (m_sparseSolver.m_KLUNumeric != nullptr) {
+			klu_free_numeric(&(m_sparseSolver.m_KLUNumeric), &(m_sparseSolver.m_KLUParas));
+			delete m_sparseSolver.m_KLUNumeric;
+			m_sparseSolver.m_KLUNumeric = nullptr;
+		}
+		m_sparseSolver.m_KLUNumeric = klu_factor((int*) jacobian.ia(),
+					(int*) jacobian.ja(),
+					 jacobian.data(),
+					 m_sparseSolver.m_KLUSymbolic,
+					 &(m_sparseSolver.m_KLUParas));
+		// error treatment: singular matrix
+		if (m_sparseSolver.m_KLUNumeric == nullptr)
+			return 1;
+		++m_statistics.m_nFactorizations;
+	}
+	return 0;
+}
+
+
+void HydraulicNetworkModelImpl::jacobianFD() {
+
 	unsigned int n = m_nodeCount + m_elementCount;
 	std::vector<double> Gy(n);
 
@@ -1264,7 +1412,6 @@ int HydraulicNetworkModelImpl::jacobianSetup() {
 	if (m_denseSolver.m_jacobian.n() > 0) {
 
 		IBKMK::DenseMatrix &jacobian = m_denseSolver.m_jacobian;
-		IBKMK::DenseMatrix &jacobianFac = m_denseSolver.m_jacobianFactorized;
 		// loop over all variables
 		for (unsigned int j=0; j<n; ++j) {
 			// modify y_j by a small EPS
@@ -1283,14 +1430,6 @@ int HydraulicNetworkModelImpl::jacobianSetup() {
 			// restore y
 			m_y[j] -= eps;
 		}
-		// copy jacobian
-		std::copy(jacobian.data().begin(), jacobian.data().end(),
-				  jacobianFac.data().begin());
-		// factorize matrix
-		int res = jacobianFac.lu(); // Note: might be singular!!!
-		// singular
-		if( res != 0)
-			return 1;
 	}
 	// we use a sparse jacobian representation
 	else if(m_sparseSolver.m_jacobian.nnz() > 0) {
@@ -1302,6 +1441,11 @@ int HydraulicNetworkModelImpl::jacobianSetup() {
 		const unsigned int * iaIdxT = jacobian.iaT();
 		const unsigned int * jaIdxT = jacobian.jaT();
 
+		// perturbations of all columns of the current color
+		// Note: the perturbations must be computed from the unmodified y values, otherwise the
+		//       difference quotients and the restored y values would be wrong
+		std::vector<double> eps(n);
+
 		// process all colors individually and modify y in groups
 		for (unsigned int i=0; i<colors.size(); ++i) {  // i == color index
 
@@ -1309,61 +1453,135 @@ int HydraulicNetworkModelImpl::jacobianSetup() {
 			for (unsigned int jind=0; jind<colors[i].size(); ++jind) {
 				unsigned int j = colors[i][jind];
 				// modify y_j by a small EPS
-				double eps = std::fabs(m_y[j])*JACOBIAN_EPS_RELTOL + JACOBIAN_EPS_ABSTOL;
+				eps[j] = std::fabs(m_y[j])*JACOBIAN_EPS_RELTOL + JACOBIAN_EPS_ABSTOL;
 				// for mass fluxes, if y > eps, rather subtract the eps
-				if (j > m_nodeCount && m_y[j] > eps)
-					eps = -eps;
-				m_y[j] += eps;
+				if (j > m_nodeCount && m_y[j] > eps[j])
+					eps[j] = -eps[j];
+				m_y[j] += eps[j];
 			}
 			// evaluate G(y_mod)
 			updateG();
 			// compute Jacobian elements in groups
 			for (unsigned int jind=0; jind<colors[i].size(); ++jind) {
 				unsigned int j = colors[i][jind];
-				// compute finite-differences column j in row i
-				double eps = std::fabs(m_y[j])*JACOBIAN_EPS_RELTOL + JACOBIAN_EPS_ABSTOL;
-				// for mass fluxes, if y > eps, rather subtract the eps
-				if (j > m_nodeCount && m_y[j] > eps)
-					eps = -eps;
 				// we compute now all Jacobian elements in the column j
 				for (unsigned int k = iaIdxT[j]; k < iaIdxT[j + 1]; ++k) {
 					unsigned int rowIdx = jaIdxT[k];
 					// now approximate dG_i/dy_j = [G_i(y_j+eps) - G_i(y_j)] / eps
-					jacobian(rowIdx,j) = (m_G[rowIdx] - Gy[rowIdx])/eps;
+					jacobian(rowIdx,j) = (m_G[rowIdx] - Gy[rowIdx])/eps[j];
 				} // for k
 
 			} // for jind
 
-			// modify m_yMod[] in all columns marked by color i
+			// restore m_y[] in all columns marked by color i
 			for (unsigned int jind=0; jind<colors[i].size(); ++jind) {
 				unsigned int j = colors[i][jind];
-				// modify y_j by a small EPS
-				double eps = std::fabs(m_y[j])*JACOBIAN_EPS_RELTOL + JACOBIAN_EPS_ABSTOL;
-				// for mass fluxes, if y > eps, rather subtract the eps
-				if (j > m_nodeCount && m_y[j] > eps)
-					eps = -eps;
-				m_y[j] -= eps;
+				m_y[j] -= eps[j];
 			}
 		} // for i
+	}
+}
 
-		// calculate lu composition for klu object (creating a new pivit ordering)
-		if (m_sparseSolver.m_KLUNumeric != nullptr) {
-			klu_free_numeric(&(m_sparseSolver.m_KLUNumeric), &(m_sparseSolver.m_KLUParas));
-			delete m_sparseSolver.m_KLUNumeric;
-			m_sparseSolver.m_KLUNumeric = nullptr;
+
+void HydraulicNetworkModelImpl::jacobianAnalytic() {
+
+	// Note: G(y) and the flow element states must correspond to the current m_y, i.e. updateG() has
+	//       been called for the current m_y. Rows/columns follow the layout in updateG().
+
+	if (m_denseSolver.m_jacobian.n() > 0) {
+		IBKMK::DenseMatrix &jacobian = m_denseSolver.m_jacobian;
+		jacobian.fill(0);
+		// flow element equations
+		for (unsigned int i=0; i<m_elementCount; ++i) {
+			const Element &fe = m_network.m_elements[i];
+			double df_dmdot, df_dp_inlet, df_dp_outlet;
+			m_flowElements[i]->partials(m_fluidMassFluxes[i], m_nodalPressures[fe.m_nodeIndexInlet],
+					m_nodalPressures[fe.m_nodeIndexOutlet], df_dmdot, df_dp_inlet, df_dp_outlet);
+			// y holds scaled mass fluxes: d(mdot)/dy = 1/massFluxScale
+			jacobian(i, i) = df_dmdot/m_massFluxScale;
+			// Note: inlet and outlet node may be the same (short-circuit element), hence we add up
+			jacobian(i, fe.m_nodeIndexInlet + m_elementCount) += df_dp_inlet;
+			jacobian(i, fe.m_nodeIndexOutlet + m_elementCount) += df_dp_outlet;
 		}
-		m_sparseSolver.m_KLUNumeric = klu_factor((int*) jacobian.ia(),
-					(int*) jacobian.ja(),
-					 jacobian.data(),
-					 m_sparseSolver.m_KLUSymbolic,
-					 &(m_sparseSolver.m_KLUParas));
-		// error treatment: singular matrix
-		if (m_sparseSolver.m_KLUNumeric == nullptr)
-			return 1;
+		// nodal equations: G = sum(+-mdot) * massFluxScale = sum(+-y)
+		for (unsigned int i=0; i<m_nodeCount; ++i) {
+			for (unsigned int feIndex : m_network.m_nodes[i].m_elementIndexes) {
+				const Element &fe = m_network.m_elements[feIndex];
+				jacobian(i + m_elementCount, feIndex) = (fe.m_nodeIndexInlet == i) ? -1 : 1;
+			}
+		}
+		// nodal constraint to reference node
+		jacobian(m_pressureRefNodeIdx + m_elementCount, m_pressureRefNodeIdx + m_elementCount) += 1;
+	}
+	else if(m_sparseSolver.m_jacobian.nnz() > 0) {
+		IBKMK::SparseMatrixCSR &jacobian = m_sparseSolver.m_jacobian;
+		std::fill(jacobian.data(), jacobian.data() + jacobian.nnz(), 0);
+		// flow element equations
+		for (unsigned int i=0; i<m_elementCount; ++i) {
+			const Element &fe = m_network.m_elements[i];
+			double df_dmdot, df_dp_inlet, df_dp_outlet;
+			m_flowElements[i]->partials(m_fluidMassFluxes[i], m_nodalPressures[fe.m_nodeIndexInlet],
+					m_nodalPressures[fe.m_nodeIndexOutlet], df_dmdot, df_dp_inlet, df_dp_outlet);
+			jacobian(i, i) = df_dmdot/m_massFluxScale;
+			jacobian(i, fe.m_nodeIndexInlet + m_elementCount) += df_dp_inlet;
+			jacobian(i, fe.m_nodeIndexOutlet + m_elementCount) += df_dp_outlet;
+		}
+		// nodal equations
+		for (unsigned int i=0; i<m_nodeCount; ++i) {
+			for (unsigned int feIndex : m_network.m_nodes[i].m_elementIndexes) {
+				const Element &fe = m_network.m_elements[feIndex];
+				jacobian(i + m_elementCount, feIndex) = (fe.m_nodeIndexInlet == i) ? -1 : 1;
+			}
+		}
+		// nodal constraint to reference node
+		jacobian(m_pressureRefNodeIdx + m_elementCount, m_pressureRefNodeIdx + m_elementCount) += 1;
 	}
-	return 0;
 }
 
+
+void HydraulicNetworkModelImpl::jacobianCompare(const std::vector<double> & fdValues) {
+	FUNCID(HydraulicNetworkModelImpl::jacobianCompare);
+
+	++m_statistics.m_nJacobianChecks;
+
+	// determine largest deviation between analytic and FD jacobian elements
+	double maxDev = 0;
+	unsigned int maxRow = 0, maxCol = 0;
+	double maxAnalytic = 0, maxFD = 0;
+	unsigned int n = m_nodeCount + m_elementCount;
+	for (unsigned int i=0; i<n; ++i) {
+		if (m_denseSolver.m_jacobian.n() > 0) {
+			for (unsigned int j=0; j<n; ++j) {
+				double a = m_denseSolver.m_jacobian(i,j);
+				double fd = fdValues[i + j*n];
+				// scale with magnitude of values, use absolute deviation for (nearly) vanishing elements
+				double dev = std::fabs(a - fd)/std::max(1.0, std::max(std::fabs(a), std::fabs(fd)));
+				if (dev > maxDev) {
+					maxDev = dev; maxRow = i; maxCol = j; maxAnalytic = a; maxFD = fd;
+				}
+			}
+		}
+		else {
+			IBKMK::SparseMatrixCSR &jacobian = m_sparseSolver.m_jacobian;
+			for (unsigned int k=jacobian.ia()[i]; k<jacobian.ia()[i+1]; ++k) {
+				double a = jacobian.data()[k];
+				double fd = fdValues[k];
+				double dev = std::fabs(a - fd)/std::max(1.0, std::max(std::fabs(a), std::fabs(fd)));
+				if (dev > maxDev) {
+					maxDev = dev; maxRow = i; maxCol = jacobian.ja()[k]; maxAnalytic = a; maxFD = fd;
+				}
+			}
+		}
+	}
+	m_statistics.m_maxJacobianDeviation = std::max(m_statistics.m_maxJacobianDeviation, maxDev);
+	if (maxDev > JACOBIAN_CHECK_RELTOL) {
+		IBK_FastMessage(IBK::VL_DETAILED)(IBK::FormatString("Analytic Jacobian element (%1,%2) = %3 deviates from "
+			"finite-difference approximation %4 (relative deviation %5).\n")
+			.arg(maxRow).arg(maxCol).arg(maxAnalytic).arg(maxFD).arg(maxDev), IBK::MSG_WARNING, FUNC_ID, IBK::VL_DETAILED);
+	}
+}
+
+
 void HydraulicNetworkModelImpl::jacobianMultiply(const std::vector<double> &b, std::vector<double> &res) {
 
 	if(m_denseSolver.m_jacobian.n() > 0)
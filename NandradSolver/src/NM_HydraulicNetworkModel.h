@@ -31,6 +31,7 @@ namespace NANDRAD {
 	class HydraulicNetworkComponent;
 	class Thermostat;
 	class HydraulicNetworkElement;
+	class SolverParameter;
 }
 
 #define BIDIRECTIONAL
@@ -57,7 +58,7 @@ public:
 	HydraulicNetworkModel(const NANDRAD::HydraulicNetwork & nw,
 		const std::vector<NANDRAD::Thermostat> &thermostats,
 		unsigned int id, const std::string &displayName,
-		double solverAbsTol, double solverMassFluxScale);
+		const NANDRAD::SolverParameter & solverParameter);
 
 	/*! D'tor, released pimpl object. */
 	~HydraulicNetworkModel() override;
@@ -73,6 +74,11 @@ public:
 	*/
 	void setup();
 
+	/*! Writes statistics of the network Newton solver (iterations, Jacobian evaluations, factorizations).
+		\param metricsFile If not nullptr, computer-readible metrics are written to the file.
+	*/
+	void writeMetrics(std::ostream * metricsFile) const;
+
 	/*! gives read access to the HydraulicNetworkModelImpl */
 	const HydraulicNetworkModelImpl*	hydraulicNetworkModelImpl() const {return m_p;}
 
@@ -63,7 +63,7 @@ struct Network {
 class HydraulicNetworkModelImpl {
 public:
 	HydraulicNetworkModelImpl(const std::vector<Element> &elems, unsigned int referenceElemIdx,
-							  double solverAbsTol, double solverMassFluxScale);
+							  const NANDRAD::SolverParameter & solverParameter);
 	~HydraulicNetworkModelImpl();
 
 	/*! Initialized solver based on current content of m_flowElements.
@@ -121,6 +121,27 @@ public:
 	*/
 	bool												m_newStepStarted = true;
 
+	/*! Counters of the Newton solver, used for solver statistics. */
+	struct Statistics {
+		/*! Number of calls to solve(). */
+		unsigned int	m_nSolves = 0;
+		/*! Number of Newton iterations (linear system solves). */
+		unsigned int	m_nIterations = 0;
+		/*! Number of Jacobian matrix evaluations. */
+		unsigned int	m_nJacobianEvaluations = 0;
+		/*! Number of full LU factorizations (with new pivot ordering). */
+		unsigned int	m_nFactorizations = 0;
+		/*! Number of numeric refactorizations with stored pivot ordering (KLU only). */
+		unsigned int	m_nRefactorizations = 0;
+		/*! Number of Jacobian matrices compared in verification mode. */
+		unsigned int	m_nJacobianChecks = 0;
+		/*! Maximum relative deviation between analytic and finite-difference Jacobian elements found in verification mode. */
+		double			m_maxJacobianDeviation = 0;
+	};
+
+	/*! Solver statistics. */
+	Statistics											m_statistics;
+
 private:
 
 	enum LESSolver {
@@ -128,6 +149,16 @@ private:
 		LESSparse
 	};
 
+	/*! Methods for Jacobian matrix generation. */
+	enum JacobianMethod {
+		/*! Difference quotients with perturbations of colored columns (one system function evaluation per color). */
+		JM_FiniteDifferences,
+		/*! Assembly of analytic partial derivatives provided by flow elements. */
+		JM_Analytic,
+		/*! Analytic Jacobian, compared against finite-difference Jacobian on each evaluation. */
+		JM_AnalyticVerified
+	};
+
 	/*! Structure for dense jacobian */
 	struct DenseSolver {
 		// jacobian
@@ -160,10 +191,25 @@ private:
 	/*! Initialize jacobian and create analytical structures (pattern, KLU reordering,..). */
 	void jacobianInit();
 
-	/*! Updates jacobian data and returns 1, if an error occured, otherwise 0. */
-
+	/*! Updates jacobian data and returns 1, if an error occured, otherwise 0.
+		If Jacobian re-use is enabled, the KLU factorization is updated with klu_refactor() using the stored
+		pivot ordering, and only re-computed from scratch if the refactorization fails or the pivots
+		degrade (reciprocal condition estimate too small).
+	*/
 	int jacobianSetup();
 
+	/*! Computes jacobian elements with finite-difference quotients (requires G(y) in m_G). */
+	void jacobianFD();
+
+	/*! Assembles jacobian elements from partial derivatives of flow elements and node balances. */
+	void jacobianAnalytic();
+
+	/*! Compares current (analytic) jacobian with finite-difference jacobian values, updates statistics and
+		reports deviations.
+		\param fdValues Jacobian values computed with finite differences (data vector of sparse or dense matrix).
+	*/
+	void jacobianCompare(const std::vector<double> & fdValues);
+
 	/*! Multiplies jacobian with b and stores result in res. */
 	void jacobianMultiply(const std::vector<double> &b, std::vector<double> &res);
 
@@ -186,6 +232,15 @@ private:
 	/*! Mass flux scaling factor for y. */
 	double								m_massFluxScale = -999;
 
+	/*! If true, the Jacobian (and its factorization) is kept across Newton iterations and time steps (modified
+		Newton method) and only updated when convergence rate degrades.
+	*/
+	bool								m_reuseJacobian = false;
+	/*! True, if the current Jacobian factorization may be re-used in the next Newton iteration. */
+	bool								m_jacobianValid = false;
+	/*! Method used for Jacobian generation. */
+	JacobianMethod						m_jacobianMethod = JM_FiniteDifferences;
+
 	unsigned int						m_nodeCount;
 	unsigned int						m_elementCount;
 
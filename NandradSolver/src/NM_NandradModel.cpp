@@ -26,11 +26,13 @@
 #endif // _OPENMP
 
 #include <memory>
+#include <algorithm>
 
 #include <IBK_Version.h>
 #include <IBK_messages.h>
 #include <IBK_FormatString.h>
 #include <IBK_FileUtils.h>
+#include <IBK_StopWatch.h>
 
 #include <CCM_Constants.h>
 
@@ -107,9 +109,18 @@ NandradModel::NandradModel() :
 
 
 NandradModel::~NandradModel() {
+	FUNCID(NandradModel::~NandradModel);
 	// final flush of outputs - only needed in case of solver crash or manual abort
-	if (m_outputHandler != nullptr)
-		m_outputHandler->flushCache();
+	if (m_outputHandler != nullptr) {
+		try {
+			m_outputHandler->flushCache();
+		}
+		catch (IBK::Exception & ex) {
+			// must not throw in destructor, just report the error
+			ex.writeMsgStackToError();
+			IBK::IBK_Message("Error writing outputs during final flush.", IBK::MSG_ERROR, FUNC_ID);
+		}
+	}
 
 	// free memory of owned instances
 	delete m_project;
@@ -165,7 +176,11 @@ void NandradModel::init(const NANDRAD::ArgsParser & args) {
 
 	// read input data from file
 	IBK::IBK_Message( IBK::FormatString("Reading project file\n"), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
-	m_project->readXML(args.m_projectFile);
+	// binary project files (e.g. written by the user interface) are read without XML parsing
+	if (IBK::tolower_string(args.m_projectFile.extension()) == "nandradb")
+		m_project->readBinary(args.m_projectFile);
+	else
+		m_project->readXML(args.m_projectFile);
 
 	// *** Print Out Placeholders ***
 	IBK::IBK_Message( IBK::FormatString("Path Placeholders\n"), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
@@ -229,6 +244,10 @@ void NandradModel::init(const NANDRAD::ArgsParser & args) {
 	initSolverVariables();
 	// *** Initialize sparse solver matrix ***
 	initSolverMatrix();
+	// *** Initialize incremental model evaluation ***
+	initIncrementalEvaluation();
+	// *** Group time-dependent models for evaluation ***
+	initTimeDependentModelGroups();
 	// *** Init statistics/feedback output ***
 	initStatistics(this, args.m_restart);
 }
@@ -279,6 +298,8 @@ SOLFRA::ModelInterface::CalculationResult NandradModel::setTime(double t) {
 	m_t = t;
 	// only update time-dependent variables when a new time-point is set
 	m_tChanged = true;
+	// time-dependent inputs may have changed in all models
+	m_fullUpdateRequired = true;
 
 	// all successful
 	return SOLFRA::ModelInterface::CalculationSuccess;
@@ -286,11 +307,51 @@ SOLFRA::ModelInterface::CalculationResult NandradModel::setTime(double t) {
 
 
 SOLFRA::ModelInterface::CalculationResult NandradModel::setY(const double * y) {
-	// copy memory
-	std::memcpy(&m_y[0], y, m_n*sizeof(double));
+	if (m_useIncrementalEvaluation) {
+		// copy memory slice-wise and remember which slices have changed
+		for (unsigned int i=0; i<m_ySliceChanged.size(); ++i) {
+			unsigned int offset = m_ySliceOffsets[i];
+			std::size_t bytes = (m_ySliceOffsets[i+1] - offset)*sizeof(double);
+			if (std::memcmp(&m_y[offset], y + offset, bytes) != 0) {
+				std::memcpy(&m_y[offset], y + offset, bytes);
+				m_ySliceChanged[i] = 1;
+			}
+		}
+	}
+	else {
+		// copy memory
+		std::memcpy(&m_y[0], y, m_n*sizeof(double));
+	}
+
+	// mark model as outdated
+	m_yChanged = true;
+
+	// fluxes and divergences are computed in ydot()
+	return SOLFRA::ModelInterface::CalculationSuccess;
+}
+
+
+SOLFRA::ModelInterface::CalculationResult NandradModel::setYPartial(const double * y, const unsigned int * changedIdx,
+																	unsigned int nChanged)
+{
+	if (!m_useIncrementalEvaluation)
+		return setY(y);
+
+	// copy changed values only and mark the y-vector slices they belong to
+	for (unsigned int i=0; i<nChanged; ++i) {
+		unsigned int idx = changedIdx[i];
+		if (m_y[idx] == y[idx])
+			continue;
+		m_y[idx] = y[idx];
+		unsigned int sliceIdx = (unsigned int)(std::upper_bound(m_ySliceOffsets.begin(), m_ySliceOffsets.end(), idx)
+											   - m_ySliceOffsets.begin()) - 1;
+		m_ySliceChanged[sliceIdx] = 1;
+	}
 
 	// mark model as outdated
 	m_yChanged = true;
+	m_partialYUpdate = true;
+	++m_nPartialStateUpdates;
 
 	// fluxes and divergences are computed in ydot()
 	return SOLFRA::ModelInterface::CalculationSuccess;
@@ -404,6 +465,8 @@ void NandradModel::stepCompleted(double t, const double * /*y*/ ) {
 	{
 		(*it)->stepCompleted(t);
 	}
+	// models may have changed their internal state (e.g. controllers)
+	m_fullUpdateRequired = true;
 }
 
 
@@ -638,6 +701,8 @@ void NandradModel::deserialize(void* & dataPtr) {
 	// restore all model states
 	for(AbstractModel *model : m_modelContainer)
 		model->deserialize(dataPtr);
+	// restored model states do not match cached model results anymore
+	m_fullUpdateRequired = true;
 }
 
 
@@ -645,6 +710,57 @@ void NandradModel::writeMetrics(double simtime, std::ostream * metricsFile) {
 	(void)simtime;
 	(void)metricsFile;
 
+	if (m_useIncrementalEvaluation) {
+		FUNCID(NandradModel::writeMetrics);
+		unsigned int nUnits = (unsigned int)m_evaluationUnits.size();
+		double meanUnitUpdates = m_nIncrementalStateUpdates == 0 ? 0 : (double)m_nIncrementalUnitUpdates/m_nIncrementalStateUpdates;
+		IBK::IBK_Message(IBK::FormatString("Nandrad model: Full state updates         = %1\n")
+			.arg(m_nFullStateUpdates, 8),
+			IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+		IBK::IBK_Message(IBK::FormatString("Nandrad model: Incremental state updates  = %1 (on average %2 of %3 models evaluated)\n")
+			.arg(m_nIncrementalStateUpdates, 8)
+			.arg(meanUnitUpdates, 0, 'f', 1)
+			.arg(nUnits),
+			IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+		if (metricsFile != nullptr) {
+			*metricsFile << "FullStateUpdates=" << m_nFullStateUpdates << std::endl;
+			*metricsFile << "IncrementalStateUpdates=" << m_nIncrementalStateUpdates << std::endl;
+			*metricsFile << "IncrementalUnitUpdates=" << m_nIncrementalUnitUpdates << std::endl;
+		}
+
+		// Jacobian generation statistics: the first color uses a full setY() call, all other colors are partial updates
+		const SOLFRA::JacobianSparseCSR * jacSparse = dynamic_cast<const SOLFRA::JacobianSparseCSR *>(m_jacobian);
+		if (jacSparse != nullptr && jacSparse->nColors() != 0) {
+			unsigned int nColors = jacSparse->nColors();
+			unsigned int nJacobians = jacSparse->nRHSEvals()/nColors;
+			double meanPartialUnitUpdates = m_nPartialStateUpdates == 0 ? 0 : (double)m_nPartialUnitUpdates/m_nPartialStateUpdates;
+			IBK::IBK_Message(IBK::FormatString("Nandrad model: Jacobian colors            = %1\n")
+				.arg(nColors, 8),
+				IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+			IBK::IBK_Message(IBK::FormatString("Nandrad model: Partial Jacobian updates   = %1 (%2 per Jacobian, on average %3 of %4 models evaluated)\n")
+				.arg(m_nPartialStateUpdates, 8)
+				.arg(nJacobians == 0 ? 0 : m_nPartialStateUpdates/nJacobians)
+				.arg(meanPartialUnitUpdates, 0, 'f', 1)
+				.arg(nUnits),
+				IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+			if (metricsFile != nullptr) {
+				*metricsFile << "JacobianColors=" << nColors << std::endl;
+				*metricsFile << "PartialStateUpdates=" << m_nPartialStateUpdates << std::endl;
+				*metricsFile << "PartialUnitUpdates=" << m_nPartialUnitUpdates << std::endl;
+			}
+		}
+	}
+
+	// hydraulic network solver statistics
+	for (AbstractModel * model : m_modelContainer) {
+		const HydraulicNetworkModel * nwmodel = dynamic_cast<const HydraulicNetworkModel *>(model);
+		if (nwmodel != nullptr)
+			nwmodel->writeMetrics(metricsFile);
+	}
+
+	if (m_profileTimeDependentModels)
+		writeTimeDependentModelProfile();
+
 #ifdef IBK_STATISTICS
 	FUNCID(NandradModel::writeMetrics);
 	std::string ustr = IBK::Time::suitableTimeUnit(simtime);
@@ -854,6 +970,22 @@ void NandradModel::initSolverParameter(const NANDRAD::ArgsParser & args) {
 	if (initialDt.value <= 0)
 		throw IBK::Exception("Invalid parameter for InitialTimeStep in SolverParameter settings.", FUNC_ID);
 
+	solverParameter.m_intPara[NANDRAD::SolverParameter::IP_RestartBackupCount].toUInt(true,
+		"Invalid parameter for RestartBackupCount in SolverParameter settings.");
+
+	const IBK::Parameter & backupInterval = solverParameter.m_para[NANDRAD::SolverParameter::P_RestartBackupInterval];
+	if (backupInterval.value < 0)
+		throw IBK::Exception("Invalid parameter for RestartBackupInterval in SolverParameter settings.", FUNC_ID);
+
+	// *** optional flags ***
+
+	m_useIncrementalEvaluation = solverParameter.m_flag[NANDRAD::SolverParameter::F_IncrementalModelEvaluation].isEnabled();
+	if (m_useIncrementalEvaluation)
+		IBK::IBK_Message("Using incremental evaluation of state-dependent models.\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	m_profileTimeDependentModels = solverParameter.m_flag[NANDRAD::SolverParameter::F_ProfileTimeDependentModels].isEnabled();
+	if (m_profileTimeDependentModels)
+		IBK::IBK_Message("Measuring setTime() duration of time-dependent models.\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
 	// *** Define standard behavior if definitions are missing ***
 
 	if (m_project->m_solverParameter.m_integrator != NANDRAD::SolverParameter::I_ExplicitEuler) {
@@ -1610,8 +1742,7 @@ void NandradModel::initNetworks() {
 			}
 			// create a network model object
 			HydraulicNetworkModel * nwmodel = new HydraulicNetworkModel(nw, m_project->m_models.m_thermostats, nw.m_id, nw.m_displayName,
-																		m_project->m_solverParameter.m_para[NANDRAD::SolverParameter::P_HydraulicNetworkAbsTol].value,
-																		m_project->m_solverParameter.m_para[NANDRAD::SolverParameter::P_HydraulicNetworkMassFluxScale].value);
+																		m_project->m_solverParameter);
 			m_modelContainer.push_back(nwmodel); // transfer ownership
 			// initialize
 			nwmodel->setup();
@@ -1991,6 +2122,15 @@ void NandradModel::initModelDependencies() {
 							//       be modified and this function remains thread-safe. The parents are set after this
 							//       parallel for-loop has completed.
 					}
+					// For incremental evaluation we need to know all models that depend on a result, including
+					// states models (not part of the graph) and results of models with fixed evaluation order
+					// (published as 'constant', so that they are not part of the graph either).
+					if (srcObject != nullptr && m_useIncrementalEvaluation) {
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+						m_modelDependents[srcObject].insert(currentStateDependency);
+					}
 				}
 			} // input value refs loop
 
@@ -3036,6 +3176,213 @@ void NandradModel::initSolverMatrix() {
 }
 
 
+void NandradModel::initIncrementalEvaluation() {
+	FUNCID(NandradModel::initIncrementalEvaluation);
+
+	if (!m_useIncrementalEvaluation)
+		return;
+
+	IBK::IBK_Message("Initializing incremental model evaluation\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK_MSG_INDENT;
+
+	// *** flatten ordered evaluation units ***
+
+	// Each entry in m_orderedStateDependentSubModels is either a single model (head/tail models) or a
+	// StateModelGroup. We number all these evaluation units in order of evaluation and remember for
+	// each individual model the unit that evaluates it.
+	std::map<const AbstractStateDependency*, unsigned int> unitIndexOfModel;
+	m_evaluationUnits.clear();
+	m_evaluationLevelOffsets.clear();
+	for (const ParallelStateObjects & objs : m_orderedStateDependentSubModels) {
+		m_evaluationLevelOffsets.push_back((unsigned int)m_evaluationUnits.size());
+		for (AbstractStateDependency * obj : objs) {
+			unsigned int unitIdx = (unsigned int)m_evaluationUnits.size();
+			m_evaluationUnits.push_back(obj);
+			const StateModelGroup * group = dynamic_cast<const StateModelGroup *>(obj);
+			if (group != nullptr) {
+				for (const AbstractStateDependency * model : group->models())
+					unitIndexOfModel[model] = unitIdx;
+			}
+			else {
+				unitIndexOfModel[obj] = unitIdx;
+			}
+		}
+	}
+	m_evaluationLevelOffsets.push_back((unsigned int)m_evaluationUnits.size());
+
+
+	// *** dependencies between evaluation units ***
+
+	std::vector<std::set<unsigned int> > unitDependents(m_evaluationUnits.size());
+	for (const std::pair<const AbstractStateDependency * const, unsigned int> & modelUnit : unitIndexOfModel) {
+		std::set<const AbstractStateDependency *> dependentModels;
+		// all models requesting results of this model
+		const AbstractModel * model = dynamic_cast<const AbstractModel *>(modelUnit.first);
+		std::map<const AbstractModel*, std::set<AbstractStateDependency*> >::const_iterator depIt = m_modelDependents.find(model);
+		if (depIt != m_modelDependents.end())
+			dependentModels.insert(depIt->second.begin(), depIt->second.end());
+		// parents in the dependency graph are models that depend on us as well
+		for (const ZEPPELIN::DependencyObject * parent : modelUnit.first->parents())
+			dependentModels.insert(dynamic_cast<const AbstractStateDependency *>(parent));
+
+		for (const AbstractStateDependency * dependentModel : dependentModels) {
+			std::map<const AbstractStateDependency*, unsigned int>::const_iterator it = unitIndexOfModel.find(dependentModel);
+			// skip models that are not evaluated and dependencies within the same unit
+			if (it == unitIndexOfModel.end() || it->second == modelUnit.second)
+				continue;
+			unitDependents[modelUnit.second].insert(it->second);
+		}
+	}
+	m_evaluationUnitDependents.resize(m_evaluationUnits.size());
+	for (unsigned int i=0; i<m_evaluationUnits.size(); ++i)
+		m_evaluationUnitDependents[i].assign(unitDependents[i].begin(), unitDependents[i].end());
+	m_evaluationUnitChanged.assign(m_evaluationUnits.size(), 0);
+
+
+	// *** y-vector slices ***
+
+	// one slice per states model, slices are ordered like the y-vector: zones, constructions, networks
+	m_ySliceOffsets.clear();
+	m_ySliceDependentUnits.clear();
+	std::vector<std::pair<const AbstractModel *, const AbstractStateDependency *> > statesAndBalanceModels;
+	for (unsigned int i=0; i<m_roomStatesModelContainer.size(); ++i) {
+		m_ySliceOffsets.push_back(m_zoneVariableOffset[i]);
+		statesAndBalanceModels.push_back(std::make_pair(m_roomStatesModelContainer[i], m_roomBalanceModelContainer[i]));
+	}
+	for (unsigned int i=0; i<m_constructionStatesModelContainer.size(); ++i) {
+		m_ySliceOffsets.push_back(m_constructionVariableOffset[i]);
+		statesAndBalanceModels.push_back(std::make_pair(m_constructionStatesModelContainer[i], m_constructionBalanceModelContainer[i]));
+	}
+	for (unsigned int i=0; i<m_networkStatesModelContainer.size(); ++i) {
+		m_ySliceOffsets.push_back(m_networkVariableOffset[i]);
+		statesAndBalanceModels.push_back(std::make_pair(m_networkStatesModelContainer[i], m_networkBalanceModelContainer[i]));
+	}
+	m_ySliceOffsets.push_back(m_n);
+
+	for (const std::pair<const AbstractModel *, const AbstractStateDependency *> & models : statesAndBalanceModels) {
+		std::set<unsigned int> dependentUnits;
+		// balance models access their states models directly, without input references
+		std::map<const AbstractStateDependency*, unsigned int>::const_iterator it = unitIndexOfModel.find(models.second);
+		if (it != unitIndexOfModel.end())
+			dependentUnits.insert(it->second);
+		// all models requesting results of the states model
+		std::map<const AbstractModel*, std::set<AbstractStateDependency*> >::const_iterator depIt = m_modelDependents.find(models.first);
+		if (depIt != m_modelDependents.end()) {
+			for (const AbstractStateDependency * model : depIt->second) {
+				it = unitIndexOfModel.find(model);
+				if (it != unitIndexOfModel.end())
+					dependentUnits.insert(it->second);
+			}
+		}
+		m_ySliceDependentUnits.push_back(std::vector<unsigned int>(dependentUnits.begin(), dependentUnits.end()));
+	}
+	m_ySliceChanged.assign(m_ySliceDependentUnits.size(), 0);
+
+	// no longer needed
+	m_modelDependents.clear();
+
+	IBK::IBK_Message(IBK::FormatString("%1 evaluation units in %2 levels, %3 state slices\n")
+					 .arg(m_evaluationUnits.size()).arg(m_evaluationLevelOffsets.size()-1).arg(m_ySliceChanged.size()),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+}
+
+
+void NandradModel::initTimeDependentModelGroups() {
+	FUNCID(NandradModel::initTimeDependentModelGroups);
+
+	m_timeModelGroups.clear();
+	m_timeModelLevelOffsets.clear();
+
+	// level 0: models whose results are accessed by other models within setTime(), for example the
+	//          shading control model retrieves radiation loads from the Loads model
+	std::vector<std::vector<unsigned int> > dependentGroups;
+	for (unsigned int i=0; i<m_timeModelContainer.size(); ++i) {
+		AbstractTimeDependency * timeModel = m_timeModelContainer[i];
+		if (timeModel == m_loads || timeModel == m_schedules || timeModel == m_fmiInputOutput) {
+			m_timeModelGroups.push_back(std::vector<unsigned int>(1, i));
+			continue;
+		}
+		// The thermal network states model is registered directly after its hydraulic network model.
+		// Both share flow element data (e.g. pump controllers access heat exchange spline values)
+		// and must be evaluated in registration order.
+		if (dynamic_cast<ThermalNetworkStatesModel*>(timeModel) != nullptr) {
+			IBK_ASSERT(!dependentGroups.empty() &&
+					   dynamic_cast<HydraulicNetworkModel*>(m_timeModelContainer[dependentGroups.back().back()]) != nullptr);
+			dependentGroups.back().push_back(i);
+			continue;
+		}
+		dependentGroups.push_back(std::vector<unsigned int>(1, i));
+	}
+	m_timeModelLevelOffsets.push_back(0);
+	m_timeModelLevelOffsets.push_back((unsigned int)m_timeModelGroups.size());
+	m_timeModelGroups.insert(m_timeModelGroups.end(), dependentGroups.begin(), dependentGroups.end());
+	m_timeModelLevelOffsets.push_back((unsigned int)m_timeModelGroups.size());
+
+	m_timeModelDurations.assign(m_timeModelContainer.size(), 0);
+
+	IBK::IBK_Message(IBK::FormatString("%1 time-dependent models in %2 evaluation groups\n")
+					 .arg(m_timeModelContainer.size()).arg(m_timeModelGroups.size()),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+}
+
+
+void NandradModel::writeTimeDependentModelProfile() const {
+	FUNCID(NandradModel::writeTimeDependentModelProfile);
+
+	IBK::Path profilePath = m_dirs.m_logDir / "timeModelProfile.tsv";
+	std::unique_ptr<std::ofstream> out( IBK::create_ofstream(profilePath) );
+	if (!out) {
+		IBK::IBK_Message(IBK::FormatString("Cannot write time-dependent model profile to '%1'.\n").arg(profilePath),
+						 IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+		return;
+	}
+
+	// list models with decreasing accumulated setTime() duration
+	std::vector<unsigned int> modelIndexes(m_timeModelContainer.size());
+	for (unsigned int i=0; i<modelIndexes.size(); ++i)
+		modelIndexes[i] = i;
+	std::stable_sort(modelIndexes.begin(), modelIndexes.end(), [this](unsigned int a, unsigned int b) {
+		return m_timeModelDurations[a] > m_timeModelDurations[b];
+	});
+
+	std::vector<unsigned int> modelLevels(m_timeModelContainer.size(), 0);
+	for (unsigned int k=0; k+1<m_timeModelLevelOffsets.size(); ++k)
+		for (unsigned int i=m_timeModelLevelOffsets[k]; i<m_timeModelLevelOffsets[k+1]; ++i)
+			for (unsigned int modelIdx : m_timeModelGroups[i])
+				modelLevels[modelIdx] = k;
+
+	double totalDuration = 0;
+	for (double d : m_timeModelDurations)
+		totalDuration += d;
+
+	*out << "Model\tId\tDisplayName\tLevel\tTotal [ms]\tPer call [us]\tShare [%]\n";
+	for (unsigned int modelIdx : modelIndexes) {
+		const AbstractTimeDependency * timeModel = m_timeModelContainer[modelIdx];
+		const AbstractModel * model = dynamic_cast<const AbstractModel *>(timeModel);
+		// schedules and FMI input/output objects do not provide a model ID name
+		std::string modelName;
+		if (timeModel == m_schedules)
+			modelName = "Schedules";
+		else if (timeModel == m_fmiInputOutput)
+			modelName = "FMIInputOutput";
+		else if (model != nullptr)
+			modelName = model->ModelIDName();
+		double duration = m_timeModelDurations[modelIdx];
+		*out << modelName << '\t'
+			 << (model != nullptr ? model->id() : 0) << '\t'
+			 << (model != nullptr ? model->displayName() : "") << '\t'
+			 << modelLevels[modelIdx] << '\t'
+			 << duration << '\t'
+			 << (m_nTimeModelUpdates == 0 ? 0 : duration*1000/m_nTimeModelUpdates) << '\t'
+			 << (totalDuration == 0 ? 0 : duration/totalDuration*100) << '\n';
+	}
+
+	IBK::IBK_Message(IBK::FormatString("Nandrad model: setTime() profile of %1 time-dependent models written to '%2'\n")
+		.arg(m_timeModelContainer.size()).arg(profilePath.filename()),
+		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+}
+
+
 void NandradModel::initStatistics(SOLFRA::ModelInterface * modelInterface, bool restart) {
 	if (restart) {
 		// m_secondsInLastRun is set in setRestart()
@@ -3088,18 +3435,152 @@ void NandradModel::registerStateDependendModel(AbstractStateDependency *stateMod
 int NandradModel::updateTimeDependentModels() {
 	// *** update time in all directly time dependend models ***
 
+	++m_nTimeModelUpdates;
 	int calculationResultFlag = 0;
-	for (std::vector<AbstractTimeDependency*>::iterator it1 = m_timeModelContainer.begin();
-		it1 != m_timeModelContainer.end(); ++it1)
-	{
+	// levels are processed one after another, since level 1 models may access results of level 0 models in setTime()
+	for (unsigned int k=0; k+1<m_timeModelLevelOffsets.size(); ++k) {
+		unsigned int groupStart = m_timeModelLevelOffsets[k];
+		unsigned int groupEnd = m_timeModelLevelOffsets[k+1];
+
+#ifdef _OPENMP
+		if (!m_useSerialCode && groupEnd - groupStart > 1) {
+			FUNCID(NandradModel::updateTimeDependentModels);
+			// create storage vectors for thread-specific return codes and errors
+			std::vector<int> calculationResultFlags(m_numThreads, 0);
+			std::vector<std::string> threadErrors(m_numThreads);
+	#pragma omp parallel
+			{
+				int threadNum = omp_get_thread_num();
+				// cost of groups differs largely (e.g. schedules vs. output files), hence use dynamic scheduling
+	#pragma omp for schedule(dynamic)
+				for (int i = (int)groupStart; i < (int)groupEnd; ++i) {
+					try {
+						calculationResultFlags[threadNum] |= updateTimeDependentModelGroup((unsigned int)i);
+					}
+					catch (IBK::Exception & ex) {
+						// OpenMP code may not throw exceptions beyond parallel region, hence only store errors in error list for
+						// later evaluation
+						threadErrors[threadNum] += ex.msgStack() + "\n";
+					}
+				} // end for
+
+			} // end parallel region
+
+			for (int i=0; i<m_numThreads; ++i) {
+				if (!threadErrors[i].empty())
+					throw IBK::Exception(threadErrors[i], FUNC_ID);
+				calculationResultFlag |= calculationResultFlags[i];
+			}
+		}
+		else
+#endif // _OPENMP
+		{
+			for (unsigned int i = groupStart; i < groupEnd; ++i)
+				calculationResultFlag |= updateTimeDependentModelGroup(i);
+		}
+	}
+	if (calculationResultFlag != 0) {
+		if (calculationResultFlag & 2)
+			return 2;
+		else
+			return 1;
+	}
+
+	// mark solution as updated
+	m_tChanged = false;
+	// signal success
+	return 0;
+}
+
+
+int NandradModel::updateTimeDependentModelGroup(unsigned int groupIdx) {
+	int calculationResultFlag = 0;
+	for (unsigned int modelIdx : m_timeModelGroups[groupIdx]) {
+		AbstractTimeDependency * timeModel = m_timeModelContainer[modelIdx];
+		if (m_profileTimeDependentModels) {
+			// each model is member of exactly one group, so accumulating durations is thread-safe
+			IBK::StopWatch w;
+			calculationResultFlag |= timeModel->setTime(m_t);
+			m_timeModelDurations[modelIdx] += w.difference();
+			continue;
+		}
 #ifdef IBK_STATISTICS
 		// set time for all objects independently
 		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_SETTIME,
-			calculationResultFlag |= (*it1)->setTime(m_t)
+			calculationResultFlag |= timeModel->setTime(m_t)
 		);
 		++m_nSetTimeCalls;
 #else
-		calculationResultFlag |= (*it1)->setTime(m_t);
+		calculationResultFlag |= timeModel->setTime(m_t);
+#endif
+	}
+	return calculationResultFlag;
+}
+
+
+int NandradModel::updateStateDependentModels() {
+
+	// any error during evaluation leaves the model in an inconsistent state, so we only clear
+	// the full-update flag after a successful evaluation
+	bool fullUpdate = !m_useIncrementalEvaluation || m_fullUpdateRequired;
+	m_fullUpdateRequired = true;
+
+	int calculationResultFlag = 0;
+	if (fullUpdate)
+		calculationResultFlag = updateAllStateDependentModels();
+	else
+		calculationResultFlag = updateChangedStateDependentModels();
+	if (calculationResultFlag != 0)
+		return calculationResultFlag;
+
+
+	// *** update ydot-values and store in (locally numbered) m_ydot vector***
+
+	// update states in all room state models
+	for (unsigned int i=0; i<m_roomBalanceModelContainer.size(); ++i) {
+#ifdef IBK_STATISTICS
+		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
+			calculationResultFlag |= m_roomBalanceModelContainer[i]->update();
+			calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
+		);
+#else
+		calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
+#endif
+	}
+	if (calculationResultFlag != 0) {
+		if (calculationResultFlag & 2)
+			return 2;
+		else
+			return 1;
+	}
+
+	// update states in all construction solver models
+	for (unsigned int i=0; i<m_constructionBalanceModelContainer.size(); ++i) {
+#ifdef IBK_STATISTICS
+		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
+			calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
+		);
+		++m_nYdotCalls;
+#else
+		calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
+#endif
+	}
+	if (calculationResultFlag != 0) {
+		if (calculationResultFlag & 2)
+			return 2;
+		else
+			return 1;
+	}
+
+	// update states in all thermal network models
+	for (unsigned int i=0; i<m_networkBalanceModelContainer.size(); ++i) {
+#ifdef IBK_STATISTICS
+		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
+			calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
+		);
+		++m_nYdotCalls;
+#else
+		calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
 #endif
 	}
 	if (calculationResultFlag != 0) {
@@ -3110,13 +3591,23 @@ int NandradModel::updateTimeDependentModels() {
 	}
 
 	// mark solution as updated
-	m_tChanged = false;
+	m_yChanged = false;
+	m_fullUpdateRequired = false;
+
 	// signal success
 	return 0;
 }
 
 
-int NandradModel::updateStateDependentModels() {
+int NandradModel::updateAllStateDependentModels() {
+
+	if (m_useIncrementalEvaluation) {
+		// all states and models are updated, so clear all change markers
+		std::fill(m_ySliceChanged.begin(), m_ySliceChanged.end(), 0);
+		std::fill(m_evaluationUnitChanged.begin(), m_evaluationUnitChanged.end(), 0);
+		m_partialYUpdate = false;
+		++m_nFullStateUpdates;
+	}
 
 	// *** update global states (head models) ***
 
@@ -3225,69 +3716,102 @@ int NandradModel::updateStateDependentModels() {
 		}
 	} // useSerialCode
 
+	return calculationResultFlag;
+}
 
 
+int NandradModel::updateChangedStateDependentModels() {
 
-	// *** update ydot-values and store in (locally numbered) m_ydot vector***
+	++m_nIncrementalStateUpdates;
+	bool partialYUpdate = m_partialYUpdate;
+	m_partialYUpdate = false;
 
-	// update states in all room state models
-	for (unsigned int i=0; i<m_roomBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_roomBalanceModelContainer[i]->update();
-			calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
-		);
-#else
-		calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
-#endif
-	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
-		else
-			return 1;
-	}
+	// *** update states models of changed y-vector slices ***
 
-	// update states in all construction solver models
-	for (unsigned int i=0; i<m_constructionBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
-		);
-		++m_nYdotCalls;
-#else
-		calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
-#endif
-	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
-		else
-			return 1;
-	}
+	// slices are ordered: zones, constructions, networks
+	const unsigned int nZoneSlices = (unsigned int)m_roomStatesModelContainer.size();
+	const unsigned int nConstructionSlices = (unsigned int)m_constructionStatesModelContainer.size();
+	for (unsigned int i=0; i<m_ySliceChanged.size(); ++i) {
+		if (!m_ySliceChanged[i])
+			continue;
+		m_ySliceChanged[i] = 0;
 
-	// update states in all thermal network models
-	for (unsigned int i=0; i<m_networkBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
-		);
-		++m_nYdotCalls;
-#else
-		calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
-#endif
+		if (i < nZoneSlices) {
+			m_roomStatesModelContainer[i]->update(&m_y[0] + m_zoneVariableOffset[i]);
+		}
+		else if (i < nZoneSlices + nConstructionSlices) {
+			unsigned int j = i - nZoneSlices;
+			m_constructionStatesModelContainer[j]->update(&m_y[0] + m_constructionVariableOffset[j]);
+		}
+		else {
+			unsigned int j = i - nZoneSlices - nConstructionSlices;
+			m_networkStatesModelContainer[j]->update(&m_y[0] + m_networkVariableOffset[j]);
+		}
+
+		// mark all models that use results of the states model
+		for (unsigned int unitIdx : m_ySliceDependentUnits[i])
+			m_evaluationUnitChanged[unitIdx] = 1;
 	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
+
+
+	// *** evaluate changed models level by level ***
+
+	int calculationResultFlag = 0;
+	for (unsigned int k=0; k+1<m_evaluationLevelOffsets.size(); ++k) {
+		// collect changed units of this level
+		m_changedEvaluationUnits.clear();
+		for (unsigned int unitIdx = m_evaluationLevelOffsets[k]; unitIdx < m_evaluationLevelOffsets[k+1]; ++unitIdx) {
+			if (m_evaluationUnitChanged[unitIdx]) {
+				m_evaluationUnitChanged[unitIdx] = 0;
+				m_changedEvaluationUnits.push_back(unitIdx);
+			}
+		}
+		if (m_changedEvaluationUnits.empty())
+			continue;
+
+		m_nIncrementalUnitUpdates += (unsigned int)m_changedEvaluationUnits.size();
+		if (partialYUpdate)
+			m_nPartialUnitUpdates += (unsigned int)m_changedEvaluationUnits.size();
+
+#ifdef _OPENMP
+		if (!m_useSerialCode && m_changedEvaluationUnits.size() > 1) {
+			// create storage vector for thread-specific return codes
+			std::vector<int> calculationResultFlags(m_numThreads, 0);
+	#pragma omp parallel
+			{
+				// store target location for thread-specific error codes
+				int & threadCalculationResultFlag = calculationResultFlags[omp_get_thread_num()];
+	#pragma omp for
+				for (int i = 0; i < (int)m_changedEvaluationUnits.size(); ++i) {
+					threadCalculationResultFlag |= m_evaluationUnits[m_changedEvaluationUnits[i]]->update();
+				} // end for
+
+			} // end parallel region
+			for (int i=0; i<m_numThreads; ++i)
+				calculationResultFlag |= calculationResultFlags[i];
+		}
 		else
-			return 1;
-	}
+#endif // _OPENMP
+		{
+			for (unsigned int unitIdx : m_changedEvaluationUnits) {
+				calculationResultFlag |= m_evaluationUnits[unitIdx]->update();
+				if (calculationResultFlag != 0)
+					break;
+			}
+		}
+		if (calculationResultFlag != 0)
+			return calculationResultFlag;
 
-	// mark solution as updated
-	m_yChanged = false;
+		// propagate changes to all dependent units
+		// Note: dependent units in the same or previous levels (only possible for
+		//       models with fixed evaluation priority) keep their flag and are evaluated in the next call,
+		//       just as they would use results of the previous evaluation in a full update.
+		for (unsigned int unitIdx : m_changedEvaluationUnits) {
+			for (unsigned int dependentIdx : m_evaluationUnitDependents[unitIdx])
+				m_evaluationUnitChanged[dependentIdx] = 1;
+		}
+	}
 
-	// signal success
 	return 0;
 }
 
@@ -105,6 +105,12 @@ public:
 	/*! Returns solver/project directories, initialized in init(). */
 	const Directories & dirs() const { return m_dirs; }
 
+	/*! Returns project data, initialized in init(). */
+	const NANDRAD::Project & project() const { return *m_project; }
+
+	/*! Returns all state-dependent models (nodes of the state dependency graph), initialized in init(). */
+	const std::vector<AbstractStateDependency*> & stateDependencies() const { return m_unorderedStateDependencies; }
+
 
 	// *** MEMBER FUNCTIONS REQUIRED BY SOLVER FRAMEWORK ***
 
@@ -130,6 +136,14 @@ public:
 	/*! Update state of model to new set of unknowns. */
 	virtual CalculationResult setY(const double * y) override;
 
+	/*! Returns true, if incremental evaluation of state-dependent models is enabled. */
+	virtual bool hasPartialEvaluation() const override { return m_useIncrementalEvaluation; }
+
+	/*! Update state of model, whereby only the unknowns with the given indexes have changed.
+		Only the states models of the affected y-vector slices and their dependent models are re-evaluated.
+	*/
+	virtual CalculationResult setYPartial(const double * y, const unsigned int * changedIdx, unsigned int nChanged) override;
+
 	/*! Stores the computed derivatives of the solution results in the vector ydot. */
 	virtual CalculationResult ydot(double * ydot) override;
 
@@ -283,6 +297,18 @@ private:
 	/*! Selects information about the discretisation matrix and provide optimal ordering for band matrices,
 		index vector for sparse matrices.*/
 	void initSolverMatrix();
+	/*! Builds the data structures needed for incremental evaluation of state-dependent models
+		(only if flag IncrementalModelEvaluation is set in the solver parameters).
+		Flattens m_orderedStateDependentSubModels into evaluation units, collects the dependent units for
+		each unit and the units directly affected by each y-vector slice.
+	*/
+	void initIncrementalEvaluation();
+	/*! Groups the models in m_timeModelContainer for parallel evaluation in updateTimeDependentModels().
+		Level 0 holds models whose results are accessed by other models during setTime() (climatic loads,
+		schedules and FMI inputs), level 1 holds all other models. Models within one group are
+		evaluated serially in order of registration.
+	*/
+	void initTimeDependentModelGroups();
 	/*! Initializes model-specific statistics output files.
 		\param restart If true, the statistics file is opened in append mode.
 	*/
@@ -297,10 +323,23 @@ private:
 	/*! Vectors storing sparse matrix pattern (CSR format): number of nonzero elements: */
 	unsigned int nnz() const  { return (unsigned int) m_ja.size(); }
 
-	/*! Updates all time dependent models due to their order in state dependency graph. */
+	/*! Updates all time dependent models, level by level in m_timeModelGroups (groups of one level in parallel). */
 	int updateTimeDependentModels();
+	/*! Calls setTime() for all models of a group in m_timeModelGroups (and measures the time spent, if requested). */
+	int updateTimeDependentModelGroup(unsigned int groupIdx);
+	/*! Writes the setTime() timing table (collected only if flag ProfileTimeDependentModels is set) to
+		the log directory.
+	*/
+	void writeTimeDependentModelProfile() const;
 	/*! Updates all state dependent models due to their order in state dependency graph. */
 	int updateStateDependentModels();
+	/*! Updates all states models and evaluates all models in m_orderedStateDependentSubModels. */
+	int updateAllStateDependentModels();
+	/*! Updates only states models of changed y-vector slices and only evaluates those models that
+		(directly or indirectly) depend on these states.
+		Only used in incremental evaluation mode.
+	*/
+	int updateChangedStateDependentModels();
 
 
 	// *** PRIVATE MEMBER VARIABLES ***
@@ -352,6 +391,12 @@ private:
 		to determine whether a full variable update is needed or not.
 	*/
 	bool													m_tChanged;
+	/*! If true, the next call to updateStateDependentModels() evaluates all models, regardless
+		of changed y-vector slices. Only used in incremental evaluation mode, where the flag
+		is cleared after each successful model evaluation and set again whenever time changes,
+		a step was completed or model state was restored.
+	*/
+	bool													m_fullUpdateRequired = true;
 
 
 	// ***  Solver specification. ***
@@ -403,7 +448,7 @@ private:
 	/*! Container for all time-dependent models created dynamically on the heap (owned).
 		The models are owned by the NandradModelImpl class and released within the clear()
 		function (and thus destructor).
-		The evaluation models is sequential.
+		The models are evaluated in groups, see m_timeModelGroups.
 	*/
 	std::vector<AbstractTimeDependency*>					m_timeModelContainer;
 
@@ -473,6 +518,70 @@ private:
 	std::vector<IBKMK::SparseMatrixPattern>					m_dependencyPatterns;
 
 
+	// *** Evaluation of time-dependent models ***
+
+	/*! Groups of time-dependent models (indexes in m_timeModelContainer), groups of the same level
+		may be evaluated in parallel.
+	*/
+	std::vector<std::vector<unsigned int> >					m_timeModelGroups;
+	/*! Start index of each evaluation level in m_timeModelGroups, size = number of levels + 1. */
+	std::vector<unsigned int>								m_timeModelLevelOffsets;
+	/*! If true, setTime() calls of all time-dependent models are timed (set from solver parameter
+		flag ProfileTimeDependentModels).
+	*/
+	bool													m_profileTimeDependentModels = false;
+	/*! Accumulated wall clock time spent in setTime() of each model in m_timeModelContainer in [ms]. */
+	std::vector<double>										m_timeModelDurations;
+	/*! Number of calls to updateTimeDependentModels(). */
+	unsigned int											m_nTimeModelUpdates = 0;
+
+
+	// *** Incremental evaluation of state-dependent models ***
+
+	/*! If true, only those state-dependent models are updated whose inputs depend on
+		changed y-vector slices (set from solver parameter flag IncrementalModelEvaluation).
+	*/
+	bool													m_useIncrementalEvaluation = false;
+	/*! Holds for each model all state-dependent models that directly request one of its results.
+		Populated in initModelDependencies() (only in incremental evaluation mode) and used
+		in initIncrementalEvaluation().
+	*/
+	std::map<const AbstractModel*, std::set<AbstractStateDependency*> >
+															m_modelDependents;
+	/*! All evaluation units (single models or model groups) of m_orderedStateDependentSubModels in
+		order of evaluation.
+	*/
+	std::vector<AbstractStateDependency*>					m_evaluationUnits;
+	/*! Start index of each parallel evaluation level in m_evaluationUnits, size = number of levels + 1. */
+	std::vector<unsigned int>								m_evaluationLevelOffsets;
+	/*! Indexes of all evaluation units that depend on results of a given evaluation unit, size = m_evaluationUnits.size(). */
+	std::vector<std::vector<unsigned int> >					m_evaluationUnitDependents;
+	/*! Flags for each evaluation unit that are set, when one of the unit's inputs has changed. */
+	std::vector<char>										m_evaluationUnitChanged;
+	/*! Cache for indexes of changed evaluation units within one evaluation level. */
+	std::vector<unsigned int>								m_changedEvaluationUnits;
+	/*! Start index of each y-vector slice (one slice per states model in order zones, constructions, networks),
+		size = number of slices + 1.
+	*/
+	std::vector<unsigned int>								m_ySliceOffsets;
+	/*! Flags for each y-vector slice, set in setY() when values in the slice have changed. */
+	std::vector<char>										m_ySliceChanged;
+	/*! Indexes of all evaluation units that directly depend on the states of a y-vector slice. */
+	std::vector<std::vector<unsigned int> >					m_ySliceDependentUnits;
+	/*! Number of full updates of state-dependent models (incremental evaluation mode only). */
+	unsigned int											m_nFullStateUpdates = 0;
+	/*! Number of incremental updates of state-dependent models. */
+	unsigned int											m_nIncrementalStateUpdates = 0;
+	/*! Number of evaluation units updated during incremental updates. */
+	unsigned int											m_nIncrementalUnitUpdates = 0;
+	/*! Set in setYPartial() and cleared in the next state update: marks updates during Jacobian generation. */
+	bool													m_partialYUpdate = false;
+	/*! Number of partial state updates (calls to setYPartial() during Jacobian generation). */
+	unsigned int											m_nPartialStateUpdates = 0;
+	/*! Number of evaluation units updated during partial state updates. */
+	unsigned int											m_nPartialUnitUpdates = 0;
+
+
 	/*! Holds references to room state models (does not own the models), size m_nZones. */
 	std::vector<RoomStatesModel*>							m_roomStatesModelContainer;
 	/*! Holds references to room balance models (does not own the models), size m_nZones. */
@@ -22,6 +22,7 @@
 #include "NM_OutputFile.h"
 
 #include <fstream>
+#include <iomanip>
 
 #include <IBK_messages.h>
 #include <IBK_Path.h>
@@ -33,6 +34,8 @@
 #include <NANDRAD_ObjectList.h>
 #include <NANDRAD_KeywordList.h>
 
+#include "NM_ColumnarOutputFile.h"
+
 namespace NANDRAD_MODEL {
 
 OutputFile::~OutputFile() {
@@ -414,12 +417,15 @@ void OutputFile::createInputReferences() {
 }
 
 
-void OutputFile::createFile(bool restart, bool binary, const std::string & timeColumnLabel, const IBK::Path * outputPath,
+void OutputFile::createFile(bool restart, FileFormat format, bool compressColumns, const std::string & timeColumnLabel,
+							const IBK::Unit & timeUnit, const IBK::Path * outputPath,
 							const std::map<std::string, std::string> & varSubstitutionMap, unsigned int startYear)
 {
 	FUNCID(OutputFile::createFile);
 
-	m_binary = binary;
+	m_format = format;
+	m_compressColumns = compressColumns;
+	bool binary = (format != FF_ASCII);
 
 	// if we have no outputs in this file, we do nothing
 	if (m_numCols == 0) {
@@ -486,7 +492,21 @@ void OutputFile::createFile(bool restart, bool binary, const std::string & timeC
 	}
 
 	// now we have the header completed, and the first row's values and we write to file
-	if (binary) {
+	if (format == FF_Columnar) {
+		// store header labels together with quantity and unit of each column
+		std::vector<ColumnarOutputFile::Column> columns;
+		columns.push_back(ColumnarOutputFile::Column(headerLabels[0], "Time", timeUnit.name()));
+		for (unsigned int i=0; i<m_numCols; ++i) {
+			std::string quantity = m_outputVarInfo[i].m_quantityDesc.m_name;
+			if (m_outputVarInfo[i].m_timeType == NANDRAD::OutputDefinition::OTT_MEAN)
+				quantity += "-average";
+			else if (m_outputVarInfo[i].m_timeType == NANDRAD::OutputDefinition::OTT_INTEGRAL)
+				quantity += "-integral";
+			columns.push_back(ColumnarOutputFile::Column(headerLabels[i+1], quantity, m_outputVarInfo[i].m_resultUnit.name()));
+		}
+		ColumnarOutputFile::writeHeader(*m_ofstream, startYear, compressColumns, columns);
+	}
+	else if (binary) {
 		// write magic header
 		m_ofstream->write("BTAB", 4);
 		m_ofstream->write("RLZ!", 4);
@@ -607,32 +627,62 @@ void OutputFile::flushCache() {
 	if (m_cache.empty())
 		return;
 
+	swapCache();
+	writeCache();
+}
+
+
+void OutputFile::swapCache() {
+	// no outputs - nothing to do
+	if (m_numCols == 0 || m_ofstream == nullptr)
+		return;
+
+	IBK_ASSERT(m_writeCache.empty());
+	// exchange buffers, m_cache now holds the (empty) previous write cache and keeps its capacity
+	m_writeCache.swap(m_cache);
+}
+
+
+void OutputFile::writeCache() {
+	FUNCID(OutputFile::writeCache);
+
+	// avoid writing for empty cache
+	if (m_writeCache.empty())
+		return;
+
 	// dump all rows of the cache into file
-	for (std::vector<double> & vals : m_cache) {
-		if (m_binary) {
-			IBK::write_vector_binary(*m_ofstream, vals);
-		}
-		else {
-			// dump vector in ascii mode
-			// first values
-			for (unsigned int i=0; i<vals.size(); ++i) {
-				if (i != 0) {
-					*m_ofstream << "\t" << vals[i];
-				}
-				else {
-					// time value is written with increased precision to avoid
-					// accuracy problems in long simulations with short output intervals (> 10 years with 10 min steps)
-					std::streamsize prec = m_ofstream->precision();
-					*m_ofstream << std::setprecision(10) << vals[i] << std::setprecision(prec);
+	if (m_format == FF_Columnar) {
+		ColumnarOutputFile::writeChunk(*m_ofstream, m_compressColumns, m_writeCache, m_writeBuffer);
+	}
+	else {
+		for (std::vector<double> & vals : m_writeCache) {
+			if (m_format == FF_Binary) {
+				IBK::write_vector_binary(*m_ofstream, vals);
+			}
+			else {
+				// dump vector in ascii mode
+				// first values
+				for (unsigned int i=0; i<vals.size(); ++i) {
+					if (i != 0) {
+						*m_ofstream << "\t" << vals[i];
+					}
+					else {
+						// time value is written with increased precision to avoid
+						// accuracy problems in long simulations with short output intervals (> 10 years with 10 min steps)
+						std::streamsize prec = m_ofstream->precision();
+						*m_ofstream << std::setprecision(10) << vals[i] << std::setprecision(prec);
+					}
 				}
+				*m_ofstream << '\n';
 			}
-			*m_ofstream << '\n';
 		}
 	}
 	// flush stream
 	m_ofstream->flush();
 	// and clear cache
-	m_cache.clear();
+	m_writeCache.clear();
+	if (!m_ofstream->good())
+		throw IBK::Exception(IBK::FormatString("Error writing to output file '%1'.").arg(m_filename), FUNC_ID);
 }
 
 
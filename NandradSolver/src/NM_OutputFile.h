@@ -63,10 +63,22 @@ namespace NANDRAD_MODEL {
 	5. before the first call to writeOutputs(), the framework calls createFile(), where we create/reopen the file
 	6. the framework calls writeOutputs(), where we cache output data
 	7. the framework calls flushCache() (after some time) and we dump the collected values to file.
+	   Alternatively, the output handler calls swapCache() in the solver thread and writeCache() in its
+	   background writer thread (double-buffered cache).
 */
 class OutputFile : public AbstractModel, public AbstractStateDependency, public AbstractTimeDependency {
 public:
 
+	/*! Supported output file formats. */
+	enum FileFormat {
+		/*! Tab-separated ASCII file (tsv). */
+		FF_ASCII,
+		/*! Binary file with row-wise data (btf). */
+		FF_Binary,
+		/*! Binary file with column-chunked data (bcf), see ColumnarOutputFile. */
+		FF_Columnar
+	};
+
 	/*! D'tor, released allocated memory. */
 	~OutputFile() override;
 
@@ -132,12 +144,15 @@ private:
 	/*! Creates/re-opens output file.
 
 		\param restart If true, the existing output file should be appended, rather than re-created
-		\param binary If true, files are written in binary mode
+		\param format File format
+		\param compressColumns If true, columns are compressed (only for format FF_Columnar)
 		\param timeColumnLabel Label of the time column
+		\param timeUnit Unit of the time column
 		\param outputPath Path to output directory.
 		\param varSubstitutionMap map containing substitutions for header labels
 	*/
-	void createFile(bool restart, bool binary, const std::string & timeColumnLabel, const IBK::Path * outputPath,
+	void createFile(bool restart, FileFormat format, bool compressColumns, const std::string & timeColumnLabel,
+					const IBK::Unit & timeUnit, const IBK::Path * outputPath,
 					const std::map<std::string, std::string> & varSubstitutionMap, unsigned int startYear);
 
 	/*! Retrieves current output values and appends values to cache.
@@ -158,13 +173,26 @@ private:
 	void clearCache();
 
 	/*! Called from output handler once sufficient real time has elapsed or amount of data cache exceeds
-		defined limit.
+		defined limit. Writes cached data directly to file.
 	*/
 	void flushCache();
 
+	/*! Moves all cached rows into the write cache (which must be empty), so that caching
+		of new outputs can continue while the write cache is written to file.
+	*/
+	void swapCache();
+
+	/*! Writes all rows in the write cache to file and clears the write cache.
+		This function is called from the background writer thread of the output handler and must not
+		touch any data used by the solver thread.
+	*/
+	void writeCache();
+
 
-	/*! Cached flag to know whether to write in binary or ASCII mode. */
-	bool										m_binary;
+	/*! Cached file format. */
+	FileFormat									m_format = FF_ASCII;
+	/*! If true, columns are compressed (only for format FF_Columnar). */
+	bool										m_compressColumns = false;
 
 	/*! The target file name (within output directory). */
 	std::string									m_filename;
@@ -236,6 +264,10 @@ private:
 		Size of inner vector matches m_numCols+1, since time column is also added to cache as first column;
 	*/
 	std::vector< std::vector<double> >			m_cache;
+	/*! Rows moved from m_cache in swapCache(), to be written in writeCache(). */
+	std::vector< std::vector<double> >			m_writeCache;
+	/*! Work buffer for composing data chunks in columnar file format. */
+	std::vector<char>							m_writeBuffer;
 
 
 	/*! Time point (simulation time) in [s] at previous stepCompleted() call (begin of integration interval). */
@@ -98,7 +98,27 @@ const char * const FLUX_QUANTITIES[] = {
 
 namespace NANDRAD_MODEL {
 
+/*! Returns file extension (including dot) for given output file format. */
+static const char * fileExtension(OutputFile::FileFormat format) {
+	switch (format) {
+		case OutputFile::FF_Binary		: return ".btf";
+		case OutputFile::FF_Columnar	: return ".bcf";
+		default							: return ".tsv";
+	}
+}
+
+
 OutputHandler::~OutputHandler() {
+	// terminate writer thread
+	if (m_writerThread != nullptr) {
+		{
+			std::unique_lock<std::mutex> lock(m_writerMutex);
+			m_stopWriter = true;
+		}
+		m_writerCondition.notify_all();
+		m_writerThread->join();
+		delete m_writerThread;
+	}
 	delete m_outputTimer;
 	// Note: Objects m_outputFiles are owned by NandradModel (stored in m_modelContainer).
 }
@@ -110,7 +130,14 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 	// cache parameters needed to create output files
 	m_restart = restart; // store restart info flag
 	m_outputPath = &outputPath;
-	m_binaryFiles = prj.m_outputs.m_binaryFormat.isEnabled();
+	// columnar format takes precedence over binary format
+	if (prj.m_outputs.m_columnarFormat.isEnabled())
+		m_fileFormat = OutputFile::FF_Columnar;
+	else if (prj.m_outputs.m_binaryFormat.isEnabled())
+		m_fileFormat = OutputFile::FF_Binary;
+	else
+		m_fileFormat = OutputFile::FF_ASCII;
+	m_compressColumns = prj.m_outputs.m_compressColumns.isEnabled();
 	m_timeUnit = prj.m_outputs.m_timeUnit;
 	if (m_timeUnit.base_id() != IBK_UNIT_ID_SECONDS) {
 		throw IBK::Exception( IBK::FormatString("Output time unit '%1' is not a valid time unit.").arg(m_timeUnit.name()), FUNC_ID);
@@ -347,11 +374,8 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 
 		// set filename
 		of->m_filename = filegrp.first;
-		// add file extension (tsv or btf see below)
-		if (prj.m_outputs.m_binaryFormat.isEnabled())
-			of->m_filename += ".btf";
-		else
-			of->m_filename += ".tsv";
+		// add file extension (tsv, btf or bcf see below)
+		of->m_filename += fileExtension(m_fileFormat);
 
 		// now set all output definitions
 		of->m_outputDefinitions = filegrp.second;
@@ -377,7 +401,8 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 
 			// now create the file with the file name pattern:
 			// <filetype>_<gridname>.tsv or
-			// <filetype>_<gridname>.btf   (bt = binary table format)
+			// <filetype>_<gridname>.btf   (bt = binary table format) or
+			// <filetype>_<gridname>.bcf   (bc = binary columnar format)
 			//
 			// also: special handling: if only a single output grid is used, i.e. size of the groupMap is 1, skip
 			// the gridname suffix
@@ -394,11 +419,8 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 
 			// set filename
 			of->m_filename = filename;
-			// add file extension (tsv or btf see below)
-			if (m_binaryFiles)
-				of->m_filename += ".btf";
-			else
-				of->m_filename += ".tsv";
+			// add file extension (tsv, btf or bcf see below)
+			of->m_filename += fileExtension(m_fileFormat);
 
 			// now set all output definitions
 			of->m_outputDefinitions = filegrp.second[i];
@@ -453,7 +475,7 @@ void OutputHandler::writeOutputs(double t_out, double t_secondsOfYear, const std
 		for (OutputFile * of : m_outputFiles) {
 			try {
 				/// \todo Add access to simulation start year
-				of->createFile(m_restart, m_binaryFiles, timeColumnHeader, m_outputPath, varSubstitutionMap, 2003);
+				of->createFile(m_restart, m_fileFormat, m_compressColumns, timeColumnHeader, m_timeUnit, m_outputPath, varSubstitutionMap, 2003);
 			} catch (IBK::Exception & ex) {
 				throw IBK::Exception(ex, IBK::FormatString("Error creating output file '%1'.").arg(of->m_filename), FUNC_ID);
 			}
@@ -487,7 +509,7 @@ void OutputHandler::writeOutputs(double t_out, double t_secondsOfYear, const std
 			IBK::IBK_Message("Flushing output cache (cache limit exceeded).\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
 		else
 			IBK::IBK_Message( IBK::FormatString("Flushing output cache (time delay reached, cache size = %1 Mb).\n").arg(storedBytes/1024./1024.), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
-		flushCache();
+		flushCacheAsync();
 		// restart timer
 		m_outputTimer->start();
 	}
@@ -495,9 +517,70 @@ void OutputHandler::writeOutputs(double t_out, double t_secondsOfYear, const std
 
 
 void OutputHandler::flushCache() {
+	waitForWriter();
 	for (OutputFile * of : m_outputFiles)
 		of->flushCache();
 }
 
 
+void OutputHandler::flushCacheAsync() {
+	// wait until previous write operation has completed, so that write caches are empty again
+	waitForWriter();
+	for (OutputFile * of : m_outputFiles)
+		of->swapCache();
+
+	// start writer thread on first use
+	if (m_writerThread == nullptr)
+		m_writerThread = new std::thread(&OutputHandler::writerThreadLoop, this);
+
+	{
+		std::unique_lock<std::mutex> lock(m_writerMutex);
+		m_writeRequested = true;
+	}
+	m_writerCondition.notify_all();
+}
+
+
+void OutputHandler::waitForWriter() {
+	FUNCID(OutputHandler::waitForWriter);
+
+	if (m_writerThread == nullptr)
+		return;
+
+	std::unique_lock<std::mutex> lock(m_writerMutex);
+	m_writerCondition.wait(lock, [this]{ return !m_writeRequested; });
+	if (!m_writerError.empty()) {
+		std::string errmsg;
+		errmsg.swap(m_writerError);
+		throw IBK::Exception(IBK::FormatString("Error writing outputs: %1").arg(errmsg), FUNC_ID);
+	}
+}
+
+
+void OutputHandler::writerThreadLoop() {
+	std::unique_lock<std::mutex> lock(m_writerMutex);
+	while (true) {
+		m_writerCondition.wait(lock, [this]{ return m_writeRequested || m_stopWriter; });
+		if (m_stopWriter)
+			break;
+
+		// main thread waits for us and does not touch the write caches, so we can write without lock
+		lock.unlock();
+		std::string errmsg;
+		try {
+			for (OutputFile * of : m_outputFiles)
+				of->writeCache();
+		}
+		catch (std::exception & ex) {
+			errmsg = ex.what();
+		}
+		lock.lock();
+
+		m_writerError = errmsg;
+		m_writeRequested = false;
+		m_writerCondition.notify_all();
+	}
+}
+
+
 } // namespace NANDRAD_MODEL
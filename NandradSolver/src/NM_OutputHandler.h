@@ -24,11 +24,16 @@
 
 #include <vector>
 #include <map>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 #include <IBK_Unit.h>
 #include <IBK_Path.h>
 
 #include "NM_QuantityDescription.h"
+#include "NM_OutputFile.h"
 
 namespace IBK {
 	class StopWatch;
@@ -40,7 +45,6 @@ namespace NANDRAD {
 
 namespace NANDRAD_MODEL {
 
-class OutputFile;
 class AbstractModel;
 
 /*! Handles all output file initialization and the process of caching and writing
@@ -53,6 +57,12 @@ class AbstractModel;
 	After some real time (or when output cache exceeds a limit), the output handler requests the output files
 	to flush their caches.
 
+	Periodic flushes during the simulation are done asynchronously: the output handler only swaps the
+	caches of all files (see OutputFile::swapCache()) and signals a background writer thread, which then
+	writes the swapped data to the files while the solver continues. The thread is started on first use.
+	Before the next periodic flush and in flushCache(), the handler waits until the writer thread is idle.
+	Errors in the writer thread are re-thrown in the main thread on the next flush.
+
 	Output files are created on first call.
 
 	\note Note that output handler operates with three time points (within writeOutputs()):
@@ -105,9 +115,17 @@ public:
 	*/
 	void writeOutputs(double t_out, double t_secondsOfYear, const std::map<std::string, std::string> & varSubstitutionMap);
 
-	/*! When called, asks all output files to flush their cached data to file. */
+	/*! When called, asks all output files to flush their cached data to file.
+		Waits for a pending background write to complete and then writes all cached data synchronously,
+		so that all outputs are in the files when the function returns.
+	*/
 	void flushCache();
 
+	/*! Swaps caches of all output files and lets the background writer thread write the data.
+		Returns without waiting for the write operation to complete.
+	*/
+	void flushCacheAsync();
+
 
 	/*! Vector with output file objects.
 		Objects are not owned by us, but rather by NandradModel, since the output file objects
@@ -121,8 +139,11 @@ public:
 	*/
 	bool										m_restart;
 
-	/*! Cached flag if using binary files or not. */
-	bool										m_binaryFiles;
+	/*! Cached output file format. */
+	OutputFile::FileFormat						m_fileFormat = OutputFile::FF_ASCII;
+
+	/*! Cached flag if columns in columnar files shall be compressed. */
+	bool										m_compressColumns = false;
 
 	/*! Unit to be used for time points in output files. */
 	IBK::Unit									m_timeUnit;
@@ -140,6 +161,28 @@ public:
 
 	/*! Number of seconds to wait before before flushing the cache. */
 	double										m_realTimeOutputDelay;
+
+private:
+	/*! Waits until the writer thread has completed the current write operation (if any) and throws
+		an IBK::Exception, if the writer thread encountered an error.
+	*/
+	void waitForWriter();
+
+	/*! Main loop of writer thread, writes swapped caches of all files whenever requested. */
+	void writerThreadLoop();
+
+	/*! Background writer thread, created on first call to flushCacheAsync() and owned by us. */
+	std::thread									*m_writerThread = nullptr;
+	/*! Mutex protecting the writer thread control variables below. */
+	std::mutex									m_writerMutex;
+	/*! Condition variable used to signal write requests and completion. */
+	std::condition_variable						m_writerCondition;
+	/*! True while a write request is pending or processed. */
+	bool										m_writeRequested = false;
+	/*! If true, writer thread terminates. */
+	bool										m_stopWriter = false;
+	/*! Error message from writer thread, empty if no error occurred. */
+	std::string									m_writerError;
 };
 
 
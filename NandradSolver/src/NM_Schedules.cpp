@@ -65,14 +65,67 @@ int Schedules::setTime(double t) {
 			t -= IBK::SECONDS_PER_YEAR;
 	}
 
-	// calculate all parameter values
-	double * result = &m_results[0]; // points to first double in vector with calculated spline values
-	for (unsigned int i = 0; i<m_results.size(); ++i) {
-		if (m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::I_LINEAR ||
-			m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::NUM_I)
-			result[i] = m_valueSpline[i].value(t);
-		else
-			result[i] = m_valueSpline[i].nonInterpolatedValue(t);
+	// calculate all parameter values, all splines of a group share the same time points
+	// and thus the same interval and interpolation factor
+	for (SplineGroup & group : m_splineGroups) {
+		const unsigned int m = group.m_resultIndexes.size();
+		const unsigned int n = group.m_x.size();
+		const double * y = &group.m_y[0];
+		double * values = &group.m_values[0];
+
+		if (n == 1) {
+			std::copy(y, y + m, values);
+		}
+		// time point beyond last time point?
+		else if (t > group.m_x.back()) {
+			const double * yLast = y + (n-1)*m;
+			if (group.m_extrapolate) {
+				double dt = t - group.m_x.back();
+				for (unsigned int j=0; j<m; ++j)
+					values[j] = yLast[j] + group.m_slopeBack[j]*dt;
+			}
+			else
+				std::copy(yLast, yLast + m, values);
+		}
+		else {
+			// update cursor to first time point >= t, check current and next interval first
+			unsigned int i = group.m_cursor;
+			if (t > group.m_x[i] || (i > 0 && group.m_x[i-1] >= t)) {
+				if (i+1 < n && t > group.m_x[i] && t <= group.m_x[i+1])
+					++i;
+				else
+					i = (unsigned int)(std::lower_bound(group.m_x.begin(), group.m_x.end(), t) - group.m_x.begin());
+				group.m_cursor = i;
+			}
+
+			// time point before or at first time point
+			if (i == 0) {
+				if (group.m_extrapolate) {
+					double dt = t - group.m_x.front();
+					for (unsigned int j=0; j<m; ++j)
+						values[j] = y[j] + group.m_slopeFront[j]*dt;
+				}
+				else
+					std::copy(y, y + m, values);
+			}
+			else if (group.m_interpolate) {
+				// same computation as in IBK::LinearSpline::value()
+				double alpha = (t - group.m_x[i-1])/(group.m_x[i] - group.m_x[i-1]);
+				const double * y0 = y + (i-1)*m;
+				const double * y1 = y0 + m;
+				for (unsigned int j=0; j<m; ++j)
+					values[j] = y0[j]*(1-alpha) + y1[j]*alpha;
+			}
+			else {
+				// same computation as in IBK::LinearSpline::nonInterpolatedValue(), at the time point of a
+				// step change we take the new value
+				const double * yi = (t == group.m_x[i]) ? y + i*m : y + (i-1)*m;
+				std::copy(yi, yi + m, values);
+			}
+		}
+
+		for (unsigned int j=0; j<m; ++j)
+			m_results[group.m_resultIndexes[j]] = values[j];
 	}
 	return 0;
 }
@@ -229,6 +282,56 @@ void Schedules::setup(NANDRAD::Project &project) {
 			m_results.push_back(0);
 		}
 	}
+
+	setupSplineGroups();
+}
+
+
+void Schedules::setupSplineGroups() {
+	m_splineGroups.clear();
+
+	// schedules generated from daily cycles usually share the same time points, so we
+	// collect the splines in groups with identical time points
+	for (unsigned int i=0; i<m_valueSpline.size(); ++i) {
+		const IBK::LinearSpline & spl = m_valueSpline[i];
+		IBK_ASSERT(spl.valid());
+		bool interpolate = (m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::I_LINEAR ||
+							m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::NUM_I);
+		bool extrapolate = interpolate && spl.m_extrapolationMethod == IBK::LinearSpline::EM_Linear && spl.size() > 1;
+
+		// search for group with same time points
+		unsigned int groupIdx = 0;
+		for (; groupIdx < m_splineGroups.size(); ++groupIdx) {
+			const SplineGroup & group = m_splineGroups[groupIdx];
+			if (group.m_interpolate == interpolate && group.m_extrapolate == extrapolate && group.m_x == spl.x())
+				break;
+		}
+		if (groupIdx == m_splineGroups.size()) {
+			m_splineGroups.push_back(SplineGroup());
+			m_splineGroups.back().m_x = spl.x();
+			m_splineGroups.back().m_interpolate = interpolate;
+			m_splineGroups.back().m_extrapolate = extrapolate;
+		}
+		SplineGroup & group = m_splineGroups[groupIdx];
+		group.m_resultIndexes.push_back(i);
+		if (extrapolate) {
+			group.m_slopeFront.push_back(spl.slopes().front());
+			group.m_slopeBack.push_back(spl.slopes().back());
+		}
+	}
+
+	// now store values of all splines of a group row-wise
+	for (SplineGroup & group : m_splineGroups) {
+		unsigned int m = group.m_resultIndexes.size();
+		group.m_y.resize(group.m_x.size()*m);
+		for (unsigned int j=0; j<m; ++j) {
+			const std::vector<double> & y = m_valueSpline[group.m_resultIndexes[j]].y();
+			for (unsigned int i=0; i<y.size(); ++i)
+				group.m_y[i*m + j] = y[i];
+		}
+		group.m_values.resize(m);
+		group.m_cursor = 0;
+	}
 }
 
 
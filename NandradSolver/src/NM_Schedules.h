@@ -131,6 +131,37 @@ private:
 	/*! Utility function that retrieves an object list object for a given name (from schedule group). */
 	const NANDRAD::ObjectList * objectListByName(const std::string & objectListName) const;
 
+	/*! Groups all splines in m_valueSpline with identical time points and evaluation rules into m_splineGroups. */
+	void setupSplineGroups();
+
+	/*! Splines with identical time points (and same interpolation/extrapolation rules), which are evaluated together.
+		All groups hold a cursor with the interval index of the last evaluation. Since the integrator usually
+		moves forward in time, the interval search reduces to a check of the current or next interval.
+		Only if the time jumps (backwards after a failed step or far ahead), a binary search is needed.
+	*/
+	struct SplineGroup {
+		/*! Time points of all splines in [s]. */
+		std::vector<double>				m_x;
+		/*! Values of all splines at all time points, stored row-wise: m_y[i*m_resultIndexes.size() + j]
+			holds the value of spline j at time point m_x[i].
+		*/
+		std::vector<double>				m_y;
+		/*! Slopes of first interval of each spline (only for linear extrapolation). */
+		std::vector<double>				m_slopeFront;
+		/*! Slopes of last interval of each spline (only for linear extrapolation). */
+		std::vector<double>				m_slopeBack;
+		/*! Indexes of the results in m_results, corresponding to splines in m_y. */
+		std::vector<unsigned int>		m_resultIndexes;
+		/*! If true, values are linearly interpolated, otherwise the value of the interval start is taken. */
+		bool							m_interpolate = true;
+		/*! If true, values outside the time range are linearly extrapolated (only with interpolation). */
+		bool							m_extrapolate = false;
+		/*! Cursor, index of the first time point >= t in last evaluation (same as std::lower_bound()). */
+		unsigned int					m_cursor = 0;
+		/*! Computed values of all splines of the group, copied to m_results afterwards. */
+		std::vector<double>				m_values;
+	};
+
 
 	/*! Year of simulation. */
 	int												m_year = 0;
@@ -162,6 +193,9 @@ private:
 	std::vector<NANDRAD::LinearSplineParameter::interpolationMethod_t>		m_interpolationMethod;
 	/*! Variables, computed/updated during the calculation.	*/
 	std::vector<double>								m_results;
+
+	/*! Splines grouped by identical time points, used for evaluation in setTime(). */
+	std::vector<SplineGroup>						m_splineGroups;
 };
 
 
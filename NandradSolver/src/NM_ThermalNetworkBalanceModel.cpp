@@ -614,13 +614,7 @@ int ThermalNetworkBalanceModel::update() {
 	// accessed as model results by other NANDRAD models.
 
 	// update derivatives
-	unsigned int offset = 0;
-	for(ThermalNetworkAbstractFlowElement *fe : m_statesModel->m_p->m_flowElements) {
-		// skip elements without states
-		if (fe->nInternalStates() != 0)
-			fe->internalDerivatives(&m_ydot[offset]);
-		offset += fe->nInternalStates();
-	}
+	m_statesModel->m_p->internalDerivatives(&m_ydot[0]);
 
 #ifdef NANDRAD_NETWORK_DEBUG_OUTPUTS
 	printVars();
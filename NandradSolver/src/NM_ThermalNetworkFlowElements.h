@@ -136,6 +136,7 @@ private:
 	double							m_outerHeatTransferCoefficient = -999;
 
 	friend class ThermalNetworkBalanceModel;
+	friend class TNSimplePipeGroup;
 };
 
 
@@ -465,6 +466,7 @@ private:
 	double							m_UAValue = -999;
 
 	friend class ThermalNetworkBalanceModel;
+	friend class TNDynamicPipeGroup;
 };
 
 #endif  // DETAILLED_WALL_CAPACITY
@@ -0,0 +1,294 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_ThermalNetworkPipeGroups.h"
+
+#include <cmath>
+
+#include <IBK_assert.h>
+#include <IBK_FluidPhysics.h>
+
+namespace NANDRAD_MODEL {
+
+// *** TNPipeGroup ***
+
+void TNPipeGroup::addPipeParameters(unsigned int elementIdx, unsigned int stateOffset, double length, double innerDiameter,
+									double outerDiameter, double outerHeatTransferCoefficient, double UValuePipeWall,
+									double fluidCrossSection, unsigned int nParallelPipes)
+{
+	m_elementIndexes.push_back(elementIdx);
+	m_stateOffsets.push_back(stateOffset);
+	m_length.push_back(length);
+	m_innerDiameter.push_back(innerDiameter);
+	// Note: we keep the order of operations of the flow elements, adding a zero resistance for missing outer heat
+	//       transfer does not change the result
+	if (outerHeatTransferCoefficient == 0.)
+		m_outerResistance.push_back(0.);
+	else
+		m_outerResistance.push_back(1.0 / (outerHeatTransferCoefficient * outerDiameter * PI));
+	m_wallResistance.push_back(1.0 / UValuePipeWall);
+	m_fluidCrossSection.push_back(fluidCrossSection);
+	m_nParallelPipes.push_back(nParallelPipes);
+
+	unsigned int n = m_elementIndexes.size();
+	m_massFlux.resize(n, 0);
+	m_inflowTemperature.resize(n, 0);
+	m_meanTemperature.resize(n, 0);
+	m_volumeFlow.resize(n, 0);
+	m_velocity.resize(n, 0);
+	m_viscosity.resize(n, 0);
+	m_reynolds.resize(n, 0);
+	m_prandtl.resize(n, 0);
+	m_nusselt.resize(n, 0);
+	m_UAValue.resize(n, 0);
+	m_heatLoss.resize(n, 0);
+}
+
+
+void TNPipeGroup::updateHeatTransfer(const std::vector<double> & lengths) {
+	const unsigned int n = m_elementIndexes.size();
+	// fluid flow, all of these loops can be vectorized
+	for (unsigned int i = 0; i < n; ++i)
+		m_volumeFlow[i] = std::fabs(m_massFlux[i])/m_fluidDensity; // m3/s !!! unit conversion is done when writing outputs
+	// note: velocity is calculated for a single pipe (but mass flux interpreted as flux through all parallel pipes)
+	for (unsigned int i = 0; i < n; ++i)
+		m_velocity[i] = m_volumeFlow[i]/m_fluidCrossSection[i];
+
+	// dimensionless numbers (non-inlined functions)
+	for (unsigned int i = 0; i < n; ++i) {
+		m_viscosity[i] = m_fluidViscosity.value(m_meanTemperature[i]);
+		m_reynolds[i] = IBK::ReynoldsNumber(m_velocity[i], m_viscosity[i], m_innerDiameter[i]);
+		m_prandtl[i] = IBK::PrandtlNumber(m_viscosity[i], m_fluidHeatCapacity, m_fluidConductivity, m_fluidDensity);
+		m_nusselt[i] = IBK::NusseltNumber(m_reynolds[i], m_prandtl[i], m_length[i], m_innerDiameter[i]);
+	}
+
+	// UA-values
+	for (unsigned int i = 0; i < n; ++i) {
+		double innerHeatTransferCoefficient = m_nusselt[i] * m_fluidConductivity / m_innerDiameter[i];
+		// UAValueTotal has W/K, basically the u-value per length pipe (including transfer coefficients) x pipe length.
+		m_UAValue[i] = lengths[i] /
+				(
+					  1.0 / (innerHeatTransferCoefficient * m_innerDiameter[i] * PI)
+					+ m_outerResistance[i]
+					+ m_wallResistance[i]
+				);
+	}
+}
+
+
+
+// *** TNSimplePipeGroup ***
+
+void TNSimplePipeGroup::addPipe(TNSimplePipeElement * pipe, unsigned int elementIdx, unsigned int stateOffset) {
+	if (m_pipes.empty()) {
+		m_fluidDensity = pipe->m_fluidDensity;
+		m_fluidHeatCapacity = pipe->m_fluidHeatCapacity;
+		m_fluidConductivity = pipe->m_fluidConductivity;
+		m_fluidViscosity = pipe->m_fluidViscosity;
+	}
+	m_pipes.push_back(pipe);
+	addPipeParameters(elementIdx, stateOffset, pipe->m_length, pipe->m_innerDiameter, pipe->m_outerDiameter,
+					  pipe->m_outerHeatTransferCoefficient, pipe->m_UValuePipeWall, pipe->m_fluidCrossSection,
+					  pipe->m_nParallelPipes);
+	m_fluidCapacity.push_back(pipe->m_fluidHeatCapacity * pipe->m_fluidVolume * pipe->m_fluidDensity);
+}
+
+
+void TNSimplePipeGroup::setInternalStates(const double * y) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		m_meanTemperature[i] = y[m_stateOffsets[i]] / m_fluidCapacity[i];
+		m_pipes[i]->m_meanTemperature = m_meanTemperature[i];
+	}
+}
+
+
+void TNSimplePipeGroup::setMassFluxes(const double * massFluxes, double * outflowTemperatures) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		const unsigned int elementIdx = m_elementIndexes[i];
+		m_massFlux[i] = massFluxes[elementIdx];
+		m_pipes[i]->m_massFlux = m_massFlux[i];
+		// well-mixed fluid volume
+		outflowTemperatures[elementIdx] = m_meanTemperature[i];
+	}
+}
+
+
+void TNSimplePipeGroup::setInflowTemperatures(const double * inflowTemperatures) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i)
+		m_inflowTemperature[i] = inflowTemperatures[m_elementIndexes[i]];
+
+	updateHeatTransfer(m_length);
+
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		TNSimplePipeElement * pipe = m_pipes[i];
+		IBK_ASSERT(pipe->m_heatExchangeTemperatureRef != nullptr);
+		const double externalTemperature = *pipe->m_heatExchangeTemperatureRef;
+		// calculate heat loss with given parameters
+		// Q in [W] = DeltaT * UAValueTotal
+		m_heatLoss[i] = m_UAValue[i] * (m_meanTemperature[i] - externalTemperature) * m_nParallelPipes[i];
+
+		// transfer results to flow element
+		pipe->m_inflowTemperature = m_inflowTemperature[i];
+		pipe->m_volumeFlow = m_volumeFlow[i];
+		pipe->m_velocity = m_velocity[i];
+		pipe->m_viscosity = m_viscosity[i];
+		pipe->m_reynolds = m_reynolds[i];
+		pipe->m_prandtl = m_prandtl[i];
+		pipe->m_nusselt = m_nusselt[i];
+		pipe->m_UAValue = m_UAValue[i];
+		pipe->m_heatLoss = m_heatLoss[i];
+	}
+}
+
+
+void TNSimplePipeGroup::internalDerivatives(double * ydot) const {
+	// same as ThermalNetworkAbstractFlowElementWithHeatLoss::internalDerivatives()
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		double & yd = ydot[m_stateOffsets[i]];
+		yd = std::fabs(m_massFlux[i]) * m_fluidHeatCapacity * (m_inflowTemperature[i] - m_meanTemperature[i]);
+		yd -= m_heatLoss[i];
+	}
+}
+
+
+
+#ifndef DETAILLED_WALL_CAPACITY
+
+// *** TNDynamicPipeGroup ***
+
+void TNDynamicPipeGroup::addPipe(TNDynamicPipeElement * pipe, unsigned int elementIdx, unsigned int stateOffset) {
+	if (m_pipes.empty()) {
+		m_fluidDensity = pipe->m_fluidDensity;
+		m_fluidHeatCapacity = pipe->m_fluidHeatCapacity;
+		m_fluidConductivity = pipe->m_fluidConductivity;
+		m_fluidViscosity = pipe->m_fluidViscosity;
+	}
+	m_pipes.push_back(pipe);
+	addPipeParameters(elementIdx, stateOffset, pipe->m_length, pipe->m_innerDiameter, pipe->m_outerDiameter,
+					  pipe->m_outerHeatTransferCoefficient, pipe->m_UValuePipeWall, pipe->m_fluidCrossSection,
+					  pipe->m_nParallelPipes);
+	m_nVolumes.push_back(pipe->m_nVolumes);
+	m_discLength.push_back(pipe->m_discLength);
+	m_discCapacity.push_back(pipe->m_discVolume * pipe->m_fluidDensity * pipe->m_fluidHeatCapacity);
+	// vectors are not resized after construction of the pipe element
+	m_temperatures.push_back(pipe->m_temperatures.data());
+	m_heatLosses.push_back(pipe->m_heatLosses.data());
+}
+
+
+void TNDynamicPipeGroup::setInternalStates(const double * y) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		const double * yPipe = y + m_stateOffsets[i];
+		double * temperatures = m_temperatures[i];
+		const double discCapacity = m_discCapacity[i];
+		const unsigned int nVolumes = m_nVolumes[i];
+		double temp = 0.0;
+		for (unsigned int j = 0; j < nVolumes; ++j) {
+			temperatures[j] = yPipe[j] / discCapacity;
+			temp += temperatures[j];
+		}
+		m_meanTemperature[i] = temp/nVolumes;
+		m_pipes[i]->m_meanTemperature = m_meanTemperature[i];
+	}
+}
+
+
+void TNDynamicPipeGroup::setMassFluxes(const double * massFluxes, double * outflowTemperatures) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		const unsigned int elementIdx = m_elementIndexes[i];
+		m_massFlux[i] = massFluxes[elementIdx];
+		m_pipes[i]->m_massFlux = m_massFlux[i];
+		// same as TNDynamicPipeElement::outflowTemperature()
+		if (m_massFlux[i] >= 0)
+			outflowTemperatures[elementIdx] = m_temperatures[i][m_nVolumes[i]-1];
+		else
+			outflowTemperatures[elementIdx] = m_temperatures[i][0];
+	}
+}
+
+
+void TNDynamicPipeGroup::setInflowTemperatures(const double * inflowTemperatures) {
+	for (unsigned int i = 0; i < m_pipes.size(); ++i)
+		m_inflowTemperature[i] = inflowTemperatures[m_elementIndexes[i]];
+
+	// assume constant heat transfer coefficient along pipe, using average temperature
+	updateHeatTransfer(m_discLength);
+
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		TNDynamicPipeElement * pipe = m_pipes[i];
+		IBK_ASSERT(pipe->m_heatExchangeTemperatureRef != nullptr);
+		const double externalTemperature = *pipe->m_heatExchangeTemperatureRef;
+		const double * temperatures = m_temperatures[i];
+		double * heatLosses = m_heatLosses[i];
+		const double UAValue = m_UAValue[i];
+		const double nParallelPipes = m_nParallelPipes[i];
+		const unsigned int nVolumes = m_nVolumes[i];
+		double heatLoss = 0.0;
+		for (unsigned int j = 0; j < nVolumes; ++j) {
+			// calculate heat loss with given parameters
+			heatLosses[j] = UAValue * (temperatures[j] - externalTemperature) * nParallelPipes;
+			// sum up heat losses
+			heatLoss += heatLosses[j];
+		}
+		m_heatLoss[i] = heatLoss;
+
+		// transfer results to flow element
+		pipe->m_inflowTemperature = m_inflowTemperature[i];
+		pipe->m_volumeFlow = m_volumeFlow[i];
+		pipe->m_velocity = m_velocity[i];
+		pipe->m_viscosity = m_viscosity[i];
+		pipe->m_reynolds = m_reynolds[i];
+		pipe->m_prandtl = m_prandtl[i];
+		pipe->m_nusselt = m_nusselt[i];
+		pipe->m_UAValue = m_UAValue[i];
+		pipe->m_heatLoss = m_heatLoss[i];
+	}
+}
+
+
+void TNDynamicPipeGroup::internalDerivatives(double * ydot) const {
+	// same as TNDynamicPipeElement::internalDerivatives()
+	for (unsigned int i = 0; i < m_pipes.size(); ++i) {
+		double * ydotPipe = ydot + m_stateOffsets[i];
+		const double * temperatures = m_temperatures[i];
+		const double * heatLosses = m_heatLosses[i];
+		const double massFlux = m_massFlux[i];
+		const double cp = m_fluidHeatCapacity;
+		const unsigned int nVolumes = m_nVolumes[i];
+		// heat fluxes into the fluid and enthalpy change are heat sources
+		if (massFlux >= 0.0) {
+			// first element copies boundary conditions
+			ydotPipe[0] = -heatLosses[0] + massFlux * cp * (m_inflowTemperature[i] - temperatures[0]);
+			for (unsigned int j = 1; j < nVolumes; ++j)
+				ydotPipe[j] = -heatLosses[j] + massFlux * cp * (temperatures[j - 1] - temperatures[j]);
+		}
+		else {
+			// last element copies boundary conditions
+			ydotPipe[nVolumes - 1] = -heatLosses[nVolumes - 1] + massFlux * cp * (temperatures[nVolumes - 1] - m_inflowTemperature[i]);
+			for (unsigned int j = 0; j < nVolumes - 1; ++j)
+				ydotPipe[j] = -heatLosses[j] + massFlux * cp * (temperatures[j] - temperatures[j + 1]);
+		}
+	}
+}
+
+#endif // DETAILLED_WALL_CAPACITY
+
+} // namespace NANDRAD_MODEL
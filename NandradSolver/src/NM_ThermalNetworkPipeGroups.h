@@ -0,0 +1,199 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_ThermalNetworkPipeGroupsH
+#define NM_ThermalNetworkPipeGroupsH
+
+#include <vector>
+
+#include <IBK_LinearSpline.h>
+
+#include "NM_ThermalNetworkFlowElements.h"
+
+namespace NANDRAD_MODEL {
+
+/*! Common data of all pipe groups: constant pipe parameters and per-pipe quantities, each stored in
+	contiguous arrays (one entry per pipe).
+
+	Pipe groups evaluate all pipe elements of one type in a network with a single loop, instead of calling the
+	virtual functions of each flow element. The flow element objects are still used for setup, dependencies and
+	outputs: all quantities published by the elements are written back to the element objects.
+*/
+class TNPipeGroup {
+public:
+	/*! Returns true, if no pipes were added to the group. */
+	bool empty() const { return m_elementIndexes.empty(); }
+
+	/*! Indexes of all pipes in ThermalNetworkModelImpl::m_flowElements. */
+	std::vector<unsigned int>		m_elementIndexes;
+
+protected:
+	/*! Adds parameters common to all pipe types, called from addPipe() of derived classes.
+		\param elementIdx Index of the flow element in ThermalNetworkModelImpl::m_flowElements.
+		\param stateOffset Offset of the first state of the element in the states vector of the network.
+	*/
+	void addPipeParameters(unsigned int elementIdx, unsigned int stateOffset, double length, double innerDiameter,
+						   double outerDiameter, double outerHeatTransferCoefficient, double UValuePipeWall,
+						   double fluidCrossSection, unsigned int nParallelPipes);
+
+	/*! Computes heat transfer related quantities of all pipes from current mass fluxes and mean temperatures
+		(see TNSimplePipeElement::setInflowTemperature()).
+		\param lengths Pipe lengths to use for UA-values (entire pipe or discretization element) in [m].
+	*/
+	void updateHeatTransfer(const std::vector<double> & lengths);
+
+	/*! Offset of the first state of each pipe in the states vector of the network. */
+	std::vector<unsigned int>		m_stateOffsets;
+	/*! Pipe lengths in [m]. */
+	std::vector<double>				m_length;
+	/*! Hydraulic (inner) diameters in [m]. */
+	std::vector<double>				m_innerDiameter;
+	/*! Thermal resistance of outer heat transfer per length of pipe in [mK/W], 0 if no outer heat transfer
+		coefficient is given.
+	*/
+	std::vector<double>				m_outerResistance;
+	/*! Thermal resistance of pipe wall and insulation per length of pipe in [mK/W]. */
+	std::vector<double>				m_wallResistance;
+	/*! Effective flow cross-sections in [m2] (of all parallel pipes). */
+	std::vector<double>				m_fluidCrossSection;
+	/*! Number of parallel pipes. */
+	std::vector<double>				m_nParallelPipes;
+
+	/*! Current mass fluxes in [kg/s]. */
+	std::vector<double>				m_massFlux;
+	/*! Current inflow temperatures in [K]. */
+	std::vector<double>				m_inflowTemperature;
+	/*! Current mean fluid temperatures in [K]. */
+	std::vector<double>				m_meanTemperature;
+	/*! Current fluid volume flows in [m3/s]. */
+	std::vector<double>				m_volumeFlow;
+	/*! Current fluid velocities in [m/s]. */
+	std::vector<double>				m_velocity;
+	/*! Current fluid viscosities in [m2/s]. */
+	std::vector<double>				m_viscosity;
+	/*! Current Reynolds numbers in [---]. */
+	std::vector<double>				m_reynolds;
+	/*! Current Prandtl numbers in [---]. */
+	std::vector<double>				m_prandtl;
+	/*! Current Nusselt numbers in [---]. */
+	std::vector<double>				m_nusselt;
+	/*! Current UA-values in [W/K] (of entire pipe or of a discretization element). */
+	std::vector<double>				m_UAValue;
+	/*! Current total heat losses in [W]. */
+	std::vector<double>				m_heatLoss;
+
+	/*! Fluid density in [kg/m3] (same fluid for all pipes of a network). */
+	double							m_fluidDensity = -999;
+	/*! Fluid heat capacity in [J/kgK]. */
+	double							m_fluidHeatCapacity = -999;
+	/*! Fluid conductivity in [W/mK]. */
+	double							m_fluidConductivity = -999;
+	/*! Fluid kinematic viscosity in [m2/s] (temperature dependent). */
+	IBK::LinearSpline				m_fluidViscosity;
+};
+
+
+/*! Grouped evaluation of all TNSimplePipeElement instances of a network. */
+class TNSimplePipeGroup : public TNPipeGroup { // NO KEYWORDS
+public:
+	/*! Adds a pipe to the group.
+		\param elementIdx Index of the flow element in ThermalNetworkModelImpl::m_flowElements.
+		\param stateOffset Offset of the (single) state of the element in the states vector of the network.
+	*/
+	void addPipe(TNSimplePipeElement * pipe, unsigned int elementIdx, unsigned int stateOffset);
+
+	/*! Replaces TNSimplePipeElement::setInternalStates() for all pipes. */
+	void setInternalStates(const double * y);
+
+	/*! Replaces TNSimplePipeElement::setMassFlux() and outflowTemperature() for all pipes.
+		\param massFluxes Mass fluxes of all flow elements of the network.
+		\param outflowTemperatures Outflow temperatures of all flow elements, values of the pipes are set.
+	*/
+	void setMassFluxes(const double * massFluxes, double * outflowTemperatures);
+
+	/*! Replaces TNSimplePipeElement::setInflowTemperature() for all pipes.
+		\param inflowTemperatures Inflow temperatures of all flow elements of the network.
+	*/
+	void setInflowTemperatures(const double * inflowTemperatures);
+
+	/*! Replaces TNSimplePipeElement::internalDerivatives() for all pipes. */
+	void internalDerivatives(double * ydot) const;
+
+private:
+	/*! Flow element objects, receive all published quantities. */
+	std::vector<TNSimplePipeElement*>	m_pipes;
+	/*! Heat capacity of fluid volume in [J/K]. */
+	std::vector<double>					m_fluidCapacity;
+};
+
+
+#ifndef DETAILLED_WALL_CAPACITY
+
+/*! Grouped evaluation of all TNDynamicPipeElement instances of a network.
+	The temperatures and heat losses of the discretization volumes remain stored in the pipe elements, they are
+	accessed through pointers. Since the states of a pipe are contiguous, the loops over the volumes of a pipe
+	can be vectorized.
+*/
+class TNDynamicPipeGroup : public TNPipeGroup { // NO KEYWORDS
+public:
+	/*! Adds a pipe to the group.
+		\param elementIdx Index of the flow element in ThermalNetworkModelImpl::m_flowElements.
+		\param stateOffset Offset of the first state of the element in the states vector of the network.
+	*/
+	void addPipe(TNDynamicPipeElement * pipe, unsigned int elementIdx, unsigned int stateOffset);
+
+	/*! Replaces TNDynamicPipeElement::setInternalStates() for all pipes. */
+	void setInternalStates(const double * y);
+
+	/*! Replaces TNDynamicPipeElement::setMassFlux() and outflowTemperature() for all pipes.
+		\param massFluxes Mass fluxes of all flow elements of the network.
+		\param outflowTemperatures Outflow temperatures of all flow elements, values of the pipes are set.
+	*/
+	void setMassFluxes(const double * massFluxes, double * outflowTemperatures);
+
+	/*! Replaces TNDynamicPipeElement::setInflowTemperature() for all pipes.
+		\param inflowTemperatures Inflow temperatures of all flow elements of the network.
+	*/
+	void setInflowTemperatures(const double * inflowTemperatures);
+
+	/*! Replaces TNDynamicPipeElement::internalDerivatives() for all pipes. */
+	void internalDerivatives(double * ydot) const;
+
+private:
+	/*! Flow element objects, receive all published quantities. */
+	std::vector<TNDynamicPipeElement*>	m_pipes;
+	/*! Number of discretization volumes. */
+	std::vector<unsigned int>			m_nVolumes;
+	/*! Lengths of discretization volumes in [m]. */
+	std::vector<double>					m_discLength;
+	/*! Heat capacity of fluid in a discretization volume in [J/K]. */
+	std::vector<double>					m_discCapacity;
+	/*! Temperatures of discretization volumes (TNDynamicPipeElement::m_temperatures). */
+	std::vector<double*>				m_temperatures;
+	/*! Heat losses of discretization volumes (TNDynamicPipeElement::m_heatLosses). */
+	std::vector<double*>				m_heatLosses;
+};
+
+#endif // DETAILLED_WALL_CAPACITY
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_ThermalNetworkPipeGroupsH
@@ -55,67 +55,111 @@ void ThermalNetworkModelImpl::setup(const Network &nw,
 	m_nodelHeatLoads.resize(nw.m_nodes.size(), 0.0);
 	// get fluid heat capacity
 	m_fluid = &fluid;
+	m_fluidHeatCapacity = m_fluid->m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value;
+
+	// flatten node-to-element connectivity, so that update() does not need to touch the Node vectors
+	m_nodeElementOffsets.resize(nw.m_nodes.size() + 1);
+	m_nodeElementIndexes.clear();
+	m_nodeElementDirections.clear();
+	for (unsigned int i = 0; i < nw.m_nodes.size(); ++i) {
+		m_nodeElementOffsets[i] = (unsigned int)m_nodeElementIndexes.size();
+		for (unsigned int idx : nw.m_nodes[i].m_elementIndexesInlet) {
+			m_nodeElementIndexes.push_back(idx);
+			m_nodeElementDirections.push_back(1);
+		}
+		for (unsigned int idx : nw.m_nodes[i].m_elementIndexesOutlet) {
+			m_nodeElementIndexes.push_back(idx);
+			m_nodeElementDirections.push_back(-1);
+		}
+	}
+	m_nodeElementOffsets.back() = (unsigned int)m_nodeElementIndexes.size();
+
+	m_elementNodeIndexesInlet.resize(nw.m_elements.size());
+	m_elementNodeIndexesOutlet.resize(nw.m_elements.size());
+	for (unsigned int i = 0; i < nw.m_elements.size(); ++i) {
+		m_elementNodeIndexesInlet[i] = nw.m_elements[i].m_nodeIndexInlet;
+		m_elementNodeIndexesOutlet[i] = nw.m_elements[i].m_nodeIndexOutlet;
+	}
+	m_outflowTemperatures.resize(nw.m_elements.size());
+	m_inflowTemperatures.resize(nw.m_elements.size());
+
+	// state offsets of all elements
+	m_stateOffsets.resize(m_flowElements.size() + 1);
+	m_stateOffsets[0] = 0;
+	for (unsigned int i = 0; i < m_flowElements.size(); ++i)
+		m_stateOffsets[i+1] = m_stateOffsets[i] + m_flowElements[i]->nInternalStates();
+
+	// collect pipes of same type into groups, all other elements are evaluated individually
+	m_simplePipes = TNSimplePipeGroup();
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes = TNDynamicPipeGroup();
+#endif // DETAILLED_WALL_CAPACITY
+	m_ungroupedElementIndexes.clear();
+	for (unsigned int i = 0; i < m_flowElements.size(); ++i) {
+		ThermalNetworkAbstractFlowElement * fe = m_flowElements[i];
+		if (TNSimplePipeElement * pipe = dynamic_cast<TNSimplePipeElement *>(fe))
+			m_simplePipes.addPipe(pipe, i, m_stateOffsets[i]);
+#ifndef DETAILLED_WALL_CAPACITY
+		else if (TNDynamicPipeElement * pipe = dynamic_cast<TNDynamicPipeElement *>(fe))
+			m_dynamicPipes.addPipe(pipe, i, m_stateOffsets[i]);
+#endif // DETAILLED_WALL_CAPACITY
+		else
+			m_ungroupedElementIndexes.push_back(i);
+	}
 }
 
 
 int ThermalNetworkModelImpl::update() {
 
 	// udpate mass flux
-	for(unsigned int i = 0; i < m_flowElements.size(); ++i) {
+	for(unsigned int i : m_ungroupedElementIndexes) {
 		ThermalNetworkAbstractFlowElement *flowElem = m_flowElements[i];
 		// update mass fluxes for each flow element
 		const double massFlux = m_fluidMassFluxes[i];
 		// set all nodal conditions
 		flowElem->setMassFlux(massFlux);
+		// outflow temperature may depend on flow direction, so we retrieve it after setting the mass flux
+		m_outflowTemperatures[i] = flowElem->outflowTemperature();
 	}
+	m_simplePipes.setMassFluxes(m_fluidMassFluxes, m_outflowTemperatures.data());
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes.setMassFluxes(m_fluidMassFluxes, m_outflowTemperatures.data());
+#endif // DETAILLED_WALL_CAPACITY
+
+	const unsigned int * offsets = m_nodeElementOffsets.data();
+	const unsigned int * elementIdxs = m_nodeElementIndexes.data();
+	const double * directions = m_nodeElementDirections.data();
+	const double * outflowTemperatures = m_outflowTemperatures.data();
+	const double cp = m_fluidHeatCapacity;
 
 	// calculate enthalpy fluxes for all nodes
-	for(unsigned int i = 0; i < m_network->m_nodes.size(); ++i) {
+	for(unsigned int i = 0; i < m_nodalTemperatures.size(); ++i) {
 
 		// set enthalpy flux to 0
 		double enthalpyFluxInlet = 0;
 
-		// vector of elements that push fluid into the node
-		std::vector<unsigned int> inletIdxs =
-				m_network->m_nodes[i].m_elementIndexesInlet;
-		// vector of elements where the node fluid goes into
-		std::vector<unsigned int> outletIdxs =
-				m_network->m_nodes[i].m_elementIndexesOutlet;
-
 		// Note: the actual mass flux direction determines what will be inlet/outlet.
 
-		// first we sum up all mass fluxes *into* the node, wether they flow from 'inlet' or 'outlet' elements
+		// first we sum up all mass fluxes *into* the node, wether they flow from 'inlet' elements (positive flux)
+		// or 'outlet' elements (negative flux) - the direction factor turns both into positive values;
 		// we also sum up the enthalpies
 
 		double massFluxInlet = 0.0;
-		// select all pipes with positive flux into element
-		for(unsigned int idx : inletIdxs) {
-			const double massFlux = m_fluidMassFluxes[idx];
-			if(massFlux > 0) {
+		for (unsigned int j = offsets[i]; j < offsets[i+1]; ++j) {
+			const unsigned int idx = elementIdxs[j];
+			// mass flux into node
+			const double massFlux = directions[j]*m_fluidMassFluxes[idx];
+			if (massFlux > 0) {
 				massFluxInlet += massFlux;
-				// and retrieve specific enthalpy
-				double temp = m_flowElements[idx]->outflowTemperature();
-				// sum up
-				enthalpyFluxInlet += massFlux * m_fluid->m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value * temp;
-			}
-		}
-		// select all pipes with negative flux into element
-		for(unsigned int idx : outletIdxs) {
-			const double massFlux = m_fluidMassFluxes[idx];
-			if(massFlux < 0) {
-				massFluxInlet -= massFlux; // mind negative sign of mass flux
-				// and retrieve specific enthalpy
-				double temp = m_flowElements[idx]->outflowTemperature();
-				// sum up (mind negative sign of mass flux!)
-				enthalpyFluxInlet += -massFlux * m_fluid->m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value * temp;
+				// sum up enthalpy flux, using outflow temperature of element
+				enthalpyFluxInlet += massFlux * cp * outflowTemperatures[idx];
 			}
 		}
 
 		// special case: temperature is given by a transient balance equation
 		if(m_nodalTemperatureRefs[i] != nullptr) {
 			double temperatureOutlet = *m_nodalTemperatureRefs[i];
-			double enthalpyFluxOutlet = massFluxInlet * m_fluid->m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value
-					* temperatureOutlet;
+			double enthalpyFluxOutlet = massFluxInlet * cp * temperatureOutlet;
 			// copy values
 			m_nodalTemperatures[i] = temperatureOutlet;
 			m_nodelHeatLoads[i] = enthalpyFluxInlet - enthalpyFluxOutlet;
@@ -124,32 +168,55 @@ int ThermalNetworkModelImpl::update() {
 		else {
 			// if we encounter a trivial flow solution (massFluxes all zero), then we just keep the temperatures the same
 			if (massFluxInlet != 0.0) {
-				m_nodalTemperatures[i] = enthalpyFluxInlet/(massFluxInlet * m_fluid->m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value);
+				m_nodalTemperatures[i] = enthalpyFluxInlet/(massFluxInlet * cp);
 			}
 		}
 	}
 
 	for(unsigned int i = 0; i < m_flowElements.size(); ++i) {
-		ThermalNetworkAbstractFlowElement *flowElem = m_flowElements[i];
-		// set enthalpy and mass fluxes for all flow elements
-		// and update their simulation results
-		const Element &fe = m_network->m_elements[i];
-		// get inlet node
 		const double massFlux = m_fluidMassFluxes[i];
-
-		double	inflowTemp = 0.0;
 		// dependening on mass flux set inflow temperature
 		if(massFlux >= 0)
-			inflowTemp = m_nodalTemperatures[fe.m_nodeIndexInlet];
+			m_inflowTemperatures[i] = m_nodalTemperatures[m_elementNodeIndexesInlet[i]];
 		else
-			inflowTemp = m_nodalTemperatures[fe.m_nodeIndexOutlet];
-		// set all nodal conditions
-		flowElem->setInflowTemperature(inflowTemp);
+			m_inflowTemperatures[i] = m_nodalTemperatures[m_elementNodeIndexesOutlet[i]];
 	}
+
+	// set enthalpy and mass fluxes for all flow elements
+	// and update their simulation results
+	for(unsigned int i : m_ungroupedElementIndexes)
+		m_flowElements[i]->setInflowTemperature(m_inflowTemperatures[i]);
+	m_simplePipes.setInflowTemperatures(m_inflowTemperatures.data());
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes.setInflowTemperatures(m_inflowTemperatures.data());
+#endif // DETAILLED_WALL_CAPACITY
 	return 0;
 }
 
 
+void ThermalNetworkModelImpl::setInternalStates(const double * y) {
+	for(unsigned int i : m_ungroupedElementIndexes)
+		m_flowElements[i]->setInternalStates(y + m_stateOffsets[i]);
+	m_simplePipes.setInternalStates(y);
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes.setInternalStates(y);
+#endif // DETAILLED_WALL_CAPACITY
+}
+
+
+void ThermalNetworkModelImpl::internalDerivatives(double * ydot) {
+	for(unsigned int i : m_ungroupedElementIndexes) {
+		// skip elements without states
+		if (m_stateOffsets[i+1] != m_stateOffsets[i])
+			m_flowElements[i]->internalDerivatives(ydot + m_stateOffsets[i]);
+	}
+	m_simplePipes.internalDerivatives(ydot);
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes.internalDerivatives(ydot);
+#endif // DETAILLED_WALL_CAPACITY
+}
+
+
 void ThermalNetworkModelImpl::dependencies(std::vector<std::pair<const double *, const double *> > & resultInputValueReferences) const {
 
 	// NOTE: we only use one representative mass flux entry, see documentation in HydraulicNetworkModel::stateDependencies()
@@ -23,6 +23,7 @@
 #define NM_ThermalNetworkPrivateH
 
 #include "NM_ThermalNetworkAbstractFlowElementWithHeatLoss.h"
+#include "NM_ThermalNetworkPipeGroups.h"
 
 #include <vector>
 
@@ -54,6 +55,14 @@ public:
 	/*! Updates all states and fluxes. */
 	int update();
 
+	/*! Sets internal states of all flow elements (pipe groups and individual elements).
+		\param y States vector of the network, elements' states are stored consecutively in order of m_flowElements.
+	*/
+	void setInternalStates(const double * y);
+
+	/*! Computes derivatives of all flow elements (pipe groups and individual elements). */
+	void internalDerivatives(double * ydot);
+
 	/*! Returns vector of dependencies. */
 	void dependencies(std::vector<std::pair<const double *, const double *> > & resultInputValueReferences) const;
 
@@ -100,6 +109,40 @@ private:
 
 	/*! Constant access to fluid. */
 	const NANDRAD::HydraulicFluid					*m_fluid = nullptr;
+	/*! Offset of the first state of each flow element in the states vector, size = m_flowElements.size() + 1. */
+	std::vector<unsigned int>						m_stateOffsets;
+	/*! Indexes of flow elements that are not part of a pipe group and are evaluated individually. */
+	std::vector<unsigned int>						m_ungroupedElementIndexes;
+	/*! All TNSimplePipeElement instances, evaluated together. */
+	TNSimplePipeGroup								m_simplePipes;
+#ifndef DETAILLED_WALL_CAPACITY
+	/*! All TNDynamicPipeElement instances, evaluated together. */
+	TNDynamicPipeGroup								m_dynamicPipes;
+#endif // DETAILLED_WALL_CAPACITY
+
+	/*! Cached heat capacity of fluid in [J/kgK]. */
+	double											m_fluidHeatCapacity = 0;
+
+	/*! Node-to-element adjacency in compressed row format, built in setup().
+		Elements connected to node i are m_nodeElementIndexes[m_nodeElementOffsets[i]...m_nodeElementOffsets[i+1]-1],
+		first all inlet elements, then all outlet elements of the node (same order as in Node).
+		Size = number of nodes + 1.
+	*/
+	std::vector<unsigned int>						m_nodeElementOffsets;
+	/*! Element indexes of all nodes, see m_nodeElementOffsets. */
+	std::vector<unsigned int>						m_nodeElementIndexes;
+	/*! Direction factor for each entry in m_nodeElementIndexes: +1 if element is an inlet element of the node
+		(positive mass flux flows into the node), -1 if element is an outlet element.
+	*/
+	std::vector<double>								m_nodeElementDirections;
+	/*! Inlet node index of each element (copy of Element::m_nodeIndexInlet). */
+	std::vector<unsigned int>						m_elementNodeIndexesInlet;
+	/*! Outlet node index of each element (copy of Element::m_nodeIndexOutlet). */
+	std::vector<unsigned int>						m_elementNodeIndexesOutlet;
+	/*! Outflow temperatures of all flow elements, cached in update() after mass fluxes have been set. */
+	std::vector<double>								m_outflowTemperatures;
+	/*! Inflow temperatures of all flow elements, computed in update(). */
+	std::vector<double>								m_inflowTemperatures;
 };
 
 
@@ -586,16 +586,8 @@ int ThermalNetworkStatesModel::update(const double * y) {
 	// copy states vector
 	std::memcpy(&m_y[0], y, m_n*sizeof(double));
 
-	// set internal states
-	unsigned int offset = 0;
-	for(unsigned int i = 0; i < m_p->m_flowElements.size(); ++i) {
-		ThermalNetworkAbstractFlowElement *fe = m_p->m_flowElements[i];
-		// calculate internal enthalpies for all flow elements
-		fe->setInternalStates(y + offset);
-		// retrieve fluid temperatures
-		unsigned int nStates = fe->nInternalStates();
-		offset += nStates;
-	}
+	// set internal states, calculate internal enthalpies for all flow elements
+	m_p->setInternalStates(y);
 	return 0;
 }
 
@@ -135,6 +135,10 @@ int main(int argc, char * argv[]) {
 		solver.m_logDirectory = model.dirs().m_logDir;
 		solver.m_stopAfterSolverInit = args.flagEnabled(IBK::SolverArgsParser::GO_TEST_INIT);
 		solver.m_restartFilename = model.dirs().m_varDir / "restart.bin";
+		const NANDRAD::SolverParameter & solverParameter = model.project().m_solverParameter;
+		solver.m_restartBackupCount = (unsigned int)solverParameter.m_intPara[NANDRAD::SolverParameter::IP_RestartBackupCount].value;
+		solver.m_restartBackupInterval = solverParameter.m_para[NANDRAD::SolverParameter::P_RestartBackupInterval].value; // in [s]
+		solver.m_incrementalRestartWriting = solverParameter.m_flag[NANDRAD::SolverParameter::F_IncrementalRestartWriting].isEnabled();
 
 		// depending on the restart settings, either run from start or continue simulation
 		if (args.m_restartFrom) {
@@ -0,0 +1,166 @@
+/*	Benchmark for getting/setting FMU states of the NANDRAD FMU (NandradSolverFMI library).
+
+	A local co-simulation master loop drives the FMU like an iterating master: in each communication interval the
+	state is stored with fmi2GetFMUstate(), the step is repeated several times (state restored with fmi2SetFMUstate()
+	before each repetition) and the state is released afterwards with fmi2FreeFMUstate(). Times spent in state
+	functions and in fmi2DoStep() are reported. Results of all repetitions after a restore must be identical, this
+	is checked by comparing the serialized states after each repetition.
+
+	Usage: FMUStateBenchmark <resource directory> [communication step size in s] [number of steps] [iterations]
+
+	The resource directory must contain the project file 'Project.nandrad' (e.g. 'resources' directory of an
+	extracted FMU). Results are written into the subdirectory 'FMUStateBenchmark' of the resource directory.
+	Enable solver flag 'LeanFMUStates' in the project to benchmark FMU states without linear system data.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <cstdarg>
+#include <cstdio>
+
+#include <IBK_Path.h>
+#include <IBK_StopWatch.h>
+
+#include <fmi2Functions.h>
+
+/*! GUID of NANDRAD FMU, see InstanceData.cpp. */
+const char * const NANDRAD_FMU_GUID = "{471a3b52-4923-44d8-ab4b-fcdb813c1244}";
+
+/*! Value reference of string parameter with results root directory. */
+const fmi2ValueReference RESULTS_ROOT_DIR_VALUE_REF = 42;
+
+
+void logger(fmi2ComponentEnvironment, fmi2String instanceName, fmi2Status status, fmi2String category, fmi2String message, ...) {
+	if (status == fmi2OK)
+		return;
+	char buffer[4096];
+	va_list args;
+	va_start(args, message);
+	std::vsnprintf(buffer, sizeof(buffer), message, args);
+	va_end(args);
+	std::cerr << instanceName << " [" << category << "] " << buffer << std::endl;
+}
+
+
+/*! Retrieves the current FMU state in serialized form. */
+bool serializedState(fmi2Component c, std::vector<char> & data) {
+	fmi2FMUstate state = nullptr;
+	size_t size = 0;
+	if (fmi2GetFMUstate(c, &state) != fmi2OK ||
+		fmi2SerializedFMUstateSize(c, state, &size) != fmi2OK)
+		return false;
+	data.resize(size);
+	bool success = (fmi2SerializeFMUstate(c, state, &data[0], size) == fmi2OK);
+	fmi2FreeFMUstate(c, &state);
+	return success;
+}
+
+
+int main(int argc, char * argv[]) {
+	if (argc < 2) {
+		std::cerr << "Usage: FMUStateBenchmark <resource directory> [communication step size in s] [number of steps] [iterations]" << std::endl;
+		return EXIT_FAILURE;
+	}
+	IBK::Path resourceDir = IBK::Path(argv[1]).absolutePath();
+	double stepSize = 3600;
+	unsigned int steps = 48;
+	unsigned int iterations = 3;
+	if (argc > 2)
+		stepSize = std::atof(argv[2]);
+	if (argc > 3)
+		steps = (unsigned int)std::atoi(argv[3]);
+	if (argc > 4)
+		iterations = (unsigned int)std::atoi(argv[4]);
+
+	IBK::Path resultsDir = resourceDir / "FMUStateBenchmark";
+	if (!IBK::Path::makePath(resultsDir)) {
+		std::cerr << "Cannot create results directory '" << resultsDir.str() << "'" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	fmi2CallbackFunctions callbacks = {logger, std::calloc, std::free, nullptr, nullptr};
+	std::string resourceURI = "file://" + resourceDir.str();
+	fmi2Component c = fmi2Instantiate("FMUStateBenchmark", fmi2CoSimulation, NANDRAD_FMU_GUID, resourceURI.c_str(),
+									  &callbacks, fmi2False, fmi2True);
+	if (c == nullptr)
+		return EXIT_FAILURE;
+
+	std::string resultsRootDir = resultsDir.str();
+	fmi2String resultsRootDirStr = resultsRootDir.c_str();
+	fmi2SetString(c, &RESULTS_ROOT_DIR_VALUE_REF, 1, &resultsRootDirStr);
+	fmi2SetupExperiment(c, fmi2False, 0, 0, fmi2False, 0);
+	if (fmi2EnterInitializationMode(c) != fmi2OK) {
+		fmi2FreeInstance(c);
+		return EXIT_FAILURE;
+	}
+	fmi2ExitInitializationMode(c);
+
+	IBK::StopWatch w;
+	double tGet = 0, tSet = 0, tFree = 0, tDoStep = 0;
+	unsigned int nGet = 0, nSet = 0, nDoStep = 0;
+	unsigned int differences = 0;
+	bool success = true;
+
+	double t = 0;
+	std::vector<char> firstResult, result;
+	for (unsigned int s = 0; s < steps && success; ++s) {
+		fmi2FMUstate state = nullptr;
+		w.start();
+		success = (fmi2GetFMUstate(c, &state) == fmi2OK);
+		tGet += w.stop();
+		++nGet;
+
+		for (unsigned int i = 0; i < iterations && success; ++i) {
+			if (i > 0) {
+				w.start();
+				success = (fmi2SetFMUstate(c, state) == fmi2OK);
+				tSet += w.stop();
+				++nSet;
+			}
+			w.start();
+			success = success && (fmi2DoStep(c, t, stepSize, i == iterations - 1 ? fmi2True : fmi2False) == fmi2OK);
+			tDoStep += w.stop();
+			++nDoStep;
+
+			// compare results of all repetitions after a restore
+			if (success && iterations > 2 && i > 0) {
+				std::vector<char> & data = (i == 1) ? firstResult : result;
+				success = serializedState(c, data);
+				if (i > 1 && data != firstResult)
+					++differences;
+			}
+		}
+
+		w.start();
+		fmi2FreeFMUstate(c, &state);
+		tFree += w.stop();
+		t += stepSize;
+	}
+	size_t stateSize = firstResult.size();
+
+	fmi2Terminate(c);
+	fmi2FreeInstance(c);
+	if (!success) {
+		std::cerr << "Error in FMU function call." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "Steps: " << steps << ", iterations: " << iterations;
+	if (stateSize != 0)
+		std::cout << ", FMU state size: " << stateSize << " bytes";
+	std::cout << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "fmi2GetFMUstate()   " << std::setw(10) << tGet << " ms  "
+			  << std::setw(10) << tGet*1e3/std::max(1u, nGet) << " us/call" << std::endl;
+	std::cout << "fmi2SetFMUstate()   " << std::setw(10) << tSet << " ms  "
+			  << std::setw(10) << tSet*1e3/std::max(1u, nSet) << " us/call" << std::endl;
+	std::cout << "fmi2FreeFMUstate()  " << std::setw(10) << tFree << " ms  "
+			  << std::setw(10) << tFree*1e3/std::max(1u, nGet) << " us/call" << std::endl;
+	std::cout << "fmi2DoStep()        " << std::setw(10) << tDoStep << " ms  "
+			  << std::setw(10) << tDoStep*1e3/std::max(1u, nDoStep) << " us/call" << std::endl;
+	std::cout << "Repetitions with results differing from first repetition: " << differences << std::endl;
+
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -61,8 +61,16 @@ std::string with_replaced_spaces(const std::string & text) {
 // that implements the SOLFRA::FMUModelInterface interface.
 InstanceData::InstanceData() :
 	InstanceDataCommon(&m_model),
-	m_tStart(0)
+	m_tStart(0),
+	m_lastRevision(1)
 {
+	// initial data of all components has revision 1
+	m_revisions.fill(1);
+	for (unsigned int i=0; i<NUM_SB; ++i) {
+		m_blockOffsets[i] = 0;
+		m_blockStored[i] = false;
+	}
+	m_blockOffsets[NUM_SB] = 0;
 }
 
 
@@ -216,6 +224,15 @@ void InstanceData::init() {
 void InstanceData::integrateTo(double tCommunicationIntervalEnd) {
 	const char * const FUNC_ID = "[InstanceData::integrateTo]";
 
+	// integration modifies the data of all components, except for linear equation system solver, preconditioner
+	// and Jacobian, which are only modified in linear solver setups
+	BlockRevisions previousRevisions = m_revisions;
+	m_revisions.fill(++m_lastRevision);
+	SOLFRA::IntegratorSundialsCVODE * cvodeIntegrator = dynamic_cast<SOLFRA::IntegratorSundialsCVODE *>(m_model.integratorInterface());
+	unsigned int nLinearSetups = 0;
+	if (cvodeIntegrator != nullptr)
+		nLinearSetups = cvodeIntegrator->nLinearSetups();
+
 	try {
 		double tCommunicationIntervalStart = m_model.integratorInterface()->t();
 		// TODO : check with standard, end time must always follow start time?
@@ -254,7 +271,6 @@ void InstanceData::integrateTo(double tCommunicationIntervalEnd) {
 
 			// reset linear setup to default value (see constant in CVODE; we have modified this
 			// value to 1 in case of KLU solver deserialization)
-			SOLFRA::IntegratorSundialsCVODE * cvodeIntegrator = dynamic_cast<SOLFRA::IntegratorSundialsCVODE *>(integrator);
 			if (cvodeIntegrator != nullptr)
 				cvodeIntegrator->setLinearSetupFrequency(0);
 
@@ -292,6 +308,13 @@ void InstanceData::integrateTo(double tCommunicationIntervalEnd) {
 			} // while (tOutput <= t) {
 
 		} // while (t < tCommunicationIntervalEnd)
+
+		// without linear solver setups, the linear equation system data is unchanged
+		if (cvodeIntegrator != nullptr && cvodeIntegrator->nLinearSetups() == nLinearSetups) {
+			m_revisions[SB_LESSolver] = previousRevisions[SB_LESSolver];
+			m_revisions[SB_Preconditioner] = previousRevisions[SB_Preconditioner];
+			m_revisions[SB_Jacobian] = previousRevisions[SB_Jacobian];
+		}
 	}
 	catch (IBK::Exception & ex) {
 		logger(fmi2Error, "error", IBK::FormatString("Exception caught: %1").arg(ex.what()));
@@ -308,87 +331,147 @@ void InstanceData::computeFMUStateSize() {
 	const char * const FUNC_ID = "[InstanceData::computeFMUStateSize]";
 	IBK_ASSERT(!m_modelExchange);
 
-	SOLFRA::IntegratorInterface *integrator = m_model.integratorInterface();
 	SOLFRA::LESInterface *lesSolver = m_model.lesInterface();
 	SOLFRA::PrecondInterface  *precond  = m_model.preconditionerInterface();
 	SOLFRA::JacobianInterface *jacobian = m_model.jacobianInterface();
 
+	// In lean mode, we do not store data that is re-computed in the linear solver setup: the preconditioner
+	// is always computed from the Jacobian, the Jacobian data is only used by the KLU solver within its setup.
+	// Other linear equation system solvers may re-use the Jacobian data in the setup.
+	bool lean = m_model.project().m_solverParameter.m_flag[NANDRAD::SolverParameter::F_LeanFMUStates].isEnabled();
+	m_blockStored[SB_Integrator] = true;
+	m_blockStored[SB_LESSolver] = (lesSolver != nullptr);
+	m_blockStored[SB_Preconditioner] = (precond != nullptr && !lean);
+	m_blockStored[SB_Jacobian] = (jacobian != nullptr && !(lean && dynamic_cast<SOLFRA::LESKLU*>(lesSolver) != nullptr));
+	m_blockStored[SB_Model] = true;
+
 	IBK_ASSERT(sizeof(size_t) == 8);
-	m_fmuStateSize = 8; // 8 bytes for leading size header
+	m_blockOffsets[0] = 8; // 8 bytes for leading size header
 
 	// ask all components of the integration framework for size
+	const char * const NOT_SUPPORTED_MSG[NUM_SB] = {
+		"Integrator does not support serialization.",
+		"LES solver does not support serialization.",
+		"Preconditioner does not support serialization.",
+		"Jacobian matrix generator does not support serialization.",
+		""
+	};
+	for (unsigned int i=0; i<NUM_SB; ++i) {
+		size_t s = 0;
+		if (m_blockStored[i]) {
+			s = blockSerializationSize((StateBlock)i);
+			// model may return s == 0
+			if (s == SOLFRA_NOT_SUPPORTED_FUNCTION)
+				throw IBK::Exception(NOT_SUPPORTED_MSG[i], FUNC_ID);
+		}
+		m_blockOffsets[i+1] = m_blockOffsets[i] + s;
+	}
+	m_fmuStateSize = m_blockOffsets[NUM_SB];
 
-	size_t s = integrator->serializationSize();
-	if (s == SOLFRA_NOT_SUPPORTED_FUNCTION)
-		throw IBK::Exception("Integrator does not support serialization.", FUNC_ID);
-	m_fmuStateSize += s;
+	if (lean)
+		IBK::IBK_Message(IBK::FormatString("Using lean FMU states (%1 bytes).\n").arg((unsigned int)m_fmuStateSize),
+						 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+}
 
-	if (lesSolver != nullptr) {
-		s = lesSolver->serializationSize();
-		if (s == SOLFRA_NOT_SUPPORTED_FUNCTION)
-			throw IBK::Exception("LES solver does not support serialization.", FUNC_ID);
-		m_fmuStateSize += s;
-	}
 
-	if (precond != nullptr) {
-		s = precond->serializationSize();
-		if (s == SOLFRA_NOT_SUPPORTED_FUNCTION)
-			throw IBK::Exception("Preconditioner does not support serialization.", FUNC_ID);
-		m_fmuStateSize += s;
+void InstanceData::serializeFMUstate(void * FMUstate) {
+	IBK_ASSERT(!m_modelExchange);
+
+	BlockRevisions & stateRevisions = m_fmuStateRevisions[FMUstate]; // new entries are initialized with 0
+	for (unsigned int i=0; i<NUM_SB; ++i) {
+		// skip components whose current data is already stored in the FMU state
+		if (stateRevisions[i] == m_revisions[i])
+			continue;
+		if (m_blockStored[i]) {
+			// let component copy its data into our memory
+			void * dataPtr = (char*)FMUstate + m_blockOffsets[i];
+			serializeBlock((StateBlock)i, dataPtr);
+			IBK_ASSERT(dataPtr == (char*)FMUstate + m_blockOffsets[i+1]);
+		}
+		stateRevisions[i] = m_revisions[i];
 	}
+}
+
 
-	if (jacobian != nullptr) {
-		s = jacobian->serializationSize();
-		if (s == SOLFRA_NOT_SUPPORTED_FUNCTION)
-			throw IBK::Exception("Jacobian matrix generator does not support serialization.", FUNC_ID);
-		m_fmuStateSize += s;
+void InstanceData::deserializeFMUstate(void * FMUstate) {
+	IBK_ASSERT(!m_modelExchange);
+
+	BlockRevisions & stateRevisions = m_fmuStateRevisions[FMUstate]; // new entries are initialized with 0
+	bool rebuildLinearSystem = false;
+	for (unsigned int i=0; i<NUM_SB; ++i) {
+		// skip components whose current data matches the data in the FMU state
+		if (stateRevisions[i] != 0 && stateRevisions[i] == m_revisions[i]) {
+			// the KLU solver does not store its factorization and always forces a new one after deserialization,
+			// we need to do the same to get identical results
+			if (i == SB_LESSolver && dynamic_cast<SOLFRA::LESKLU*>(m_model.lesInterface()) != nullptr)
+				rebuildLinearSystem = true;
+			continue;
+		}
+		if (m_blockStored[i]) {
+			// copy component memory back from state memory
+			void * dataPtr = (char*)FMUstate + m_blockOffsets[i];
+			deserializeBlock((StateBlock)i, dataPtr);
+			IBK_ASSERT(dataPtr == (char*)FMUstate + m_blockOffsets[i+1]);
+			// FMU state content of unknown revision (e.g. from fmi2DeSerializeFMUstate()) gets a new revision
+			if (stateRevisions[i] == 0)
+				stateRevisions[i] = ++m_lastRevision;
+			m_revisions[i] = stateRevisions[i];
+		}
+		else {
+			// data was not stored and must be re-computed in the next linear solver setup
+			rebuildLinearSystem = true;
+			m_revisions[i] = ++m_lastRevision;
+		}
 	}
 
-	s = m_model.serializationSize();
-	// we allow s == 0
-	m_fmuStateSize += s;
+	if (rebuildLinearSystem) {
+		// force linear solver setup in next integration step, reset in integrateTo()
+		SOLFRA::IntegratorSundialsCVODE * cvodeIntegrator = dynamic_cast<SOLFRA::IntegratorSundialsCVODE *>(m_model.integratorInterface());
+		IBK_ASSERT(cvodeIntegrator != nullptr);
+		cvodeIntegrator->setLinearSetupFrequency(1);
+	}
 }
 
 
-void InstanceData::serializeFMUstate(void * FMUstate) {
-	IBK_ASSERT(!m_modelExchange);
+void InstanceData::resetFMUstate(void * FMUstate) {
+	m_fmuStateRevisions.erase(FMUstate);
+}
 
-	SOLFRA::IntegratorInterface *integrator = m_model.integratorInterface();
-	SOLFRA::LESInterface *lesSolver = m_model.lesInterface();
-	SOLFRA::PrecondInterface  *precond  = m_model.preconditionerInterface();
-	SOLFRA::JacobianInterface *jacobian = m_model.jacobianInterface();
 
-	// let all components copy their data into our memory
-	void * dataStart = (char*)FMUstate + 8; // add space for the initial size_t that holds total sizes
-	integrator->serialize(dataStart);
-	if (lesSolver != nullptr)
-		lesSolver->serialize(dataStart);
-	if (precond != nullptr)
-		precond->serialize(dataStart);
-	if (jacobian != nullptr)
-		jacobian->serialize(dataStart);
-	m_model.serialize(dataStart);
+std::size_t InstanceData::blockSerializationSize(StateBlock block) {
+	switch (block) {
+		case SB_Integrator		: return m_model.integratorInterface()->serializationSize();
+		case SB_LESSolver		: return m_model.lesInterface()->serializationSize();
+		case SB_Preconditioner	: return m_model.preconditionerInterface()->serializationSize();
+		case SB_Jacobian		: return m_model.jacobianInterface()->serializationSize();
+		case SB_Model			: return m_model.serializationSize();
+		case NUM_SB : ;
+	}
+	return 0;
 }
 
 
-void InstanceData::deserializeFMUstate(void * FMUstate) {
-	IBK_ASSERT(!m_modelExchange);
+void InstanceData::serializeBlock(StateBlock block, void * & dataPtr) {
+	switch (block) {
+		case SB_Integrator		: m_model.integratorInterface()->serialize(dataPtr); break;
+		case SB_LESSolver		: m_model.lesInterface()->serialize(dataPtr); break;
+		case SB_Preconditioner	: m_model.preconditionerInterface()->serialize(dataPtr); break;
+		case SB_Jacobian		: m_model.jacobianInterface()->serialize(dataPtr); break;
+		case SB_Model			: m_model.serialize(dataPtr); break;
+		case NUM_SB : ;
+	}
+}
 
-	SOLFRA::IntegratorInterface *integrator = m_model.integratorInterface();
-	SOLFRA::LESInterface *lesSolver = m_model.lesInterface();
-	SOLFRA::PrecondInterface  *precond  = m_model.preconditionerInterface();
-	SOLFRA::JacobianInterface *jacobian = m_model.jacobianInterface();
 
-	// copy component memory back from state memory
-	void * dataStart = (char*)FMUstate + 8; // add space for the initial size_t that holds total sizes
-	integrator->deserialize(dataStart);
-	if (lesSolver != nullptr)
-		lesSolver->deserialize(dataStart);
-	if (precond != nullptr)
-		precond->deserialize(dataStart);
-	if (jacobian != nullptr)
-		jacobian->deserialize(dataStart);
-	m_model.deserialize(dataStart);
+void InstanceData::deserializeBlock(StateBlock block, void * & dataPtr) {
+	switch (block) {
+		case SB_Integrator		: m_model.integratorInterface()->deserialize(dataPtr); break;
+		case SB_LESSolver		: m_model.lesInterface()->deserialize(dataPtr); break;
+		case SB_Preconditioner	: m_model.preconditionerInterface()->deserialize(dataPtr); break;
+		case SB_Jacobian		: m_model.jacobianInterface()->deserialize(dataPtr); break;
+		case SB_Model			: m_model.deserialize(dataPtr); break;
+		case NUM_SB : ;
+	}
 }
 
 
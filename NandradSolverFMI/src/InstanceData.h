@@ -2,6 +2,8 @@
 #define InstanceDataH
 
 #include <vector>
+#include <map>
+#include <array>
 
 #include <IBK_Path.h>
 #include <IBK_FormatString.h>
@@ -32,19 +34,26 @@ public:
 		the FMU and stores the size in m_fmuStateSize.
 		\note The size includes the leading 8byte for the 64bit integer size
 		of the memory array (for testing purposes).
+		With solver flag LeanFMUStates, preconditioner data (and Jacobian data when using the
+		KLU solver) is not stored, since it is re-computed in the first linear solver setup after a restore.
 	*/
 	virtual void computeFMUStateSize() override;
 
 	/*! Copies the internal state of the FMU to the memory array pointed to by FMUstate.
 		Memory array always has size m_fmuStateSize.
+		Blocks of the memory array that already hold the current data of a component are not written again.
 	*/
 	virtual void serializeFMUstate(void * FMUstate) override;
 
 	/*! Copies the content of the memory array pointed to by FMUstate to the internal state of the FMU.
 		Memory array always has size m_fmuStateSize.
+		Components whose current data matches the data in the memory array are not restored.
 	*/
 	virtual void deserializeFMUstate(void * FMUstate) override;
 
+	/*! Discards block revisions stored for the FMU state. */
+	virtual void resetFMUstate(void * FMUstate) override;
+
 
 	/*! Called from fmi2FreeInstance() in CoSimulation at the end of simulation.
 		Writes any cached outputs.
@@ -57,6 +66,39 @@ public:
 	/*! Holds the start time from the co-sim master in setupExperiment(). */
 	double				m_tStart;
 
+private:
+	/*! Components of integrator framework and model, each component is serialized into a separate block of the
+		FMU state memory (in this order).
+	*/
+	enum StateBlock {
+		SB_Integrator,
+		SB_LESSolver,
+		SB_Preconditioner,
+		SB_Jacobian,
+		SB_Model,
+		NUM_SB
+	};
+
+	/*! Revision numbers of the data of all components, 0 means unknown revision. */
+	typedef std::array<std::size_t, NUM_SB> BlockRevisions;
+
+	/*! Returns serialization size of a component. */
+	std::size_t blockSerializationSize(StateBlock block);
+	/*! Serializes a component, dataPtr is moved past the written data. */
+	void serializeBlock(StateBlock block, void * & dataPtr);
+	/*! Deserializes a component, dataPtr is moved past the read data. */
+	void deserializeBlock(StateBlock block, void * & dataPtr);
+
+	/*! Offsets of all blocks in FMU state memory, last entry is total size (= m_fmuStateSize). */
+	std::size_t								m_blockOffsets[NUM_SB+1];
+	/*! True for all components whose data is stored in FMU states. */
+	bool									m_blockStored[NUM_SB];
+	/*! Revisions of current data of all components, updated in integrateTo() and deserializeFMUstate(). */
+	BlockRevisions							m_revisions;
+	/*! Last revision number assigned. */
+	std::size_t								m_lastRevision;
+	/*! Revisions of the data stored in the FMU states, entries are created in serializeFMUstate(). */
+	std::map<const void*, BlockRevisions>	m_fmuStateRevisions;
 }; // class InstanceData
 
 #endif // InstanceDataH
@@ -92,6 +92,34 @@ void NandradModelFMU::getBoolean(int varID, bool & /*value*/) {
 }
 
 
+void NandradModelFMU::setReals(const unsigned int * varIDs, std::size_t n, const double * values) {
+	FUNCID(NandradModelFMU::setReals);
+
+	// For now, we ignore call to setReals() *before* initialization was done
+	if (m_fmiInputOutput == nullptr)
+		return;
+
+	try {
+		m_fmiInputOutput->setFMIInputValues(varIDs, n, values);
+	}
+	catch(IBK::Exception &ex) {
+		throw IBK::Exception(ex, "Error setting input values.", FUNC_ID);
+	}
+}
+
+
+void NandradModelFMU::getReals(const unsigned int * varIDs, std::size_t n, double * values) {
+	FUNCID(NandradModelFMU::getReals);
+	IBK_ASSERT(m_fmiInputOutput != nullptr);
+	try {
+		m_fmiInputOutput->getFMIOutputValues(varIDs, n, values);
+	}
+	catch(IBK::Exception &ex) {
+		throw IBK::Exception(ex, "Error retrieving output values.", FUNC_ID);
+	}
+}
+
+
 void NandradModelFMU::startCommunicationInterval(double tStart, bool noSetFMUStatePriorToCurrentPoint) {
 //	FUNCID(NandradModelFMU::startCommunicationInterval);
 
@@ -54,6 +54,11 @@ public:
 	/*! Retrieves an output parameter of type bool. */
 	virtual void getBoolean(int varID, bool & value) override;
 
+	/*! Sets n input parameters of type double (direct table access, see FMIInputOutput). */
+	virtual void setReals(const unsigned int * varIDs, std::size_t n, const double * values) override;
+	/*! Retrieves n output parameters of type double (direct table access, see FMIInputOutput). */
+	virtual void getReals(const unsigned int * varIDs, std::size_t n, double * values) override;
+
 	/*! This function is called by the master/control system whenever a communication
 		interval is started or restarted.
 		The model should implement all functionality related to resetting temporary
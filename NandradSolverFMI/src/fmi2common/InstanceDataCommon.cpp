@@ -30,6 +30,8 @@ InstanceDataCommon::~InstanceDataCommon() {
 	for (std::set<void*>::iterator it = m_fmuStates.begin(); it != m_fmuStates.end(); ++it) {
 		free(*it);
 	}
+	for (void * mem : m_fmuStatePool)
+		free(mem);
 }
 
 
@@ -56,6 +58,36 @@ void InstanceDataCommon::logger(fmi2Status state, fmi2String category, const IBK
 }
 
 
+void * InstanceDataCommon::allocateFMUstate() {
+	IBK_ASSERT(m_fmuStateSize != 0);
+	void * fmuMem;
+	if (m_fmuStatePool.empty()) {
+		// alloc new memory
+		fmuMem = malloc(m_fmuStateSize);
+		// store size of memory in first 8 bytes of fmu memory
+		*(size_t*)(fmuMem) = m_fmuStateSize;
+	}
+	else {
+		// re-use memory of a released state
+		fmuMem = m_fmuStatePool.back();
+		m_fmuStatePool.pop_back();
+	}
+	// remember this memory array
+	m_fmuStates.insert(fmuMem);
+	// content of memory is unknown
+	resetFMUstate(fmuMem);
+	return fmuMem;
+}
+
+
+void InstanceDataCommon::releaseFMUstate(void * FMUstate) {
+	IBK_ASSERT(m_fmuStates.find(FMUstate) != m_fmuStates.end());
+	m_fmuStates.erase(FMUstate);
+	resetFMUstate(FMUstate);
+	m_fmuStatePool.push_back(FMUstate);
+}
+
+
 void InstanceDataCommon::setupMessageHandler(const IBK::Path & logfile) {
 	const char * const FUNC_ID = "[InstanceDataCommon::setupMessageHandler]";
 
@@ -142,6 +174,20 @@ void InstanceDataCommon::getBoolean(int varID, bool & value) {
 }
 
 
+void InstanceDataCommon::setReals(const fmi2ValueReference * varIDs, size_t n, const double * values) {
+	m_model->setReals(varIDs, n, values);
+	m_externalInputVarsModified = true;
+}
+
+
+void InstanceDataCommon::getReals(const fmi2ValueReference * varIDs, size_t n, double * values) {
+	// update procedure for model exchnge
+	if(m_modelExchange)
+		updateIfModified();
+	m_model->getReals(varIDs, n, values);
+}
+
+
 void InstanceDataCommon::completedIntegratorStep() {
 	// this function must only be called in ModelExchange mode!!!
 	IBK_ASSERT(m_modelExchange);
@@ -111,6 +111,12 @@ public:
 	/*! Retrieves an output parameter of type bool. */
 	void getBoolean(int varID, bool & value);
 
+	/*! Sets n input parameters of type double. */
+	void setReals(const fmi2ValueReference * varIDs, size_t n, const double * values);
+
+	/*! Retrieves n output parameters of type double. */
+	void getReals(const fmi2ValueReference * varIDs, size_t n, double * values);
+
 	/*! Called from fmi2CompletedIntegratorStep(): only ModelExchange. */
 	void completedIntegratorStep();
 
@@ -135,6 +141,21 @@ public:
 	*/
 	virtual void deserializeFMUstate(void * FMUstate) { (void)FMUstate; }
 
+	/*! Re-implement to discard cached information about the content of an FMU state.
+		Called whenever memory of an FMU state is (re-)assigned, released or overwritten from outside.
+	*/
+	virtual void resetFMUstate(void * FMUstate) { (void)FMUstate; }
+
+	/*! Returns memory for a new FMU state of size m_fmuStateSize and adds it to m_fmuStates.
+		Memory of released states is re-used, so that masters that free and re-create states in each
+		communication interval do not allocate new memory each time.
+		The leading 8 bytes of the memory array hold its size.
+	*/
+	void * allocateFMUstate();
+
+	/*! Removes an FMU state from m_fmuStates and keeps its memory for re-use in m_fmuStatePool. */
+	void releaseFMUstate(void * FMUstate);
+
 	/*! Called from fmi2FreeInstance() in CoSimulation at the end of simulation.
 		Write outputs here.
 	*/
@@ -204,6 +225,10 @@ public:
 		Unreleased memory gets deallocated in destructor.
 	*/
 	std::set<void*>					m_fmuStates;
+	/*! Holds memory arrays of released FMU states, re-used in allocateFMUstate().
+		Memory gets deallocated in destructor.
+	*/
+	std::vector<void*>				m_fmuStatePool;
 
 	/*! Controls output behavior of FMUs. */
 	OutputBehaviour					m_outputBehavior;
@@ -234,17 +234,13 @@ fmi2Status fmi2GetReal(void* c, const fmi2ValueReference vr[], size_t nvr, fmi2R
 	InstanceData * modelInstance = static_cast<InstanceData*>(c);
 	MessageHandlerSwapper handlerSwap(modelInstance->m_messageHandlerPtr); (void)handlerSwap;
 	FMI_ASSERT(modelInstance != NULL);
-	for (size_t i=0; i<nvr; ++i) {
-		try {
-			modelInstance->getReal(vr[i], value[i]);
-		}
-		catch (IBK::Exception & ex) {
-			ex.writeMsgStackToError();
-			modelInstance->logger(fmi2Error, "error",
-								  IBK::FormatString("Error in fmi2GetReal() for vr=%1 and value=%2.")
-								  .arg(vr[i]).arg(value[i]).str().c_str());
-			return fmi2Error;
-		}
+	try {
+		modelInstance->getReals(vr, nvr, value);
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		modelInstance->logger(fmi2Error, "error", "Error in fmi2GetReal().");
+		return fmi2Error;
 	}
 	return fmi2OK;
 }
@@ -316,17 +312,13 @@ fmi2Status fmi2SetReal (void* c, const fmi2ValueReference vr[], size_t nvr, cons
 	InstanceData * modelInstance = static_cast<InstanceData*>(c);
 	MessageHandlerSwapper handlerSwap(modelInstance->m_messageHandlerPtr); (void)handlerSwap;
 	FMI_ASSERT(modelInstance != NULL);
-	for (size_t i=0; i<nvr; ++i) {
-		try {
-			modelInstance->setReal(vr[i], value[i]);
-		}
-		catch (IBK::Exception & ex) {
-			ex.writeMsgStackToError();
-			modelInstance->logger(fmi2Error, "error",
-								  IBK::FormatString("Error in fmi2SetReal() for vr=%1 and value=%2.")
-								  .arg(vr[i]).arg(value[i]).str().c_str());
-			return fmi2Error;
-		}
+	try {
+		modelInstance->setReals(vr, nvr, value);
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		modelInstance->logger(fmi2Error, "error", "Error in fmi2SetReal().");
+		return fmi2Error;
 	}
 	return fmi2OK;
 }
@@ -407,14 +399,8 @@ fmi2Status fmi2GetFMUstate(void* c, fmi2FMUstate* FMUstate) {
 
 	// check if new alloc is needed
 	if (*FMUstate == NULL) {
-		// alloc new memory
-		fmi2FMUstate fmuMem = malloc(modelInstance->m_fmuStateSize);
-		// remember this memory array
-		modelInstance->m_fmuStates.insert(fmuMem);
-		// store size of memory in first 8 bytes of fmu memory
-		*(size_t*)(fmuMem) = modelInstance->m_fmuStateSize;
-		// return newly created FMU mem
-		*FMUstate = fmuMem;
+		// return newly created (or re-used) FMU mem
+		*FMUstate = modelInstance->allocateFMUstate();
 	}
 	else {
 		// check if FMUstate is in list of stored FMU states
@@ -465,10 +451,8 @@ fmi2Status fmi2FreeFMUstate(void* c, fmi2FMUstate* FMUstate) {
 		return fmi2Error;
 	}
 
-	// free memory
-	free(*FMUstate);
-	// and remove pointer from list of own fmu state pointers
-	modelInstance->m_fmuStates.erase(*FMUstate);
+	// remove pointer from list of own fmu state pointers, memory is kept for re-use
+	modelInstance->releaseFMUstate(*FMUstate);
 	*FMUstate = NULL; // set pointer to zero
 
 	return fmi2OK;
@@ -522,16 +506,14 @@ fmi2Status fmi2DeSerializeFMUstate(void* c, const char serializedState[], size_t
 	MessageHandlerSwapper handlerSwap(modelInstance->m_messageHandlerPtr); (void)handlerSwap;
 	FMI_ASSERT(modelInstance != NULL);
 
-	// check if FMUstate is in list of stored FMU states
-	if (modelInstance->m_fmuStates.find(FMUstate) == modelInstance->m_fmuStates.end()) {
-		modelInstance->logger(fmi2Error, "error", "fmi2FreeFMUstate is called with invalid FMUstate (unknown or already released pointer).");
+	// serialized state must have been created by an FMU with same configuration
+	if (modelInstance->m_fmuStateSize == 0 || modelInstance->m_fmuStateSize != s) {
+		modelInstance->logger(fmi2Error, "error", "fmi2DeSerializeFMUstate is called with serialized FMUstate of invalid size.");
 		return fmi2Error;
 	}
 
-	// if the state of stored previously, then we must have a valid fmu size
-	FMI_ASSERT(modelInstance->m_fmuStateSize == s);
-
-	// copy memory
+	// copy memory into a new FMU state
+	*FMUstate = modelInstance->allocateFMUstate();
 	std::memcpy(*FMUstate, serializedState, modelInstance->m_fmuStateSize);
 
 	return fmi2OK;
@@ -207,6 +207,7 @@ SOURCES += \
 	../../src/core3D/Vic3DOpaqueGeometryObject.cpp \
 	../../src/core3D/Vic3DOpenGLWindow.cpp \
 	../../src/core3D/Vic3DOrbitControllerObject.cpp \
+	../../src/core3D/Vic3DPickBVH.cpp \
 	../../src/core3D/Vic3DRubberbandObject.cpp \
 	../../src/core3D/Vic3DScene.cpp \
 	../../src/core3D/Vic3DSceneView.cpp \
@@ -455,6 +456,7 @@ HEADERS  += \
 	../../src/core3D/Vic3DOpenGLException.h \
 	../../src/core3D/Vic3DOpenGLWindow.h \
 	../../src/core3D/Vic3DOrbitControllerObject.h \
+	../../src/core3D/Vic3DPickBVH.h \
 	../../src/core3D/Vic3DPickObject.h \
 	../../src/core3D/Vic3DRubberbandObject.h \
 	../../src/core3D/Vic3DScene.h \
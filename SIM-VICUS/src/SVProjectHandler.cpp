@@ -217,6 +217,7 @@ void SVProjectHandler::loadProject(QWidget * parent, QString fileName,	bool sile
 	IBK_ASSERT(!isValid());
 
 	bool autosaveLoaded = false;
+	bool autosaveFailed = false;
 	do {
 		m_reload = false;
 
@@ -224,7 +225,7 @@ void SVProjectHandler::loadProject(QWidget * parent, QString fileName,	bool sile
 		createProject();
 
 		// check for autosave file
-		if (QFile::exists(fileName + "~")) {
+		if (!autosaveFailed && QFile::exists(fileName + "~")) {
 			QDateTime timeBackup = QFileInfo(fileName + "~").lastModified();
 			QDateTime timeProject = QFileInfo(fileName).lastModified();
 			QMessageBox msgbox(QMessageBox::Question, tr("Load autosave backup?"), tr("There exists a backup file for "
@@ -260,6 +261,19 @@ void SVProjectHandler::loadProject(QWidget * parent, QString fileName,	bool sile
 		}
 		catch (IBK::Exception & ex) {
 			ex.writeMsgStackToError();
+			// autosave backup cannot be read (e.g. written by another program version), open project file instead
+			if (autosaveLoaded) {
+				if (!silent)
+					QMessageBox::warning(parent, tr("Error loading autosave backup"),
+										 tr("The autosave backup '%1' cannot be read, it was probably written by another "
+											"version of SIM-VICUS. The project file is opened instead.").arg(fileName));
+				destroyProject();
+				fileName.chop(1); // remove ~
+				autosaveLoaded = false;
+				autosaveFailed = true;
+				m_reload = true;
+				continue;
+			}
 			if (!silent) {
 
 				QMessageBox::critical(
@@ -1126,7 +1140,13 @@ bool SVProjectHandler::read(QWidget * parent, const QString & fname) {
 	try {
 
 		// filename is converted to utf8 before calling readXML
-		m_project->readXML(IBK::Path(fname.toStdString()) );
+		// binary project files (e.g. autosave backups of older versions) are detected by their file magic,
+		// reading fails if they were written with another data layout
+		IBK::Path projectFilePath(fname.toStdString());
+		if (VICUS::Project::isBinaryFile(projectFilePath))
+			m_project->readBinary(projectFilePath);
+		else
+			m_project->readXML(projectFilePath);
 		m_projectFile = fname;
 
 		m_lastReadTime = QFileInfo(fname).lastModified();
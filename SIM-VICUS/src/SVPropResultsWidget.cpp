@@ -618,8 +618,8 @@ void SVPropResultsWidget::readDataFile(const QString & filename) {
 
 	try {
 		if (m_resultFileType == FT_TSV) {
-			// read entire file
-			reader.read(IBK::Path(fullFilePath.toStdString()), false, true);
+			// read entire file, values are stored column-wise
+			reader.readColumns(IBK::Path(fullFilePath.toStdString()), true);
 			if (reader.m_nColumns < 2 || reader.m_nRows < 5)
 				throw IBK::Exception("Missing data in file.", FUNC_ID);
 
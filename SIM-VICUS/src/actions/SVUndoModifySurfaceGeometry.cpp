@@ -63,8 +63,25 @@ void updateParent(VICUS::Surface &s) {
 }
 
 
+/*! Returns true, if both surfaces have sub-surfaces with the same IDs. */
+static bool sameSubSurfaces(const VICUS::Surface & s1, const VICUS::Surface & s2) {
+	if (s1.subSurfaces().size() != s2.subSurfaces().size())
+		return false;
+	for (unsigned int i=0; i<s1.subSurfaces().size(); ++i)
+		if (s1.subSurfaces()[i].m_id != s2.subSurfaces()[i].m_id)
+			return false;
+	return true;
+}
+
+
 void SVUndoModifySurfaceGeometry::undo() {
 	VICUS::Project &prj = theProject();
+
+	// IDs of modified surfaces, passed on to the scene for updating the geometry in place
+	ModifiedSurfaces modInfo;
+	// if sub-surfaces or windows are added/removed, the building topology changes
+	bool topologyChanged = m_modifySubSurfaceComponentInstances;
+
 	// process all of our stored surfaces in the project
 	for (unsigned int i=0; i<m_surfaces.size(); ++i) {
 		// find surface by ID in current project
@@ -73,6 +90,10 @@ void SVUndoModifySurfaceGeometry::undo() {
 		VICUS::Surface * s = dynamic_cast<VICUS::Surface *>(o);
 		Q_ASSERT(s != nullptr);
 
+		if (!sameSubSurfaces(*s, m_surfaces[i]))
+			topologyChanged = true;
+		modInfo.m_surfaceIDs.push_back(s->m_id);
+
 		// We need to temporarily store the child surfaces
 		std::vector<VICUS::Surface>		childs = s->childSurfaces();
 
@@ -118,10 +139,12 @@ void SVUndoModifySurfaceGeometry::undo() {
 	theProject().updatePointers();
 
 	// tell project that geometry has changed
-	// NOTE: this may be slow for larger geometries...
-	SVProjectHandler::instance().setModified( SVProjectHandler::BuildingGeometryChanged );
-	SVProjectHandler::instance().setModified( SVProjectHandler::DrawingModified );
-	SVProjectHandler::instance().setModified( SVProjectHandler::BuildingTopologyChanged );
+	// NOTE: if sub-surfaces have been added/removed, this may be slow for larger geometries...
+	SVProjectHandler::instance().setModified( SVProjectHandler::BuildingGeometryChanged, topologyChanged ? nullptr : &modInfo);
+	if (!m_drawings.empty())
+		SVProjectHandler::instance().setModified( SVProjectHandler::DrawingModified );
+	if (topologyChanged)
+		SVProjectHandler::instance().setModified( SVProjectHandler::BuildingTopologyChanged );
 }
 
 
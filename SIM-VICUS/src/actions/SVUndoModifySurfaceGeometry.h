@@ -40,6 +40,15 @@
 class SVUndoModifySurfaceGeometry : public SVUndoCommandBase {
 	Q_DECLARE_TR_FUNCTIONS(SVUndoModifySurfaceGeometry)
 public:
+	/*! Data type of the modification info object passed along with BuildingGeometryChanged.
+		Only sent if the sub-surfaces of the modified surfaces are unchanged, so that clients
+		can update the geometry of these surfaces in place.
+	*/
+	class ModifiedSurfaces : public ModificationInfo {
+	public:
+		std::vector<unsigned int>	m_surfaceIDs; // unique IDs
+	};
+
 	/*! Creates the undo-action.
 		Mind: surfaces must be triangulated already, if they contain new sub-surfaces.
 	*/
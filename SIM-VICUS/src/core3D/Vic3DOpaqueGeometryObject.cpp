@@ -29,6 +29,8 @@
 #include <QOpenGLShaderProgram>
 #include <QElapsedTimer>
 
+#include <algorithm>
+
 #include <VICUS_Project.h>
 #include "SVProjectHandler.h"
 #include "Vic3DGeometryHelpers.h"
@@ -131,6 +133,9 @@ void OpaqueGeometryObject::updateBuffers() {
 	//               buffer size change.
 
 	// transfer data stored in m_vertexBufferData
+	// all data is transferred, so no need to transfer modified ranges separately
+	m_modifiedRanges.clear();
+
 	m_vertexBufferObject.bind();
 	m_vertexBufferObject.allocate(m_vertexBufferData.data(), m_vertexBufferData.size()*sizeof(Vertex));
 	m_vertexBufferObject.release();
@@ -162,6 +167,71 @@ void OpaqueGeometryObject::updateColorBuffer() {
 }
 
 
+/*! Sorts the intervals (start, count) and merges overlapping intervals and intervals that are only separated by
+	a small gap, in order to reduce the number of buffer transfers.
+*/
+static void mergeIntervals(std::vector<std::pair<unsigned int, unsigned int> > & intervals) {
+	// intervals separated by less than this number of items are transferred in one piece
+	const unsigned int MAX_GAP = 64;
+	std::sort(intervals.begin(), intervals.end());
+	unsigned int j=0;
+	for (unsigned int i=1; i<intervals.size(); ++i) {
+		std::pair<unsigned int, unsigned int> & last = intervals[j];
+		if (intervals[i].first <= last.first + last.second + MAX_GAP)
+			last.second = std::max(last.second, intervals[i].first + intervals[i].second - last.first);
+		else
+			intervals[++j] = intervals[i];
+	}
+	if (!intervals.empty())
+		intervals.resize(j+1);
+}
+
+
+void OpaqueGeometryObject::updateModifiedRanges() {
+	if (m_modifiedRanges.empty())
+		return;
+
+	// if buffer sizes have changed, we need to re-allocate GPU memory anyway
+	if ((unsigned int)m_vertexBufferObject.size() != m_vertexBufferData.size()*sizeof(Vertex) ||
+		(unsigned int)m_colorBufferObject.size() != m_colorBufferData.size()*sizeof(ColorRGBA) ||
+		(unsigned int)m_indexBufferObject.size() != m_indexBufferData.size()*sizeof(GLuint))
+	{
+		updateBuffers();
+		return;
+	}
+
+	// collect and merge modified intervals
+	std::vector<std::pair<unsigned int, unsigned int> > vertexIntervals;
+	std::vector<std::pair<unsigned int, unsigned int> > elementIntervals;
+	for (const BufferRange & r : m_modifiedRanges) {
+		if (r.m_vertexCount != 0)
+			vertexIntervals.push_back(std::make_pair(r.m_vertexStart, r.m_vertexCount));
+		if (r.m_elementCount != 0)
+			elementIntervals.push_back(std::make_pair(r.m_elementStart, r.m_elementCount));
+	}
+	m_modifiedRanges.clear();
+	mergeIntervals(vertexIntervals);
+	mergeIntervals(elementIntervals);
+
+	// Note: QOpenGLBuffer::write() uses glBufferSubData()
+
+	m_vertexBufferObject.bind();
+	for (const std::pair<unsigned int, unsigned int> & i : vertexIntervals)
+		m_vertexBufferObject.write(i.first*sizeof(Vertex), m_vertexBufferData.data() + i.first, i.second*sizeof(Vertex));
+	m_vertexBufferObject.release();
+
+	m_colorBufferObject.bind();
+	for (const std::pair<unsigned int, unsigned int> & i : vertexIntervals)
+		m_colorBufferObject.write(i.first*sizeof(ColorRGBA), m_colorBufferData.data() + i.first, i.second*sizeof(ColorRGBA));
+	m_colorBufferObject.release();
+
+	m_indexBufferObject.bind();
+	for (const std::pair<unsigned int, unsigned int> & i : elementIntervals)
+		m_indexBufferObject.write(i.first*sizeof(GLuint), m_indexBufferData.data() + i.first, i.second*sizeof(GLuint));
+	m_indexBufferObject.release();
+}
+
+
 void OpaqueGeometryObject::renderOpaque() {
 	// bind all buffers ("position", "normal" and "color" arrays)
 	m_vao.bind();
@@ -63,6 +63,12 @@ public:
 		Call this function instead of updateBuffers(), if only colors of objects/visibility have changed.
 	*/
 	void updateColorBuffer();
+	/*! Copies only the buffer ranges listed in m_modifiedRanges to GPU memory (using glBufferSubData) and
+		clears the list afterwards. Falls back to updateBuffers(), if buffer sizes on GPU differ from those in
+		CPU memory.
+		Call this function instead of updateBuffers(), if data of only a few objects has been regenerated in place.
+	*/
+	void updateModifiedRanges();
 
 	/*! Binds the vertex array object and renders the geometry. */
 	void renderOpaque();
@@ -97,6 +103,33 @@ public:
 	/*! Maps unique surface/node ID to vertex start index in m_vertexBufferData. */
 	std::map<unsigned int, unsigned int>	m_vertexStartMap;
 
+	/*! Range of vertexes and element indexes of an object in the buffers. */
+	struct BufferRange {
+		BufferRange() = default;
+		BufferRange(unsigned int vertexStart, unsigned int vertexCount, unsigned int elementStart, unsigned int elementCount) :
+			m_vertexStart(vertexStart), m_vertexCount(vertexCount), m_elementStart(elementStart), m_elementCount(elementCount)
+		{}
+
+		/*! Index of first vertex in m_vertexBufferData and m_colorBufferData. */
+		unsigned int	m_vertexStart = 0;
+		/*! Number of vertexes. */
+		unsigned int	m_vertexCount = 0;
+		/*! Index of first element in m_indexBufferData. */
+		unsigned int	m_elementStart = 0;
+		/*! Number of elements. */
+		unsigned int	m_elementCount = 0;
+	};
+
+	/*! Maps unique object ID to buffer ranges holding the data of this object.
+		Populated when generating buffer data (optional), and used to regenerate data of individual objects in place.
+	*/
+	std::map<unsigned int, BufferRange>		m_bufferRanges;
+
+	/*! Buffer ranges whose data has been modified in CPU memory and needs to be transferred to GPU memory
+		in updateModifiedRanges().
+	*/
+	std::vector<BufferRange>	m_modifiedRanges;
+
 	/*! VertexArrayObject, references the vertex, color and index buffers. */
 	QOpenGLVertexArrayObject	m_vao;
 
@@ -0,0 +1,166 @@
+/*	SIM-VICUS - Building and District Energy Simulation Tool.
+
+	Copyright (c) 2020-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Dirk Weiss  <dirk.weiss -[at]- tu-dresden.de>
+	  Stephan Hirth  <stephan.hirth -[at]- tu-dresden.de>
+	  Hauke Hirsch  <hauke.hirsch -[at]- tu-dresden.de>
+
+	  ... all the others from the SIM-VICUS team ... :-)
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "Vic3DPickBVH.h"
+
+#include <algorithm>
+
+#include <VICUS_Project.h>
+
+#include "Vic3DConstants.h"
+
+namespace Vic3D {
+
+/*! Margin in [m] added to the bounding boxes of surfaces, so that flat boxes of planar surfaces
+	still get hit and rounding errors in the intersection test do not cause missed surfaces.
+*/
+const double PICK_BVH_BOX_TOLERANCE = 1e-4;
+
+
+void PickBVH::update(const VICUS::Project & prj) {
+
+	// *** surfaces ***
+
+	if (m_modified[C_Surfaces]) {
+		Tree & tree = m_trees[C_Surfaces];
+		tree.clear();
+		Item item;
+		// room surfaces, hole polygons of sub-surfaces are inside the surface polygon and thus
+		// enclosed by the surface's bounding box
+		item.m_type = IT_RoomSurface;
+		for (const VICUS::Building & b : prj.m_buildings)
+			for (const VICUS::BuildingLevel & bl : b.m_buildingLevels)
+				for (const VICUS::Room & r : bl.m_rooms)
+					for (const VICUS::Surface & s : r.m_surfaces) {
+						item.m_surface = &s;
+						tree.addItem(item, IBKMK::BoundingVolumeHierarchy::boundingBox(s.geometry().polygon3D().vertexes(), PICK_BVH_BOX_TOLERANCE));
+					}
+		item.m_type = IT_PlainSurface;
+		for (const VICUS::Surface & s : prj.m_plainGeometry.m_surfaces) {
+			item.m_surface = &s;
+			tree.addItem(item, IBKMK::BoundingVolumeHierarchy::boundingBox(s.geometry().polygon3D().vertexes(), PICK_BVH_BOX_TOLERANCE));
+		}
+		tree.build();
+		m_modified[C_Surfaces] = false;
+	}
+
+
+	// *** networks ***
+
+	if (m_modified[C_Network]) {
+		Tree & tree = m_trees[C_Network];
+		tree.clear();
+		for (const VICUS::Network & n : prj.m_geometricNetworks) {
+			// nodes first, same order as in Scene::pick()
+			Item item;
+			item.m_type = IT_NetworkNode;
+			for (const VICUS::NetworkNode & no : n.m_nodes) {
+				item.m_node = &no;
+				tree.addItem(item, IBKMK::BoundingVolumeHierarchy::boundingBox(std::vector<IBKMK::Vector3D>(1, no.m_position), no.m_visualizationRadius));
+			}
+			item = Item();
+			item.m_type = IT_NetworkEdge;
+			for (const VICUS::NetworkEdge & e : n.m_edges) {
+				// edges without node pointers cannot be picked anyway
+				if (e.m_node1 == nullptr || e.m_node2 == nullptr)
+					continue;
+				item.m_edge = &e;
+				std::vector<IBKMK::Vector3D> pts{e.m_node1->m_position, e.m_node2->m_position};
+				tree.addItem(item, IBKMK::BoundingVolumeHierarchy::boundingBox(pts, e.m_visualizationRadius));
+			}
+		}
+		tree.build();
+		m_modified[C_Network] = false;
+	}
+
+
+	// *** drawings ***
+
+	if (m_modified[C_Drawings]) {
+		Tree & tree = m_trees[C_Drawings];
+		tree.clear();
+		Item item;
+		item.m_type = IT_DrawingPoint;
+		std::vector<IBKMK::Vector3D> pts;
+		for (const VICUS::Drawing & d : prj.m_drawings) {
+			item.m_drawing = &d;
+			const std::map<unsigned int, std::vector<IBKMK::Vector3D>> &points3D = d.pickPoints();
+			for (std::map<unsigned int, std::vector<IBKMK::Vector3D>>::const_iterator it = points3D.begin();
+				 it != points3D.end(); ++it)
+			{
+				item.m_drawingObjectID = it->first;
+				const std::vector<IBKMK::Vector3D> &points = it->second;
+				for (unsigned int j=0; j<points.size(); ++j) {
+					item.m_point = points[j];
+					item.m_previousPoint = points[((int)j - 1) % points.size()];
+					pts.assign(1, item.m_point);
+					// line picking also needs the line segment to the previous point inside the box
+					if (PICK_LINE)
+						pts.push_back(item.m_previousPoint);
+					tree.addItem(item, IBKMK::BoundingVolumeHierarchy::boundingBox(pts, SNAP_DRAWING_DISTANCES_THRESHHOLD));
+				}
+			}
+		}
+		tree.build();
+		m_modified[C_Drawings] = false;
+	}
+}
+
+
+void PickBVH::collectCandidates(const IBKMK::Vector3D & p, const IBKMK::Vector3D & d,
+								std::vector<const Item*> & candidates) const
+{
+	candidates.clear();
+	for (unsigned int c=0; c<NUM_C; ++c) {
+		const Tree & tree = m_trees[c];
+		tree.m_bvh.collectCandidates(p, p, d, m_indexes);
+		// restore order of project data, so that candidates with equal depth are sorted as without tree
+		std::sort(m_indexes.begin(), m_indexes.end());
+		for (unsigned int idx : m_indexes)
+			candidates.push_back(&tree.m_items[idx]);
+	}
+}
+
+
+void PickBVH::Tree::clear() {
+	m_items.clear();
+	m_boxes.clear();
+	m_bvh.clear();
+}
+
+
+void PickBVH::Tree::addItem(const Item & item, const IBKMK::BoundingVolumeHierarchy::Box & box) {
+	m_items.push_back(item);
+	m_boxes.push_back(box);
+}
+
+
+void PickBVH::Tree::build() {
+	m_bvh.build(m_boxes);
+	// boxes are copied into the tree
+	std::vector<IBKMK::BoundingVolumeHierarchy::Box>().swap(m_boxes);
+}
+
+} // namespace Vic3D
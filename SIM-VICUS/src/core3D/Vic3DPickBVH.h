@@ -0,0 +1,146 @@
+/*	SIM-VICUS - Building and District Energy Simulation Tool.
+
+	Copyright (c) 2020-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Dirk Weiss  <dirk.weiss -[at]- tu-dresden.de>
+	  Stephan Hirth  <stephan.hirth -[at]- tu-dresden.de>
+	  Hauke Hirsch  <hauke.hirsch -[at]- tu-dresden.de>
+
+	  ... all the others from the SIM-VICUS team ... :-)
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef Vic3DPickBVHH
+#define Vic3DPickBVHH
+
+#include <vector>
+
+#include <IBKMK_Vector3D.h>
+#include <IBKMK_BoundingVolumeHierarchy.h>
+
+namespace VICUS {
+	class Project;
+	class Surface;
+	class NetworkNode;
+	class NetworkEdge;
+	class Drawing;
+}
+
+namespace Vic3D {
+
+/*! Bounding volume hierarchies (binary trees of axis-aligned bounding boxes) of all pickable objects in the scene.
+
+	Scene::pick() uses these trees to find the objects whose bounding boxes are hit by the line-of-sight. The exact
+	(and expensive) intersection tests are then only done for these candidates.
+
+	Pickable objects are grouped in categories, each with its own tree. When project data of a category is modified,
+	the category is marked with setModified() and its tree is rebuilt on next call to update(). Trees of unmodified
+	categories are kept.
+
+	Items hold pointers to project data, so a category must be marked as modified whenever the respective data
+	may have been reallocated. Visibility is not stored in the trees, it is checked when testing the candidates.
+*/
+class PickBVH {
+public:
+	/*! Categories of pickable objects, each category has its own tree. */
+	enum Category {
+		/*! Surfaces of rooms (including their sub-surfaces) and plain geometry surfaces. */
+		C_Surfaces,
+		/*! Nodes and edges of all networks. */
+		C_Network,
+		/*! Pick points of all drawings. */
+		C_Drawings,
+		NUM_C
+	};
+
+	/*! Types of pickable objects. */
+	enum ItemType {
+		/*! Surface of a room, sub-surfaces are picked through the holes of the surface. */
+		IT_RoomSurface,
+		/*! Surface of plain geometry. */
+		IT_PlainSurface,
+		/*! Network node (sphere). */
+		IT_NetworkNode,
+		/*! Network edge (cylinder). */
+		IT_NetworkEdge,
+		/*! Pick point of a drawing object. */
+		IT_DrawingPoint
+	};
+
+	/*! A pickable object. */
+	struct Item {
+		/*! Type of object, determines which of the pointers below is used. */
+		ItemType					m_type;
+		/*! Surface (room and plain surfaces). */
+		const VICUS::Surface		*m_surface = nullptr;
+		/*! Network node. */
+		const VICUS::NetworkNode	*m_node = nullptr;
+		/*! Network edge. */
+		const VICUS::NetworkEdge	*m_edge = nullptr;
+		/*! Drawing (drawing points). */
+		const VICUS::Drawing		*m_drawing = nullptr;
+		/*! ID of drawing object the pick point belongs to (drawing points). */
+		unsigned int				m_drawingObjectID = 0;
+		/*! Coordinates of pick point (drawing points). */
+		IBKMK::Vector3D				m_point;
+		/*! Coordinates of previous pick point of the same drawing object (drawing points). */
+		IBKMK::Vector3D				m_previousPoint;
+	};
+
+	/*! Marks a category as modified, its tree is rebuilt on next call to update(). */
+	void setModified(Category c) { m_modified[c] = true; }
+
+	/*! Rebuilds the trees of all modified categories. */
+	void update(const VICUS::Project & prj);
+
+	/*! Collects all items whose bounding boxes are hit by the line-of-sight (p + t*d, t arbitrary).
+		Candidates are returned ordered by category, within a category in the order of the project data.
+		\param p Offset of line-of-sight.
+		\param d Direction of line-of-sight.
+		\param candidates Vector that receives pointers to candidate items (cleared first).
+	*/
+	void collectCandidates(const IBKMK::Vector3D & p, const IBKMK::Vector3D & d,
+						   std::vector<const Item*> & candidates) const;
+
+private:
+	/*! Tree of all items of one category. */
+	struct Tree {
+		/*! Clears all items and the tree. */
+		void clear();
+		/*! Adds an item with its bounding box. */
+		void addItem(const Item & item, const IBKMK::BoundingVolumeHierarchy::Box & box);
+		/*! Builds tree for all items added. */
+		void build();
+
+		/*! All items of the category, in the order of the project data. */
+		std::vector<Item>									m_items;
+		/*! Bounding boxes of the items, only needed until the tree is built. */
+		std::vector<IBKMK::BoundingVolumeHierarchy::Box>	m_boxes;
+		/*! Tree over the bounding boxes, indexes match m_items. */
+		IBKMK::BoundingVolumeHierarchy						m_bvh;
+	};
+
+	/*! Trees for all categories. */
+	Tree							m_trees[NUM_C];
+	/*! Modification flags of all categories. */
+	bool							m_modified[NUM_C] = {true, true, true};
+	/*! Cache for item indexes collected in collectCandidates(). */
+	mutable std::vector<unsigned int>	m_indexes;
+};
+
+} // namespace Vic3D
+
+#endif // Vic3DPickBVHH
@@ -53,6 +53,7 @@
 #include "SVViewState.h"
 #include "SVSettings.h"
 #include "SVUndoTreeNodeState.h"
+#include "SVUndoModifySurfaceGeometry.h"
 #include "SVUndoDeleteSelected.h"
 #include "SVNavigationTreeWidget.h"
 #include "SVMeasurementWidget.h"
@@ -109,7 +110,31 @@ void Scene::create(SceneView * parent, std::vector<ShaderProgram> & shaderProgra
 }
 
 
-void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
+void Scene::onModified(int modificationType, ModificationInfo * data) {
+
+	// mark pick trees of modified objects, they are rebuilt on next pick
+	// Note: this is also done before the scene is initialized, since project data may be reallocated
+	switch ((SVProjectHandler::ModificationTypes)modificationType) {
+		case SVProjectHandler::AllModified :
+			m_pickBVH.setModified(PickBVH::C_Surfaces);
+			m_pickBVH.setModified(PickBVH::C_Network);
+			m_pickBVH.setModified(PickBVH::C_Drawings);
+		break;
+		case SVProjectHandler::BuildingGeometryChanged :
+		case SVProjectHandler::BuildingTopologyChanged :
+		case SVProjectHandler::ComponentInstancesModified :
+		case SVProjectHandler::SubSurfaceComponentInstancesModified :
+			m_pickBVH.setModified(PickBVH::C_Surfaces);
+		break;
+		case SVProjectHandler::NetworkGeometryChanged :
+		case SVProjectHandler::NetworkDataChanged :
+			m_pickBVH.setModified(PickBVH::C_Network);
+		break;
+		case SVProjectHandler::DrawingModified :
+			m_pickBVH.setModified(PickBVH::C_Drawings);
+		break;
+		default: ; // visibility/selection changes do not affect the trees
+	}
 
 	// no shader - not initialized yet, skip modified event
 	if (m_gridShader == nullptr)
@@ -121,6 +146,8 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 	bool updateDrawing = false;
 	bool updateCamera = false;
 	bool updateSelection = false;
+	// IDs of modified objects, if known, these are updated in place in the geometry buffers
+	const std::vector<unsigned int> * modifiedObjectIDs = nullptr;
 	// filter out all modification types that we handle
 	SVProjectHandler::ModificationTypes mod = (SVProjectHandler::ModificationTypes)modificationType;
 	switch (mod) {
@@ -153,6 +180,9 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 	case SVProjectHandler::BuildingGeometryChanged : {
 		updateBuilding = true;
 		updateSelection = true;
+		SVUndoModifySurfaceGeometry::ModifiedSurfaces * modSurfaces = dynamic_cast<SVUndoModifySurfaceGeometry::ModifiedSurfaces *>(data);
+		if (modSurfaces != nullptr)
+			modifiedObjectIDs = &modSurfaces->m_surfaceIDs;
 		// we might have just deleted all selected items, in this case switch back to AddGeometry
 
 		std::set<const VICUS::Object*> selectedObjects;
@@ -209,6 +239,10 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 		updateBuilding = true;
 		updateNetwork = true;
 		updateDrawing = true;
+		// only the colors of the modified objects change
+		SVUndoTreeNodeState::ModifiedNodes * modNodes = dynamic_cast<SVUndoTreeNodeState::ModifiedNodes *>(data);
+		if (modNodes != nullptr)
+			modifiedObjectIDs = &modNodes->m_nodeIDs;
 
 		// Now check if our new selection set is different from the previous selection set.
 		std::set<const VICUS::Object*> selectedObjects;
@@ -272,6 +306,10 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 		m_selectedGeometryObject.updateBuffers();
 	}
 
+	// if true, only modified ranges of the building/network geometry buffers need to be transferred
+	bool buildingUpdatedInPlace = false;
+	bool networkUpdatedInPlace = false;
+
 	if (updateBuilding) {
 		// create geometry object (if already existing, nothing happens here)
 		m_buildingGeometryObject.create(m_buildingShader->shaderProgram()); // Note: does nothing, if already existing
@@ -281,7 +319,11 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 		const SVViewState & vs = SVViewStateHandler::instance().viewState();
 		if (vs.inPropertyEditingMode())
 			recolorObjects(vs.m_objectColorMode, vs.m_colorModePropertyID); // only changes color set in objects
-		generateBuildingGeometry();
+		// recoloring may change colors of all objects, otherwise update only modified objects, if possible
+		if (modifiedObjectIDs != nullptr && !vs.inPropertyEditingMode())
+			buildingUpdatedInPlace = updateBuildingObjects(*modifiedObjectIDs);
+		if (!buildingUpdatedInPlace)
+			generateBuildingGeometry();
 		generateTransparentBuildingGeometry();
 	}
 
@@ -298,7 +340,10 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 
 		// Fill vertex, color and index buffer data from network geometry and
 		// transfer data to vertex array caches on GPU
-		generateNetworkGeometry();
+		if (modifiedObjectIDs != nullptr && !vs.inPropertyEditingMode())
+			networkUpdatedInPlace = updateNetworkObjects(*modifiedObjectIDs);
+		if (!networkUpdatedInPlace)
+			generateNetworkGeometry();
 	}
 
 	if(updateDrawing){
@@ -309,13 +354,20 @@ void Scene::onModified(int modificationType, ModificationInfo * /*data*/) {
 
 	// update all GPU buffers (transfer cached data to GPU)
 	if (updateBuilding || updateSelection) {
-		m_buildingGeometryObject.updateBuffers();
+		if (buildingUpdatedInPlace)
+			m_buildingGeometryObject.updateModifiedRanges();
+		else
+			m_buildingGeometryObject.updateBuffers();
 		m_transparentBuildingObject.updateBuffers();
 		m_surfaceNormalsObject.updateVertexBuffers();
 	}
 
-	if (updateNetwork || updateSelection)
-		m_networkGeometryObject.updateBuffers();
+	if (updateNetwork || updateSelection) {
+		if (networkUpdatedInPlace)
+			m_networkGeometryObject.updateModifiedRanges();
+		else
+			m_networkGeometryObject.updateBuffers();
+	}
 
 	if(updateDrawing){
 		m_drawingGeometryObject.updateBuffers();
@@ -1466,6 +1518,96 @@ void Scene::refreshColors() {
 }
 
 
+/*! Returns true, if sub-surface is drawn as transparent surface (window). */
+static bool isTransparentSubSurface(const VICUS::SubSurface & sub, const SVDatabase & db) {
+	if (sub.m_subSurfaceComponentInstance == nullptr ||
+			sub.m_subSurfaceComponentInstance->m_idSubSurfaceComponent == VICUS::INVALID_ID)
+		return false;
+	// lookup subsurface component - if it exists
+	const VICUS::SubSurfaceComponent * comp = db.m_subSurfaceComponents[sub.m_subSurfaceComponentInstance->m_idSubSurfaceComponent];
+	return comp != nullptr && comp->m_type == VICUS::SubSurfaceComponent::CT_Window;
+}
+
+
+/*! Returns color of transparent sub-surface (window).
+	Invisible and selected windows get a fully transparent color and are not drawn (discarded in fragment shader).
+*/
+static QColor transparentSubSurfaceColor(const VICUS::SubSurface & sub) {
+	QColor col = sub.m_color;
+	if (!sub.m_visible || sub.m_selected)
+		col.setAlphaF(0);
+	return col;
+}
+
+
+/*! Adds cylinder for network edge. */
+static void addNetworkEdge(const VICUS::NetworkEdge & e,
+						   unsigned int & currentVertexIndex, unsigned int & currentElementIndex,
+						   std::vector<Vertex> & vertexBufferData, std::vector<ColorRGBA> & colorBufferData,
+						   std::vector<GLuint> & indexBufferData)
+{
+	QColor pipeColor = e.m_color;
+	if (!e.m_visible || e.m_selected)
+		pipeColor.setAlpha(0);
+	addCylinder(e.m_node1->m_position, e.m_node2->m_position, pipeColor, e.m_visualizationRadius,
+				currentVertexIndex, currentElementIndex, vertexBufferData, colorBufferData, indexBufferData);
+}
+
+
+/*! Adds sphere for network node. */
+static void addNetworkNode(const VICUS::NetworkNode & no, const VICUS::Network & network,
+						   unsigned int & currentVertexIndex, unsigned int & currentElementIndex,
+						   std::vector<Vertex> & vertexBufferData, std::vector<ColorRGBA> & colorBufferData,
+						   std::vector<GLuint> & indexBufferData)
+{
+	QColor col = no.m_color;
+	if (!no.m_visible || !network.m_visible)
+		col.setAlpha(0);
+	addSphere(no.m_position, col, no.m_visualizationRadius,
+			  currentVertexIndex, currentElementIndex, vertexBufferData, colorBufferData, indexBufferData);
+}
+
+
+/*! Holds buffer data generated for a single object, with vertex indexes starting at 0. */
+struct ObjectBufferData {
+	void clear() {
+		m_vertexBufferData.clear();
+		m_colorBufferData.clear();
+		m_indexBufferData.clear();
+		m_vertexIndex = 0;
+		m_elementIndex = 0;
+	}
+
+	std::vector<Vertex>			m_vertexBufferData;
+	std::vector<ColorRGBA>		m_colorBufferData;
+	std::vector<GLuint>			m_indexBufferData;
+	unsigned int				m_vertexIndex = 0;
+	unsigned int				m_elementIndex = 0;
+};
+
+
+/*! Copies buffer data of a single object into its buffer range and marks the range as modified.
+	Returns false if the size of the data differs from the buffer range (buffer layout changed).
+*/
+static bool replaceBufferRange(OpaqueGeometryObject & obj, unsigned int objectID, const ObjectBufferData & data) {
+	std::map<unsigned int, OpaqueGeometryObject::BufferRange>::const_iterator it = obj.m_bufferRanges.find(objectID);
+	if (it == obj.m_bufferRanges.end())
+		return false;
+	const OpaqueGeometryObject::BufferRange & r = it->second;
+	if (data.m_vertexBufferData.size() != r.m_vertexCount || data.m_indexBufferData.size() != r.m_elementCount)
+		return false;
+	std::copy(data.m_vertexBufferData.begin(), data.m_vertexBufferData.end(), obj.m_vertexBufferData.begin() + r.m_vertexStart);
+	std::copy(data.m_colorBufferData.begin(), data.m_colorBufferData.end(), obj.m_colorBufferData.begin() + r.m_vertexStart);
+	// shift vertex indexes to start of buffer range, but keep primitive restart indexes of triangle strips
+	for (unsigned int i=0; i<r.m_elementCount; ++i) {
+		GLuint idx = data.m_indexBufferData[i];
+		obj.m_indexBufferData[r.m_elementStart + i] = (idx == VIC3D_STRIP_STOP_INDEX) ? idx : r.m_vertexStart + idx;
+	}
+	obj.m_modifiedRanges.push_back(r);
+	return true;
+}
+
+
 void Scene::generateBuildingGeometry() {
 	//	const SVViewState & vs = SVViewStateHandler::instance().viewState();
 	//	// when we show transparent building, we do not need to update the building geometry
@@ -1482,14 +1624,14 @@ void Scene::generateBuildingGeometry() {
 
 	// clear out existing cache
 
+	// Note: clear() keeps the capacity of the buffers, so memory is only re-allocated when the geometry grows
 	m_buildingGeometryObject.m_vertexBufferData.clear();
 	m_buildingGeometryObject.m_colorBufferData.clear();
 	m_buildingGeometryObject.m_indexBufferData.clear();
 	m_buildingGeometryObject.m_vertexStartMap.clear();
-
-	m_buildingGeometryObject.m_vertexBufferData.reserve(100000);
-	m_buildingGeometryObject.m_colorBufferData.reserve(100000);
-	m_buildingGeometryObject.m_indexBufferData.reserve(100000);
+	m_buildingGeometryObject.m_bufferRanges.clear();
+	m_buildingGeometryObject.m_modifiedRanges.clear();
+	m_transparentSubSurfaceIDs.clear();
 
 	// we want to draw triangles
 	m_buildingGeometryObject.m_drawTriangleStrips = false;
@@ -1514,6 +1656,8 @@ void Scene::generateBuildingGeometry() {
 
 					// remember where the vertexes for this surface start in the buffer
 					m_buildingGeometryObject.m_vertexStartMap[s.m_id] = currentVertexIndex;
+					unsigned int vertexStart = currentVertexIndex;
+					unsigned int elementStart = currentElementIndex;
 
 					// now we store the surface data into the vertex/color and index buffers
 					// the indexes are advanced and the buffers enlarged as needed.
@@ -1522,31 +1666,30 @@ void Scene::generateBuildingGeometry() {
 							   m_buildingGeometryObject.m_vertexBufferData,
 							   m_buildingGeometryObject.m_colorBufferData,
 							   m_buildingGeometryObject.m_indexBufferData);
+					// remember buffer ranges of surface (including child surfaces) for in-place updates
+					m_buildingGeometryObject.m_bufferRanges[s.m_id] = OpaqueGeometryObject::BufferRange(
+								vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
 
 					// process all subsurfaces, add opaque surfaces but remember transparent surfaces for later
 					for (unsigned int i=0; i<s.subSurfaces().size(); ++i) {
 						const VICUS::SubSurface & sub = s.subSurfaces()[i];
-						if (sub.m_subSurfaceComponentInstance != nullptr &&
-								sub.m_subSurfaceComponentInstance->m_idSubSurfaceComponent != VICUS::INVALID_ID)
-						{
-							// lookup subsurface component - if it exists
-							const VICUS::SubSurfaceComponent * comp = db.m_subSurfaceComponents[sub.m_subSurfaceComponentInstance->m_idSubSurfaceComponent];
-							if (comp != nullptr) {
-								// now select transparent or opaque surface based on type
-								if (comp->m_type == VICUS::SubSurfaceComponent::CT_Window) {
-									// only add to transparent subsurfaces if visible and not selected
-									if (sub.m_visible && !sub.m_selected && !s.geometry().holeTriangulationData().empty())
-										transparentSubsurfaces.push_back(std::make_pair(&sub, &s.geometry().holeTriangulationData()[i]) );
-									continue; // next surface
-								}
-							}
+						if (isTransparentSubSurface(sub, db)) {
+							// Note: invisible and selected windows are added as well (but not drawn, see
+							//       transparentSubSurfaceColor()), so that changing the selection does not change the buffer layout
+							if (!s.geometry().holeTriangulationData().empty())
+								transparentSubsurfaces.push_back(std::make_pair(&sub, &s.geometry().holeTriangulationData()[i]) );
+							continue; // next surface
 						}
 
 						// not a transparent surface, just add surface as opaque surface
+						vertexStart = currentVertexIndex;
+						elementStart = currentElementIndex;
 						addSubSurface(s, i, currentVertexIndex, currentElementIndex,
 									  m_buildingGeometryObject.m_vertexBufferData,
 									  m_buildingGeometryObject.m_colorBufferData,
 									  m_buildingGeometryObject.m_indexBufferData);
+						m_buildingGeometryObject.m_bufferRanges[sub.m_id] = OpaqueGeometryObject::BufferRange(
+									vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
 					}
 				}
 			}
@@ -1558,6 +1701,8 @@ void Scene::generateBuildingGeometry() {
 
 		// remember where the vertexes for this surface start in the buffer
 		m_buildingGeometryObject.m_vertexStartMap[s.m_id] = currentVertexIndex;
+		unsigned int vertexStart = currentVertexIndex;
+		unsigned int elementStart = currentElementIndex;
 
 		// now we store the surface data into the vertex/color and index buffers
 		// the indexes are advanced and the buffers enlarged as needed.
@@ -1566,6 +1711,8 @@ void Scene::generateBuildingGeometry() {
 				   m_buildingGeometryObject.m_vertexBufferData,
 				   m_buildingGeometryObject.m_colorBufferData,
 				   m_buildingGeometryObject.m_indexBufferData);
+		m_buildingGeometryObject.m_bufferRanges[s.m_id] = OpaqueGeometryObject::BufferRange(
+					vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
 	}
 
 	// done with all opaque planes, remember start index for transparent geometry
@@ -1573,17 +1720,22 @@ void Scene::generateBuildingGeometry() {
 
 	// now add all transparent surfaces
 	for (std::pair<const VICUS::SubSurface *, const VICUS::PlaneTriangulationData*> & p : transparentSubsurfaces) {
-		QColor col = p.first->m_color;
+		QColor col = transparentSubSurfaceColor(*p.first);
 
 		const VICUS::PlaneTriangulationData* triangu = dynamic_cast<const VICUS::PlaneTriangulationData*>(p.second);
 
 		if(triangu == nullptr)
 			continue;
 
+		unsigned int vertexStart = currentVertexIndex;
+		unsigned int elementStart = currentElementIndex;
 		addPlane(*triangu, col, currentVertexIndex, currentElementIndex,
 				 m_buildingGeometryObject.m_vertexBufferData,
 				 m_buildingGeometryObject.m_colorBufferData,
 				 m_buildingGeometryObject.m_indexBufferData, false);
+		m_buildingGeometryObject.m_bufferRanges[p.first->m_id] = OpaqueGeometryObject::BufferRange(
+					vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
+		m_transparentSubSurfaceIDs.insert(p.first->m_id);
 	}
 
 	if (t.elapsed() > 20)
@@ -1592,6 +1744,66 @@ void Scene::generateBuildingGeometry() {
 
 
 
+bool Scene::updateBuildingObjects(const std::vector<unsigned int> & objectIDs) {
+	const VICUS::Project & p = project();
+	const SVDatabase & db = SVSettings::instance().m_db;
+
+	// collect top-level surfaces (child surfaces are stored in the buffer range of their parent) and sub-surfaces
+	std::set<const VICUS::Surface *> surfaces;
+	std::set<const VICUS::SubSurface *> subSurfaces;
+	for (unsigned int id : objectIDs) {
+		const VICUS::Object * o = p.objectById(id);
+		if (const VICUS::Surface * s = dynamic_cast<const VICUS::Surface *>(o)) {
+			while (const VICUS::Surface * parent = dynamic_cast<const VICUS::Surface *>(s->m_parent))
+				s = parent;
+			surfaces.insert(s);
+			// sub-surface geometry depends on surface geometry
+			for (const VICUS::SubSurface & sub : s->subSurfaces())
+				subSurfaces.insert(&sub);
+		}
+		else if (const VICUS::SubSurface * sub = dynamic_cast<const VICUS::SubSurface *>(o))
+			subSurfaces.insert(sub);
+		// other objects (rooms, buildings, ...) do not have geometry
+	}
+
+	ObjectBufferData data;
+	for (const VICUS::Surface * s : surfaces) {
+		data.clear();
+		addSurface(*s, data.m_vertexIndex, data.m_elementIndex,
+				   data.m_vertexBufferData, data.m_colorBufferData, data.m_indexBufferData);
+		if (!replaceBufferRange(m_buildingGeometryObject, s->m_id, data))
+			return false;
+	}
+
+	for (const VICUS::SubSurface * sub : subSurfaces) {
+		const VICUS::Surface * s = dynamic_cast<const VICUS::Surface *>(sub->m_parent);
+		if (s == nullptr)
+			return false;
+		unsigned int i = (unsigned int)(sub - s->subSurfaces().data());
+		bool transparent = isTransparentSubSurface(*sub, db);
+		// sub-surface must still be in the same part of the buffer
+		if (transparent != (m_transparentSubSurfaceIDs.find(sub->m_id) != m_transparentSubSurfaceIDs.end()))
+			return false;
+		data.clear();
+		if (transparent) {
+			// windows without triangulation data are not in the buffer
+			if (s->geometry().holeTriangulationData().empty())
+				return false;
+			addPlane(s->geometry().holeTriangulationData()[i], transparentSubSurfaceColor(*sub),
+					 data.m_vertexIndex, data.m_elementIndex,
+					 data.m_vertexBufferData, data.m_colorBufferData, data.m_indexBufferData, false);
+		}
+		else {
+			addSubSurface(*s, i, data.m_vertexIndex, data.m_elementIndex,
+						  data.m_vertexBufferData, data.m_colorBufferData, data.m_indexBufferData);
+		}
+		if (!replaceBufferRange(m_buildingGeometryObject, sub->m_id, data))
+			return false;
+	}
+	return true;
+}
+
+
 void Scene::generateTransparentBuildingGeometry(const HighlightingMode &mode) {
 	FUNCID(Scene::generateTransparentBuildingGeometry);
 
@@ -1834,14 +2046,13 @@ void Scene::generateNetworkGeometry() {
 
 	// clear out existing cache
 
+	// Note: clear() keeps the capacity of the buffers, so memory is only re-allocated when the geometry grows
 	m_networkGeometryObject.m_vertexBufferData.clear();
 	m_networkGeometryObject.m_colorBufferData.clear();
 	m_networkGeometryObject.m_indexBufferData.clear();
 	m_networkGeometryObject.m_vertexStartMap.clear();
-
-	m_networkGeometryObject.m_vertexBufferData.reserve(100000);
-	m_networkGeometryObject.m_colorBufferData.reserve(100000);
-	m_networkGeometryObject.m_indexBufferData.reserve(100000);
+	m_networkGeometryObject.m_bufferRanges.clear();
+	m_networkGeometryObject.m_modifiedRanges.clear();
 
 	// process all network elements
 
@@ -1862,32 +2073,28 @@ void Scene::generateNetworkGeometry() {
 		const_cast<VICUS::Network &>(network).updateVisualizationRadius(db.m_pipes);
 
 		for (const VICUS::NetworkEdge & e : network.m_edges) {
-			double radius = e.m_visualizationRadius;
-			QColor pipeColor = e.m_color;
-			if (!e.m_visible || e.m_selected)
-				pipeColor.setAlpha(0);
-
 			m_networkGeometryObject.m_vertexStartMap[e.m_id] = currentVertexIndex;
-			addCylinder(e.m_node1->m_position, e.m_node2->m_position, pipeColor, radius,
-						currentVertexIndex, currentElementIndex,
-						m_networkGeometryObject.m_vertexBufferData,
-						m_networkGeometryObject.m_colorBufferData,
-						m_networkGeometryObject.m_indexBufferData);
+			unsigned int vertexStart = currentVertexIndex;
+			unsigned int elementStart = currentElementIndex;
+			addNetworkEdge(e, currentVertexIndex, currentElementIndex,
+						   m_networkGeometryObject.m_vertexBufferData,
+						   m_networkGeometryObject.m_colorBufferData,
+						   m_networkGeometryObject.m_indexBufferData);
+			m_networkGeometryObject.m_bufferRanges[e.m_id] = OpaqueGeometryObject::BufferRange(
+						vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
 		}
 
 		// add spheres for nodes
 		for (const VICUS::NetworkNode & no : network.m_nodes) {
-			double radius = no.m_visualizationRadius;
-			QColor col = no.m_color;
-			if (!no.m_visible || !network.m_visible)
-				col.setAlpha(0);
-
 			m_networkGeometryObject.m_vertexStartMap[no.m_id] = currentVertexIndex;
-			addSphere(no.m_position, col, radius,
-					  currentVertexIndex, currentElementIndex,
-					  m_networkGeometryObject.m_vertexBufferData,
-					  m_networkGeometryObject.m_colorBufferData,
-					  m_networkGeometryObject.m_indexBufferData);
+			unsigned int vertexStart = currentVertexIndex;
+			unsigned int elementStart = currentElementIndex;
+			addNetworkNode(no, network, currentVertexIndex, currentElementIndex,
+						   m_networkGeometryObject.m_vertexBufferData,
+						   m_networkGeometryObject.m_colorBufferData,
+						   m_networkGeometryObject.m_indexBufferData);
+			m_networkGeometryObject.m_bufferRanges[no.m_id] = OpaqueGeometryObject::BufferRange(
+						vertexStart, currentVertexIndex - vertexStart, elementStart, currentElementIndex - elementStart);
 		}
 	}
 
@@ -1898,6 +2105,58 @@ void Scene::generateNetworkGeometry() {
 		qDebug() << t.elapsed() << "ms for network generation";
 }
 
+bool Scene::updateNetworkObjects(const std::vector<unsigned int> & objectIDs) {
+	const VICUS::Project & p = project();
+
+	// collect modified edges and nodes
+	std::set<const VICUS::NetworkEdge *> edges;
+	std::set<const VICUS::NetworkNode *> nodes;
+	for (unsigned int id : objectIDs) {
+		const VICUS::Object * o = p.objectById(id);
+		if (const VICUS::NetworkEdge * e = dynamic_cast<const VICUS::NetworkEdge *>(o))
+			edges.insert(e);
+		else if (const VICUS::NetworkNode * no = dynamic_cast<const VICUS::NetworkNode *>(o))
+			nodes.insert(no);
+		else if (const VICUS::Network * n = dynamic_cast<const VICUS::Network *>(o)) {
+			// node colors depend on network visibility
+			for (const VICUS::NetworkNode & no : n->m_nodes)
+				nodes.insert(&no);
+		}
+	}
+
+	ObjectBufferData data;
+	for (const VICUS::NetworkEdge * e : edges) {
+		const VICUS::Network * network = dynamic_cast<const VICUS::Network *>(e->m_parent);
+		if (network == nullptr || e->m_node1 == nullptr || e->m_node2 == nullptr)
+			return false;
+		// skip edges of networks that are not shown
+		if (SVViewStateHandler::instance().viewState().m_showActiveNetworkOnly &&
+			p.m_activeNetworkId != network->m_id)
+			continue;
+		data.clear();
+		addNetworkEdge(*e, data.m_vertexIndex, data.m_elementIndex,
+					   data.m_vertexBufferData, data.m_colorBufferData, data.m_indexBufferData);
+		if (!replaceBufferRange(m_networkGeometryObject, e->m_id, data))
+			return false;
+	}
+
+	for (const VICUS::NetworkNode * no : nodes) {
+		const VICUS::Network * network = dynamic_cast<const VICUS::Network *>(no->m_parent);
+		if (network == nullptr)
+			return false;
+		if (SVViewStateHandler::instance().viewState().m_showActiveNetworkOnly &&
+			p.m_activeNetworkId != network->m_id)
+			continue;
+		data.clear();
+		addNetworkNode(*no, *network, data.m_vertexIndex, data.m_elementIndex,
+					   data.m_vertexBufferData, data.m_colorBufferData, data.m_indexBufferData);
+		if (!replaceBufferRange(m_networkGeometryObject, no->m_id, data))
+			return false;
+	}
+	return true;
+}
+
+
 const QColor objectColor(const VICUS::Drawing::AbstractDrawingObject &obj) {
 	const VICUS::DrawingLayer *layer = obj.m_layerRef;
 
@@ -2845,136 +3104,143 @@ void Scene::pick(PickObject & pickObject) {
 	// now process all surfaces and update p to hold the closest hit
 	const VICUS::Project & prj = project();
 
-
-	// *** surfaces of buildings ***
-
-	for (const VICUS::Building & b : prj.m_buildings) {
-		for (const VICUS::BuildingLevel & bl : b.m_buildingLevels) {
-			for (const VICUS::Room & r : bl.m_rooms) {
-				for (const VICUS::Surface & s : r.m_surfaces) {
-					// skip invisible or inactive surfaces
-					//					if (!s.m_visible)
-					//						continue;
-					IBKMK::Vector3D intersectionPoint;
-					double dist;
-					// check if we hit the surface - since we show the surface from both sides, we
-					// can also pick both sides
-					int holeIndex;
-					if (s.geometry().intersectsLine(nearPoint, direction, intersectionPoint, dist, holeIndex, true)) {
-						// if there is no whole in the surface, we only require that the surface is visible - otherwise
-						// ignore the click
-						if (holeIndex == -1 && !s.m_visible)
-							continue; // skip
-
-						// we may have a click...
-						PickObject::PickResult r;
-						r.m_resultType = PickObject::RT_Object;
-						r.m_depth = dist;
-						r.m_pickPoint = intersectionPoint;
-						r.m_holeIdx = holeIndex;
-
-						// if we have hole, check if we did click on it
-						if (holeIndex != -1) {
-							const VICUS::Object *obj = nullptr;
-							obj = SVProjectHandler::instance().project().objectById(s.geometry().holes()[(unsigned int)holeIndex].m_idObject);
-							if (obj == nullptr) {// guard against dangling IDs
-								// Note: cannot use an assert/exception here, as hole ID is user-data from potentially corrupt data file
-								//								(IBK::FormatString("Invalid hole ID #%1 in surface #%2")
-								continue;
-							}
-
-							// hole must be visible to be checked
-							if (!obj->m_visible)
-								continue;
-							r.m_objectID = obj->m_id;
-						}
-						else {
-							r.m_objectID = s.m_id;
+	// only test objects whose bounding boxes are hit by the line-of-sight
+	m_pickBVH.update(prj);
+	m_pickBVH.collectCandidates(nearPoint, direction, m_pickCandidates);
+
+	for (const PickBVH::Item * item : m_pickCandidates) {
+		switch (item->m_type) {
+
+			// *** surfaces of buildings ***
+
+			case PickBVH::IT_RoomSurface : {
+				const VICUS::Surface & s = *item->m_surface;
+				// skip invisible or inactive surfaces
+				//					if (!s.m_visible)
+				//						continue;
+				IBKMK::Vector3D intersectionPoint;
+				double dist;
+				// check if we hit the surface - since we show the surface from both sides, we
+				// can also pick both sides
+				int holeIndex;
+				if (s.geometry().intersectsLine(nearPoint, direction, intersectionPoint, dist, holeIndex, true)) {
+					// if there is no whole in the surface, we only require that the surface is visible - otherwise
+					// ignore the click
+					if (holeIndex == -1 && !s.m_visible)
+						continue; // skip
+
+					// we may have a click...
+					PickObject::PickResult r;
+					r.m_resultType = PickObject::RT_Object;
+					r.m_depth = dist;
+					r.m_pickPoint = intersectionPoint;
+					r.m_holeIdx = holeIndex;
+
+					// if we have hole, check if we did click on it
+					if (holeIndex != -1) {
+						const VICUS::Object *obj = nullptr;
+						obj = SVProjectHandler::instance().project().objectById(s.geometry().holes()[(unsigned int)holeIndex].m_idObject);
+						if (obj == nullptr) {// guard against dangling IDs
+							// Note: cannot use an assert/exception here, as hole ID is user-data from potentially corrupt data file
+							//								(IBK::FormatString("Invalid hole ID #%1 in surface #%2")
+							continue;
 						}
-						// register click candidate
-						pickObject.m_candidates.push_back(r);
+
+						// hole must be visible to be checked
+						if (!obj->m_visible)
+							continue;
+						r.m_objectID = obj->m_id;
+					}
+					else {
+						r.m_objectID = s.m_id;
 					}
+					// register click candidate
+					pickObject.m_candidates.push_back(r);
 				}
-			}
-		}
-	}
+			} break;
 
 
-	// *** now try plain geometry ***
+			// *** now try plain geometry ***
 
-	for (const VICUS::Surface & s : prj.m_plainGeometry.m_surfaces) {
-		// skip invisible or inactive surfaces
-		if (!s.m_visible)
-			continue;
-		IBKMK::Vector3D intersectionPoint;
-		double dist;
-		// dump geometry is rendered front/back facing and also picked from both sides
-		int holeIndex;
-		if (s.geometry().intersectsLine(nearPoint, direction, intersectionPoint, dist, holeIndex, true)) {
-			PickObject::PickResult r;
-			r.m_resultType = PickObject::RT_Object;
-			r.m_depth = dist;
-			r.m_pickPoint = intersectionPoint;
-			// TODO : Dirk, can "dump geometry" contain sub-surfaces?
-			r.m_objectID = s.m_id;
-			pickObject.m_candidates.push_back(r);
-		}
-	}
+			case PickBVH::IT_PlainSurface : {
+				const VICUS::Surface & s = *item->m_surface;
+				// skip invisible or inactive surfaces
+				if (!s.m_visible)
+					continue;
+				IBKMK::Vector3D intersectionPoint;
+				double dist;
+				// dump geometry is rendered front/back facing and also picked from both sides
+				int holeIndex;
+				if (s.geometry().intersectsLine(nearPoint, direction, intersectionPoint, dist, holeIndex, true)) {
+					PickObject::PickResult r;
+					r.m_resultType = PickObject::RT_Object;
+					r.m_depth = dist;
+					r.m_pickPoint = intersectionPoint;
+					// TODO : Dirk, can "dump geometry" contain sub-surfaces?
+					r.m_objectID = s.m_id;
+					pickObject.m_candidates.push_back(r);
+				}
+			} break;
 
 
-	// *** process all networks ***
+			// *** network nodes ***
 
-	for (const VICUS::Network & n : prj.m_geometricNetworks) {
+			case PickBVH::IT_NetworkNode : {
+				const VICUS::NetworkNode & no = *item->m_node;
 
-		// process all nodes
-		for (const VICUS::NetworkNode & no : n.m_nodes) {
+				// skip invisible nodes
+				if (!no.m_visible)
+					continue;
 
-			// skip invisible nodes
-			if (!no.m_visible)
-				continue;
+				// compute closest distance between nodal center point and line
+				double dist;
+				IBKMK::Vector3D closestPoint;
+				double linePointDist = IBKMK::lineToPointDistance(nearPoint, direction, no.m_position, dist, closestPoint);
+				// check distance against radius of sphere
+				if (linePointDist < no.m_visualizationRadius) {
+					PickObject::PickResult r;
+					r.m_resultType = PickObject::RT_Object;
+					r.m_depth = dist; // the depth to the point on the line-of-sight that is closest to the sphere's center point
+					r.m_pickPoint = closestPoint; // this
+					r.m_objectID = no.m_id;
+					pickObject.m_candidates.push_back(r);
+				}
+			} break;
 
-			// compute closest distance between nodal center point and line
-			double dist;
-			IBKMK::Vector3D closestPoint;
-			double linePointDist = IBKMK::lineToPointDistance(nearPoint, direction, no.m_position, dist, closestPoint);
-			// check distance against radius of sphere
-			if (linePointDist < no.m_visualizationRadius) {
-				PickObject::PickResult r;
-				r.m_resultType = PickObject::RT_Object;
-				r.m_depth = dist; // the depth to the point on the line-of-sight that is closest to the sphere's center point
-				r.m_pickPoint = closestPoint; // this
-				r.m_objectID = no.m_id;
-				pickObject.m_candidates.push_back(r);
-			}
-		}
 
-		// process all edges
-		for (const VICUS::NetworkEdge & e : n.m_edges) {
+			// *** network edges ***
 
-			// skip invisible nodes
-			if (!e.m_visible)
-				continue;
+			case PickBVH::IT_NetworkEdge : {
+				const VICUS::NetworkEdge & e = *item->m_edge;
 
-			// compute closest distance between nodal center point and line
-			double dist;
-			IBKMK::Vector3D closestPoint;
-			double lineFactor;
-			double line2LineDistance = IBKMK::lineToLineDistance(nearPoint, direction,
-																 e.m_node1->m_position, e.m_node2->m_position - e.m_node1->m_position,
-																 dist, closestPoint, lineFactor);
-			// check distance against cylinder radius
-			if (line2LineDistance < e.m_visualizationRadius && lineFactor >= 0 && lineFactor <= 1) {
-				PickObject::PickResult r;
-				r.m_resultType = PickObject::RT_Object;
-				r.m_depth = 9999; // ToDo Hauke: Improve hack, currently used to prevent picking of edges
-				r.m_pickPoint = closestPoint;
-				r.m_objectID = e.m_id;
-				pickObject.m_candidates.push_back(r);
-			}
+				// skip invisible nodes
+				if (!e.m_visible)
+					continue;
+
+				// compute closest distance between nodal center point and line
+				double dist;
+				IBKMK::Vector3D closestPoint;
+				double lineFactor;
+				double line2LineDistance = IBKMK::lineToLineDistance(nearPoint, direction,
+																	 e.m_node1->m_position, e.m_node2->m_position - e.m_node1->m_position,
+																	 dist, closestPoint, lineFactor);
+				// check distance against cylinder radius
+				if (line2LineDistance < e.m_visualizationRadius && lineFactor >= 0 && lineFactor <= 1) {
+					PickObject::PickResult r;
+					r.m_resultType = PickObject::RT_Object;
+					r.m_depth = 9999; // ToDo Hauke: Improve hack, currently used to prevent picking of edges
+					r.m_pickPoint = closestPoint;
+					r.m_objectID = e.m_id;
+					pickObject.m_candidates.push_back(r);
+				}
+			} break;
+
+			// drawing points are handled in pickDrawings()
+			case PickBVH::IT_DrawingPoint : break;
 		}
 	}
 
-	pickDrawings(pickObject, nearPoint, farPoint, direction);
+	pickDrawings(pickObject, nearPoint, farPoint, direction, m_pickCandidates);
 
 	// *** local coordinate system pick points ***
 
@@ -3022,58 +3288,52 @@ void Scene::pick(PickObject & pickObject) {
 void Scene::pickDrawings(PickObject &pickObject,
 						 const IBKMK::Vector3D &nearPoint,
 						 const IBKMK::Vector3D &/*farPoint*/,
-						 const IBKMK::Vector3D &direction) {
-
-	for (const VICUS::Drawing & d : project().m_drawings) {
-		const std::map<unsigned int, std::vector<IBKMK::Vector3D>> &points3D = d.pickPoints();
-
-		for (std::map<unsigned int, std::vector<IBKMK::Vector3D>>::const_iterator it = points3D.begin();
-			 it != points3D.end(); ++it) {
-
-			unsigned int id = it->first;
-			const std::vector<IBKMK::Vector3D> &points = it->second;
-
-			const VICUS::Drawing::AbstractDrawingObject &object = *d.objectByID(it->first);
-
-			for (unsigned int j=0; j<points.size(); ++j) {
-				const IBKMK::Vector3D &v  = points[j];
-				const IBKMK::Vector3D &vB = points[((int)j - 1) % points.size()];
-
-				double depth = 0., depth2 = 0., dist = 0., dist2 = 0., lineFactor;
-				IBKMK::Vector3D closestPoint, closestPoint2;
-
-				/// If a line should be traced, it is handled here.
-				/// But it is costing performance and so it is right now not handled
-				if (PICK_LINE) {
-					dist2 = IBKMK::lineToLineDistance(nearPoint, direction, v,
-													  vB - v, depth2, closestPoint2, lineFactor);
-
-					// check distance to line
-					if (dist2 < SNAP_DRAWING_DISTANCES_THRESHHOLD &&
-							lineFactor > 0.0 && lineFactor < 1.0) {
-						PickObject::PickResult r;
-						r.m_resultType = PickObject::RT_Object;
-						r.m_depth = depth2; // the depth to the point on the line-of-sight that is closest to the point
-						r.m_pickPoint = closestPoint2; // this
-						r.m_objectID = object.m_layerRef->m_id;
-						r.m_drawingID = id;
-						pickObject.m_candidates.push_back(r);
-					}
-				}
+						 const IBKMK::Vector3D &direction,
+						 const std::vector<const PickBVH::Item*> & candidates) {
 
-				// check distance against radius of sphere
-				dist = IBKMK::lineToPointDistance(nearPoint, direction, v, depth, closestPoint);
-				if (dist < SNAP_DRAWING_DISTANCES_THRESHHOLD) {
-					PickObject::PickResult r;
-					r.m_resultType = PickObject::RT_Object;
-					r.m_depth = depth; // the depth to the point on the line-of-sight that is closest to the point
-					r.m_pickPoint = closestPoint; // this
-					r.m_objectID = object.m_layerRef->m_id;
-					r.m_drawingID = id;
-					pickObject.m_candidates.push_back(r);
-				}
+	for (const PickBVH::Item * item : candidates) {
+		if (item->m_type != PickBVH::IT_DrawingPoint)
+			continue;
+
+		unsigned int id = item->m_drawingObjectID;
+		const VICUS::Drawing::AbstractDrawingObject &object = *item->m_drawing->objectByID(id);
+
+		const IBKMK::Vector3D &v  = item->m_point;
+		const IBKMK::Vector3D &vB = item->m_previousPoint;
+
+		double depth = 0., depth2 = 0., dist = 0., dist2 = 0., lineFactor;
+		IBKMK::Vector3D closestPoint, closestPoint2;
+
+		/// If a line should be traced, it is handled here.
+		/// But it is costing performance and so it is right now not handled
+		if (PICK_LINE) {
+			dist2 = IBKMK::lineToLineDistance(nearPoint, direction, v,
+											  vB - v, depth2, closestPoint2, lineFactor);
+
+			// check distance to line
+			if (dist2 < SNAP_DRAWING_DISTANCES_THRESHHOLD &&
+					lineFactor > 0.0 && lineFactor < 1.0) {
+				PickObject::PickResult r;
+				r.m_resultType = PickObject::RT_Object;
+				r.m_depth = depth2; // the depth to the point on the line-of-sight that is closest to the point
+				r.m_pickPoint = closestPoint2; // this
+				r.m_objectID = object.m_layerRef->m_id;
+				r.m_drawingID = id;
+				pickObject.m_candidates.push_back(r);
 			}
 		}
+
+		// check distance against radius of sphere
+		dist = IBKMK::lineToPointDistance(nearPoint, direction, v, depth, closestPoint);
+		if (dist < SNAP_DRAWING_DISTANCES_THRESHHOLD) {
+			PickObject::PickResult r;
+			r.m_resultType = PickObject::RT_Object;
+			r.m_depth = depth; // the depth to the point on the line-of-sight that is closest to the point
+			r.m_pickPoint = closestPoint; // this
+			r.m_objectID = object.m_layerRef->m_id;
+			r.m_drawingID = id;
+			pickObject.m_candidates.push_back(r);
+		}
 	}
 }
 
@@ -27,6 +27,7 @@
 #define Vic3DSceneH
 
 #include <vector>
+#include <set>
 
 #include <QRect>
 #include <QVector3D>
@@ -48,6 +49,7 @@
 #include "Vic3DNewSubSurfaceObject.h"
 #include "Vic3DSurfaceNormalsObject.h"
 #include "Vic3DPickObject.h"
+#include "Vic3DPickBVH.h"
 #include "Vic3DMeasurementObject.h"
 #include "Vic3DRubberbandObject.h"
 
@@ -167,6 +169,19 @@ private:
 	void generateTransparentBuildingGeometry(const HighlightingMode &mode = HighlightingMode::HM_TransparentWithBoxes);
 	void generateNetworkGeometry();
 
+	/*! Regenerates buffer data of the surfaces and sub-surfaces with the given IDs in place and marks the
+		modified buffer ranges in m_buildingGeometryObject. Other IDs are ignored.
+		Sub-surfaces of modified surfaces are regenerated as well, child surfaces are regenerated with their parent surface.
+		\return Returns false, if the layout of the buffers has changed (different number of vertexes, changed window
+				assignment, ...) and generateBuildingGeometry() must be called instead.
+	*/
+	bool updateBuildingObjects(const std::vector<unsigned int> & objectIDs);
+	/*! Regenerates buffer data of the network edges and nodes with the given IDs in place and marks the
+		modified buffer ranges in m_networkGeometryObject. For network IDs all nodes of the network are regenerated.
+		\return Returns false, if the layout of the buffers has changed and generateNetworkGeometry() must be called instead.
+	*/
+	bool updateNetworkObjects(const std::vector<unsigned int> & objectIDs);
+
 	void generate2DDrawingGeometry();
 
 	/*! Processes all surfaces and assigns colors based on current object color mode. */
@@ -178,9 +193,12 @@ private:
 	*/
 	void pick(PickObject & pickObject);
 
-	/*! Pick drawing points. */
+	/*! Pick drawing points.
+		\param candidates Pick candidates of the bounding volume hierarchy, only drawing points are processed.
+	*/
 	void pickDrawings(PickObject & pickObject, const IBKMK::Vector3D &nearPoint,
-					  const IBKMK::Vector3D &farPoint, const IBKMK::Vector3D &direction);
+					  const IBKMK::Vector3D &farPoint, const IBKMK::Vector3D &direction,
+					  const std::vector<const PickBVH::Item*> & candidates);
 
 	/*! Pick all block depening drawing points. */
 	void pickBlockDrawings(PickObject &pickObject, const VICUS::Drawing &d, const std::vector<VICUS::Drawing::Insert> &inserts,
@@ -310,6 +328,14 @@ private:
 	/*! Cached surface colors. */
 	std::map<unsigned int, QColor> m_surfaceColor;
 
+	/*! IDs of sub-surfaces in the transparent part of m_buildingGeometryObject (windows), updated in generateBuildingGeometry(). */
+	std::set<unsigned int>	m_transparentSubSurfaceIDs;
+
+	/*! Bounding volume hierarchies of all pickable objects, updated in pick() for categories modified in onModified(). */
+	PickBVH					m_pickBVH;
+	/*! Cache for pick candidates of the bounding volume hierarchies, used in pick(). */
+	std::vector<const PickBVH::Item*>	m_pickCandidates;
+
 	// *** Navigation stuff ***
 
 	/*! Struct for exclusive navigation modes.
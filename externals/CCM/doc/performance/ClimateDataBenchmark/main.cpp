@@ -0,0 +1,128 @@
+/*	Throughput benchmark for CCM::ClimateDataLoader::setTime().
+
+	Compares the evaluation of hourly climate data (equidistant, no time points) with 10-minute data
+	(custom time points). Time points are passed like by an integrator, mostly small forward steps with
+	occasional steps back in time (failed integration steps). Interpolated temperatures of the 10-minute data
+	are checked against a straight-forward lookup with std::lower_bound (must be identical).
+
+	Usage: ClimateDataBenchmark [climate data file] [number of years]
+
+	Without climate data file, synthetic hourly data is generated.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <IBK_StopWatch.h>
+#include <IBK_Path.h>
+
+#include <CCM_ClimateDataLoader.h>
+#include <CCM_Constants.h>
+
+/*! Returns interpolated value from data at time points tp, same rules as in ClimateDataLoader::setTime(). */
+double referenceValue(const std::vector<double> & tp, const std::vector<double> & data, double t) {
+	std::vector<double>::const_iterator it = std::lower_bound(tp.begin(), tp.end(), t);
+	if (it == tp.begin())
+		return data.front();
+	if (it == tp.end())
+		return data.back();
+	unsigned int i2 = (unsigned int)(it - tp.begin());
+	unsigned int i1 = i2 - 1;
+	double alpha = 1 - (t - tp[i1])/(tp[i2] - tp[i1]);
+	return data[i1]*alpha + data[i2]*(1-alpha);
+}
+
+
+int main(int argc, char * argv[]) {
+	const unsigned int SECONDS_PER_YEAR = 365*24*3600;
+
+	CCM::ClimateDataLoader hourly;
+	if (argc > 1) {
+		try {
+			hourly.readClimateData(IBK::Path(argv[1]));
+		}
+		catch (IBK::Exception & ex) {
+			ex.writeMsgStackToError();
+			return EXIT_FAILURE;
+		}
+		if (!hourly.m_dataTimePoints.empty()) {
+			std::cerr << "Climate data file must contain hourly data." << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	else {
+		hourly.initDataWithDefault();
+		for (unsigned int i=0; i<8760; ++i) {
+			double day = i/24.0;
+			hourly.m_data[CCM::ClimateDataLoader::Temperature][i] = 10 - 10*std::cos(2*3.14159265358979*day/365)
+					- 5*std::cos(2*3.14159265358979*day);
+			hourly.m_data[CCM::ClimateDataLoader::RelativeHumidity][i] = 70 + 20*std::cos(2*3.14159265358979*day);
+		}
+	}
+	unsigned int years = 1;
+	if (argc > 2)
+		years = (unsigned int)std::atoi(argv[2]);
+
+	// generate 10-minute data by sampling hourly data
+	CCM::ClimateDataLoader tenMinutes;
+	for (unsigned int t=0; t<SECONDS_PER_YEAR; t += 600)
+		tenMinutes.m_dataTimePoints.push_back(t);
+	tenMinutes.initDataWithDefault();
+	for (unsigned int i=0; i<tenMinutes.m_dataTimePoints.size(); ++i) {
+		hourly.setTime(2019, tenMinutes.m_dataTimePoints[i]);
+		for (unsigned int c=0; c<CCM::ClimateDataLoader::NumClimateComponents; ++c)
+			tenMinutes.m_data[c][i] = hourly.m_currentData[c];
+	}
+
+	// time points as passed by an integrator: steps between 10 s and 15 min, every 50th step is rejected and
+	// repeated with half the step size
+	std::vector<double> timePoints;
+	std::srand(42);
+	double t = 0;
+	while (t < years*(double)SECONDS_PER_YEAR) {
+		double dt = 10 + 890.0*std::rand()/RAND_MAX;
+		if (timePoints.size() % 50 == 49)
+			timePoints.push_back(t + dt);
+		t += dt*(timePoints.size() % 50 == 49 ? 0.5 : 1);
+		timePoints.push_back(t);
+	}
+	std::cout << "Time points: " << timePoints.size() << " (" << years << " year(s))" << std::endl;
+
+	IBK::StopWatch w;
+	double sum = 0;
+	for (double tp : timePoints) {
+		hourly.setTime(2019, tp);
+		sum += hourly.m_currentData[CCM::ClimateDataLoader::Temperature];
+	}
+	double tHourly = w.stop();
+
+	w.start();
+	for (double tp : timePoints) {
+		tenMinutes.setTime(2019, tp);
+		sum += tenMinutes.m_currentData[CCM::ClimateDataLoader::Temperature];
+	}
+	double tTenMinutes = w.stop();
+
+	// check against lookup with binary search
+	unsigned int differences = 0;
+	for (double tp : timePoints) {
+		tenMinutes.setTime(2019, tp);
+		double tCyclic = std::fmod(tp, (double)SECONDS_PER_YEAR);
+		double ref = referenceValue(tenMinutes.m_dataTimePoints, tenMinutes.m_data[CCM::ClimateDataLoader::Temperature], tCyclic);
+		if (ref != tenMinutes.m_currentData[CCM::ClimateDataLoader::Temperature])
+			++differences;
+	}
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Hourly data     " << std::setw(10) << tHourly << " ms  "
+			  << std::setprecision(1) << timePoints.size()/tHourly*1e-3 << " Mio. evaluations/s" << std::setprecision(3) << std::endl;
+	std::cout << "10-minute data  " << std::setw(10) << tTenMinutes << " ms  "
+			  << std::setprecision(1) << timePoints.size()/tTenMinutes*1e-3 << " Mio. evaluations/s" << std::endl;
+	std::cout << "Differences to binary search: " << differences << "  (checksum " << sum << ")" << std::endl;
+
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
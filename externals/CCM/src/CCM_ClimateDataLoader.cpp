@@ -602,6 +602,8 @@ void ClimateDataLoader::readClimateData(const IBK::Path & fname, bool headerOnly
 	catch (IBK::Exception & ex) {
 		throw IBK::Exception(ex, "Error reading climate data file.", FUNC_ID);
 	}
+	// analyse time points once, setTime() only checks whether time points have been modified afterwards
+	updateTimePointCache();
 }
 
 
@@ -1836,10 +1838,15 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 		if (m_dataTimePoints.size() != m_data[Temperature].size())
 			throw IBK::Exception("Mismatching sizes of time points vector and data vectors.", FUNC_ID);
 
-		std::string errmsg;
-		bool canBeUsedCyclic = checkForValidCyclicData(m_dataTimePoints, errmsg);
+		// check for cyclic data only when time points have been modified
+		if (m_dataTimePoints.size() != m_cachedTimePointCount ||
+			m_dataTimePoints.front() != m_cachedFirstTimePoint ||
+			m_dataTimePoints.back() != m_cachedLastTimePoint)
+		{
+			updateTimePointCache();
+		}
 
-		if(canBeUsedCyclic) {
+		if (m_cyclicTimePoints) {
 			// normalize to year
 			while (t >= SECONDS_PER_YEAR)
 				t -= (double)SECONDS_PER_YEAR;
@@ -1849,9 +1856,7 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 			// for each year that we differ from startYear, add appropriate number of seconds
 	//		double yearDiff = (double) SECONDS_PER_YEAR * year - m_startYear;
 			t += (double) SECONDS_PER_YEAR * (year - m_startYear);
-		}
 
-		if(!canBeUsedCyclic) {
 			// ensure, that time point is within interval spanned by m_dataTimePoints
 			if (t < m_dataTimePoints.front() || t > m_dataTimePoints.back())
 				throw IBK::Exception( IBK::FormatString("Time point out of range of time points vector (%1;%2), data available "
@@ -1863,22 +1868,35 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 									  .arg(year).arg(m_startYear), FUNC_ID);
 		}
 
-		// lookup t in m_dataTimePoints
-		std::vector<double>::const_iterator it = std::lower_bound(m_dataTimePoints.begin(), m_dataTimePoints.end(), t);
-		// it == m_dataTimePoints.begin() : t <= m_dataTimePoints[0]
-		// it == m_dataTimePoints.end() : t > m_dataTimePoints.back()
-		// it == m_dataTimePoints.begin()+1 : m_dataTimePoints[0] < t <= m_dataTimePoints[1]
-		if (it == m_dataTimePoints.begin()) {
+		// lookup t in m_dataTimePoints, i is the index of the first time point >= t (as with std::lower_bound):
+		// i == 0 : t <= m_dataTimePoints[0]
+		// i == n : t > m_dataTimePoints.back()
+		// i == 1 : m_dataTimePoints[0] < t <= m_dataTimePoints[1]
+		// we first check the interval of the last call and the following interval
+		unsigned int n = (unsigned int)m_dataTimePoints.size();
+		unsigned int i = m_timePointCursor;
+		if (i > n ||
+			(i < n && t > m_dataTimePoints[i]) ||
+			(i == n && t <= m_dataTimePoints.back()) ||
+			(i > 0 && m_dataTimePoints[i-1] >= t))
+		{
+			if (i < n && t > m_dataTimePoints[i] && (i+1 == n || t <= m_dataTimePoints[i+1]))
+				++i;
+			else
+				// 64bit -> 32bit cast, hope we don't have gigabytes of data... :-)
+				i = static_cast<unsigned int>(std::lower_bound(m_dataTimePoints.begin(), m_dataTimePoints.end(), t) - m_dataTimePoints.begin());
+			m_timePointCursor = i;
+		}
+		if (i == 0) {
 			hourIndex2 = hourIndex1 = 0;
 			alpha = 1;
 		}
-		else if (it == m_dataTimePoints.end()) {
-			hourIndex2 = hourIndex1 = (unsigned int)m_dataTimePoints.size()-1;
+		else if (i == n) {
+			hourIndex2 = hourIndex1 = n-1;
 			alpha = 1;
 		}
 		else {
-			// 64bit -> 32bit cast, hope we don't have gigabytes of data... :-)
-			hourIndex2 = static_cast<unsigned int>(it - m_dataTimePoints.begin());
+			hourIndex2 = i;
 			hourIndex1 = hourIndex2-1;
 			alpha = 1 - (t - m_dataTimePoints[hourIndex1])/(m_dataTimePoints[hourIndex2]-m_dataTimePoints[hourIndex1]);
 		}
@@ -1978,6 +1996,16 @@ bool ClimateDataLoader::checkForValidCyclicData(const std::vector<double> & time
 }
 
 
+void ClimateDataLoader::updateTimePointCache() {
+	std::string errmsg;
+	m_cyclicTimePoints = checkForValidCyclicData(m_dataTimePoints, errmsg);
+	m_cachedTimePointCount = m_dataTimePoints.size();
+	m_cachedFirstTimePoint = m_dataTimePoints.empty() ? 0 : m_dataTimePoints.front();
+	m_cachedLastTimePoint = m_dataTimePoints.empty() ? 0 : m_dataTimePoints.back();
+	m_timePointCursor = 0;
+}
+
+
 void ClimateDataLoader::checkForValidCyclicData(const std::vector<double> & timeVec) {
 	FUNCID(ClimateDataLoader::checkForValidCyclicData);
 	if (timeVec.size() < 2)
@@ -467,6 +467,26 @@ public:
 		When all data is missing, m_checkBitsBadValueRowIndexes[XXX].first is always 0.
 	*/
 	std::array<std::pair<unsigned int,unsigned int>, NumClimateComponents>	m_checkBitsBadValueRowIndexes;
+
+private:
+	/*! Updates cached properties of m_dataTimePoints used in setTime().
+		The cyclic data check only depends on number, first and last time point, these are stored
+		as well so that setTime() can detect modified time points.
+	*/
+	void updateTimePointCache();
+
+	/*! Number of time points in m_dataTimePoints when cache was updated. */
+	size_t					m_cachedTimePointCount = 0;
+	/*! First time point in m_dataTimePoints when cache was updated. */
+	double					m_cachedFirstTimePoint = 0;
+	/*! Last time point in m_dataTimePoints when cache was updated. */
+	double					m_cachedLastTimePoint = 0;
+	/*! True if m_dataTimePoints can be used cyclically (see checkForValidCyclicData()). */
+	bool					m_cyclicTimePoints = false;
+	/*! Index of first time point >= t in last call to setTime() (m_dataTimePoints.size() if t is beyond last time point).
+		Since time usually moves forward, the next lookup in m_dataTimePoints only needs to check the current and next interval.
+	*/
+	unsigned int			m_timePointCursor = 0;
 };
 
 
@@ -45,6 +45,12 @@
 #include "CCM_SolarRadiationModel.h"
 #include "CCM_Constants.h"
 
+// SSE2 is part of the x86-64 baseline instruction set, so no runtime check is needed
+#if defined(__x86_64__) || defined(_M_X64)
+	#define CCM_SIMD_SSE2
+	#include <emmintrin.h>
+#endif
+
 // include this file last
 #include "CCM_Defines.h"
 
@@ -55,6 +61,128 @@ inline bool nearly_equal(double a, double b, double EPS = 1e-5) {
 }
 
 
+/*! Sun position and climate data dependent quantities used by the radiation kernels. */
+struct SunState {
+	double	m_cosAzimuth;
+	double	m_sinAzimuth;
+	/*! Sine of elevation angle (fraction of horizontal radiation). */
+	double	m_sinElevation;
+	/*! Cosine of elevation angle (fraction of vertical radiation). */
+	double	m_cosElevation;
+	double	m_directRadHorizontal;
+	double	m_directRadVertical;
+	double	m_diffuseRadHorizontal;
+	double	m_albedo;
+	/*! If true, diffuse radiation from upper hemisphere is computed with the Perez model and coefficients below. */
+	bool	m_perez;
+	double	m_perezF1;
+	double	m_perezF2;
+	double	m_perezB;
+};
+
+
+/* Computes radiation loads for surfaces [begin, end) in the arrays qRadDir and qRadDif, and the cosine of the incidence
+	angle in cosIncidence (negative if the sun is behind the surface).
+*/
+static void radiationLoadsScalar(const SunState & sun, unsigned int begin, unsigned int end,
+								 const double * cosOrientation, const double * sinOrientation,
+								 const double * cosInclination, const double * sinInclination,
+								 const double * viewFactorToSky,
+								 double * qRadDir, double * qRadDif, double * cosIncidence)
+{
+	for (unsigned int i=begin; i<end; ++i) {
+		// calculate projection of surface normal to horizontal vertical radiation vector, with
+		// cos(azimuth - orientation) = cos(azimuth)*cos(orientation) + sin(azimuth)*sin(orientation)
+		double surfaceNormalInVerticalRadDirection = sinInclination[i] *
+				(sun.m_cosAzimuth * cosOrientation[i] + sun.m_sinAzimuth * sinOrientation[i]);
+		double cosInc = cosInclination[i] * sun.m_sinElevation + surfaceNormalInVerticalRadDirection * sun.m_cosElevation;
+		// ensure, that rounding errors may not give cosIncidence > 1
+		cosInc = std::min(cosInc, 1.0);
+		// incidence angle < 0 --> no direct radiation
+		double directRadOnSurface = 0;
+		if (cosInc >= 0)
+			directRadOnSurface = cosInclination[i] * sun.m_directRadHorizontal + surfaceNormalInVerticalRadDirection * sun.m_directRadVertical;
+
+		double diffuseRadOfUpperHemisphere;
+		if (sun.m_perez) {
+			double rB = std::max(cosInc, 0.0) / sun.m_perezB;
+			diffuseRadOfUpperHemisphere = sun.m_diffuseRadHorizontal * ((1 - sun.m_perezF1) * (1 + cosInclination[i]) * 0.5
+																		+ sun.m_perezF1 * rB + sun.m_perezF2 * sinInclination[i]);
+		}
+		else {
+			diffuseRadOfUpperHemisphere = viewFactorToSky[i] * sun.m_diffuseRadHorizontal;
+		}
+		double diffuseRadOfLowerHemisphere = sun.m_albedo * (1 - viewFactorToSky[i])
+				* (sun.m_diffuseRadHorizontal + sun.m_directRadHorizontal);
+
+		qRadDir[i] = directRadOnSurface;
+		qRadDif[i] = diffuseRadOfUpperHemisphere + diffuseRadOfLowerHemisphere;
+		cosIncidence[i] = cosInc;
+	}
+}
+
+
+#if defined(CCM_SIMD_SSE2)
+
+/* SSE2 variant of radiationLoadsScalar(), processes 2 surfaces at a time. */
+static void radiationLoadsSSE2(const SunState & sun, unsigned int n,
+							   const double * cosOrientation, const double * sinOrientation,
+							   const double * cosInclination, const double * sinInclination,
+							   const double * viewFactorToSky,
+							   double * qRadDir, double * qRadDif, double * cosIncidence)
+{
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d one = _mm_set1_pd(1);
+	const __m128d half = _mm_set1_pd(0.5);
+	const __m128d cosAzimuth = _mm_set1_pd(sun.m_cosAzimuth);
+	const __m128d sinAzimuth = _mm_set1_pd(sun.m_sinAzimuth);
+	const __m128d sinElevation = _mm_set1_pd(sun.m_sinElevation);
+	const __m128d cosElevation = _mm_set1_pd(sun.m_cosElevation);
+	const __m128d directRadHorizontal = _mm_set1_pd(sun.m_directRadHorizontal);
+	const __m128d directRadVertical = _mm_set1_pd(sun.m_directRadVertical);
+	const __m128d diffuseRadHorizontal = _mm_set1_pd(sun.m_diffuseRadHorizontal);
+	const __m128d albedo = _mm_set1_pd(sun.m_albedo);
+	const __m128d globalRadHorizontal = _mm_set1_pd(sun.m_diffuseRadHorizontal + sun.m_directRadHorizontal);
+	const __m128d perezF1 = _mm_set1_pd(sun.m_perezF1);
+	const __m128d perezOneMinusF1 = _mm_set1_pd(1 - sun.m_perezF1);
+	const __m128d perezF2 = _mm_set1_pd(sun.m_perezF2);
+	const __m128d perezB = _mm_set1_pd(sun.m_perezB);
+
+	unsigned int i=0;
+	for (; i+2<=n; i+=2) {
+		__m128d cosInclin = _mm_loadu_pd(cosInclination + i);
+		__m128d sinInclin = _mm_loadu_pd(sinInclination + i);
+		__m128d vfSky = _mm_loadu_pd(viewFactorToSky + i);
+		__m128d vertical = _mm_mul_pd(sinInclin, _mm_add_pd(_mm_mul_pd(cosAzimuth, _mm_loadu_pd(cosOrientation + i)),
+															 _mm_mul_pd(sinAzimuth, _mm_loadu_pd(sinOrientation + i))));
+		__m128d cosInc = _mm_min_pd(_mm_add_pd(_mm_mul_pd(cosInclin, sinElevation), _mm_mul_pd(vertical, cosElevation)), one);
+		__m128d sunVisible = _mm_cmpge_pd(cosInc, zero);
+		__m128d directRadOnSurface = _mm_and_pd(sunVisible, _mm_add_pd(_mm_mul_pd(cosInclin, directRadHorizontal),
+																	   _mm_mul_pd(vertical, directRadVertical)));
+		__m128d diffuseRadOfUpperHemisphere;
+		if (sun.m_perez) {
+			__m128d rB = _mm_div_pd(_mm_max_pd(cosInc, zero), perezB);
+			diffuseRadOfUpperHemisphere = _mm_mul_pd(diffuseRadHorizontal,
+				_mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_mul_pd(perezOneMinusF1, _mm_add_pd(one, cosInclin)), half),
+									  _mm_mul_pd(perezF1, rB)),
+						   _mm_mul_pd(perezF2, sinInclin)));
+		}
+		else {
+			diffuseRadOfUpperHemisphere = _mm_mul_pd(vfSky, diffuseRadHorizontal);
+		}
+		__m128d diffuseRadOfLowerHemisphere = _mm_mul_pd(_mm_mul_pd(albedo, _mm_sub_pd(one, vfSky)), globalRadHorizontal);
+
+		_mm_storeu_pd(qRadDir + i, directRadOnSurface);
+		_mm_storeu_pd(qRadDif + i, _mm_add_pd(diffuseRadOfUpperHemisphere, diffuseRadOfLowerHemisphere));
+		_mm_storeu_pd(cosIncidence + i, cosInc);
+	}
+	radiationLoadsScalar(sun, i, n, cosOrientation, sinOrientation, cosInclination, sinInclination, viewFactorToSky,
+						 qRadDir, qRadDif, cosIncidence);
+}
+
+#endif // defined(CCM_SIMD_SSE2)
+
+
 SolarRadiationModel::SolarRadiationModel() :
 	m_albedo(0.2),
 	m_climateConversionModel(ASHRAE_ClearSky),
@@ -76,21 +204,6 @@ void SolarRadiationModel::setTime(int year, double secondsOfYear) {
 	// update climate data loader
 	m_climateDataLoader.setTime(year, secondsOfYear);
 
-	// calculate local weather station time (correct longitude shift to time zone median)
-	//double localStationTime = longitudeCorrectedTime(secondsOfYear,
-	//	m_climateDataLoader.m_longitudeInDegree * DEG2RAD,
-	//	m_climateDataLoader.m_timeZone);
-
-	//double correctedTime = secondsOfYear + m_localObserverTime - m_localStationTime;
-	//// perform a cyclic correction
-	//if(correctedTime < 0.0)
-	//	correctedTime += (double) SECONDS_PER_YEAR;
-	//else if(correctedTime > (double) SECONDS_PER_YEAR)
-	//	correctedTime -= (double) SECONDS_PER_YEAR;
-
-	//// update climate data loader
-	//m_climateDataLoader.setTime(year, correctedTime);
-
 	// compute radiation load and incidence angle for all surfaces
 
 	// retrieve sun elevation angle and azimuth angle in [rad]
@@ -99,6 +212,8 @@ void SolarRadiationModel::setTime(int year, double secondsOfYear) {
 
 	bool sunBeyondHorizont	= elevationAngle <= 0;
 
+	unsigned int surfaceCount = (unsigned int)m_orientation.size();
+
 	// for negative elevation angle set all radiation vector to 0
 	// and incident angle to Pi
 	if (sunBeyondHorizont) {
@@ -119,27 +234,14 @@ void SolarRadiationModel::setTime(int year, double secondsOfYear) {
 		double diffuseRadHorizontal = m_climateDataLoader.m_currentData[ClimateDataLoader::DiffuseRadiationHorizontal];
 		if (diffuseRadHorizontal == 0.0)
 			return; // no diffuse radiation, no calculation necessay
-		for (unsigned int i = 0; i < m_surface.size(); ++i) {
-			double inclinationAngle = m_surface[i].second;
-
-			bool flatRoof			= nearly_equal(inclinationAngle, 0);
-			// for flat roofs we can directly return the (measured) horizontal values
-			if (flatRoof) {
-				m_qRadDif[i] = diffuseRadHorizontal;
-				continue;
-			}
-
-			// calculate diffuse radiation on upper and lower hemisphere
-			double cosInclination2 = std::cos(0.5 * inclinationAngle);
-			double viewFactorToSky = cosInclination2 * cosInclination2;
-			double viewFactorToGround = 1-viewFactorToSky;
-
-			double diffuseRadOfUpperHemisphere = viewFactorToSky * diffuseRadHorizontal;
-			double diffuseRadOfLowerHemisphere = m_albedo * viewFactorToGround * diffuseRadHorizontal;
-
-			// store values
-			m_qRadDif[i] = diffuseRadOfUpperHemisphere + diffuseRadOfLowerHemisphere;
+		// diffuse radiation on upper and lower hemisphere
+		for (unsigned int i = 0; i < surfaceCount; ++i) {
+			double viewFactorToSky = m_viewFactorToSky[i];
+			m_qRadDif[i] = viewFactorToSky * diffuseRadHorizontal + m_albedo * (1 - viewFactorToSky) * diffuseRadHorizontal;
 		}
+		// for flat roofs we can directly return the (measured) horizontal values
+		for (unsigned int i : m_flatRoofs)
+			m_qRadDif[i] = diffuseRadHorizontal;
 		return;
 	}
 
@@ -152,123 +254,88 @@ void SolarRadiationModel::setTime(int year, double secondsOfYear) {
 	// get direct solar radiation (normal direction) and apply smooth clipping rule
 	double directRadNormal	  = smoothElevationClipping * m_climateDataLoader.m_currentData[ClimateDataLoader::DirectRadiationNormal];
 
+	SunState sun;
+	sun.m_cosAzimuth = std::cos(azimuthAngle);
+	sun.m_sinAzimuth = std::sin(azimuthAngle);
 	// calculate radiation fraction
-	double radiationFractionHorizontal = std::sin(elevationAngle);
-	double radiationFractionVertical   = std::cos(elevationAngle);
+	sun.m_sinElevation = std::sin(elevationAngle);
+	sun.m_cosElevation = std::cos(elevationAngle);
 	// calculate horizontal and vertical solar radiation in [W/m2]
-	double directRadHorizontal  = radiationFractionHorizontal * directRadNormal;
-	double directRadVertical	= radiationFractionVertical * directRadNormal;
+	sun.m_directRadHorizontal = sun.m_sinElevation * directRadNormal;
+	sun.m_directRadVertical = sun.m_cosElevation * directRadNormal;
 	// retrieve horizontal diffuse radiation [W/m2]
-	double diffuseRadHorizontal = m_climateDataLoader.m_currentData[ClimateDataLoader::DiffuseRadiationHorizontal];
-
-	for (unsigned int i = 0; i < m_surface.size(); ++i) {
-		// retrieve orientation and inclination angle [rad]
-		double orientationAngle = m_surface[i].first;
-		double inclinationAngle = m_surface[i].second;
-
-		bool flatRoof			= nearly_equal(inclinationAngle, 0);
-
-		// for flat roofs we can directly return the horizontal values - also valid for Perez
-		if (flatRoof) {
-			m_qRadDir[i] = directRadHorizontal;
-			m_qRadDif[i] = diffuseRadHorizontal;
-			// incident angle = 90° - elevation angle
-			m_incidenceAngle[i] = PI_HALF - elevationAngle;
-			continue;
-		}
-
-		// *** compute incidence angle
-
-		// caluclate fractions of horizontal and vertical solar radiation at all surfaces
-		double cosInclination = std::cos(inclinationAngle);
-		double sinInclination = std::sin(inclinationAngle);
-
-		// calculate projection of surface normal to horizontal vertical radiation vector
-		// use the identity normal angle on plane = 90° + (azimuth - orientation)
-		// -> sin(normalAngle) = sin (90° + (azimuth - orientation)) = cos(azimuth - orientation)
-		// normal angle in height = 90° - inclination
-		// -> sin(normalAngle) = sin( 90° - inclination ) =   sin (inclination + 90°) = cos(inclination)
-		// -> cos(normalAngle) = cos( 90° - inclination ) = - cos (inclination + 90°) = sin(inclination)
-		double surfaceNormalInHorizontalRadDirection = cosInclination;
-		double surfaceNormalInVerticalRadDirection   = sinInclination * std::cos(azimuthAngle - orientationAngle);
-
-		// calulate incidence angle from scalar product: <radVector, surfaceNormal>
-		// with <radVector, surfaceNormal> denoting the scalar product.
-		// We use the formula <a, b> = || a || * || b || * cos(<)(a,b))
-		// with the enclosed angle <)(a,b)
-		double cosIncidence = surfaceNormalInHorizontalRadDirection * radiationFractionHorizontal +
-							 surfaceNormalInVerticalRadDirection * radiationFractionVertical;
-
-		// ensure, that rounding errors may not give cosIncidence > 1
-		if (cosIncidence > 1)
-			cosIncidence = 1;
-
-		// incidence angle < 0 --> no direct radiation
-		// we assume the worst - and set direct radiation and incidence angle to PI_HALF = 90°
-		double directRadOnSurface = 0;
-		double incidenceAngle = PI_HALF;
-		if (cosIncidence >= 0) {
-
-			// in the special case azimuthAngle == orientationAngle this formula gives
-			// directRadOnSurface = directRadNormal * (cosInclination * sinElevation + sinInclination * cosElevation)
-			//                    = directRadNormal * (sin(normalAngle) * sinElevation + cos(normalAngle) * cosElevation)
-			//					  = directRadNormal * cos(normalAngle - elevationAngle)
-			directRadOnSurface = surfaceNormalInHorizontalRadDirection * directRadHorizontal +
-									surfaceNormalInVerticalRadDirection * directRadVertical;
-			// incidenceAngle will be always between 0° and 180° (symmetry of cosinus function)
-			incidenceAngle  = std::acos(cosIncidence); // in Rad
-		}
-
-		// calculate diffuse radiation on upper and lower hemisphere
-		double cosInclination2 = std::cos(0.5 * inclinationAngle);
-		double viewFactorToSky = cosInclination2 * cosInclination2;
-		double viewFactorToGround = 1-viewFactorToSky; // = sinInclination2*sinInclination2 with sinInclination2 = std::sin(0.5 * inclinationAngle);
-
-		// diffuse rad on upper hemisphere either with Perez or standard
-		double diffuseRadOfUpperHemisphere;
-		if (m_diffuseRadiationPerezEnabled) {
-			diffuseRadOfUpperHemisphere = diffuseRadiationPerez(inclinationAngle, incidenceAngle, diffuseRadHorizontal, directRadNormal);
-		}
-		else {
-			diffuseRadOfUpperHemisphere = viewFactorToSky * diffuseRadHorizontal;
-		}
-		double diffuseRadOfLowerHemisphere = m_albedo * viewFactorToGround
-													* (diffuseRadHorizontal + directRadHorizontal);
-
-		// sum up both parts
-		double diffuseRadOnSurface = diffuseRadOfUpperHemisphere + diffuseRadOfLowerHemisphere;
+	sun.m_diffuseRadHorizontal = m_climateDataLoader.m_currentData[ClimateDataLoader::DiffuseRadiationHorizontal];
+	sun.m_albedo = m_albedo;
+	// Perez coefficients only depend on sun position and climate data, so we compute them once for all surfaces
+	sun.m_perez = m_diffuseRadiationPerezEnabled;
+	sun.m_perezF1 = sun.m_perezF2 = sun.m_perezB = 0;
+	if (m_diffuseRadiationPerezEnabled)
+		perezCoefficients(sun.m_diffuseRadHorizontal, directRadNormal, sun.m_perezF1, sun.m_perezF2, sun.m_perezB);
+
+	// compute radiation loads of all surfaces, m_incidenceAngle holds cosine of incidence angle afterwards
+#if defined(CCM_SIMD_SSE2)
+	radiationLoadsSSE2(sun, surfaceCount, m_cosOrientation.data(), m_sinOrientation.data(), m_cosInclination.data(),
+					   m_sinInclination.data(), m_viewFactorToSky.data(), m_qRadDir.data(), m_qRadDif.data(), m_incidenceAngle.data());
+#else
+	radiationLoadsScalar(sun, 0, surfaceCount, m_cosOrientation.data(), m_sinOrientation.data(), m_cosInclination.data(),
+						 m_sinInclination.data(), m_viewFactorToSky.data(), m_qRadDir.data(), m_qRadDif.data(), m_incidenceAngle.data());
+#endif
+
+	// incidenceAngle will be always between 0° and 180° (symmetry of cosinus function); if sun is behind
+	// the surface, we assume the worst and set incidence angle to PI_HALF = 90°
+	for (unsigned int i = 0; i < surfaceCount; ++i) {
+		double cosIncidence = m_incidenceAngle[i];
+		m_incidenceAngle[i] = cosIncidence >= 0 ? std::acos(cosIncidence) : PI_HALF;
+	}
 
-		// store values
-		m_qRadDir[i] = directRadOnSurface;
-		m_qRadDif[i] = diffuseRadOnSurface;
-		m_incidenceAngle[i] = incidenceAngle;
+	// for flat roofs we can directly return the horizontal values - also valid for Perez
+	for (unsigned int i : m_flatRoofs) {
+		m_qRadDir[i] = sun.m_directRadHorizontal;
+		m_qRadDif[i] = sun.m_diffuseRadHorizontal;
+		// incident angle = 90° - elevation angle
+		m_incidenceAngle[i] = PI_HALF - elevationAngle;
 	}
 }
 
 
 unsigned int SolarRadiationModel::addSurface(double orientation, double inclination) {
+	double cosOrientation = std::cos(orientation);
+	double sinOrientation = std::sin(orientation);
+	double cosInclination = std::cos(inclination);
+	double sinInclination = std::sin(inclination);
+
 	// search for existing surfaces with same orientation and inclination
 	//	\todo Compute scalar product between all normal vectors of already registered surfaces and the normal vector
 	//			of the new surfaces, and if angle between normals is less than a threshold (say 0.1 deg), treat
 	//			surfaces as the same.
-	for (unsigned int i=0; i<m_surface.size(); ++i) {
-		if (nearly_equal(m_surface[i].first, orientation, 1e-5) &&
-			nearly_equal(m_surface[i].second, inclination, 1e-5) )
+	for (unsigned int i=0; i<m_orientation.size(); ++i) {
+		if (nearly_equal(m_orientation[i], orientation, 1e-5) &&
+			nearly_equal(m_inclination[i], inclination, 1e-5) )
 		{
 			// Same surface definition already known,
-			// return the current index in the m_surface vector.
+			// return the current index in the surface table.
 			return i;
 		}
 	}
+	// construct a new surface id from table index
+	unsigned int surfaceID = (unsigned int)m_orientation.size();
+
 	// add new surface definition
-	m_surface.push_back( std::make_pair(orientation, inclination));
+	m_orientation.push_back(orientation);
+	m_inclination.push_back(inclination);
+	m_cosOrientation.push_back(cosOrientation);
+	m_sinOrientation.push_back(sinOrientation);
+	m_cosInclination.push_back(cosInclination);
+	m_sinInclination.push_back(sinInclination);
+	double cosInclination2 = std::cos(0.5 * inclination);
+	m_viewFactorToSky.push_back(cosInclination2 * cosInclination2);
+	if (nearly_equal(inclination, 0))
+		m_flatRoofs.push_back(surfaceID);
 	// add entry for incindent angle
 	m_incidenceAngle.push_back(0.0);
 	// add entry for direct and diffuse solar radiation
 	m_qRadDir.push_back(0.0);
 	m_qRadDif.push_back(0.0);
-	// construct a new surface id from container index
-	unsigned int surfaceID = (unsigned int)m_surface.size()-1;
 
 	return surfaceID;
 }
@@ -333,7 +400,7 @@ double SolarRadiationModel::apparentSolarTimeFromLocalMeanTime( double secondsOf
 void SolarRadiationModel::radiationLoad(unsigned int surfaceID, double & qRadDir, double & qRadDif, double & incidenceAngleInRad) const {
 	FUNCID(SolarRadiationModel::radiationLoad);
 
-	if (surfaceID >= m_surface.size())
+	if (surfaceID >= m_orientation.size())
 		throw IBK::Exception( IBK::FormatString("Invalid surface ID %1.").arg(surfaceID), FUNC_ID);
 
 	qRadDir = m_qRadDir[surfaceID];
@@ -528,26 +595,36 @@ double calcExtraTerrRad(const unsigned int dayOfYear) {
 
 
 double SolarRadiationModel::diffuseRadiationPerez(double inclinationAngleRad, double incidenceAngleRad, double diffuseRadHorizontal, double directRadNormal) const {
+	double f1, f2, b;
+	perezCoefficients(diffuseRadHorizontal, directRadNormal, f1, f2, b);
+
+	double a = std::cos(incidenceAngleRad);
+	// Mind: rounding errors may cause a to become slightly smaller than 0
+	a = std::max<double>(a,0);
+	double rB = a/b;
+
+	//diffuse radiation on surface with perez model
+	double diffRad = diffuseRadHorizontal * (     (1-f1) * (1+cos(inclinationAngleRad))*0.5
+												+ f1 * rB
+												+ f2 * sin(inclinationAngleRad)  );
+
+	return diffRad;
+}
 
 
+void SolarRadiationModel::perezCoefficients(double diffuseRadHorizontal, double directRadNormal, double & f1, double & f2, double & b) const {
+
 	// we need air pressure
 	double pa = m_climateDataLoader.m_currentData[ClimateDataLoader::AirPressure];
 	if (pa == DATA_NOT_VALID)
 		pa = 101325; // Pa
 
-	double diffRad = 0;
-
 	// get elevation angle
 	double elevation = m_sunPositionModel.m_elevation;
 	double solarZenithAngleRad = PI_HALF-elevation;
 	IBK_ASSERT(solarZenithAngleRad >= 0 && solarZenithAngleRad <= PI_HALF);
 
-	double a = std::cos(incidenceAngleRad);
-	// Mind: rounding errors may cause a to become slightly smaller than 0
-	a = std::max<double>(a,0);
-
-	double b = std::max<double>(cos(85 * PI / 180), cos(solarZenithAngleRad));
-	double rB = a/b;
+	b = std::max<double>(cos(85 * PI / 180), cos(solarZenithAngleRad));
 	double kappa = 1.041;
 
 	//relative optical air mass (simple model)
@@ -564,9 +641,6 @@ double SolarRadiationModel::diffuseRadiationPerez(double inclinationAngleRad, do
 					(1+ kappa * std::pow(solarZenithAngleRad,3));
 
 	//brightness coefficients F1 and F2
-	double f1 = 0;
-	double f2 = 0;
-
 	//coeff.
 	double f11 = 0;
 	double f12 = 0;
@@ -618,13 +692,6 @@ double SolarRadiationModel::diffuseRadiationPerez(double inclinationAngleRad, do
 
 	f1 = std::max<double>(0, f11 + f12 * delta + solarZenithAngleRad * f13);
 	f2 = f21 + f22 * delta + solarZenithAngleRad * f23;
-
-	//diffuse radiation on surface with perez model
-	diffRad = diffuseRadHorizontal * (     (1-f1) * (1+cos(inclinationAngleRad))*0.5
-										  + f1 * rB
-										  + f2 * sin(inclinationAngleRad)  );
-
-	return diffRad;
 }
 
 
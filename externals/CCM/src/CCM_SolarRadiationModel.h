@@ -57,6 +57,10 @@ namespace CCM {
 	members m_sunPositionModel and m_climateDataLoader are also updated. The time correction
 	(local time to apparent solar time) for the sun position model is done automatically within
 	the setTime() function.
+
+	Surfaces are stored in a table with one array per quantity (sine/cosine of orientation and inclination
+	are computed once in addSurface()). setTime() computes the radiation loads of all surfaces in one pass,
+	several surfaces at a time using SSE2 instructions on x86-64 platforms.
 */
 class SolarRadiationModel {
 public:
@@ -184,11 +188,32 @@ private:
 	*/
 	double localMeanTimeFromLocalStandardTime( double secondsOfYear);
 
-
-	/*! Vector of surfaces to compute radiation loads on, first value in pair is the orientation,
-		second value in pair is the inclination (both in [rad]).
+	/*! Computes the coefficients of the Perez model, that only depend on the sun position and climate data.
+		\param diffuseRadHorizontal Diffuse radiation onto horizontal surface [W/m2].
+		\param directRadNormal Direct radiation in sun's normal direction [W/m2].
+		\param f1 Circumsolar brightness coefficient F1 [-].
+		\param f2 Horizon brightness coefficient F2 [-].
+		\param b Denominator of ratio of direct radiation on surface and horizontal surface [-].
 	*/
-	std::vector< std::pair<double, double> >	m_surface;
+	void perezCoefficients(double diffuseRadHorizontal, double directRadNormal, double & f1, double & f2, double & b) const;
+
+
+	/*! Orientations of surfaces to compute radiation loads on in [rad]. */
+	std::vector<double>							m_orientation;
+	/*! Inclinations of surfaces in [rad]. */
+	std::vector<double>							m_inclination;
+	/*! Cached cosine of orientation of each surface. */
+	std::vector<double>							m_cosOrientation;
+	/*! Cached sine of orientation of each surface. */
+	std::vector<double>							m_sinOrientation;
+	/*! Cached cosine of inclination of each surface. */
+	std::vector<double>							m_cosInclination;
+	/*! Cached sine of inclination of each surface. */
+	std::vector<double>							m_sinInclination;
+	/*! Cached view factor to sky of each surface, cos^2(inclination/2). */
+	std::vector<double>							m_viewFactorToSky;
+	/*! Indexes of flat roofs (surfaces with inclination 0), these get the horizontal radiation loads. */
+	std::vector<unsigned int>					m_flatRoofs;
 
 	/*! Cached values for direct solar radiation in [W/m2] normal to each surface,
 		retrieve via member function radiationLoad()
@@ -38,13 +38,12 @@
 
 #include "IBK_CSVReader.h"
 
-#include <iostream>
-#include <iomanip>
-#include <sstream>
 #include <fstream>
 #include <vector>
-#include <stdexcept>
-#include <iterator>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <thread>
 
 #include "IBK_configuration.h"
 #include "IBK_messages.h"
@@ -52,10 +51,156 @@
 #include "IBK_FormatString.h"
 #include "IBK_FileUtils.h"
 
-using namespace std;
+// use same number conversion as IBK::string2val<double>()
+#if defined(_WIN32) && !defined(_WIN64)
+	#define IBK_USE_STOD
+#else
+	#include "fast_float/fast_float.h"
+#endif
 
 namespace IBK {
 
+/*! Minimum number of bytes parsed by one thread. */
+const std::size_t CSV_CHUNK_SIZE = 4*1024*1024;
+
+
+namespace {
+
+/*! Reads the entire file into data, returns false if file cannot be opened.
+	If the file is truncated while being read (e.g. by a solver rewriting it), only the remaining content is read.
+*/
+bool readFile(const IBK::Path & filename, std::string & data) {
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, filename, std::ios_base::binary))
+		return false;
+	in.seekg(0, std::ios_base::end);
+	std::streamoff size = in.tellg();
+	if (size < 0)
+		return false;
+	in.seekg(0, std::ios_base::beg);
+	data.resize((std::size_t)size);
+	in.read(&data[0], size);
+	data.resize((std::size_t)in.gcount());
+	return true;
+}
+
+
+/*! Data and state of a block of lines parsed by one thread. */
+struct CSVChunk {
+	/*! Start of first line in chunk. */
+	const char							*m_begin = nullptr;
+	/*! End of chunk (after line end of last line). */
+	const char							*m_end = nullptr;
+	/*! Values of parsed columns, other columns remain empty. */
+	std::vector<std::vector<double> >	m_colValues;
+	/*! Number of lines in chunk (including empty lines). */
+	unsigned int						m_lineCount = 0;
+	/*! Number of data rows in chunk. */
+	unsigned int						m_rowCount = 0;
+	/*! If true, parsing stopped with an error in the last counted line. */
+	bool								m_error = false;
+	/*! Column with invalid value, or -1 if the number of columns is wrong. */
+	int									m_errorColumn = -1;
+	/*! Invalid value. */
+	std::string							m_errorToken;
+};
+
+
+} // namespace
+
+
+/*! Converts value in [begin, end), same rules as IBK::string2val<double>(). Returns false if conversion fails. */
+static bool convertValue(const char * begin, const char * end, double & val) {
+	if (end - begin == 7 && std::memcmp(begin, "1.#QNAN", 7) == 0) {
+		val = std::numeric_limits<double>::quiet_NaN();
+		return true;
+	}
+#ifdef IBK_USE_STOD
+	try {
+		val = IBK::string2val<double>(std::string(begin, end));
+	}
+	catch (...) {
+		return false;
+	}
+	return true;
+#else
+	return fast_float::from_chars(begin, end, val).ec == std::errc();
+#endif
+}
+
+
+/*! Parses all lines in chunk. Empty tokens are skipped (i.e. several separation characters in a row are treated
+	as one). For separation character ',' tokens are trimmed.
+	\param readColumn Flag for each column, values are only converted in columns with flag set.
+*/
+static void parseChunk(CSVChunk & chunk, char sepChar, const std::vector<bool> & readColumn) {
+	unsigned int nColumns = (unsigned int)readColumn.size();
+	chunk.m_colValues.resize(nColumns);
+	const char * p = chunk.m_begin;
+	while (p < chunk.m_end) {
+		const char * lineEnd = (const char *)std::memchr(p, '\n', chunk.m_end - p);
+		const char * nextLine;
+		if (lineEnd == nullptr)
+			lineEnd = nextLine = chunk.m_end;
+		else
+			nextLine = lineEnd + 1;
+		// remove carriage return of Windows line endings
+		if (lineEnd > p && lineEnd[-1] == '\r')
+			--lineEnd;
+		++chunk.m_lineCount; // also count empty rows, to get correct line numbers in error messages
+
+		// skip empty rows
+		const char * c = p;
+		while (c < lineEnd && (*c == ' ' || *c == '\t' || *c == '\r'))
+			++c;
+		if (c == lineEnd) {
+			p = nextLine;
+			continue;
+		}
+
+		unsigned int col = 0;
+		int errorColumn = -1;
+		const char * tokenBegin = p;
+		while (tokenBegin < lineEnd) {
+			const char * tokenEnd = (const char *)std::memchr(tokenBegin, sepChar, lineEnd - tokenBegin);
+			if (tokenEnd == nullptr)
+				tokenEnd = lineEnd;
+			// skip empty tokens
+			if (tokenEnd != tokenBegin) {
+				if (col < nColumns && readColumn[col] && errorColumn == -1) {
+					const char * b = tokenBegin;
+					const char * e = tokenEnd;
+					if (sepChar == ',') {
+						while (b < e && std::strchr(" \t\r\"", *b) != nullptr)
+							++b;
+						while (e > b && std::strchr(" \t\r\"", e[-1]) != nullptr)
+							--e;
+					}
+					double val;
+					if (convertValue(b, e, val))
+						chunk.m_colValues[col].push_back(val);
+					else {
+						errorColumn = (int)col;
+						chunk.m_errorToken.assign(b, e);
+					}
+				}
+				++col;
+			}
+			tokenBegin = tokenEnd + 1;
+		}
+
+		// wrong column count is reported first
+		if (col != nColumns || errorColumn != -1) {
+			chunk.m_error = true;
+			chunk.m_errorColumn = (col != nColumns) ? -1 : errorColumn;
+			return;
+		}
+		++chunk.m_rowCount;
+		p = nextLine;
+	}
+}
+
+
 bool CSVReader::haveTabSeparationChar(const IBK::Path & filename) {
 	FUNCID(CSVReader::haveTabSeparationChar);
 	// first detect file format
@@ -90,11 +235,12 @@ bool CSVReader::haveTabSeparationChar(const IBK::Path & filename) {
 void CSVReader::read(const IBK::Path & filename, bool headerOnly, bool extractUnits) {
 	FUNCID(CSVReader::read);
 	try {
-		std::ifstream in;
-		if (!IBK::open_ifstream(in, filename))
+		std::string data;
+		if (!readFile(filename, data))
 			throw IBK::Exception( IBK::FormatString("File doesn't exist or cannot open/access file."), FUNC_ID);
 
-		parse(in, headerOnly, extractUnits);
+		parse(data.data(), data.data() + data.size(), headerOnly, extractUnits, std::vector<unsigned int>());
+		transposeColValues();
 	}
 	catch (IBK::Exception & ex) {
 		throw IBK::Exception( ex, IBK::FormatString("Error reading file '%1'.").arg(filename), FUNC_ID);
@@ -102,19 +248,43 @@ void CSVReader::read(const IBK::Path & filename, bool headerOnly, bool extractUn
 }
 
 
-void CSVReader::parse(const string & data, bool headerOnly, bool extractUnits) {
+void CSVReader::parse(const std::string & data, bool headerOnly, bool extractUnits) {
 	FUNCID(CSVReader::parse);
 	try {
-		std::stringstream in(data);
-		parse(in, headerOnly, extractUnits);
+		parse(data.data(), data.data() + data.size(), headerOnly, extractUnits, std::vector<unsigned int>());
+		transposeColValues();
 	} catch (IBK::Exception & ex) {
 		throw IBK::Exception( ex, IBK::FormatString("Error parsing data."), FUNC_ID);
 	}
 }
 
 
+void CSVReader::readColumns(const IBK::Path & filename, bool extractUnits, const std::vector<unsigned int> & columnIndexes) {
+	FUNCID(CSVReader::readColumns);
+	try {
+		std::string data;
+		if (!readFile(filename, data))
+			throw IBK::Exception( IBK::FormatString("File doesn't exist or cannot open/access file."), FUNC_ID);
+
+		parse(data.data(), data.data() + data.size(), false, extractUnits, columnIndexes);
+		m_values.clear();
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception( ex, IBK::FormatString("Error reading file '%1'.").arg(filename), FUNC_ID);
+	}
+}
+
+
 std::vector<double> CSVReader::colData(unsigned int colIndex) const {
 	FUNCID(CSVReader::colData);
+	// values read with readColumns()
+	if (!m_colValues.empty()) {
+		if (colIndex >= m_colValues.size())
+			throw IBK::Exception(IBK::FormatString("Column index %1 out of range. Only have %2 columns in file.").arg(colIndex).arg(m_colValues.size()), FUNC_ID);
+		if (m_colValues[colIndex].size() != m_nRows)
+			throw IBK::Exception(IBK::FormatString("Values of column %1 have not been read.").arg(colIndex), FUNC_ID);
+		return m_colValues[colIndex];
+	}
 	if (m_values.empty())
 		return std::vector<double>();
 	if (colIndex >= m_values[0].size())
@@ -132,11 +302,23 @@ std::vector<double> CSVReader::colData(unsigned int colIndex) const {
 
 // PRIVATE FUNCTIONS
 
-void CSVReader::parse(istream & in, bool headerOnly, bool extractUnits) {
+void CSVReader::parse(const char * begin, const char * end, bool headerOnly, bool extractUnits,
+					  const std::vector<unsigned int> & columnIndexes)
+{
 	FUNCID(CSVReader::parse);
 
-	std::string line;
-	std::getline(in, line);
+	// first line contains captions
+	const char * headerEnd = nullptr;
+	if (begin != end)
+		headerEnd = (const char *)std::memchr(begin, '\n', end - begin);
+	const char * dataBegin = end;
+	if (headerEnd == nullptr)
+		headerEnd = end;
+	else
+		dataBegin = headerEnd + 1;
+	if (headerEnd > begin && headerEnd[-1] == '\r')
+		--headerEnd;
+	std::string line(begin, headerEnd);
 	std::string sepChars;
 	sepChars.push_back(m_separationCharacter);
 	if (m_separationCharacter == ',')
@@ -146,6 +328,7 @@ void CSVReader::parse(istream & in, bool headerOnly, bool extractUnits) {
 	m_nColumns = (unsigned int)m_captions.size();
 	m_nRows = 0;
 	m_units.clear();
+	m_colValues.clear();
 	if (extractUnits) {
 		for (unsigned int i=0; i<m_captions.size(); ++i) {
 			const std::string & c = m_captions[i];
@@ -162,40 +345,83 @@ void CSVReader::parse(istream & in, bool headerOnly, bool extractUnits) {
 	}
 	if (headerOnly)
 		return;
-	while (std::getline(in, line)) {
-		++m_nRows; // also count empty rows, to get correct line numbers in error messages
-		// skip empty rows
-		if (line.empty() || line.find_first_not_of("\n\r\t ") == std::string::npos)
-			continue;
-		std::vector<std::string> tokens;
-		if (m_separationCharacter == ',') {
-			IBK::explode(line, tokens, sepChars, IBK::EF_UseQuotes);
-			for (unsigned int i=0; i<tokens.size(); ++i) {
-				IBK::trim(tokens[i], " \t\r\"");
-			}
+
+	// columns to convert
+	std::vector<bool> readColumn(m_nColumns, columnIndexes.empty());
+	for (unsigned int colIndex : columnIndexes) {
+		if (colIndex >= m_nColumns)
+			throw IBK::Exception(IBK::FormatString("Column index %1 out of range. Only have %2 columns in file.").arg(colIndex).arg(m_nColumns), FUNC_ID);
+		readColumn[colIndex] = true;
+	}
+
+	// split data into chunks of complete lines, one for each thread
+	std::size_t dataSize = (std::size_t)(end - dataBegin);
+	std::size_t threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+	std::size_t chunkCount = (std::min)(threadCount, dataSize/CSV_CHUNK_SIZE + 1);
+	std::vector<CSVChunk> chunks(chunkCount);
+	const char * chunkBegin = dataBegin;
+	for (std::size_t i=0; i<chunkCount; ++i) {
+		chunks[i].m_begin = chunkBegin;
+		const char * chunkEnd = end;
+		if (i+1 < chunkCount) {
+			chunkEnd = (std::max)(chunkBegin, dataBegin + dataSize*(i+1)/chunkCount);
+			chunkEnd = (const char *)std::memchr(chunkEnd, '\n', end - chunkEnd);
+			chunkEnd = (chunkEnd == nullptr) ? end : chunkEnd + 1;
 		}
-		else
-			IBK::explode(line, tokens, sepChars, IBK::EF_NoFlags);
-		// error: wrong column size
-		if (tokens.size() != m_nColumns) {
+		chunks[i].m_end = chunkBegin = chunkEnd;
+	}
+
+	// parse first chunk in this thread, and all others in parallel
+	std::vector<std::thread> threads;
+	for (std::size_t i=1; i<chunkCount; ++i)
+		threads.push_back(std::thread(parseChunk, std::ref(chunks[i]), m_separationCharacter, std::cref(readColumn)));
+	parseChunk(chunks[0], m_separationCharacter, readColumn);
+	for (std::thread & t : threads)
+		t.join();
+
+	// report first error in file; line numbers include the header line
+	unsigned int lineCount = 1;
+	for (const CSVChunk & chunk : chunks) {
+		lineCount += chunk.m_lineCount;
+		if (!chunk.m_error)
+			continue;
+		if (chunk.m_errorColumn == -1)
 			throw IBK::Exception(IBK::FormatString("Wrong number of columns in line #%1!")
-									.arg(m_nRows+1), FUNC_ID);
+									.arg(lineCount), FUNC_ID);
+		IBK::Exception ex(IBK::FormatString("Could not convert '%1' into value.").arg(chunk.m_errorToken), "[IBK::string2val<double>]");
+		throw IBK::Exception( ex, IBK::FormatString("Error reading value in column %1 in line #%2.")
+							  .arg(chunk.m_errorColumn).arg(lineCount), FUNC_ID);
+	}
+
+	// collect values of all chunks
+	for (const CSVChunk & chunk : chunks)
+		m_nRows += chunk.m_rowCount;
+	m_colValues.resize(m_nColumns);
+	for (unsigned int j=0; j<m_nColumns; ++j) {
+		if (!readColumn[j])
+			continue;
+		if (chunkCount == 1) {
+			m_colValues[j].swap(chunks[0].m_colValues[j]);
+			continue;
 		}
-		std::vector<double> values(m_nColumns);
-		for (unsigned int i=0; i<m_nColumns; ++i) {
-			try {
-				values[i] = IBK::string2val<double>(tokens[i]);
-			}
-			catch (IBK::Exception & ex) {
-				throw IBK::Exception( ex, IBK::FormatString("Error reading value in column %1 in line #%2.")
-									  .arg(i).arg(m_nRows+1), FUNC_ID);
-			}
+		m_colValues[j].reserve(m_nRows);
+		for (CSVChunk & chunk : chunks) {
+			m_colValues[j].insert(m_colValues[j].end(), chunk.m_colValues[j].begin(), chunk.m_colValues[j].end());
+			std::vector<double>().swap(chunk.m_colValues[j]);
 		}
-		m_values.push_back(values);
 	}
+}
+
 
-	// store final number of rows
-	m_nRows = (unsigned int)m_values.size();
+void CSVReader::transposeColValues() {
+	m_values.clear();
+	m_values.resize(m_nRows, std::vector<double>(m_nColumns));
+	for (unsigned int j=0; j<m_colValues.size(); ++j) {
+		const std::vector<double> & col = m_colValues[j];
+		for (unsigned int i=0; i<col.size(); ++i)
+			m_values[i][j] = col[i];
+	}
+	m_colValues.clear();
 }
 
 
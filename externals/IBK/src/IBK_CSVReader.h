@@ -47,7 +47,13 @@
 namespace IBK {
 
 /*! A class for simplified reading of tab/csv separated double values in a column format.
-	\todo Speed up reading through use of IBK::FileReader
+
+	Files are read into memory at once and parsed in place, numbers are converted directly from the file content
+	without creating temporary strings. Large files are split into chunks at line boundaries which
+	are parsed in parallel.
+
+	Use readColumns() for large files, which stores the values column-wise in m_colValues and can restrict
+	number conversion to a subset of columns. read() and parse() store values row-wise in m_values.
 */
 class CSVReader {
 public:
@@ -60,6 +66,15 @@ public:
 	/*! Same as read, but this time the content is read from string. */
 	void parse(const std::string & data, bool headerOnly = false, bool extractUnits = false);
 
+	/*! Reads table from a file and stores values column-wise in m_colValues (m_values is cleared).
+		\param filename Input file name.
+		\param extractUnits If true, units are extracted from captions (see m_units).
+		\param columnIndexes Indexes of columns to read (starting with index 0), values of other columns are
+			not converted and their vectors in m_colValues remain empty. If empty, all columns are read.
+	*/
+	void readColumns(const IBK::Path & filename, bool extractUnits = false,
+					 const std::vector<unsigned int> & columnIndexes = std::vector<unsigned int>());
+
 	/*! Convenience function to extract data of a given column (colIndex starts with index 0). */
 	std::vector<double> colData(unsigned int colIndex) const;
 
@@ -77,6 +92,8 @@ public:
 	std::vector<std::string>			m_units;
 	/*! Data values sorted by row and column, access via m_values[row][column] or use the convenience function colData(colIndex). */
 	std::vector<std::vector<double> >	m_values;
+	/*! Data values sorted by column and row, access via m_colValues[column][row] (only filled by readColumns()). */
+	std::vector<std::vector<double> >	m_colValues;
 	/*! Number of tabulator columns. */
 	unsigned int						m_nColumns;
 	/*! Number of tabulator rows. */
@@ -84,7 +101,14 @@ public:
 
 private:
 
-	void parse(std::istream & in, bool headerOnly = false, bool extractUnits = false);
+	/*! Parses content in memory range [begin, end) and stores values column-wise in m_colValues.
+		\param columnIndexes Columns to convert, all columns if empty.
+	*/
+	void parse(const char * begin, const char * end, bool headerOnly, bool extractUnits,
+			   const std::vector<unsigned int> & columnIndexes);
+
+	/*! Moves values from m_colValues to m_values. */
+	void transposeColValues();
 };
 
 } // namespace IBK
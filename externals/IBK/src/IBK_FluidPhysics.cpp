@@ -29,6 +29,27 @@ double FrictionFactorSwamee(const double &reynolds, const double &d, const doubl
 }
 
 
+double FrictionFactorSwameeDerivative(const double &reynolds, const double &d, const double &roughness) {
+	if (reynolds < RE_LAMINAR)
+		return -64.0/(reynolds*reynolds);
+	else if (reynolds < RE_TURBULENT){
+		// slope of linear interpolation between fLam and fTurb
+		double fLam = 64.0/RE_LAMINAR; // f(RE_LAMINAR)
+		double fTurb = std::log10((roughness / d) / 3.7 + 5.74 / std::pow(RE_TURBULENT, 0.9) );
+		fTurb = 0.25/(fTurb*fTurb); // f(RE_TURBULENT)
+		return (fTurb - fLam) / (RE_TURBULENT - RE_LAMINAR);
+	}
+	else{
+		// f = 0.25/g^2 with g = log10(x) and x = (roughness / d) / 3.7 + 5.74 * Re^-0.9
+		double x = (roughness / d) / 3.7 + 5.74 / std::pow(reynolds, 0.9);
+		double g = std::log10(x);
+		double dx_dRe = -0.9 * 5.74 / std::pow(reynolds, 1.9);
+		double dg_dRe = dx_dRe / (x * std::log(10.0));
+		return -0.5 / (g*g*g) * dg_dRe;
+	}
+}
+
+
 double NusseltNumber(const double &reynolds, const double &prandtl, const double &l, const double &d) {
 	if (reynolds < RE_LAMINAR){
 		return NusseltNumberLaminar(reynolds, prandtl, l, d);
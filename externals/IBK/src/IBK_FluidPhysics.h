@@ -58,6 +58,14 @@ double NusseltNumber(const double &reynolds, const double &prandtl, const double
 */
 double FrictionFactorSwamee(const double &reynolds, const double &d, const double &roughness);
 
+/*! Calculates the derivative of the darcy friction factor computed in FrictionFactorSwamee() with respect
+	to the Reynolds number [-].
+	\param reynolds Reynolds number [-]
+	\param d Pipe outside diameter [m]
+	\param roughness Pipe wall roughness [m]
+*/
+double FrictionFactorSwameeDerivative(const double &reynolds, const double &d, const double &roughness);
+
 
 } // namespace IBK
 
@@ -76,6 +76,36 @@ void set_console_text_color(ConsoleColor c) {
 #endif // IBK_ENABLE_COLORED_CONSOLE
 }
 
+/*! Collector of the current thread. */
+static thread_local MessageCollector * currentCollector = nullptr;
+
+MessageCollector::MessageCollector() :
+	m_previous(currentCollector)
+{
+	currentCollector = this;
+}
+
+
+MessageCollector::~MessageCollector() {
+	currentCollector = m_previous;
+}
+
+
+void MessageCollector::passOn(const std::vector<Message> & messages) {
+	for (const Message & m : messages) {
+		if (currentCollector != nullptr)
+			currentCollector->m_messages.push_back(m);
+		else
+			MessageHandlerRegistry::instance().msg(m.m_msg, m.m_type, m.m_funcId.empty() ? nullptr : m.m_funcId.c_str(), m.m_verboseLevel);
+	}
+}
+
+
+MessageCollector * MessageCollector::current() {
+	return currentCollector;
+}
+
+
 extern const char * const TERMINAL_CODES[16] =
 {
 	"\033[22;30m", // black			CF_BLACK
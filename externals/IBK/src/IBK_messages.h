@@ -40,6 +40,7 @@
 #define IBK_messagesH
 
 #include <string>
+#include <vector>
 #include "IBK_FormatString.h"
 #include "IBK_MessageHandlerRegistry.h"
 
@@ -61,10 +62,68 @@ namespace IBK {
 */
 #define IBK_FastMessage(x) 	if (IBK::MessageHandlerRegistry::instance().messageHandler()->consoleVerbosityLevel() >= (x))IBK::IBK_Message
 
+/*! Collects the messages issued with IBK_Message() by the thread that created the collector.
+
+	Within OpenMP parallel sections IBK_Message() only passes on messages of the master thread. While a collector
+	exists, messages of its thread are stored instead and can be passed on after the parallel section with passOn(),
+	for example in the order of the processed work items:
+	\code
+	std::vector<std::vector<IBK::MessageCollector::Message> > messages(n);
+	#pragma omp parallel for
+	for (int i=0; i<n; ++i) {
+		IBK::MessageCollector collector;
+		// ... work that issues messages ...
+		messages[i].swap(collector.m_messages);
+	}
+	for (int i=0; i<n; ++i)
+		IBK::MessageCollector::passOn(messages[i]);
+	\endcode
+	Collectors may be nested, the innermost collector receives the messages.
+*/
+class MessageCollector {
+public:
+	/*! A collected message, arguments of IBK_Message(). */
+	struct Message {
+		std::string		m_msg;
+		msg_type_t		m_type;
+		std::string		m_funcId;
+		int				m_verboseLevel;
+	};
+
+	/*! Constructor, registers collector for the current thread. */
+	MessageCollector();
+	/*! Destructor, restores previously registered collector of the current thread. */
+	~MessageCollector();
+
+	/*! Passes messages to the collector of the current thread, or to the message handler if there is none.
+		Call this outside the parallel section, after the collectors of the worker threads have been destroyed.
+	*/
+	static void passOn(const std::vector<Message> & messages);
+
+	/*! Returns the collector of the current thread, or nullptr if there is none. */
+	static MessageCollector * current();
+
+	/*! Collected messages. */
+	std::vector<Message>	m_messages;
+
+private:
+	MessageCollector(const MessageCollector &);
+	MessageCollector & operator=(const MessageCollector &);
+
+	/*! Collector of the current thread before this collector was created. */
+	MessageCollector		*m_previous;
+};
+
+
 /*! Prototype for the message function.
 	The function will be called from certain IBK classes.
 */
 inline void IBK_Message(const std::string& msg, msg_type_t t = MSG_PROGRESS, const char * func_id = nullptr, int verbose_level = VL_ALL) {
+	MessageCollector * collector = MessageCollector::current();
+	if (collector != nullptr) {
+		collector->m_messages.push_back(MessageCollector::Message{msg, t, func_id != nullptr ? func_id : "", verbose_level});
+		return;
+	}
 #ifdef _OPENMP
 	#pragma omp master
 #endif
@@ -76,6 +135,11 @@ inline void IBK_Message(const std::string& msg, msg_type_t t = MSG_PROGRESS, con
 	The function will be called from certain IBK classes.
 */
 inline void IBK_Message(const IBK::FormatString& msg, msg_type_t t = MSG_PROGRESS, const char * func_id = nullptr, int verbose_level = VL_ALL) {
+	MessageCollector * collector = MessageCollector::current();
+	if (collector != nullptr) {
+		collector->m_messages.push_back(MessageCollector::Message{msg.str(), t, func_id != nullptr ? func_id : "", verbose_level});
+		return;
+	}
 #ifdef _OPENMP
 	#pragma omp master
 #endif
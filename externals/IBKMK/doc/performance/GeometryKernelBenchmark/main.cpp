@@ -0,0 +1,137 @@
+/*	Micro-benchmark for the batched geometry kernels of the IBKMK library.
+
+	Computes intersection points of parallel lines (sun beams through grid points) with a polygon
+	(obstacle), the plane coordinates of the intersection points and the point in polygon test, first
+	with the single-point functions and then with the batched functions for all supported SIMD levels.
+	Results of the batched functions are compared against the single-point results (must be identical).
+
+	Usage: GeometryKernelBenchmark [number of points] [number of repetitions]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <IBK_StopWatch.h>
+
+#include <IBKMK_2DCalculations.h>
+#include <IBKMK_3DCalculations.h>
+#include <IBKMK_SIMD.h>
+
+/*! Results of one benchmark run. */
+struct Results {
+	std::vector<double>	m_ix, m_iy, m_iz, m_dist;
+	std::vector<double>	m_x, m_y;
+	std::vector<int>	m_inside;
+
+	void resize(unsigned int n) {
+		m_ix.resize(n); m_iy.resize(n); m_iz.resize(n); m_dist.resize(n);
+		m_x.resize(n); m_y.resize(n);
+		m_inside.resize(n);
+	}
+};
+
+
+/*! Returns number of values in a and b that are not bitwise identical. */
+template <typename T>
+unsigned int countDifferences(const std::vector<T> & a, const std::vector<T> & b) {
+	unsigned int count = 0;
+	for (unsigned int i=0; i<a.size(); ++i)
+		if (std::memcmp(&a[i], &b[i], sizeof(T)) != 0)
+			++count;
+	return count;
+}
+
+
+int main(int argc, char * argv[]) {
+	unsigned int n = 100000;
+	unsigned int repetitions = 20;
+	if (argc > 1)
+		n = (unsigned int)std::atoi(argv[1]);
+	if (argc > 2)
+		repetitions = (unsigned int)std::atoi(argv[2]);
+
+	// obstacle: star-shaped polygon with 24 vertexes in a tilted plane
+	IBKMK::Vector3D offset(2, 1, 3);
+	IBKMK::Vector3D localX(1, 0, 0.2);
+	IBKMK::Vector3D localY(0, 1, 0.5);
+	IBKMK::Vector3D normal = localX.crossProduct(localY).normalized();
+	std::vector<IBKMK::Vector2D> polyline;
+	for (unsigned int i=0; i<24; ++i) {
+		double phi = 2*3.14159265358979*i/24;
+		double r = (i % 2 == 0) ? 4 : 2.5;
+		polyline.push_back(IBKMK::Vector2D(r*std::cos(phi), r*std::sin(phi)));
+	}
+
+	// random grid points below obstacle
+	std::vector<double> px(n), py(n), pz(n);
+	std::srand(42);
+	for (unsigned int i=0; i<n; ++i) {
+		px[i] = offset.m_x - 6 + 12.0*std::rand()/RAND_MAX;
+		py[i] = offset.m_y - 6 + 12.0*std::rand()/RAND_MAX;
+		pz[i] = -1.0*std::rand()/RAND_MAX;
+	}
+	// sun beam direction (pointing from grid points to the sun)
+	IBKMK::Vector3D sunNormal(0.1, 0.2, 1);
+
+	std::cout << "Points: " << n << ", repetitions: " << repetitions << std::endl;
+
+	// reference: single-point functions
+	Results ref;
+	ref.resize(n);
+	IBK::StopWatch w;
+	for (unsigned int r=0; r<repetitions; ++r) {
+		for (unsigned int i=0; i<n; ++i) {
+			IBKMK::Vector3D p(px[i], py[i], pz[i]);
+			IBKMK::Vector3D intersection;
+			IBKMK::linePlaneIntersectionWithNormalCheck(offset, normal, p, sunNormal, intersection, ref.m_dist[i], false);
+			ref.m_ix[i] = intersection.m_x;
+			ref.m_iy[i] = intersection.m_y;
+			ref.m_iz[i] = intersection.m_z;
+			IBKMK::planeCoordinates(offset, localX, localY, intersection, ref.m_x[i], ref.m_y[i]);
+			ref.m_inside[i] = IBKMK::pointInPolygon(polyline, IBK::point2D<double>(ref.m_x[i], ref.m_y[i]));
+		}
+	}
+	double tRef = w.stop()/repetitions;
+	std::cout << std::setw(10) << std::left << "Single" << std::setw(12) << std::right << std::fixed << std::setprecision(3)
+			  << tRef << " ms" << std::endl;
+
+	// batched functions for all supported SIMD levels
+	const char * const LEVEL_NAMES[] = { "Scalar", "SSE2", "AVX2" };
+	IBKMK::SimdLevel bestLevel = IBKMK::simdLevel();
+	bool success = true;
+	for (int level = IBKMK::SIMD_Scalar; level <= bestLevel; ++level) {
+		IBKMK::setSimdLevel((IBKMK::SimdLevel)level);
+		Results res;
+		res.resize(n);
+		w.start();
+		for (unsigned int r=0; r<repetitions; ++r) {
+			IBKMK::linePlaneIntersectionWithNormalCheck(offset, normal, sunNormal, px.data(), py.data(), pz.data(), n,
+														res.m_ix.data(), res.m_iy.data(), res.m_iz.data(), res.m_dist.data(), false);
+			IBKMK::planeCoordinates(offset, localX, localY, res.m_ix.data(), res.m_iy.data(), res.m_iz.data(), n,
+									res.m_x.data(), res.m_y.data());
+			IBKMK::pointInPolygon(polyline, res.m_x.data(), res.m_y.data(), n, res.m_inside.data());
+		}
+		double t = w.stop()/repetitions;
+		unsigned int differences = countDifferences(ref.m_ix, res.m_ix) + countDifferences(ref.m_iy, res.m_iy)
+				+ countDifferences(ref.m_iz, res.m_iz) + countDifferences(ref.m_dist, res.m_dist)
+				+ countDifferences(ref.m_x, res.m_x) + countDifferences(ref.m_y, res.m_y)
+				+ countDifferences(ref.m_inside, res.m_inside);
+		std::cout << std::setw(10) << std::left << LEVEL_NAMES[level] << std::setw(12) << std::right << t << " ms"
+				  << "  speedup = " << std::setprecision(2) << tRef/t << std::setprecision(3)
+				  << "  differences = " << differences << std::endl;
+		if (differences != 0)
+			success = false;
+	}
+
+	unsigned int inside = 0;
+	for (int r : ref.m_inside)
+		if (r >= 0)
+			++inside;
+	std::cout << "Points inside polygon: " << inside << std::endl;
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
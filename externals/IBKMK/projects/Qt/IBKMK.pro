@@ -39,6 +39,7 @@ SOURCES += \
 	../../src/IBKMK_BlockBandMatrix.cpp \
 	../../src/IBKMK_BlockSparseMatrix.cpp \
 	../../src/IBKMK_BlockTridiagMatrix.cpp \
+	../../src/IBKMK_BoundingVolumeHierarchy.cpp \
 	../../src/IBKMKC_band_matrix.c \
 	../../src/IBKMKC_dense_matrix.c \
 	../../src/IBKMKC_ilut.c \
@@ -55,6 +56,7 @@ SOURCES += \
 	../../src/IBKMK_numerics.cpp \
 	../../src/IBKMK_Polygon2D.cpp \
 	../../src/IBKMK_Polygon3D.cpp \
+	../../src/IBKMK_SIMD.cpp \
 	../../src/IBKMK_SparseMatrixCSR.cpp \
 	../../src/IBKMK_SparseMatrixEID.cpp \
 	../../src/IBKMK_SparseMatrixPattern.cpp \
@@ -71,6 +73,7 @@ HEADERS += \
 	../../src/IBKMK_BlockSparseMatrix.h \
 	../../src/IBKMK_BlockTridiagMatrix.h \
 	../../src/IBKMK_BlockVector.h \
+	../../src/IBKMK_BoundingVolumeHierarchy.h \
 	../../src/IBKMKC_band_matrix.h \
 	../../src/IBKMKC_dense_matrix.h \
 	../../src/IBKMKC_ilut.h \
@@ -90,6 +93,7 @@ HEADERS += \
 	../../src/IBKMK_Polygon3D.h \
 	../../src/IBKMK_random.h \
 	../../src/IBKMK_rational_number.h \
+	../../src/IBKMK_SIMD.h \
 	../../src/IBKMK_SparseMatrixCSR.h \
 	../../src/IBKMK_SparseMatrixEID.h \
 	../../src/IBKMK_SparseMatrix.h \
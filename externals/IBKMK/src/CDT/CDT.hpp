@@ -18,7 +18,8 @@ namespace CDT
 
 namespace detail
 {
-static mt19937 randGen(9001);
+// Note: thread-local, so that several triangulations can be computed in parallel
+static thread_local mt19937 randGen(9001);
 
 /// Needed for c++03 compatibility (no uniform initialization available)
 template <typename T>
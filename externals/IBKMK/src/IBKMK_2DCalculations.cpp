@@ -37,8 +37,13 @@
 */
 
 #include "IBKMK_2DCalculations.h"
+#include "IBKMK_SIMD.h"
 #include "IBK_Line.h"
 
+#if defined(IBKMK_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
 namespace IBKMK {
 
 bool intersectsLine2D(const std::vector<Vector2D> & polygon,
@@ -103,6 +108,177 @@ int pointInPolygon(const std::vector<Vector2D> & polygon, const IBK::point2D<dou
 }
 
 
+/* Polygon edge prepared for the batched point in polygon test.
+	Vertexes are sorted such that b has the lower y-coordinate, as in crossProdTest().
+*/
+struct PolygonEdge {
+	double	m_bx;
+	double	m_by;
+	double	m_cx;
+	double	m_cy;
+	double	m_xMin;
+	double	m_xMax;
+	bool	m_horizontal;
+};
+
+
+/* Scalar kernel of the batched point in polygon test, also used for remaining points of SIMD kernels. */
+static void pointInPolygonScalar(const PolygonEdge * edges, unsigned int nEdges, const double * x, const double * y,
+								 unsigned int n, int * result)
+{
+	for (unsigned int i=0; i<n; ++i) {
+		int t = -1;
+		for (const PolygonEdge * e = edges; e != edges + nEdges; ++e) {
+			if (e->m_horizontal) {
+				if (y[i] == e->m_by && e->m_xMin <= x[i] && x[i] <= e->m_xMax)
+					t = 0;
+			}
+			else if (!(y[i] <= e->m_by || y[i] > e->m_cy)) {
+				double delta = (e->m_bx - x[i]) * (e->m_cy - y[i]) - (e->m_by - y[i]) * (e->m_cx - x[i]);
+				if (delta < 0)
+					t = -t;
+				else if (!(delta > 0))
+					t = 0;
+			}
+			if (t == 0)
+				break;
+		}
+		result[i] = t;
+	}
+}
+
+
+#if defined(IBKMK_SIMD_X86)
+
+/* SSE2 kernel of the batched point in polygon test, processes 2 points at a time.
+	Same algorithm as the scalar kernel, but the results of crossProdTest() (1, 0 or -1) are computed
+	branch-free as doubles and multiplied.
+*/
+static void pointInPolygonSSE2(const PolygonEdge * edges, unsigned int nEdges, const double * x, const double * y,
+							   unsigned int n, int * result)
+{
+	const __m128d zero = _mm_setzero_pd();
+	const __m128d one = _mm_set1_pd(1);
+	const __m128d minusOne = _mm_set1_pd(-1);
+	unsigned int i=0;
+	for (; i+2<=n; i+=2) {
+		__m128d ax = _mm_loadu_pd(x + i);
+		__m128d ay = _mm_loadu_pd(y + i);
+		__m128d t = minusOne;
+		for (const PolygonEdge * e = edges; e != edges + nEdges; ++e) {
+			__m128d by = _mm_set1_pd(e->m_by);
+			__m128d r;
+			if (e->m_horizontal) {
+				// 0 if point is on the edge, otherwise 1
+				__m128d onEdge = _mm_and_pd(_mm_cmpeq_pd(ay, by),
+											_mm_and_pd(_mm_cmple_pd(_mm_set1_pd(e->m_xMin), ax),
+													   _mm_cmple_pd(ax, _mm_set1_pd(e->m_xMax))));
+				r = _mm_andnot_pd(onEdge, one);
+			}
+			else {
+				__m128d bx = _mm_set1_pd(e->m_bx);
+				__m128d cx = _mm_set1_pd(e->m_cx);
+				__m128d cy = _mm_set1_pd(e->m_cy);
+				__m128d delta = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(bx, ax), _mm_sub_pd(cy, ay)),
+										   _mm_mul_pd(_mm_sub_pd(by, ay), _mm_sub_pd(cx, ax)));
+				__m128d sign = _mm_or_pd(_mm_and_pd(_mm_cmpgt_pd(delta, zero), one),
+										 _mm_and_pd(_mm_cmplt_pd(delta, zero), minusOne));
+				// 1 if point is below or above the edge
+				__m128d outside = _mm_or_pd(_mm_cmple_pd(ay, by), _mm_cmpgt_pd(ay, cy));
+				r = _mm_or_pd(_mm_and_pd(outside, one), _mm_andnot_pd(outside, sign));
+			}
+			t = _mm_mul_pd(t, r);
+			// stop if all points are on the polygon boundary
+			if (_mm_movemask_pd(_mm_cmpneq_pd(t, zero)) == 0)
+				break;
+		}
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(result + i), _mm_cvtpd_epi32(t));
+	}
+	pointInPolygonScalar(edges, nEdges, x + i, y + i, n - i, result + i);
+}
+
+
+/* AVX2 kernel of the batched point in polygon test, processes 4 points at a time. */
+IBKMK_TARGET_AVX2
+static void pointInPolygonAVX2(const PolygonEdge * edges, unsigned int nEdges, const double * x, const double * y,
+							   unsigned int n, int * result)
+{
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d one = _mm256_set1_pd(1);
+	const __m256d minusOne = _mm256_set1_pd(-1);
+	unsigned int i=0;
+	for (; i+4<=n; i+=4) {
+		__m256d ax = _mm256_loadu_pd(x + i);
+		__m256d ay = _mm256_loadu_pd(y + i);
+		__m256d t = minusOne;
+		for (const PolygonEdge * e = edges; e != edges + nEdges; ++e) {
+			__m256d by = _mm256_set1_pd(e->m_by);
+			__m256d r;
+			if (e->m_horizontal) {
+				__m256d onEdge = _mm256_and_pd(_mm256_cmp_pd(ay, by, _CMP_EQ_OQ),
+											   _mm256_and_pd(_mm256_cmp_pd(_mm256_set1_pd(e->m_xMin), ax, _CMP_LE_OQ),
+															 _mm256_cmp_pd(ax, _mm256_set1_pd(e->m_xMax), _CMP_LE_OQ)));
+				r = _mm256_andnot_pd(onEdge, one);
+			}
+			else {
+				__m256d bx = _mm256_set1_pd(e->m_bx);
+				__m256d cx = _mm256_set1_pd(e->m_cx);
+				__m256d cy = _mm256_set1_pd(e->m_cy);
+				__m256d delta = _mm256_sub_pd(_mm256_mul_pd(_mm256_sub_pd(bx, ax), _mm256_sub_pd(cy, ay)),
+											  _mm256_mul_pd(_mm256_sub_pd(by, ay), _mm256_sub_pd(cx, ax)));
+				__m256d sign = _mm256_or_pd(_mm256_and_pd(_mm256_cmp_pd(delta, zero, _CMP_GT_OQ), one),
+											_mm256_and_pd(_mm256_cmp_pd(delta, zero, _CMP_LT_OQ), minusOne));
+				__m256d outside = _mm256_or_pd(_mm256_cmp_pd(ay, by, _CMP_LE_OQ), _mm256_cmp_pd(ay, cy, _CMP_GT_OQ));
+				r = _mm256_blendv_pd(sign, one, outside);
+			}
+			t = _mm256_mul_pd(t, r);
+			if (_mm256_movemask_pd(_mm256_cmp_pd(t, zero, _CMP_NEQ_OQ)) == 0)
+				break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm256_cvtpd_epi32(t));
+	}
+	pointInPolygonScalar(edges, nEdges, x + i, y + i, n - i, result + i);
+}
+
+#endif // defined(IBKMK_SIMD_X86)
+
+
+void pointInPolygon(const std::vector<Vector2D> & polygon, const double * x, const double * y, unsigned int n, int * result) {
+	// prepare edges once for all points; typical polygons fit into the local buffer, avoiding memory allocation
+	const unsigned int EDGE_BUFFER_SIZE = 32;
+	PolygonEdge edgeBuffer[EDGE_BUFFER_SIZE];
+	std::vector<PolygonEdge> edgeVector;
+	unsigned int nEdges = (unsigned int)polygon.size();
+	PolygonEdge * edges = edgeBuffer;
+	if (nEdges > EDGE_BUFFER_SIZE) {
+		edgeVector.resize(nEdges);
+		edges = edgeVector.data();
+	}
+	for (size_t i=0; i<polygon.size(); ++i) {
+		IBKMK::Vector2D b = polygon[i];
+		IBKMK::Vector2D c = polygon[(i+1) % polygon.size()];
+		if (b.m_y > c.m_y)
+			std::swap(b,c);
+		PolygonEdge & e = edges[i];
+		e.m_bx = b.m_x;
+		e.m_by = b.m_y;
+		e.m_cx = c.m_x;
+		e.m_cy = c.m_y;
+		e.m_xMin = std::min(b.m_x, c.m_x);
+		e.m_xMax = std::max(b.m_x, c.m_x);
+		e.m_horizontal = (b.m_y == c.m_y);
+	}
+
+	switch (simdLevel()) {
+#if defined(IBKMK_SIMD_X86)
+		case SIMD_AVX2 : pointInPolygonAVX2(edges, nEdges, x, y, n, result); break;
+		case SIMD_SSE2 : pointInPolygonSSE2(edges, nEdges, x, y, n, result); break;
+#endif
+		default : pointInPolygonScalar(edges, nEdges, x, y, n, result);
+	}
+}
+
+
 void eliminateCollinearPoints(std::vector<IBKMK::Vector2D> & polygon, double epsilon) {
 	if (polygon.size()<2)
 		return;
@@ -60,6 +60,16 @@ bool intersectsLine2D(const std::vector<Vector2D> & polygon,
 */
 int pointInPolygon(const std::vector<Vector2D> & poly, const IBK::point2D<double> &p);
 
+/*! Batched point in polygon test for n points, given as separate coordinate arrays (structure of arrays).
+	Stores for each point the same result as the single-point version above in result[i].
+	Several points are tested at once using SIMD instructions (see simdLevel()).
+	\param	x Array with n x-coordinates of test points.
+	\param	y Array with n y-coordinates of test points.
+	\param	n Number of test points.
+	\param	result Array with space for n results.
+*/
+void pointInPolygon(const std::vector<Vector2D> & poly, const double * x, const double * y, unsigned int n, int * result);
+
 /*! Eliminates collinear points in a polygon.
 	All points that are closer together than the provided epsilon will be merged.
 */
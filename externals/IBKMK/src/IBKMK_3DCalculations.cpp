@@ -40,8 +40,13 @@
 #include "IBKMK_2DCalculations.h"
 
 #include "IBKMK_Vector3D.h"
+#include "IBKMK_SIMD.h"
 #include <IBK_messages.h>
 
+#if defined(IBKMK_SIMD_X86)
+	#include <immintrin.h>
+#endif
+
 namespace IBKMK {
 
 
@@ -130,6 +135,200 @@ bool planeCoordinates(const Vector3D & offset, const Vector3D & a, const Vector3
 }
 
 
+/* Data of the batched plane coordinate computation that is the same for all points. */
+struct PlaneCoordinatesData {
+	Vector3D		m_offset;
+	/* Normalized normal vector of plane. */
+	Vector3D		m_n;
+	/* If true, a and b are orthogonal and coordinates are computed by projection onto m_aNorm and m_bNorm. */
+	bool			m_orthogonal;
+	Vector3D		m_aNorm;
+	Vector3D		m_bNorm;
+	double			m_aMag;
+	double			m_bMag;
+	/* Otherwise, coordinates are computed with Cramer's rule from rows m_row1 and m_row2 (see solve()),
+		with coefficients m_a..m_d and determinant m_det.
+	*/
+	unsigned int	m_row1;
+	unsigned int	m_row2;
+	double			m_a;
+	double			m_b;
+	double			m_c;
+	double			m_d;
+	double			m_det;
+};
+
+
+/* Scalar kernel of the batched plane coordinate computation, also used for remaining points of SIMD kernels.
+	Same operations as in planeCoordinates() for a single point.
+*/
+static void planeCoordinatesScalar(const PlaneCoordinatesData & pd, const double * vx, const double * vy, const double * vz,
+								   unsigned int n, double * x, double * y)
+{
+	for (unsigned int i=0; i<n; ++i) {
+		double dist = (pd.m_offset.m_x - vx[i])*pd.m_n.m_x + (pd.m_offset.m_y - vy[i])*pd.m_n.m_y + (pd.m_offset.m_z - vz[i])*pd.m_n.m_z;
+		double rhs[3] = {
+			(vx[i] - pd.m_n.m_x*dist) - pd.m_offset.m_x,
+			(vy[i] - pd.m_n.m_y*dist) - pd.m_offset.m_y,
+			(vz[i] - pd.m_n.m_z*dist) - pd.m_offset.m_z
+		};
+		if (pd.m_orthogonal) {
+			x[i] = (rhs[0]*pd.m_aNorm.m_x + rhs[1]*pd.m_aNorm.m_y + rhs[2]*pd.m_aNorm.m_z) / pd.m_aMag;
+			y[i] = (rhs[0]*pd.m_bNorm.m_x + rhs[1]*pd.m_bNorm.m_y + rhs[2]*pd.m_bNorm.m_z) / pd.m_bMag;
+		}
+		else {
+			double e = rhs[pd.m_row1];
+			double f = rhs[pd.m_row2];
+			x[i] = (e*pd.m_d - pd.m_c*f)/pd.m_det;
+			y[i] = (pd.m_a*f - e*pd.m_b)/pd.m_det;
+		}
+	}
+}
+
+
+#if defined(IBKMK_SIMD_X86)
+
+/* SSE2 kernel of the batched plane coordinate computation, processes 2 points at a time. */
+static void planeCoordinatesSSE2(const PlaneCoordinatesData & pd, const double * vx, const double * vy, const double * vz,
+								 unsigned int n, double * x, double * y)
+{
+	const __m128d ox = _mm_set1_pd(pd.m_offset.m_x);
+	const __m128d oy = _mm_set1_pd(pd.m_offset.m_y);
+	const __m128d oz = _mm_set1_pd(pd.m_offset.m_z);
+	const __m128d nx = _mm_set1_pd(pd.m_n.m_x);
+	const __m128d ny = _mm_set1_pd(pd.m_n.m_y);
+	const __m128d nz = _mm_set1_pd(pd.m_n.m_z);
+	unsigned int i=0;
+	for (; i+2<=n; i+=2) {
+		__m128d px = _mm_loadu_pd(vx + i);
+		__m128d py = _mm_loadu_pd(vy + i);
+		__m128d pz = _mm_loadu_pd(vz + i);
+		__m128d dist = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_sub_pd(ox, px), nx), _mm_mul_pd(_mm_sub_pd(oy, py), ny)),
+								  _mm_mul_pd(_mm_sub_pd(oz, pz), nz));
+		__m128d rhs[3] = {
+			_mm_sub_pd(_mm_sub_pd(px, _mm_mul_pd(nx, dist)), ox),
+			_mm_sub_pd(_mm_sub_pd(py, _mm_mul_pd(ny, dist)), oy),
+			_mm_sub_pd(_mm_sub_pd(pz, _mm_mul_pd(nz, dist)), oz)
+		};
+		if (pd.m_orthogonal) {
+			__m128d xa = _mm_add_pd(_mm_add_pd(_mm_mul_pd(rhs[0], _mm_set1_pd(pd.m_aNorm.m_x)),
+											   _mm_mul_pd(rhs[1], _mm_set1_pd(pd.m_aNorm.m_y))),
+									_mm_mul_pd(rhs[2], _mm_set1_pd(pd.m_aNorm.m_z)));
+			__m128d yb = _mm_add_pd(_mm_add_pd(_mm_mul_pd(rhs[0], _mm_set1_pd(pd.m_bNorm.m_x)),
+											   _mm_mul_pd(rhs[1], _mm_set1_pd(pd.m_bNorm.m_y))),
+									_mm_mul_pd(rhs[2], _mm_set1_pd(pd.m_bNorm.m_z)));
+			_mm_storeu_pd(x + i, _mm_div_pd(xa, _mm_set1_pd(pd.m_aMag)));
+			_mm_storeu_pd(y + i, _mm_div_pd(yb, _mm_set1_pd(pd.m_bMag)));
+		}
+		else {
+			__m128d e = rhs[pd.m_row1];
+			__m128d f = rhs[pd.m_row2];
+			__m128d det = _mm_set1_pd(pd.m_det);
+			_mm_storeu_pd(x + i, _mm_div_pd(_mm_sub_pd(_mm_mul_pd(e, _mm_set1_pd(pd.m_d)), _mm_mul_pd(_mm_set1_pd(pd.m_c), f)), det));
+			_mm_storeu_pd(y + i, _mm_div_pd(_mm_sub_pd(_mm_mul_pd(_mm_set1_pd(pd.m_a), f), _mm_mul_pd(e, _mm_set1_pd(pd.m_b))), det));
+		}
+	}
+	planeCoordinatesScalar(pd, vx + i, vy + i, vz + i, n - i, x + i, y + i);
+}
+
+
+/* AVX2 kernel of the batched plane coordinate computation, processes 4 points at a time. */
+IBKMK_TARGET_AVX2
+static void planeCoordinatesAVX2(const PlaneCoordinatesData & pd, const double * vx, const double * vy, const double * vz,
+								 unsigned int n, double * x, double * y)
+{
+	const __m256d ox = _mm256_set1_pd(pd.m_offset.m_x);
+	const __m256d oy = _mm256_set1_pd(pd.m_offset.m_y);
+	const __m256d oz = _mm256_set1_pd(pd.m_offset.m_z);
+	const __m256d nx = _mm256_set1_pd(pd.m_n.m_x);
+	const __m256d ny = _mm256_set1_pd(pd.m_n.m_y);
+	const __m256d nz = _mm256_set1_pd(pd.m_n.m_z);
+	unsigned int i=0;
+	for (; i+4<=n; i+=4) {
+		__m256d px = _mm256_loadu_pd(vx + i);
+		__m256d py = _mm256_loadu_pd(vy + i);
+		__m256d pz = _mm256_loadu_pd(vz + i);
+		__m256d dist = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(ox, px), nx), _mm256_mul_pd(_mm256_sub_pd(oy, py), ny)),
+									 _mm256_mul_pd(_mm256_sub_pd(oz, pz), nz));
+		__m256d rhs[3] = {
+			_mm256_sub_pd(_mm256_sub_pd(px, _mm256_mul_pd(nx, dist)), ox),
+			_mm256_sub_pd(_mm256_sub_pd(py, _mm256_mul_pd(ny, dist)), oy),
+			_mm256_sub_pd(_mm256_sub_pd(pz, _mm256_mul_pd(nz, dist)), oz)
+		};
+		if (pd.m_orthogonal) {
+			__m256d xa = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(rhs[0], _mm256_set1_pd(pd.m_aNorm.m_x)),
+													 _mm256_mul_pd(rhs[1], _mm256_set1_pd(pd.m_aNorm.m_y))),
+									   _mm256_mul_pd(rhs[2], _mm256_set1_pd(pd.m_aNorm.m_z)));
+			__m256d yb = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(rhs[0], _mm256_set1_pd(pd.m_bNorm.m_x)),
+													 _mm256_mul_pd(rhs[1], _mm256_set1_pd(pd.m_bNorm.m_y))),
+									   _mm256_mul_pd(rhs[2], _mm256_set1_pd(pd.m_bNorm.m_z)));
+			_mm256_storeu_pd(x + i, _mm256_div_pd(xa, _mm256_set1_pd(pd.m_aMag)));
+			_mm256_storeu_pd(y + i, _mm256_div_pd(yb, _mm256_set1_pd(pd.m_bMag)));
+		}
+		else {
+			__m256d e = rhs[pd.m_row1];
+			__m256d f = rhs[pd.m_row2];
+			__m256d det = _mm256_set1_pd(pd.m_det);
+			_mm256_storeu_pd(x + i, _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(e, _mm256_set1_pd(pd.m_d)),
+																_mm256_mul_pd(_mm256_set1_pd(pd.m_c), f)), det));
+			_mm256_storeu_pd(y + i, _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(pd.m_a), f),
+																_mm256_mul_pd(e, _mm256_set1_pd(pd.m_b))), det));
+		}
+	}
+	planeCoordinatesScalar(pd, vx + i, vy + i, vz + i, n - i, x + i, y + i);
+}
+
+#endif // defined(IBKMK_SIMD_X86)
+
+
+bool planeCoordinates(const Vector3D & offset, const Vector3D & a, const Vector3D & b,
+					  const double * vx, const double * vy, const double * vz, unsigned int n,
+					  double * x, double * y)
+{
+	PlaneCoordinatesData pd;
+	pd.m_offset = offset;
+	pd.m_n = a.crossProduct(b);
+	pd.m_n.normalize();
+
+	pd.m_aNorm = a.normalized();
+	pd.m_bNorm = b.normalized();
+	pd.m_orthogonal = std::fabs(pd.m_aNorm.scalarProduct(pd.m_bNorm)) < 1e-10;
+	if (pd.m_orthogonal) {
+		pd.m_aMag = a.magnitude();
+		pd.m_bMag = b.magnitude();
+	}
+	else {
+		// select first pair of rows that yields a solvable equation system, in the same order as in solve()
+		const double av[3] = {a.m_x, a.m_y, a.m_z};
+		const double bv[3] = {b.m_x, b.m_y, b.m_z};
+		const unsigned int rows[3][2] = { {0,1}, {0,2}, {1,2} };
+		unsigned int k=0;
+		for (; k<3; ++k) {
+			pd.m_row1 = rows[k][0];
+			pd.m_row2 = rows[k][1];
+			pd.m_a = av[pd.m_row1];
+			pd.m_b = av[pd.m_row2];
+			pd.m_c = bv[pd.m_row1];
+			pd.m_d = bv[pd.m_row2];
+			pd.m_det = pd.m_a*pd.m_d - pd.m_b*pd.m_c;
+			if (!(std::fabs(pd.m_det) < 1e-4))
+				break;
+		}
+		if (k == 3)
+			return false;
+	}
+
+	switch (simdLevel()) {
+#if defined(IBKMK_SIMD_X86)
+		case SIMD_AVX2 : planeCoordinatesAVX2(pd, vx, vy, vz, n, x, y); break;
+		case SIMD_SSE2 : planeCoordinatesSSE2(pd, vx, vy, vz, n, x, y); break;
+#endif
+		default : planeCoordinatesScalar(pd, vx, vy, vz, n, x, y);
+	}
+	return true;
+}
+
+
 double lineToPointDistance(const Vector3D & a, const Vector3D & d, const Vector3D & p,
 												   double & lineFactor, Vector3D & p2)
 {
@@ -314,6 +513,114 @@ bool linePlaneIntersectionWithNormalCheck(const Vector3D & a, const Vector3D & n
 }
 
 
+/* Scalar kernel of the batched line-plane intersection, also used for remaining lines of SIMD kernels.
+	Same operations as in linePlaneIntersectionWithNormalCheck() for a single line.
+*/
+static void linePlaneIntersectionScalar(const Vector3D & a, const Vector3D & normal, const Vector3D & d, double d_dot_normal,
+										const double * px, const double * py, const double * pz, unsigned int n,
+										double * ix, double * iy, double * iz, double * dist)
+{
+	for (unsigned int i=0; i<n; ++i) {
+		double t = ((a.m_x - px[i])*normal.m_x + (a.m_y - py[i])*normal.m_y + (a.m_z - pz[i])*normal.m_z) / d_dot_normal;
+		ix[i] = px[i] + d.m_x*t;
+		iy[i] = py[i] + d.m_y*t;
+		iz[i] = pz[i] + d.m_z*t;
+		dist[i] = t;
+	}
+}
+
+
+#if defined(IBKMK_SIMD_X86)
+
+/* SSE2 kernel of the batched line-plane intersection, processes 2 lines at a time. */
+static void linePlaneIntersectionSSE2(const Vector3D & a, const Vector3D & normal, const Vector3D & d, double d_dot_normal,
+									  const double * px, const double * py, const double * pz, unsigned int n,
+									  double * ix, double * iy, double * iz, double * dist)
+{
+	const __m128d ax = _mm_set1_pd(a.m_x);
+	const __m128d ay = _mm_set1_pd(a.m_y);
+	const __m128d az = _mm_set1_pd(a.m_z);
+	const __m128d nx = _mm_set1_pd(normal.m_x);
+	const __m128d ny = _mm_set1_pd(normal.m_y);
+	const __m128d nz = _mm_set1_pd(normal.m_z);
+	const __m128d dx = _mm_set1_pd(d.m_x);
+	const __m128d dy = _mm_set1_pd(d.m_y);
+	const __m128d dz = _mm_set1_pd(d.m_z);
+	const __m128d dn = _mm_set1_pd(d_dot_normal);
+	unsigned int i=0;
+	for (; i+2<=n; i+=2) {
+		__m128d x = _mm_loadu_pd(px + i);
+		__m128d y = _mm_loadu_pd(py + i);
+		__m128d z = _mm_loadu_pd(pz + i);
+		__m128d t = _mm_div_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_sub_pd(ax, x), nx), _mm_mul_pd(_mm_sub_pd(ay, y), ny)),
+										  _mm_mul_pd(_mm_sub_pd(az, z), nz)), dn);
+		_mm_storeu_pd(ix + i, _mm_add_pd(x, _mm_mul_pd(dx, t)));
+		_mm_storeu_pd(iy + i, _mm_add_pd(y, _mm_mul_pd(dy, t)));
+		_mm_storeu_pd(iz + i, _mm_add_pd(z, _mm_mul_pd(dz, t)));
+		_mm_storeu_pd(dist + i, t);
+	}
+	linePlaneIntersectionScalar(a, normal, d, d_dot_normal, px + i, py + i, pz + i, n - i, ix + i, iy + i, iz + i, dist + i);
+}
+
+
+/* AVX2 kernel of the batched line-plane intersection, processes 4 lines at a time. */
+IBKMK_TARGET_AVX2
+static void linePlaneIntersectionAVX2(const Vector3D & a, const Vector3D & normal, const Vector3D & d, double d_dot_normal,
+									  const double * px, const double * py, const double * pz, unsigned int n,
+									  double * ix, double * iy, double * iz, double * dist)
+{
+	const __m256d ax = _mm256_set1_pd(a.m_x);
+	const __m256d ay = _mm256_set1_pd(a.m_y);
+	const __m256d az = _mm256_set1_pd(a.m_z);
+	const __m256d nx = _mm256_set1_pd(normal.m_x);
+	const __m256d ny = _mm256_set1_pd(normal.m_y);
+	const __m256d nz = _mm256_set1_pd(normal.m_z);
+	const __m256d dx = _mm256_set1_pd(d.m_x);
+	const __m256d dy = _mm256_set1_pd(d.m_y);
+	const __m256d dz = _mm256_set1_pd(d.m_z);
+	const __m256d dn = _mm256_set1_pd(d_dot_normal);
+	unsigned int i=0;
+	for (; i+4<=n; i+=4) {
+		__m256d x = _mm256_loadu_pd(px + i);
+		__m256d y = _mm256_loadu_pd(py + i);
+		__m256d z = _mm256_loadu_pd(pz + i);
+		__m256d t = _mm256_div_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(ax, x), nx),
+															  _mm256_mul_pd(_mm256_sub_pd(ay, y), ny)),
+												_mm256_mul_pd(_mm256_sub_pd(az, z), nz)), dn);
+		_mm256_storeu_pd(ix + i, _mm256_add_pd(x, _mm256_mul_pd(dx, t)));
+		_mm256_storeu_pd(iy + i, _mm256_add_pd(y, _mm256_mul_pd(dy, t)));
+		_mm256_storeu_pd(iz + i, _mm256_add_pd(z, _mm256_mul_pd(dz, t)));
+		_mm256_storeu_pd(dist + i, t);
+	}
+	linePlaneIntersectionScalar(a, normal, d, d_dot_normal, px + i, py + i, pz + i, n - i, ix + i, iy + i, iz + i, dist + i);
+}
+
+#endif // defined(IBKMK_SIMD_X86)
+
+
+bool linePlaneIntersectionWithNormalCheck(const Vector3D & a, const Vector3D & normal, const IBKMK::Vector3D & d,
+										  const double * px, const double * py, const double * pz, unsigned int n,
+										  double * ix, double * iy, double * iz, double * dist, bool checkNormal)
+{
+	// normal tests are the same for all lines, see single line version
+	double d_dot_normal = d.scalarProduct(normal);
+	double angle = d_dot_normal/d.magnitude();
+	if (angle < 1e-8 && angle > -1e-8)
+		return false;
+	if (checkNormal && angle >= 0)
+		return false;
+
+	switch (simdLevel()) {
+#if defined(IBKMK_SIMD_X86)
+		case SIMD_AVX2 : linePlaneIntersectionAVX2(a, normal, d, d_dot_normal, px, py, pz, n, ix, iy, iz, dist); break;
+		case SIMD_SSE2 : linePlaneIntersectionSSE2(a, normal, d, d_dot_normal, px, py, pz, n, ix, iy, iz, dist); break;
+#endif
+		default : linePlaneIntersectionScalar(a, normal, d, d_dot_normal, px, py, pz, n, ix, iy, iz, dist);
+	}
+	return true;
+}
+
+
 bool linePlaneIntersection(const Vector3D & a, const Vector3D & normal, const Vector3D & p,
 		const IBKMK::Vector3D & d, IBKMK::Vector3D & intersectionPoint, double & dist)
 {
@@ -48,6 +48,22 @@ bool planeCoordinates(const Vector3D & offset, const Vector3D & a, const Vector3
 					  const Vector3D & v, double & x, double & y,
 					  double tolerance = 1e-4, bool showWarings = false);
 
+/*! Batched version of planeCoordinates() for n points, given as separate coordinate arrays (structure of arrays).
+	Computes the same plane coordinates as the single-point version (without tolerance check), but the method
+	of solving the equation system is selected only once for all points. Several points are processed
+	at once using SIMD instructions (see simdLevel()).
+	\param	vx Array with n x-coordinates of points.
+	\param	vy Array with n y-coordinates of points.
+	\param	vz Array with n z-coordinates of points.
+	\param	n Number of points.
+	\param	x Array with space for n plane coordinates (factors for vector a).
+	\param	y Array with space for n plane coordinates (factors for vector b).
+	\return Returns false, if no solution could be found (same for all points), in this case x and y are not modified.
+*/
+bool planeCoordinates(const Vector3D & offset, const Vector3D & a, const Vector3D & b,
+					  const double * vx, const double * vy, const double * vz, unsigned int n,
+					  double * x, double * y);
+
 
 /*! Computes the distance between a line (defined through offset point a, and directional vector d) and a point p.
 	\return Returns the shortest distance between line and point. Factor lineFactor contains the scale factor for
@@ -82,6 +98,26 @@ bool lineShereIntersection(const Vector3D & a, const Vector3D & d, const Vector3
 bool linePlaneIntersectionWithNormalCheck(const Vector3D & a, const Vector3D & normal, const Vector3D & p,
 						   const IBKMK::Vector3D & lineVector, IBKMK::Vector3D & intersectionPoint, double & dist, bool checkNormal = true);
 
+/*! Batched version of linePlaneIntersectionWithNormalCheck() for n parallel lines with common line vector 'lineVector',
+	given by points in separate coordinate arrays (structure of arrays).
+	Computes the same intersection points as the single-point version. Since parallel and normal vector checks
+	depend only on the common line vector, they are done once for all lines. Several lines are processed
+	at once using SIMD instructions (see simdLevel()).
+	\param	px Array with n x-coordinates of line points.
+	\param	py Array with n y-coordinates of line points.
+	\param	pz Array with n z-coordinates of line points.
+	\param	n Number of lines.
+	\param	ix Array with space for n x-coordinates of intersection points.
+	\param	iy Array with space for n y-coordinates of intersection points.
+	\param	iz Array with space for n z-coordinates of intersection points.
+	\param	dist Array with space for n line factors.
+	\return Returns false, if lines are parallel to the plane or point into the direction of the normal vector
+		(and checkNormal is true). In this case, the output arrays are not modified.
+*/
+bool linePlaneIntersectionWithNormalCheck(const Vector3D & a, const Vector3D & normal, const IBKMK::Vector3D & lineVector,
+						   const double * px, const double * py, const double * pz, unsigned int n,
+						   double * ix, double * iy, double * iz, double * dist, bool checkNormal = true);
+
 /*! Calculates intersection of a line with a plane.
 	Plane is given by offset 'a' and normal vector 'normal'.
 	Line is given by point 'p' and its line vector 'd'.
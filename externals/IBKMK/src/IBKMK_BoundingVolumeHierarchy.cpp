@@ -0,0 +1,216 @@
+/*	IBK Math Kernel Library
+	Copyright (c) 2001-today, Institut fuer Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, A. Paepcke, H. Fechner, St. Vogelsang
+	All rights reserved.
+
+	This file is part of the IBKMK Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+	This library contains derivative work based on other open-source libraries,
+	see LICENSE and OTHER_LICENSES files.
+
+*/
+
+#include "IBKMK_BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <IBK_assert.h>
+
+namespace IBKMK {
+
+/*! Maximum number of objects in a leaf node. */
+const unsigned int BVH_LEAF_SIZE = 4;
+
+/*! Returns coordinate k (0 = x, 1 = y, 2 = z) of vector v. */
+static inline double coordinate(const IBKMK::Vector3D & v, unsigned int k) {
+	return k == 0 ? v.m_x : (k == 1 ? v.m_y : v.m_z);
+}
+
+
+BoundingVolumeHierarchy::Box BoundingVolumeHierarchy::boundingBox(const std::vector<IBKMK::Vector3D> & points, double margin) {
+	Box b;
+	for (unsigned int k=0; k<3; ++k) {
+		b.m_min[k] = std::numeric_limits<double>::max();
+		b.m_max[k] = -std::numeric_limits<double>::max();
+	}
+	for (const IBKMK::Vector3D & v : points) {
+		for (unsigned int k=0; k<3; ++k) {
+			b.m_min[k] = std::min(b.m_min[k], coordinate(v, k));
+			b.m_max[k] = std::max(b.m_max[k], coordinate(v, k));
+		}
+	}
+	for (unsigned int k=0; k<3; ++k) {
+		b.m_min[k] -= margin;
+		b.m_max[k] += margin;
+	}
+	return b;
+}
+
+
+void BoundingVolumeHierarchy::build(const std::vector<Box> & boxes) {
+	m_boxes = boxes;
+	m_indexes.resize(boxes.size());
+	m_nodes.clear();
+
+	std::vector<IBKMK::Vector3D> centroids(boxes.size());
+	for (unsigned int i=0; i<boxes.size(); ++i) {
+		const Box & b = boxes[i];
+		centroids[i] = IBKMK::Vector3D(0.5*(b.m_min[0] + b.m_max[0]),
+									   0.5*(b.m_min[1] + b.m_max[1]),
+									   0.5*(b.m_min[2] + b.m_max[2]));
+		m_indexes[i] = i;
+	}
+
+	if (boxes.empty())
+		return;
+
+	// a balanced tree has less than 2*n/BVH_LEAF_SIZE nodes
+	m_nodes.reserve(2*boxes.size()/BVH_LEAF_SIZE + 1);
+	buildNode(0, (unsigned int)boxes.size(), centroids);
+}
+
+
+void BoundingVolumeHierarchy::clear() {
+	m_boxes.clear();
+	m_indexes.clear();
+	m_nodes.clear();
+}
+
+
+void BoundingVolumeHierarchy::collectCandidates(const IBKMK::Vector3D & pMin, const IBKMK::Vector3D & pMax,
+												const IBKMK::Vector3D & d, std::vector<unsigned int> & candidates) const
+{
+	candidates.clear();
+	if (m_nodes.empty())
+		return;
+
+	// depth-first traversal; tree depth is about log2(n/BVH_LEAF_SIZE), so a fixed size stack is sufficient
+	unsigned int stack[64];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0) {
+		const Node & node = m_nodes[stack[--stackSize]];
+		if (!linesHitBox(pMin, pMax, d, node.m_box))
+			continue;
+		if (node.m_count > 0) {
+			candidates.insert(candidates.end(), m_indexes.begin() + node.m_index,
+							  m_indexes.begin() + node.m_index + node.m_count);
+		}
+		else {
+			IBK_ASSERT(stackSize + 2 <= 64);
+			stack[stackSize++] = node.m_index;									// right child
+			stack[stackSize++] = (unsigned int)(&node - m_nodes.data()) + 1;	// left child
+		}
+	}
+}
+
+
+unsigned int BoundingVolumeHierarchy::buildNode(unsigned int first, unsigned int last,
+												const std::vector<IBKMK::Vector3D> & centroids)
+{
+	unsigned int nodeIdx = (unsigned int)m_nodes.size();
+	m_nodes.push_back(Node());
+
+	// compute bounding box of all objects and of their centroids
+	Box box, centroidBox;
+	for (unsigned int k=0; k<3; ++k) {
+		box.m_min[k] = centroidBox.m_min[k] = std::numeric_limits<double>::max();
+		box.m_max[k] = centroidBox.m_max[k] = -std::numeric_limits<double>::max();
+	}
+	for (unsigned int i=first; i<last; ++i) {
+		const Box & b = m_boxes[m_indexes[i]];
+		for (unsigned int k=0; k<3; ++k) {
+			box.m_min[k] = std::min(box.m_min[k], b.m_min[k]);
+			box.m_max[k] = std::max(box.m_max[k], b.m_max[k]);
+			double c = coordinate(centroids[m_indexes[i]], k);
+			centroidBox.m_min[k] = std::min(centroidBox.m_min[k], c);
+			centroidBox.m_max[k] = std::max(centroidBox.m_max[k], c);
+		}
+	}
+	m_nodes[nodeIdx].m_box = box;
+
+	// split along axis with largest centroid extent
+	unsigned int axis = 0;
+	for (unsigned int k=1; k<3; ++k)
+		if (centroidBox.m_max[k] - centroidBox.m_min[k] > centroidBox.m_max[axis] - centroidBox.m_min[axis])
+			axis = k;
+
+	// create leaf node for few objects or if all centroids coincide (no meaningful split possible)
+	if (last - first <= BVH_LEAF_SIZE || centroidBox.m_max[axis] - centroidBox.m_min[axis] <= 0) {
+		m_nodes[nodeIdx].m_index = first;
+		m_nodes[nodeIdx].m_count = last - first;
+		return nodeIdx;
+	}
+
+	// median split
+	unsigned int mid = (first + last)/2;
+	std::nth_element(m_indexes.begin() + first, m_indexes.begin() + mid, m_indexes.begin() + last,
+		[&centroids, axis](unsigned int a, unsigned int b) {
+			return coordinate(centroids[a], axis) < coordinate(centroids[b], axis);
+		});
+
+	// left child is stored directly after this node
+	buildNode(first, mid, centroids);
+	unsigned int rightIdx = buildNode(mid, last, centroids);
+	m_nodes[nodeIdx].m_index = rightIdx;
+	m_nodes[nodeIdx].m_count = 0;
+	return nodeIdx;
+}
+
+
+bool BoundingVolumeHierarchy::linesHitBox(const IBKMK::Vector3D & pMin, const IBKMK::Vector3D & pMax,
+										  const IBKMK::Vector3D & d, const Box & b)
+{
+	double tMin = -std::numeric_limits<double>::max();
+	double tMax = std::numeric_limits<double>::max();
+	for (unsigned int k=0; k<3; ++k) {
+		double oMin = coordinate(pMin, k);
+		double oMax = coordinate(pMax, k);
+		double dk = coordinate(d, k);
+		if (dk == 0) {
+			// lines parallel to slab: origins must overlap box along this axis
+			if (oMax < b.m_min[k] || oMin > b.m_max[k])
+				return false;
+			continue;
+		}
+		// origin interval [oMin + t*dk, oMax + t*dk] overlaps [b.m_min, b.m_max] for t between t1 and t2
+		double t1 = (b.m_min[k] - oMax)/dk;
+		double t2 = (b.m_max[k] - oMin)/dk;
+		if (t1 > t2)
+			std::swap(t1, t2);
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax)
+			return false;
+	}
+	return true;
+}
+
+} // namespace IBKMK
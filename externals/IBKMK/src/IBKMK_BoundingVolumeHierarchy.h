@@ -0,0 +1,131 @@
+/*	IBK Math Kernel Library
+	Copyright (c) 2001-today, Institut fuer Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, A. Paepcke, H. Fechner, St. Vogelsang
+	All rights reserved.
+
+	This file is part of the IBKMK Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+	This library contains derivative work based on other open-source libraries,
+	see LICENSE and OTHER_LICENSES files.
+
+*/
+
+#ifndef IBKMK_BoundingVolumeHierarchyH
+#define IBKMK_BoundingVolumeHierarchyH
+
+#include <vector>
+
+#include "IBKMK_Vector3D.h"
+
+namespace IBKMK {
+
+/*! Bounding volume hierarchy (binary tree of axis-aligned bounding boxes) over a set of objects.
+
+	The tree is built for the bounding boxes of the objects (see boundingBox()) and is used to quickly find all
+	objects whose boxes are hit by a line, for example sun beams in the shading calculation or the line-of-sight
+	when picking objects in the 3D scene. The exact (and expensive) intersection tests are then only done for
+	these candidates.
+
+	Lines are not limited (t arbitrary in p + t*d), i.e. boxes on both sides of the line origin are candidates.
+	All queries are read-only and can be used concurrently from several threads.
+*/
+class BoundingVolumeHierarchy {
+public:
+	/*! Axis-aligned bounding box, stored as array for easy per-axis access. */
+	struct Box {
+		double	m_min[3];
+		double	m_max[3];
+	};
+
+	/*! Returns bounding box of the given points, enlarged by margin in all directions.
+		A margin > 0 gives flat objects a non-zero box volume, so that hits on their boundaries are never
+		missed due to round-off.
+	*/
+	static Box boundingBox(const std::vector<IBKMK::Vector3D> & points, double margin);
+
+	/*! Builds tree for the given bounding boxes. Object indexes returned by queries refer to this vector. */
+	void build(const std::vector<Box> & boxes);
+
+	/*! Removes all boxes and nodes. */
+	void clear();
+
+	/*! Collects indexes of all objects whose bounding box is intersected by at least one line through
+		a point in the box [pMin, pMax] with direction d (packet query, all lines are parallel).
+		The result is conservative, i.e. it may contain objects not hit by any of the lines.
+		For a single line pass the line origin as pMin and pMax.
+		\param pMin Lower corner of bounding box of line origins.
+		\param pMax Upper corner of bounding box of line origins.
+		\param d Line direction (needs not be normalized).
+		\param candidates Vector with object indexes, cleared and filled in function.
+	*/
+	void collectCandidates(const IBKMK::Vector3D & pMin, const IBKMK::Vector3D & pMax, const IBKMK::Vector3D & d,
+						   std::vector<unsigned int> & candidates) const;
+
+	/*! Returns true if the line through p with direction d intersects the bounding box of object idx. */
+	bool lineHitsBox(unsigned int idx, const IBKMK::Vector3D & p, const IBKMK::Vector3D & d) const {
+		return linesHitBox(p, p, d, m_boxes[idx]);
+	}
+
+	/*! Number of objects in tree. */
+	unsigned int size() const { return (unsigned int)m_boxes.size(); }
+
+private:
+	/*! A tree node, either inner node or leaf.
+		Nodes are stored in depth-first order, so the left child of an inner node follows the node directly.
+	*/
+	struct Node {
+		/*! Bounding box of all objects in this node. */
+		Box				m_box;
+		/*! For inner nodes index of the right child node, for leaf nodes index of the first object in m_indexes. */
+		unsigned int	m_index;
+		/*! Number of objects in leaf node, 0 for inner nodes. */
+		unsigned int	m_count;
+	};
+
+	/*! Recursively creates node for object indexes m_indexes[first...last) and returns its index. */
+	unsigned int buildNode(unsigned int first, unsigned int last, const std::vector<IBKMK::Vector3D> & centroids);
+
+	/*! Returns true if at least one line through a point in [pMin, pMax] with direction d intersects box b.
+		For each axis the interval of line factors is computed where the moving origin box overlaps b along
+		this axis; the lines may hit b only if the intervals of all axes overlap.
+	*/
+	static bool linesHitBox(const IBKMK::Vector3D & pMin, const IBKMK::Vector3D & pMax, const IBKMK::Vector3D & d,
+							const Box & b);
+
+	/*! Bounding boxes of all objects (index matches box vector passed to build()). */
+	std::vector<Box>			m_boxes;
+	/*! Object indexes, sorted such that the objects of each leaf node are stored consecutively. */
+	std::vector<unsigned int>	m_indexes;
+	/*! All nodes of the tree, root node has index 0. */
+	std::vector<Node>			m_nodes;
+};
+
+} // namespace IBKMK
+
+#endif // IBKMK_BoundingVolumeHierarchyH
@@ -0,0 +1,101 @@
+/*	IBK Math Kernel Library
+	Copyright (c) 2001-today, Institut fuer Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, A. Paepcke, H. Fechner, St. Vogelsang
+	All rights reserved.
+
+	This file is part of the IBKMK Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+	This library contains derivative work based on other open-source libraries,
+	see LICENSE and OTHER_LICENSES files.
+
+*/
+
+#include "IBKMK_SIMD.h"
+
+#include <atomic>
+
+#if defined(IBKMK_SIMD_X86) && defined(_MSC_VER)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+namespace IBKMK {
+
+/*! Currently selected instruction set level, -1 if not yet initialized. */
+static std::atomic<int> s_simdLevel(-1);
+
+/*! Returns the best instruction set level supported by CPU and operating system. */
+static SimdLevel detectSimdLevel() {
+#if defined(IBKMK_SIMD_X86)
+#if defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 0);
+	if (regs[0] >= 7) {
+		__cpuid(regs, 1);
+		bool osxsave = (regs[2] & (1 << 27)) != 0;
+		bool avx = (regs[2] & (1 << 28)) != 0;
+		// operating system must save/restore the YMM registers
+		if (osxsave && avx && (_xgetbv(0) & 6) == 6) {
+			__cpuidex(regs, 7, 0);
+			if ((regs[1] & (1 << 5)) != 0)
+				return SIMD_AVX2;
+		}
+	}
+	return SIMD_SSE2;
+#else
+	// __builtin_cpu_supports also checks that the operating system supports the AVX registers
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return SIMD_AVX2;
+	return SIMD_SSE2;
+#endif
+#else
+	return SIMD_Scalar;
+#endif
+}
+
+
+SimdLevel simdLevel() {
+	int level = s_simdLevel.load(std::memory_order_relaxed);
+	if (level < 0) {
+		level = detectSimdLevel();
+		s_simdLevel.store(level, std::memory_order_relaxed);
+	}
+	return (SimdLevel)level;
+}
+
+
+void setSimdLevel(SimdLevel level) {
+	SimdLevel supported = detectSimdLevel();
+	if (level > supported)
+		level = supported;
+	s_simdLevel.store(level, std::memory_order_relaxed);
+}
+
+} // namespace IBKMK
@@ -0,0 +1,79 @@
+/*	IBK Math Kernel Library
+	Copyright (c) 2001-today, Institut fuer Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, A. Paepcke, H. Fechner, St. Vogelsang
+	All rights reserved.
+
+	This file is part of the IBKMK Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+	This library contains derivative work based on other open-source libraries,
+	see LICENSE and OTHER_LICENSES files.
+
+*/
+
+#ifndef IBKMK_SIMDH
+#define IBKMK_SIMDH
+
+// Batched geometry kernels (see IBKMK_2DCalculations.h and IBKMK_3DCalculations.h) are implemented with
+// SSE2 and AVX2 intrinsics on x86-64 platforms. The AVX2 variants are compiled with function-specific target
+// attributes, so that the library itself can still be compiled for the SSE2 baseline.
+#if defined(__x86_64__) || defined(_M_X64)
+	#define IBKMK_SIMD_X86
+	#if defined(__GNUC__) || defined(__clang__)
+		#define IBKMK_TARGET_AVX2 __attribute__((target("avx2")))
+	#else
+		#define IBKMK_TARGET_AVX2
+	#endif
+#endif
+
+namespace IBKMK {
+
+/*! Instruction set levels for batched geometry kernels. */
+enum SimdLevel {
+	/*! Plain C++ code, one point at a time. */
+	SIMD_Scalar,
+	/*! SSE2 code, 2 points at a time (always available on x86-64). */
+	SIMD_SSE2,
+	/*! AVX2 code, 4 points at a time. */
+	SIMD_AVX2
+};
+
+/*! Returns the instruction set level used by the batched geometry kernels.
+	On first call, the best level supported by CPU and operating system is detected.
+*/
+SimdLevel simdLevel();
+
+/*! Sets the instruction set level used by the batched geometry kernels, for example to compare
+	the different kernel variants in benchmarks.
+	Levels not supported by the CPU are reduced to the best supported level.
+*/
+void setSimdLevel(SimdLevel level);
+
+} // namespace IBKMK
+
+#endif // IBKMK_SIMDH
@@ -0,0 +1,277 @@
+/*	Benchmark and test of SOLFRA::CheckpointWriter.
+
+	1. Round trip: checkpoints are written in append mode, with full and with incremental writing and
+	   read back after each checkpoint. Data must be identical.
+	2. Backups: with 3 backup files and no minimum interval, the restart file and the backup files must
+	   hold the last checkpoints in order.
+	3. Timing: write time per checkpoint for full and incremental writing of a large data block, where
+	   a quarter of the data changes between checkpoints.
+	4. Interrupted writing (not on Windows): a child process writes checkpoints incrementally and is
+	   killed after a random time. The restart file left behind must either hold a consistent checkpoint
+	   or be marked incomplete (time point NaN), it must never hold a time point with mismatching data.
+
+	Files are written into the given directory (default: current directory) and removed afterwards.
+
+	Usage: CheckpointWriterBenchmark [<working directory>]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#endif // !defined(_WIN32)
+
+#include <IBK_Path.h>
+#include <IBK_Exception.h>
+#include <IBK_StopWatch.h>
+
+#include <SOLFRA_CheckpointWriter.h>
+
+/*! Number of doubles in a chunk of the checkpoint writer (see CHECKPOINT_CHUNK_SIZE). */
+const unsigned int CHUNK_SIZE = 512;
+
+
+/*! Fills data of checkpoint k. Between two checkpoints, every fourth chunk changes. */
+void fillCheckpoint(unsigned int k, double * data, unsigned int n) {
+	for (unsigned int i=0; i<n; ++i)
+		data[i] = i + 1e7*((k + (i/CHUNK_SIZE) % 4)/4);
+}
+
+
+/*! Returns true if data holds the data of checkpoint k. */
+bool checkpointMatches(unsigned int k, const std::vector<double> & data) {
+	std::vector<double> expected(data.size());
+	fillCheckpoint(k, expected.data(), expected.size());
+	return data == expected;
+}
+
+
+/*! Reads block with given index from a restart file. Returns false if block cannot be read. */
+bool readBlock(const IBK::Path & fname, unsigned int block, double & t, std::vector<double> & data) {
+	std::ifstream in(fname.c_str(), std::ios_base::binary);
+	unsigned int n;
+	if (!in.read((char *)&t, sizeof(double)) || !in.read((char *)&n, sizeof(unsigned int)))
+		return false;
+	std::streamoff blockSize = sizeof(double) + sizeof(unsigned int) + n*sizeof(double);
+	in.seekg(block*blockSize);
+	in.read((char *)&t, sizeof(double));
+	in.read((char *)&n, sizeof(unsigned int));
+	data.resize(n);
+	in.read((char *)data.data(), n*sizeof(double));
+	return (bool)in;
+}
+
+
+/*! Returns true if block in restart file holds checkpoint k. */
+bool blockMatches(const IBK::Path & fname, unsigned int block, unsigned int k) {
+	double t;
+	std::vector<double> data;
+	if (!readBlock(fname, block, t, data))
+		return false;
+	return t == k && checkpointMatches(k, data);
+}
+
+
+/*! Removes restart file, temporary file and backup files. */
+void removeFiles(const IBK::Path & fname) {
+	for (const char * suffix : { "", ".tmp", ".bak", ".bak2", ".bak3" })
+		std::remove((fname.str() + suffix).c_str());
+}
+
+
+/*! Writes checkpoints and checks the restart file after each checkpoint. Returns number of failures. */
+unsigned int roundTrip(const IBK::Path & fname, bool appendMode, bool incremental) {
+	const unsigned int n = 10000;
+	removeFiles(fname);
+	unsigned int failures = 0;
+	{
+		SOLFRA::CheckpointWriter writer;
+		writer.setup(fname, appendMode, n, 0, 0, incremental);
+		for (unsigned int k=0; k<8; ++k) {
+			fillCheckpoint(k, writer.snapshotBuffer(), n);
+			writer.write(k);
+			writer.flush();
+			if (appendMode) {
+				for (unsigned int j=0; j<=k; ++j)
+					if (!blockMatches(fname, j, j))
+						++failures;
+			}
+			else if (!blockMatches(fname, 0, k) || blockMatches(fname, 1, k)) {
+				++failures;
+			}
+		}
+	}
+	removeFiles(fname);
+	return failures;
+}
+
+
+/*! Writes checkpoints with backups and checks restart file and backup files. Returns number of failures. */
+unsigned int backups(const IBK::Path & fname, bool incremental) {
+	const unsigned int n = 10000;
+	removeFiles(fname);
+	unsigned int failures = 0;
+	{
+		SOLFRA::CheckpointWriter writer;
+		writer.setup(fname, false, n, 3, 0, incremental);
+		for (unsigned int k=0; k<6; ++k) {
+			// backups are created if more than backupInterval has passed, wait a little to be sure
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			fillCheckpoint(k, writer.snapshotBuffer(), n);
+			writer.write(k);
+		}
+		writer.flush();
+	}
+	if (!blockMatches(fname, 0, 5)) ++failures;
+	if (!blockMatches(fname + ".bak", 0, 4)) ++failures;
+	if (!blockMatches(fname + ".bak2", 0, 3)) ++failures;
+	if (!blockMatches(fname + ".bak3", 0, 2)) ++failures;
+	removeFiles(fname);
+	return failures;
+}
+
+
+/*! Returns average time in [ms] for writing a checkpoint. */
+double writeTime(const IBK::Path & fname, unsigned int n, bool incremental) {
+	const unsigned int count = 16;
+	removeFiles(fname);
+	SOLFRA::CheckpointWriter writer;
+	writer.setup(fname, false, n, 0, 0, incremental);
+	// first checkpoint is always written completely
+	fillCheckpoint(0, writer.snapshotBuffer(), n);
+	writer.write(0);
+	writer.flush();
+	double ms = 0;
+	for (unsigned int k=1; k<=count; ++k) {
+		fillCheckpoint(k, writer.snapshotBuffer(), n);
+		IBK::StopWatch w;
+		writer.write(k);
+		writer.flush();
+		ms += w.difference();
+	}
+	removeFiles(fname);
+	return ms/count;
+}
+
+
+#if !defined(_WIN32)
+
+/*! Results of interrupted write operations. */
+struct KillStatistics {
+	unsigned int	m_missing = 0;
+	unsigned int	m_valid = 0;
+	unsigned int	m_incomplete = 0;
+	unsigned int	m_corrupt = 0;
+};
+
+
+/*! Kills a process writing checkpoints incrementally and checks the restart file left behind. */
+void killWriter(const IBK::Path & fname, unsigned int n, unsigned int delayMicroSeconds, KillStatistics & stats) {
+	removeFiles(fname);
+	pid_t pid = fork();
+	if (pid == 0) {
+		try {
+			SOLFRA::CheckpointWriter writer;
+			writer.setup(fname, false, n, 0, 0, true);
+			for (unsigned int k=0; ; ++k) {
+				fillCheckpoint(k, writer.snapshotBuffer(), n);
+				writer.write(k);
+			}
+		}
+		catch (IBK::Exception & ex) {
+			std::cerr << ex.what() << std::endl;
+		}
+		_exit(EXIT_FAILURE);
+	}
+	std::this_thread::sleep_for(std::chrono::microseconds(delayMicroSeconds));
+	kill(pid, SIGKILL);
+	waitpid(pid, nullptr, 0);
+
+	double t;
+	std::vector<double> data;
+	if (!readBlock(fname, 0, t, data))
+		++stats.m_missing;
+	else if (std::isnan(t))
+		++stats.m_incomplete;
+	else if (checkpointMatches((unsigned int)t, data))
+		++stats.m_valid;
+	else
+		++stats.m_corrupt;
+	removeFiles(fname);
+}
+
+#endif // !defined(_WIN32)
+
+
+int main(int argc, char * argv[]) {
+	IBK::Path workingDir(".");
+	if (argc > 1)
+		workingDir = IBK::Path(argv[1]);
+	IBK::Path fname = workingDir / "CheckpointWriterBenchmark_restart.bin";
+
+	unsigned int failures = 0;
+	try {
+		// *** round trip ***
+
+		unsigned int f = roundTrip(fname, true, false);
+		std::cout << "Round trip, append mode:           " << f << " failures" << std::endl;
+		failures += f;
+		f = roundTrip(fname, false, false);
+		std::cout << "Round trip, full writing:          " << f << " failures" << std::endl;
+		failures += f;
+		f = roundTrip(fname, false, true);
+		std::cout << "Round trip, incremental writing:   " << f << " failures" << std::endl;
+		failures += f;
+
+		// *** backups ***
+
+		f = backups(fname, false);
+		std::cout << "Backups, full writing:             " << f << " failures" << std::endl;
+		failures += f;
+		f = backups(fname, true);
+		std::cout << "Backups, incremental writing:      " << f << " failures" << std::endl;
+		failures += f;
+
+		// *** timing ***
+
+		for (unsigned int n : { 100000u, 4000000u }) {
+			std::cout << std::setw(8) << n << " doubles, write time per checkpoint: full "
+					  << std::setw(8) << std::fixed << std::setprecision(2) << writeTime(fname, n, false) << " ms, incremental "
+					  << std::setw(8) << writeTime(fname, n, true) << " ms" << std::endl;
+		}
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		return EXIT_FAILURE;
+	}
+
+	// *** interrupted writing ***
+
+#if !defined(_WIN32)
+	KillStatistics stats;
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<unsigned int> delay(10000, 80000);
+	const unsigned int runs = 200;
+	for (unsigned int i=0; i<runs; ++i)
+		killWriter(fname, 1000000, delay(rng), stats);
+	std::cout << runs << " killed writer processes, restart file missing: " << stats.m_missing
+			  << ", valid: " << stats.m_valid << ", marked incomplete: " << stats.m_incomplete
+			  << ", corrupt: " << stats.m_corrupt << std::endl;
+	failures += stats.m_corrupt;
+#endif // !defined(_WIN32)
+
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
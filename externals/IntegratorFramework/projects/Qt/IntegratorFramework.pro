@@ -28,6 +28,7 @@ INCLUDEPATH += \
 DEPENDPATH = $$INCLUDEPATH
 
 HEADERS += \
+	../../src/SOLFRA_CheckpointWriter.h \
 	../../src/SOLFRA_Constants.h \
 	../../src/SOLFRA_FMUModelInterface.h \
 	../../src/SOLFRA_IntegratorADI.h \
@@ -70,6 +71,7 @@ HEADERS += \
 	../../src/SOLFRA_SolverFeedback.h
 
 SOURCES += \
+	../../src/SOLFRA_CheckpointWriter.cpp \
 	../../src/SOLFRA_Constants.cpp \
 	../../src/SOLFRA_IntegratorADI.cpp \
 	../../src/SOLFRA_IntegratorErrorControlled.cpp \
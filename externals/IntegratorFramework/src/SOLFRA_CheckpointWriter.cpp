@@ -0,0 +1,278 @@
+/*	Solver Control Framework
+	Copyright (C) 2010  Andreas Nicolai <andreas.nicolai -[at]- tu-dresden.de>
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SOLFRA_CheckpointWriter.h"
+
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <limits>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif // _WIN32
+
+#include <IBK_messages.h>
+#include <IBK_FormatString.h>
+#include <IBK_Exception.h>
+#include <IBK_FileUtils.h>
+
+namespace SOLFRA {
+
+/*! Number of doubles compared and written at once in incremental mode (4 kB). */
+const unsigned int CHECKPOINT_CHUNK_SIZE = 512;
+
+const double CheckpointWriter::INCOMPLETE_CHECKPOINT_TIME = std::numeric_limits<double>::quiet_NaN();
+
+
+/*! Renames file source to target, replaces target if it exists (atomically, where supported by the OS).
+	We do not use IBK::Path::move() here, since it is meant for directories as well and way too slow.
+*/
+static bool replaceFile(const IBK::Path & source, const IBK::Path & target) {
+#if defined(_WIN32)
+	return MoveFileExW(source.wstrOS().c_str(), target.wstrOS().c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	return std::rename(source.c_str(), target.c_str()) == 0;
+#endif
+}
+
+
+CheckpointWriter::CheckpointWriter() {
+}
+
+
+CheckpointWriter::~CheckpointWriter() {
+	FUNCID(CheckpointWriter::~CheckpointWriter);
+	if (m_writerThread == nullptr)
+		return;
+
+	// complete pending write operation
+	try {
+		flush();
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		IBK::IBK_Message("Error writing last restart data.", IBK::MSG_ERROR, FUNC_ID);
+	}
+
+	// terminate writer thread
+	{
+		std::unique_lock<std::mutex> lock(m_writerMutex);
+		m_stopWriter = true;
+	}
+	m_writerCondition.notify_all();
+	m_writerThread->join();
+	delete m_writerThread;
+}
+
+
+void CheckpointWriter::setup(const IBK::Path & restartFile, bool appendMode, unsigned int dataSize,
+							 unsigned int backupCount, double backupInterval, bool incremental)
+{
+	m_restartFile = restartFile;
+	m_appendMode = appendMode;
+	m_backupCount = backupCount;
+	m_backupInterval = backupInterval*1000;
+	m_incremental = incremental && !appendMode;
+
+	m_snapshot.resize(dataSize);
+	m_writeBuffer.resize(dataSize);
+	if (m_incremental)
+		m_lastWritten.resize(dataSize);
+	// we do not know the current content of the restart file
+	m_lastWrittenValid = false;
+
+	m_backupWatch.start();
+}
+
+
+double * CheckpointWriter::snapshotBuffer() {
+	// solver must not touch the buffer before writer thread is done swapping
+	flush();
+	return m_snapshot.data();
+}
+
+
+void CheckpointWriter::write(double t) {
+	// writer is idle (snapshotBuffer() has been called before), so we can swap buffers without lock
+	m_snapshot.swap(m_writeBuffer);
+	m_writeTime = t;
+
+	// start writer thread on first use
+	if (m_writerThread == nullptr)
+		m_writerThread = new std::thread(&CheckpointWriter::writerThreadLoop, this);
+
+	{
+		std::unique_lock<std::mutex> lock(m_writerMutex);
+		m_writeRequested = true;
+	}
+	m_writerCondition.notify_all();
+}
+
+
+void CheckpointWriter::flush() {
+	FUNCID(CheckpointWriter::flush);
+
+	if (m_writerThread == nullptr)
+		return;
+
+	std::unique_lock<std::mutex> lock(m_writerMutex);
+	m_writerCondition.wait(lock, [this]{ return !m_writeRequested; });
+	if (!m_writerError.empty()) {
+		std::string errmsg;
+		errmsg.swap(m_writerError);
+		throw IBK::Exception(IBK::FormatString("Error writing restart data: %1").arg(errmsg), FUNC_ID);
+	}
+}
+
+
+void CheckpointWriter::writerThreadLoop() {
+	std::unique_lock<std::mutex> lock(m_writerMutex);
+	while (true) {
+		m_writerCondition.wait(lock, [this]{ return m_writeRequested || m_stopWriter; });
+		if (m_stopWriter)
+			break;
+
+		// solver thread waits for us before touching the write buffer, so we can write without lock
+		lock.unlock();
+		std::string errmsg;
+		try {
+			writeCheckpoint();
+		}
+		catch (std::exception & ex) {
+			errmsg = ex.what();
+		}
+		lock.lock();
+
+		m_writerError = errmsg;
+		m_writeRequested = false;
+		m_writerCondition.notify_all();
+	}
+}
+
+
+void CheckpointWriter::writeCheckpoint() {
+	FUNCID(CheckpointWriter::writeCheckpoint);
+
+	unsigned int n = m_writeBuffer.size();
+
+	// append mode: all checkpoints are kept in the restart file
+	if (m_appendMode) {
+		std::ofstream out;
+		if (!IBK::open_ofstream(out, m_restartFile, std::ios_base::app | std::ios_base::binary))
+			throw IBK::Exception( IBK::FormatString("Cannot open restart file '%1' for writing.").arg(m_restartFile), FUNC_ID);
+		out.write((const char *)&m_writeTime, sizeof(double) );
+		out.write((const char *)&n, sizeof(unsigned int) );
+		out.write((const char *)m_writeBuffer.data(), sizeof(double)*n);
+		if (!out)
+			throw IBK::Exception( IBK::FormatString("Error writing restart file '%1'.").arg(m_restartFile), FUNC_ID);
+		return;
+	}
+
+	// keep previous checkpoint as backup, but only every few minutes - this is for really long simulations,
+	// where we accept potentially duplicate output steps in output files (when we restart to a time point past
+	// that we had already several outputs written)
+	bool createBackup = m_backupCount > 0 && m_backupWatch.difference() > m_backupInterval;
+
+	std::size_t blockSize = sizeof(double) + sizeof(unsigned int) + sizeof(double)*n;
+	if (!createBackup && m_incremental && m_lastWrittenValid && m_restartFile.isFile() &&
+		(std::size_t)m_restartFile.fileSize() == blockSize)
+	{
+		// incremental update of existing restart file, which still holds the last written checkpoint
+		std::ofstream out;
+		if (!IBK::open_ofstream(out, m_restartFile, std::ios_base::in | std::ios_base::out | std::ios_base::binary))
+			throw IBK::Exception( IBK::FormatString("Cannot open restart file '%1' for writing.").arg(m_restartFile), FUNC_ID);
+		// mark checkpoint as incomplete before touching the data, so that a file left behind by a killed
+		// solver is detected when reading it
+		double incompleteTime = INCOMPLETE_CHECKPOINT_TIME;
+		out.write((const char *)&incompleteTime, sizeof(double) );
+		out.flush();
+		for (unsigned int i=0; i<n; i += CHECKPOINT_CHUNK_SIZE) {
+			unsigned int count = (std::min)(CHECKPOINT_CHUNK_SIZE, n - i);
+			if (std::memcmp(m_writeBuffer.data() + i, m_lastWritten.data() + i, sizeof(double)*count) == 0)
+				continue;
+			out.seekp(sizeof(double) + sizeof(unsigned int) + sizeof(double)*i);
+			out.write((const char *)(m_writeBuffer.data() + i), sizeof(double)*count);
+		}
+		// data is complete, now store the time point
+		out.flush();
+		out.seekp(0);
+		out.write((const char *)&m_writeTime, sizeof(double) );
+		out.close();
+		if (!out) {
+			m_lastWrittenValid = false;
+			throw IBK::Exception( IBK::FormatString("Error writing restart file '%1'.").arg(m_restartFile), FUNC_ID);
+		}
+	}
+	else {
+		// write to temporary file first and replace restart file afterwards, so that a valid restart file exists
+		// at any time, even if the solver is killed while writing
+		m_lastWrittenValid = false;
+		IBK::Path tmpFile = m_restartFile + ".tmp";
+		{
+			std::ofstream out;
+			if (!IBK::open_ofstream(out, tmpFile, std::ios_base::trunc | std::ios_base::binary))
+				throw IBK::Exception( IBK::FormatString("Cannot open restart file '%1' for writing.").arg(tmpFile), FUNC_ID);
+			out.write((const char *)&m_writeTime, sizeof(double) );
+			out.write((const char *)&n, sizeof(unsigned int) );
+			out.write((const char *)m_writeBuffer.data(), sizeof(double)*n);
+			if (!out)
+				throw IBK::Exception( IBK::FormatString("Error writing restart file '%1'.").arg(tmpFile), FUNC_ID);
+		}
+		if (createBackup) {
+			rotateBackups();
+			m_backupWatch.start();
+		}
+		if (!replaceFile(tmpFile, m_restartFile))
+			throw IBK::Exception( IBK::FormatString("Cannot replace restart file '%1'.").arg(m_restartFile), FUNC_ID);
+	}
+
+	// remember content of restart file; the old buffer is overwritten completely by the solver
+	// with the next snapshot, so we can simply swap
+	if (m_incremental) {
+		m_lastWritten.swap(m_writeBuffer);
+		m_lastWrittenValid = true;
+	}
+}
+
+
+void CheckpointWriter::rotateBackups() {
+	FUNCID(CheckpointWriter::rotateBackups);
+
+	// nothing to keep if restart file has not been written, yet
+	if (!m_restartFile.isFile() || m_restartFile.fileSize() == 0)
+		return;
+
+	// shift all backups by one, oldest backup is replaced; newest backup has index 1
+	for (unsigned int i=m_backupCount; i>1; --i) {
+		if (backupFile(i-1).exists())
+			replaceFile(backupFile(i-1), backupFile(i));
+	}
+	if (!replaceFile(m_restartFile, backupFile(1)))
+		throw IBK::Exception( IBK::FormatString("Cannot create backup copy of restart file '%1'.").arg(m_restartFile), FUNC_ID);
+}
+
+
+IBK::Path CheckpointWriter::backupFile(unsigned int idx) const {
+	// first backup keeps the name used by former solver versions
+	if (idx == 1)
+		return m_restartFile + ".bak";
+	return m_restartFile + IBK::FormatString(".bak%1").arg(idx).str();
+}
+
+} // namespace SOLFRA
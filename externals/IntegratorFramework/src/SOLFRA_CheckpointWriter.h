@@ -0,0 +1,143 @@
+/*	Solver Control Framework
+	Copyright (C) 2010  Andreas Nicolai <andreas.nicolai -[at]- tu-dresden.de>
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLFRA_CheckpointWriterH
+#define SOLFRA_CheckpointWriterH
+
+#include <vector>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include <IBK_Path.h>
+#include <IBK_StopWatch.h>
+
+namespace SOLFRA {
+
+/*! Writes restart data (checkpoints) in a background thread.
+
+	A checkpoint consists of time point and a data block with integrator states and serialized model memory.
+	The solver copies the data into the snapshot buffer returned by snapshotBuffer() and passes the buffer
+	on with write(). The writer thread then writes the data while the solver continues. All buffers are
+	allocated in setup(), the buffers are swapped between solver and writer thread.
+
+	File format (one block per checkpoint, see SolverControlFramework::readRestartFile()):
+	\code
+	double			t
+	unsigned int	n
+	double			data[n]
+	\endcode
+
+	In append mode all checkpoints are appended to the restart file. Otherwise, the restart file holds only
+	the last checkpoint. It is written to a temporary file first, which then replaces the restart file.
+	Every few minutes, the previous checkpoint is kept in a bounded ring of backup files
+	(restart.bin.bak, restart.bin.bak2, ...).
+	With incremental writing enabled, only parts of the data block that have changed since the
+	last checkpoint are written into the existing restart file. This saves disk bandwidth for large models.
+	While the data block is updated, the time point in the file is set to INCOMPLETE_CHECKPOINT_TIME and
+	the actual time point is written last. If the solver is killed while writing, the restart file is
+	recognized as incomplete when read and one of the backup files must be used.
+
+	Errors in the writer thread are re-thrown in the solver thread on the next call to snapshotBuffer() or flush().
+*/
+class CheckpointWriter {
+public:
+	/*! Time point (NaN) stored in the restart file while an incremental update is in progress. */
+	static const double INCOMPLETE_CHECKPOINT_TIME;
+
+	CheckpointWriter();
+	/*! Waits for pending write operation and terminates writer thread. */
+	~CheckpointWriter();
+
+	/*! Sets up checkpoint writer and allocates buffers.
+		Must not be called while a write operation is pending, see flush().
+		\param restartFile Path to restart file.
+		\param appendMode If true, checkpoints are appended to the restart file, otherwise the file is replaced.
+		\param dataSize Number of doubles in data block.
+		\param backupCount Number of backup files holding previous checkpoints (only used if appendMode is false).
+		\param backupInterval Minimum time in [s] between creation of backup files.
+		\param incremental If true, only changed parts of the data block are written (only used if appendMode is false).
+	*/
+	void setup(const IBK::Path & restartFile, bool appendMode, unsigned int dataSize,
+			   unsigned int backupCount, double backupInterval, bool incremental);
+
+	/*! Returns buffer with space for dataSize doubles that will be written on next call to write().
+		Waits until pending write operation has completed.
+	*/
+	double * snapshotBuffer();
+
+	/*! Hands data in snapshot buffer over to writer thread. */
+	void write(double t);
+
+	/*! Waits until all checkpoints have been written. */
+	void flush();
+
+private:
+	/*! Main loop of writer thread. */
+	void writerThreadLoop();
+
+	/*! Writes checkpoint in m_writeBuffer (called from writer thread). */
+	void writeCheckpoint();
+
+	/*! Moves restart file to first backup file and shifts all backup files by one. */
+	void rotateBackups();
+
+	/*! Returns file name of backup with given index (1 = newest). */
+	IBK::Path backupFile(unsigned int idx) const;
+
+	/*! Path to restart file. */
+	IBK::Path					m_restartFile;
+	/*! If true, checkpoints are appended. */
+	bool						m_appendMode = false;
+	/*! Number of backup files. */
+	unsigned int				m_backupCount = 1;
+	/*! Time between creation of backup files in [ms]. */
+	double						m_backupInterval = 600*1000;
+	/*! If true, only changed data chunks are written. */
+	bool						m_incremental = false;
+
+	/*! Buffer filled by solver thread. */
+	std::vector<double>			m_snapshot;
+	/*! Buffer with data to be written, owned by writer thread while write is pending. */
+	std::vector<double>			m_writeBuffer;
+	/*! Time point of checkpoint in m_writeBuffer. */
+	double						m_writeTime = 0;
+	/*! Data of last checkpoint written to restart file (only used in incremental mode). */
+	std::vector<double>			m_lastWritten;
+	/*! If true, m_lastWritten holds the data currently stored in the restart file. */
+	bool						m_lastWrittenValid = false;
+	/*! Timer for creating backup files. */
+	IBK::StopWatch				m_backupWatch;
+
+	/*! Writer thread, created on first write. */
+	std::thread					*m_writerThread = nullptr;
+	/*! Mutex protecting the flags below. */
+	std::mutex					m_writerMutex;
+	/*! Condition variable to signal changes of the flags below. */
+	std::condition_variable		m_writerCondition;
+	/*! Set by solver thread when checkpoint is ready for writing, cleared by writer thread when done. */
+	bool						m_writeRequested = false;
+	/*! Set to request termination of the writer thread. */
+	bool						m_stopWriter = false;
+	/*! Error message of last write operation. */
+	std::string					m_writerError;
+};
+
+} // namespace SOLFRA
+
+#endif // SOLFRA_CheckpointWriterH
@@ -60,6 +60,21 @@ public:
 	/*! Retrieves an output parameter of type bool. */
 	virtual void getBoolean(int varID, bool & value) { (void)varID; (void)value; }
 
+	/*! Sets n input parameters of type double.
+		Default implementation calls setReal() for each value, re-implement for faster access.
+	*/
+	virtual void setReals(const unsigned int * varIDs, std::size_t n, const double * values) {
+		for (std::size_t i=0; i<n; ++i)
+			setReal((int)varIDs[i], values[i]);
+	}
+	/*! Retrieves n output parameters of type double.
+		Default implementation calls getReal() for each value, re-implement for faster access.
+	*/
+	virtual void getReals(const unsigned int * varIDs, std::size_t n, double * values) {
+		for (std::size_t i=0; i<n; ++i)
+			getReal((int)varIDs[i], values[i]);
+	}
+
 	/*! This function is called by the master/control system whenever a communication
 		interval is started or restarted.
 		The model should implement all functionality related to resetting temporary
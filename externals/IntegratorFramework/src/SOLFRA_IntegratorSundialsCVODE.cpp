@@ -400,6 +400,13 @@ void IntegratorSundialsCVODE::setLinearSetupFrequency(int msbp) {
 }
 
 
+unsigned int IntegratorSundialsCVODE::nLinearSetups() const {
+	long int nsetups = 0;
+	CVodeGetNumLinSolvSetups(m_impl->m_mem, &nsetups);
+	return (unsigned int)nsetups;
+}
+
+
 IntegratorInterface::StepResultType IntegratorSundialsCVODE::step() {
 
 	// if a stop time has been set, set it in CVode with CVodeSetStopTime()...
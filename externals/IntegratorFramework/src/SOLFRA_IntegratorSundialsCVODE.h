@@ -48,6 +48,11 @@ public:
 	*/
 	void setLinearSetupFrequency(int msbp);
 
+	/*! Returns the number of linear solver setups (Jacobian/preconditioner updates) performed so far.
+		\note The counter is part of the CVODE memory and thus restored in deserialize().
+	*/
+	unsigned int nLinearSetups() const;
+
 	/*! Advances the solution from the current time to the next, thereby
 		adjusting the time step.
 		If the step was completed sucessfully, the functions t() and dt() can be
@@ -140,12 +140,27 @@ int JacobianSparseCSR::setup(double t, const double * y, const double * ydot, co
 			m_yMod[j] += m_ydiff[j];
 		}
 
-		SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_FEVAL_JACOBIAN_GENERATION,
-			// calculate modified right hand side
-			m_model->setY(&m_yMod[0]);
-			// calculate modified right hand side of the model, and store f(t,y) in m_FMod
-			m_model->ydot(&m_ydotMod[0]);
-		);
+		// For models with partial evaluation support, all but the first color only pass the
+		// columns restored from the previous color and the newly perturbed columns.
+		// The first color must use setY(), since we cannot know which y vector was passed to the model last.
+		if (i > 0 && m_model->hasPartialEvaluation()) {
+			m_changedIdx.assign(m_colors[i-1].begin(), m_colors[i-1].end());
+			m_changedIdx.insert(m_changedIdx.end(), m_colors[i].begin(), m_colors[i].end());
+			SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_FEVAL_JACOBIAN_GENERATION,
+				// update model with modified y elements only
+				m_model->setYPartial(&m_yMod[0], &m_changedIdx[0], (unsigned int)m_changedIdx.size());
+				// calculate modified right hand side of the model, and store f(t,y) in m_FMod
+				m_model->ydot(&m_ydotMod[0]);
+			);
+		}
+		else {
+			SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_FEVAL_JACOBIAN_GENERATION,
+				// calculate modified right hand side
+				m_model->setY(&m_yMod[0]);
+				// calculate modified right hand side of the model, and store f(t,y) in m_FMod
+				m_model->ydot(&m_ydotMod[0]);
+			);
+		}
 		// update statistics
 		++m_nRhsEvals;
 
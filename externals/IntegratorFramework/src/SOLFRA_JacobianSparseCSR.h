@@ -51,6 +51,9 @@ public:
 	*/
 	virtual unsigned int nRHSEvals() const override { return m_nRhsEvals; }
 
+	/*! Returns number of colors (i.e. number of RHS evaluations per Jacobian setup). */
+	unsigned int nColors() const { return (unsigned int)m_colors.size(); }
+
 	/*! Create and releases a copy of the internally stored sparse matrix holding the system jacobian.
 		\note Caller takes ownership of allocated memory.
 	*/
@@ -101,6 +104,10 @@ protected:
 	std::vector<double>						m_ydotMod;
 	/*! Used to store differences added to the individual y elements. */
 	std::vector<double>						m_ydiff;
+	/*! Indexes of y elements changed since the last model evaluation, passed to
+		ModelInterface::setYPartial() (only used if the model supports partial evaluation).
+	*/
+	std::vector<unsigned int>				m_changedIdx;
 
 	/*! Number of rhs evaluations for ILU preconditioner. */
 	unsigned int							m_nRhsEvals;
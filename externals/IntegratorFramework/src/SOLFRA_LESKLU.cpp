@@ -5,6 +5,7 @@
 
 #include <cvode/cvode_klu.h>
 #include <cvode/cvode_sparse.h>
+#include <cvode/cvode_serialization.h>
 #include <nvector/nvector_serial.h>
 #include <sundials/sundials_timer.h>
 
@@ -152,8 +153,12 @@ void LESKLU::updateSUNDIALSStatistics() {
 
 
 size_t LESKLU::serializationSize() const {
-	// we only need to serialize the actual data and statistics
-	return 2 * sizeof(unsigned int);
+	// we only need to serialize the actual data and statistics, and the saved Jacobian of the CVODE sparse solver
+	size_t s = 2 * sizeof(unsigned int);
+	IntegratorSundialsCVODE* intCVODE = dynamic_cast<IntegratorSundialsCVODE*>(m_integrator);
+	if (intCVODE != nullptr)
+		s += CVSlsSerializationSize(intCVODE->cvodeMem());
+	return s;
 }
 
 
@@ -162,6 +167,9 @@ void LESKLU::serialize(void *& dataPtr) const {
 	dataPtr = (char*)dataPtr + sizeof(unsigned int);
 	*(unsigned int*)dataPtr = m_statNumRhsEvals;
 	dataPtr = (char*)dataPtr + sizeof(unsigned int);
+	IntegratorSundialsCVODE* intCVODE = dynamic_cast<IntegratorSundialsCVODE*>(m_integrator);
+	if (intCVODE != nullptr)
+		CVSlsSerialize(intCVODE->cvodeMem(), &dataPtr);
 }
 
 
@@ -171,8 +179,11 @@ void LESKLU::deserialize(void *& dataPtr) {
 	m_statNumRhsEvals = *(unsigned int*)dataPtr;
 	dataPtr = (char*)dataPtr + sizeof(unsigned int);
 	IntegratorSundialsCVODE* intCVODE = dynamic_cast<IntegratorSundialsCVODE*>(m_integrator);
-	if (intCVODE != nullptr)
+	if (intCVODE != nullptr) {
+		CVSlsDeserialize(intCVODE->cvodeMem(), &dataPtr);
+		// the factorization is not stored, force a new one in the next step
 		intCVODE->setLinearSetupFrequency(1);
+	}
 }
 
 } // namespace SOLFRA
@@ -87,6 +87,26 @@ public:
 	*/
 	virtual CalculationResult setY(const double * y) = 0;
 
+	/*! Returns true, if the model implements setYPartial() such that only the parts of the model
+		affected by the changed unknowns are re-evaluated.
+		Jacobian generators use this to decide whether to pass change information to the model.
+		Default implementation returns false.
+	*/
+	virtual bool hasPartialEvaluation() const { return false; }
+
+	/*! Update state of model to new set of unknowns, whereby only the unknowns with the given indexes
+		differ from those passed in the last call to setY() or setYPartial().
+		Models may use this information to re-evaluate only the affected parts of the model.
+		Default implementation calls setY().
+		\param y Pointer to linear memory array of size n() holding the new unknowns.
+		\param changedIdx Pointer to array with indexes of the changed unknowns.
+		\param nChanged Number of indexes in changedIdx.
+	*/
+	virtual CalculationResult setYPartial(const double * y, const unsigned int * changedIdx, unsigned int nChanged) {
+		(void)changedIdx; (void)nChanged;
+		return setY(y);
+	}
+
 	/*! Stores the computed derivatives of the solution variables in the vector ydot.
 		This function must be implemented by models who support an ODE type interface,
 		which means they implement setY() and ydot(), but not setYdot() and residuals().
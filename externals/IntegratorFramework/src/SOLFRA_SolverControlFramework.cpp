@@ -26,6 +26,7 @@
 #include <string>
 #include <stdexcept>
 #include <cstring>
+#include <cmath>
 #include <memory>
 
 #include <IBK_messages.h>
@@ -49,6 +50,7 @@
 #include "SOLFRA_PrecondInterface.h"
 #include "SOLFRA_JacobianInterface.h"
 #include "SOLFRA_Constants.h"
+#include "SOLFRA_CheckpointWriter.h"
 
 #include <sundials/sundials_config.h>
 #include <sundials/sundials_timer.h>
@@ -77,11 +79,15 @@ std::string format_time_difference(double delta_t) {
 
 SolverControlFramework::SolverControlFramework(ModelInterface * model) :
 	m_restartMode(RestartFromLast),
+	m_restartBackupCount(1),
+	m_restartBackupInterval(600),
+	m_incrementalRestartWriting(false),
 	m_stopAfterSolverInit(false),
 	m_useStepStatistics(false),
 	m_model(model),
 	m_integrator(nullptr),
 	m_outputScheduler(nullptr),
+	m_checkpointWriter(nullptr),
 	m_defaultIntegrator(nullptr),
 	m_defaultLES(nullptr),
 	m_defaultOutputScheduler(nullptr)
@@ -92,6 +98,7 @@ SolverControlFramework::SolverControlFramework(ModelInterface * model) :
 
 
 SolverControlFramework::~SolverControlFramework() {
+	delete m_checkpointWriter; // waits for last restart data to be written
 	delete m_defaultIntegrator;
 	delete m_defaultLES;
 	delete m_defaultOutputScheduler;
@@ -346,7 +353,10 @@ void SolverControlFramework::printRestartFileInfo(const IBK::Path & restartFileP
 		if (!in)
 			break;
 		std::stringstream strm;
-		strm << std::setw(10) << std::right << format_time_difference(t) << "\n";
+		if (std::isnan(t))
+			strm << std::setw(10) << std::right << "incomplete" << "\n";
+		else
+			strm << std::setw(10) << std::right << format_time_difference(t) << "\n";
 		IBK::IBK_Message( strm.str(), IBK::MSG_PROGRESS);
 		++block;
 	}
@@ -377,6 +387,17 @@ void SolverControlFramework::run(double t) {
 	double t_end = m_model->tEnd();
 	double t_out = m_outputScheduler->nextOutputTime(t);
 
+	// prepare writing of restart data
+	if (!m_restartFilename.str().empty()) {
+		if (m_checkpointWriter == nullptr)
+			m_checkpointWriter = new CheckpointWriter;
+		else
+			m_checkpointWriter->flush();
+		unsigned int dataSize = m_model->n() + m_model->serializationSize()/sizeof(double);
+		m_checkpointWriter->setup(m_restartFilename, m_restartMode == RestartFromAll, dataSize,
+								  m_restartBackupCount, m_restartBackupInterval, m_incrementalRestartWriting);
+	}
+
 	m_stopWatch.start();
 
 	try {
@@ -512,6 +533,10 @@ void SolverControlFramework::run(double t) {
 
 		writeProgress(t, false);
 
+		// wait until last restart data has been written
+		if (m_checkpointWriter != nullptr)
+			m_checkpointWriter->flush();
+
 		// Ask model to write out any last outputs to files. Most models won't need this, but if value
 		// caching is implemented, this ensures that there is a mechanism to flush the cache to files.
 		SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
@@ -529,52 +554,24 @@ void SolverControlFramework::run(double t) {
 }
 
 
-void SolverControlFramework::appendRestartInfo(double t, const double * y) const {
-	FUNCID(SolverControlFramework::appendRestartInfo);
-
+void SolverControlFramework::appendRestartInfo(double t, const double * y) {
 	// do nothing if no filename is set
 	if (m_restartFilename.str().empty()) return;
 
-	// if restart file exists, rename it to bak, but only once every 10 minutes - this is
-	// for really long simulations, where we accept potentially duplicate output steps
-	// in output files (when we restart to a time point past that we had already several
-	// outputs written), in order to save a lot of simulation time
-	if (m_restartFileRenameWatch.difference() > 600*1000) {
-		if (m_restartFilename.isFile()) {
-			IBK::Path::move(m_restartFilename, m_restartFilename + ".bak"); // restart.bak
-			const_cast<SolverControlFramework*>(this)->m_restartFileRenameWatch.start(); // reset timer
-		}
-	}
-
-	// try to open file for writing
-	std::ofstream out;
-	if (m_restartMode == RestartFromAll)
-		IBK::open_ofstream(out, m_restartFilename, std::ios_base::app | std::ios_base::binary);
-	else {
-		IBK::open_ofstream(out, m_restartFilename, std::ios_base::trunc | std::ios_base::binary);
-	}
-	if (!out)
-		throw IBK::Exception( IBK::FormatString("Cannot open restart file '%1' for writing.").arg(m_restartFilename), FUNC_ID);
-	// write in binary mode unless debug option is set
-	out.write((const char *)&t, sizeof(double) );
-
-	// collect and write total number of doubles in double-value data block
+	// copy integrator memory into snapshot buffer (waits for previous restart data to be written)
 	unsigned int n = m_model->n();
-	unsigned int dataSize = m_model->serializationSize() / sizeof(double);
-	unsigned int totalNumberOfDoubles = n + dataSize;
-	out.write((const char *)&totalNumberOfDoubles, sizeof(unsigned int) );
+	double * snapshot = m_checkpointWriter->snapshotBuffer();
+	std::memcpy(snapshot, y, sizeof(double)*n);
 
-	// write integrator memory
-	out.write((const char *)y, sizeof(double)*n);
-
-	// write model memory
+	// copy model memory
+	unsigned int dataSize = m_model->serializationSize() / sizeof(double);
 	if (dataSize != 0) {
-		std::vector<double> tmpData(dataSize);
-		void * dataPtr = (void *)tmpData.data();
+		void * dataPtr = (void *)(snapshot + n);
 		m_model->serialize(dataPtr);
-		out.write((const char *)tmpData.data(), sizeof(double)*dataSize);
 	}
 
+	// writing to file is done in background
+	m_checkpointWriter->write(t);
 }
 
 
@@ -604,6 +601,11 @@ bool SolverControlFramework::readRestartFile(int step,
 		IBK::IBK_Message( IBK::FormatString("Failed to read first block in restart file."), IBK::MSG_ERROR);
 		return false;
 	}
+	if (std::isnan(t)) {
+		IBK::IBK_Message( IBK::FormatString("Restart file '%1' is incomplete, solver was terminated while writing restart data. "
+			"Use backup file '%1.bak' instead.").arg(m_restartFilename), IBK::MSG_ERROR);
+		return false;
+	}
 	unsigned int numberOfDoubles = m_model->n() + m_model->serializationSize()/sizeof(double);
 	if (n != numberOfDoubles) {
 		IBK::IBK_Message( IBK::FormatString("Size mismatch between restart file (n = %1) and "
@@ -625,6 +627,10 @@ bool SolverControlFramework::readRestartFile(int step,
 			IBK::IBK_Message( IBK::FormatString("Error reading last block in restart file."), IBK::MSG_ERROR);
 			return false;
 		}
+		if (std::isnan(t)) {
+			IBK::IBK_Message( IBK::FormatString("Last block in restart file '%1' is incomplete.").arg(m_restartFilename), IBK::MSG_ERROR);
+			return false;
+		}
 		if (restartFileCopy != nullptr) {
 			// since we continue from last step, we now need to copy the whole file into our temporary file
 			in.seekg(0, std::ios_base::beg);
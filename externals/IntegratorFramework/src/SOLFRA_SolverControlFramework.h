@@ -39,6 +39,7 @@ class OutputScheduler;
 class LESInterface;
 class PrecondInterface;
 class JacobianInterface;
+class CheckpointWriter;
 
 /*!	\brief Declaration for class SolverControlFramework
 	\author Andreas Nicolai <andreas.nicolai -[at]- tu-dresden.de>
@@ -177,6 +178,16 @@ public:
 	IBK::Path				m_restartFilename;
 	/*! Defines restart file handling. */
 	RestartFileMode			m_restartMode;
+	/*! Number of backup copies of previous restart data that are kept (restart.bin.bak, restart.bin.bak2, ...).
+		Not used in mode RestartFromAll.
+	*/
+	unsigned int			m_restartBackupCount;
+	/*! Minimum time in [s] between creation of backup copies of restart data (real time). */
+	double					m_restartBackupInterval;
+	/*! If true, only those parts of the restart data that changed since the last restart point are
+		written into the restart file. Not used in mode RestartFromAll.
+	*/
+	bool					m_incrementalRestartWriting;
 
 	/*! If set to true before a call to run() or restart(), the framework will
 		return from run() or restart() once the solver initialization was done.
@@ -197,8 +208,10 @@ protected:
 	*/
 	void run(double t0);
 
-	/*! Re-opens restart file for writing and appends new solution at end. */
-	void appendRestartInfo(double t, const double * y) const;
+	/*! Stores current solution and model memory as restart point.
+		Data is copied into a buffer and written by the checkpoint writer in the background.
+	*/
+	void appendRestartInfo(double t, const double * y);
 
 	/*! Reads restart file.
 		\param step Can be either:
@@ -233,10 +246,8 @@ protected:
 	/*! The central stopwatch, to measure execution time. */
 	IBK::StopWatch			m_stopWatch;
 
-	/*! Timer for creating backup copies of restart file - this is slow, hence we do this
-		only every few minutes.
-	*/
-	IBK::StopWatch			m_restartFileRenameWatch;
+	/*! Writes restart data in background thread (owned and released), created on first use. */
+	CheckpointWriter		*m_checkpointWriter;
 
 	/*! Pointer to default integrator implementation (owned and released). */
 	IntegratorInterface		*m_defaultIntegrator;
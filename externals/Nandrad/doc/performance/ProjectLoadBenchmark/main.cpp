@@ -0,0 +1,153 @@
+/*	Load-time benchmark for NANDRAD::Project::readXML() and NANDRAD::Project::readBinary().
+
+	Reads each project file several times, once with a single thread and once with all threads (when compiled
+	with OpenMP), and reports the fastest load time of each. The project is then written as binary project file
+	and read again several times from the binary file, the fastest binary load time is reported as well.
+	The projects read with one and all threads and from the binary file are written back to XML and compared
+	(must be identical).
+
+	Usage: ProjectLoadBenchmark [-r <repetitions>] <project file> [<project file> ...]
+
+	Example (all example projects):
+
+		find data -name "*.nandrad" | xargs ProjectLoadBenchmark -r 5
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <IBK_StopWatch.h>
+#include <IBK_Path.h>
+#include <IBK_FileUtils.h>
+#include <IBK_messages.h>
+#include <IBK_Exception.h>
+
+#include <NANDRAD_Project.h>
+
+/*! Reads the project repeatedly with the given number of threads and returns fastest load time in [ms].
+	The project of the last repetition is written to xmlFile (and to binaryFile, if given).
+*/
+double loadProject(const IBK::Path & projectFile, unsigned int repetitions, int threads, const IBK::Path & xmlFile,
+				   const IBK::Path & binaryFile = IBK::Path())
+{
+#if defined(_OPENMP)
+	omp_set_num_threads(threads);
+#else
+	(void)threads;
+#endif
+	double tMin = 0;
+	for (unsigned int i=0; i<repetitions; ++i) {
+		NANDRAD::Project prj;
+		IBK::StopWatch w;
+		prj.readXML(projectFile);
+		double t = w.stop();
+		if (i == 0 || t < tMin)
+			tMin = t;
+		if (i+1 == repetitions) {
+			prj.writeXML(xmlFile);
+			if (binaryFile.isValid())
+				prj.writeBinary(binaryFile);
+		}
+	}
+	return tMin;
+}
+
+
+/*! Reads the binary project file repeatedly and returns fastest load time in [ms].
+	The project of the last repetition is written to xmlFile.
+*/
+double loadBinaryProject(const IBK::Path & binaryFile, unsigned int repetitions, const IBK::Path & xmlFile) {
+	double tMin = 0;
+	for (unsigned int i=0; i<repetitions; ++i) {
+		NANDRAD::Project prj;
+		IBK::StopWatch w;
+		prj.readBinary(binaryFile);
+		double t = w.stop();
+		if (i == 0 || t < tMin)
+			tMin = t;
+		if (i+1 == repetitions)
+			prj.writeXML(xmlFile);
+	}
+	return tMin;
+}
+
+
+int main(int argc, char * argv[]) {
+	unsigned int repetitions = 3;
+	std::vector<IBK::Path> projectFiles;
+	for (int i=1; i<argc; ++i) {
+		if (std::string(argv[i]) == "-r" && i+1 < argc)
+			repetitions = (unsigned int)std::max(1, std::atoi(argv[++i]));
+		else
+			projectFiles.push_back(IBK::Path(argv[i]));
+	}
+	if (projectFiles.empty()) {
+		std::cerr << "Usage: ProjectLoadBenchmark [-r <repetitions>] <project file> [<project file> ...]" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// warnings of the example projects are not of interest here
+	IBK::MessageHandlerRegistry::instance().messageHandler()->setConsoleVerbosityLevel(0);
+
+	int maxThreads = 1;
+#if defined(_OPENMP)
+	maxThreads = omp_get_max_threads();
+#endif
+	std::cout << "Repetitions: " << repetitions << ", threads: " << maxThreads << std::endl;
+
+	const IBK::Path xmlSerial("ProjectLoadBenchmark_serial.xml");
+	const IBK::Path xmlParallel("ProjectLoadBenchmark_parallel.xml");
+	const IBK::Path xmlBinary("ProjectLoadBenchmark_binary.xml");
+	const IBK::Path binaryFile("ProjectLoadBenchmark.nandradb");
+
+	double tSerialTotal = 0;
+	double tParallelTotal = 0;
+	double tBinaryTotal = 0;
+	unsigned int differences = 0;
+	unsigned int failures = 0;
+	std::cout << std::fixed << std::setprecision(1);
+	for (const IBK::Path & projectFile : projectFiles) {
+		double tSerial, tParallel, tBinary;
+		try {
+			tSerial = loadProject(projectFile, repetitions, 1, xmlSerial, binaryFile);
+			tParallel = loadProject(projectFile, repetitions, maxThreads, xmlParallel);
+			tBinary = loadBinaryProject(binaryFile, repetitions, xmlBinary);
+		}
+		catch (IBK::Exception & ex) {
+			std::cout << "  failed      " << projectFile.filename() << " (" << ex.what() << ")" << std::endl;
+			++failures;
+			continue;
+		}
+		tSerialTotal += tSerial;
+		tParallelTotal += tParallel;
+		tBinaryTotal += tBinary;
+		std::string xmlSerialContent = IBK::file2String(xmlSerial);
+		bool identical = xmlSerialContent == IBK::file2String(xmlParallel) &&
+						 xmlSerialContent == IBK::file2String(xmlBinary);
+		if (!identical)
+			++differences;
+		std::cout << std::setw(10) << tSerial << " ms " << std::setw(10) << tParallel << " ms "
+				  << std::setw(10) << tBinary << " ms  "
+				  << (identical ? "" : "DIFFERENT  ") << projectFile.filename() << std::endl;
+	}
+	IBK::Path::remove(xmlSerial, true);
+	IBK::Path::remove(xmlParallel, true);
+	IBK::Path::remove(xmlBinary, true);
+	IBK::Path::remove(binaryFile, true);
+
+	std::cout << "Total 1 thread   " << std::setw(10) << tSerialTotal << " ms" << std::endl;
+	std::cout << "Total " << std::setw(2) << maxThreads << " threads " << std::setw(10) << tParallelTotal << " ms" << std::endl;
+	std::cout << "Total binary     " << std::setw(10) << tBinaryTotal << " ms" << std::endl;
+	std::cout << "Projects: " << projectFiles.size() << ", failed to read: " << failures
+			  << ", different results: " << differences << std::endl;
+
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -27,6 +27,7 @@ DEPENDPATH = $${INCLUDEPATH}
 
 HEADERS += \
         ../../src/NANDRAD_ArgsParser.h \
+        ../../src/NANDRAD_BinaryIO.h \
         ../../src/NANDRAD_CodeGenMacros.h \
         ../../src/NANDRAD_Constants.h \
         ../../src/NANDRAD_ConstructionInstance.h \
@@ -91,10 +92,12 @@ HEADERS += \
         ../../src/NANDRAD_WindowGlazingLayer.h \
         ../../src/NANDRAD_WindowGlazingSystem.h \
         ../../src/NANDRAD_WindowShading.h \
+        ../../src/NANDRAD_XMLListReader.h \
         ../../src/NANDRAD_Zone.h
 
 SOURCES += \
         ../../src/NANDRAD_ArgsParser.cpp \
+        ../../src/NANDRAD_BinaryIO.cpp \
         ../../src/NANDRAD_Constants.cpp \
         ../../src/NANDRAD_ConstructionInstance.cpp \
         ../../src/NANDRAD_ConstructionType.cpp \
@@ -149,6 +152,7 @@ SOURCES += \
         ../../src/NANDRAD_Utilities.cpp \
         ../../src/NANDRAD_WindowGlazingSystem.cpp \
         ../../src/NANDRAD_WindowShading.cpp \
+        ../../src/NANDRAD_XMLListReader.cpp \
         ../../src/NANDRAD_Zone.cpp \
         ../../src/ncg/ncg_NANDRAD_ConstructionInstance.cpp \
         ../../src/ncg/ncg_NANDRAD_ConstructionType.cpp \
@@ -0,0 +1,276 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NANDRAD_BinaryIO.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include <IBK_Exception.h>
+#include <IBK_FormatString.h>
+#include <IBK_Path.h>
+#include <IBK_Parameter.h>
+#include <IBK_IntPara.h>
+#include <IBK_Unit.h>
+#include <IBK_UnitList.h>
+#include <IBK_Flag.h>
+#include <IBK_Time.h>
+#include <IBK_LinearSpline.h>
+#include <IBK_MultiLanguageString.h>
+#include <IBK_FileUtils.h>
+
+namespace NANDRAD {
+
+/*! Byte order mark written into the header of binary files, read as 0x04030201 on platforms with other byte order. */
+static const uint32_t BINARY_BYTE_ORDER_MARK = 0x01020304;
+
+/*! Signature of the unit list (FNV-1a hash of all unit names in the order of their IDs). */
+static uint32_t unitListSignature() {
+	uint32_t hash = 2166136261u;
+	for (unsigned int i=0, count = IBK::UnitList::instance().size(); i<count; ++i) {
+		const std::string & name = IBK::Unit(i).name();
+		for (char c : name)
+			hash = (hash ^ (unsigned char)c) * 16777619u;
+		hash = (hash ^ 0u) * 16777619u; // separator
+	}
+	return hash;
+}
+
+
+void readBinaryLayout(std::istream & in, unsigned int layout, const char * const className) {
+	FUNCID(NANDRAD::readBinaryLayout);
+	uint32_t storedLayout = 0;
+	IBK::read_uint32_binary(in, storedLayout);
+	if (!in)
+		throw IBK::Exception(IBK::FormatString("Unexpected end of binary data when reading '%1'.").arg(className), FUNC_ID);
+	if (storedLayout != layout)
+		throw IBK::Exception(IBK::FormatString("Binary data of '%1' was written with another data layout "
+											   "(incompatible version).").arg(className), FUNC_ID);
+}
+
+
+void writeBinaryHeader(std::ostream & out, const char * const magic, unsigned int version) {
+	char buffer[8] = {0};
+	std::memcpy(buffer, magic, std::min(std::strlen(magic), (std::size_t)8));
+	out.write(buffer, 8);
+	IBK::write_uint32_binary(out, BINARY_BYTE_ORDER_MARK);
+	IBK::write_uint32_binary(out, version);
+	IBK::write_uint32_binary(out, unitListSignature());
+}
+
+
+void readBinaryHeader(std::istream & in, const char * const magic, unsigned int version) {
+	FUNCID(NANDRAD::readBinaryHeader);
+	char buffer[8] = {0};
+	char expected[8] = {0};
+	std::memcpy(expected, magic, std::min(std::strlen(magic), (std::size_t)8));
+	in.read(buffer, 8);
+	if (!in || std::memcmp(buffer, expected, 8) != 0)
+		throw IBK::Exception("Invalid file format (not a binary project file).", FUNC_ID);
+	uint32_t byteOrderMark = 0;
+	IBK::read_uint32_binary(in, byteOrderMark);
+	checkBinaryStream(in);
+	if (byteOrderMark == 0x04030201)
+		throw IBK::Exception("Binary file was written on a platform with different byte order.", FUNC_ID);
+	// binary files of version 1 have no byte order mark
+	if (byteOrderMark != BINARY_BYTE_ORDER_MARK)
+		throw IBK::Exception(IBK::FormatString("Binary file format is not supported (expected version %1).")
+							 .arg(version), FUNC_ID);
+	uint32_t storedVersion = 0;
+	IBK::read_uint32_binary(in, storedVersion);
+	checkBinaryStream(in);
+	if (storedVersion != version)
+		throw IBK::Exception(IBK::FormatString("Binary file version %1 is not supported (expected version %2).")
+							 .arg(storedVersion).arg(version), FUNC_ID);
+	uint32_t signature = 0;
+	IBK::read_uint32_binary(in, signature);
+	checkBinaryStream(in);
+	if (signature != unitListSignature())
+		throw IBK::Exception("Binary file was written with another unit list (incompatible version).", FUNC_ID);
+}
+
+
+bool isBinaryFile(const IBK::Path & filename, const char * const magic) {
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, filename, std::ios_base::in | std::ios_base::binary))
+		return false;
+	char buffer[8] = {0};
+	char expected[8] = {0};
+	std::memcpy(expected, magic, std::min(std::strlen(magic), (std::size_t)8));
+	in.read(buffer, 8);
+	return in && std::memcmp(buffer, expected, 8) == 0;
+}
+
+
+void throwUnexpectedEndOfBinaryData() {
+	FUNCID(NANDRAD::throwUnexpectedEndOfBinaryData);
+	throw IBK::Exception("Unexpected end of binary data.", FUNC_ID);
+}
+
+
+uint32_t readBinarySize(std::istream & in) {
+	FUNCID(NANDRAD::readBinarySize);
+	uint32_t n = 0;
+	IBK::read_uint32_binary(in, n);
+	checkBinaryStream(in);
+	if (n > BINARY_MAX_SIZE)
+		throw IBK::Exception(IBK::FormatString("Invalid container size %1 in binary data.").arg(n), FUNC_ID);
+	return n;
+}
+
+
+void BinaryIO<std::string>::read(std::istream & in, std::string & str) {
+	str.resize(readBinarySize(in));
+	if (!str.empty()) {
+		in.read(&str[0], str.size());
+		checkBinaryStream(in);
+	}
+}
+
+
+void BinaryIO<IBK::MultiLanguageString>::write(std::ostream & out, const IBK::MultiLanguageString & str) {
+	BinaryIO<std::string>::write(out, str.encodedString());
+}
+
+void BinaryIO<IBK::MultiLanguageString>::read(std::istream & in, IBK::MultiLanguageString & str) {
+	std::string encodedString;
+	BinaryIO<std::string>::read(in, encodedString);
+	if (!encodedString.empty())
+		str.setEncodedString(encodedString);
+}
+
+
+void BinaryIO<IBK::Path>::write(std::ostream & out, const IBK::Path & p) {
+	IBK::write_string_binary(out, p.str());
+}
+
+void BinaryIO<IBK::Path>::read(std::istream & in, IBK::Path & p) {
+	std::string str;
+	BinaryIO<std::string>::read(in, str);
+	p = IBK::Path(str);
+}
+
+
+void BinaryIO<IBK::Parameter>::write(std::ostream & out, const IBK::Parameter & p) {
+	p.writeBinary(out);
+}
+
+void BinaryIO<IBK::Parameter>::read(std::istream & in, IBK::Parameter & p) {
+	FUNCID(BinaryIO<IBK::Parameter>::read);
+	// same format as written by IBK::Parameter::writeBinary(), but with checks
+	int size = 0;
+	BinaryIO<int>::read(in, size);
+	if (size < 0 || (unsigned int)size > BINARY_MAX_SIZE)
+		throw IBK::Exception(IBK::FormatString("Invalid parameter name size %1 in binary data.").arg(size), FUNC_ID);
+	std::string name((std::size_t)size, '\0');
+	if (size > 0) {
+		in.read(&name[0], size);
+		checkBinaryStream(in);
+	}
+	double value = 0;
+	BinaryIO<double>::read(in, value);
+	IBK::Unit unit;
+	BinaryIO<IBK::Unit>::read(in, unit);
+	if (!name.empty()) {
+		p.name = name;
+		p.value = value;
+		p.IO_unit = unit;
+	}
+}
+
+
+void BinaryIO<IBK::IntPara>::write(std::ostream & out, const IBK::IntPara & p) {
+	p.writeBinary(out);
+}
+
+void BinaryIO<IBK::IntPara>::read(std::istream & in, IBK::IntPara & p) {
+	// same format as written by IBK::IntPara::writeBinary(), but with checks
+	std::string name;
+	BinaryIO<std::string>::read(in, name);
+	uint32_t value = 0;
+	BinaryIO<uint32_t>::read(in, value);
+	if (!name.empty())
+		p.set(name, (int)value);
+}
+
+
+void BinaryIO<IBK::Unit>::write(std::ostream & out, const IBK::Unit & u) {
+	IBK::write_uint32_binary(out, u.id());
+}
+
+void BinaryIO<IBK::Unit>::read(std::istream & in, IBK::Unit & u) {
+	FUNCID(BinaryIO<IBK::Unit>::read);
+	uint32_t id = 0;
+	BinaryIO<uint32_t>::read(in, id);
+	if (id >= IBK::UnitList::instance().size())
+		throw IBK::Exception(IBK::FormatString("Invalid unit id %1 in binary data.").arg(id), FUNC_ID);
+	u.set(id);
+}
+
+
+void BinaryIO<IBK::Flag>::write(std::ostream & out, const IBK::Flag & f) {
+	IBK::write_string_binary(out, f.name());
+	BinaryIO<bool>::write(out, f.isEnabled());
+}
+
+void BinaryIO<IBK::Flag>::read(std::istream & in, IBK::Flag & f) {
+	std::string name;
+	BinaryIO<std::string>::read(in, name);
+	bool enabled = false;
+	BinaryIO<bool>::read(in, enabled);
+	if (!name.empty())
+		f.set(name, enabled);
+}
+
+
+void BinaryIO<IBK::Time>::write(std::ostream & out, const IBK::Time & t) {
+	BinaryIO<int>::write(out, t.year());
+	BinaryIO<double>::write(out, t.secondsOfYear());
+}
+
+void BinaryIO<IBK::Time>::read(std::istream & in, IBK::Time & t) {
+	int year = 0;
+	double sec = 0;
+	BinaryIO<int>::read(in, year);
+	BinaryIO<double>::read(in, sec);
+	t.set(year, sec);
+}
+
+
+void BinaryIO<IBK::LinearSpline>::write(std::ostream & out, const IBK::LinearSpline & spl) {
+	spl.writeBinary(out);
+	BinaryIO<IBK::LinearSpline::ExtrapolationMethod>::write(out, spl.m_extrapolationMethod);
+}
+
+void BinaryIO<IBK::LinearSpline>::read(std::istream & in, IBK::LinearSpline & spl) {
+	std::vector<double> x, y;
+	BinaryIO<std::vector<double> >::read(in, x);
+	BinaryIO<std::vector<double> >::read(in, y);
+	IBK::LinearSpline::ExtrapolationMethod extrapolationMethod;
+	BinaryIO<IBK::LinearSpline::ExtrapolationMethod>::read(in, extrapolationMethod);
+	spl = IBK::LinearSpline();
+	if (!x.empty())
+		spl.setValues(x, y);
+	spl.m_extrapolationMethod = extrapolationMethod;
+}
+
+} // namespace NANDRAD
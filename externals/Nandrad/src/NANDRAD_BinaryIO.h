@@ -0,0 +1,355 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NANDRAD_BinaryIOH
+#define NANDRAD_BinaryIOH
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <utility>
+#include <type_traits>
+
+#include <IBK_InputOutput.h>
+#include <IBK_point.h>
+
+namespace IBK {
+	class Path;
+	class Parameter;
+	class IntPara;
+	class Unit;
+	class Flag;
+	class Time;
+	class LinearSpline;
+	class MultiLanguageString;
+}
+
+namespace NANDRAD {
+
+/*! Upper limit for the number of elements in containers and strings read from binary data, protects against
+	allocation of huge amounts of memory when reading corrupt data.
+*/
+const unsigned int BINARY_MAX_SIZE = 0x10000000;
+
+/*! Binary write and read functions for data type T.
+
+	The binary format is a compact dump of the data members: numbers are written in native byte order,
+	strings and containers are written with a leading 32-bit element count. There is no padding
+	and no type information.
+
+	All read functions check the stream state after reading and throw an IBK::Exception on unexpected end of data,
+	so that truncated or corrupt files are reported as errors instead of yielding undefined values.
+
+	The generic implementation calls the member functions writeBinary() and readBinary() of the data class.
+	These functions are generated by the NandradCodeGenerator for all classes with XML-annotated members and
+	hand-written for classes with hand-written readXML()/writeXML() code (or types of the IBK library).
+	The specializations below handle fundamental types, enumerations, containers and IBK types.
+	Libraries using the code generator add specializations for their own value types (see VICUS_BinaryIO.h).
+
+	Use the convenience functions writeBinary() and readBinary() below.
+
+	Reading follows the same rules as reading XML data: values that are undefined in the binary data and hence would
+	not be written to XML (empty parameters and flags, enumeration values NUM_xxx) do not overwrite existing values.
+	This way, default values set before reading are kept. Container elements are always default-constructed before
+	being read.
+*/
+template <typename T, typename Enable = void>
+struct BinaryIO {
+	static void write(std::ostream & out, const T & val) { val.writeBinary(out); }
+	static void read(std::istream & in, T & val) { val.readBinary(in); }
+};
+
+/*! Writes a value in binary format. */
+template <typename T>
+inline void writeBinary(std::ostream & out, const T & val) {
+	BinaryIO<T>::write(out, val);
+}
+
+/*! Reads a value in binary format. */
+template <typename T>
+inline void readBinary(std::istream & in, T & val) {
+	BinaryIO<T>::read(in, val);
+}
+
+/*! Reads an enumeration value, the value is only stored if it differs from enumNUM (undefined value). */
+template <typename T>
+inline void readBinaryEnum(std::istream & in, T & val, T enumNUM) {
+	T tmp = enumNUM;
+	BinaryIO<T>::read(in, tmp);
+	if (tmp != enumNUM)
+		val = tmp;
+}
+
+/*! Reads the data layout signature written by the generated writeBinary() functions and compares it with the
+	signature of the current data layout of the class.
+	Throws an IBK::Exception if the signatures differ, i.e. if the binary data was written with another version
+	of the class.
+*/
+void readBinaryLayout(std::istream & in, unsigned int layout, const char * const className);
+
+/*! Writes the header of a binary project file.
+	The header is composed of the file magic (8 characters), a byte order mark (32-bit value 0x01020304),
+	the version number of the hand-written binary code of the file type and a signature of the IBK unit list
+	(units are stored by ID).
+*/
+void writeBinaryHeader(std::ostream & out, const char * const magic, unsigned int version);
+
+/*! Reads and checks the header of a binary project file, written with writeBinaryHeader().
+	Throws an IBK::Exception if the file magic doesn't match, or if the file was written on a platform with
+	different byte order, with another binary version or unit list.
+*/
+void readBinaryHeader(std::istream & in, const char * const magic, unsigned int version);
+
+/*! Checks if the given file starts with the given file magic, i.e. if it is a binary project file
+	written with writeBinaryHeader(). Returns false if the file cannot be opened.
+*/
+bool isBinaryFile(const IBK::Path & filename, const char * const magic);
+
+/*! Throws an IBK::Exception about unexpected end of binary data. */
+void throwUnexpectedEndOfBinaryData();
+
+/*! Checks the stream state after reading binary data, throws an IBK::Exception if reading failed. */
+inline void checkBinaryStream(const std::istream & in) {
+	if (in.fail())
+		throwUnexpectedEndOfBinaryData();
+}
+
+
+// *** Fundamental types and enumerations ***
+
+template <typename T>
+struct BinaryIO<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+	static void write(std::ostream & out, const T & val) { out.write(reinterpret_cast<const char *>(&val), sizeof(T)); }
+	static void read(std::istream & in, T & val) {
+		in.read(reinterpret_cast<char *>(&val), sizeof(T));
+		checkBinaryStream(in);
+	}
+};
+
+/*! Enumerations are always written as 32-bit integer, independent of the underlying type. */
+template <typename T>
+struct BinaryIO<T, typename std::enable_if<std::is_enum<T>::value>::type> {
+	static void write(std::ostream & out, const T & val) {
+		int32_t i = static_cast<int32_t>(val);
+		out.write(reinterpret_cast<const char *>(&i), sizeof(i));
+	}
+	static void read(std::istream & in, T & val) {
+		int32_t i = 0;
+		in.read(reinterpret_cast<char *>(&i), sizeof(i));
+		checkBinaryStream(in);
+		val = static_cast<T>(i);
+	}
+};
+
+
+// *** Containers ***
+
+/*! Writes the number of elements of a container. */
+inline void writeBinarySize(std::ostream & out, std::size_t n) {
+	IBK::write_uint32_binary(out, static_cast<uint32_t>(n));
+}
+
+/*! Reads the number of elements of a container.
+	Throws an IBK::Exception if the stream is in error state or the number exceeds BINARY_MAX_SIZE.
+*/
+uint32_t readBinarySize(std::istream & in);
+
+template <>
+struct BinaryIO<std::string> {
+	static void write(std::ostream & out, const std::string & str) { IBK::write_string_binary(out, str); }
+	static void read(std::istream & in, std::string & str);
+};
+
+/*! Element-wise write/read of vectors. */
+template <typename T, bool Plain = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+struct BinaryVectorIO {
+	static void write(std::ostream & out, const std::vector<T> & vec) {
+		writeBinarySize(out, vec.size());
+		for (const T & val : vec)
+			BinaryIO<T>::write(out, val);
+	}
+	static void read(std::istream & in, std::vector<T> & vec) {
+		vec.clear();
+		vec.resize(readBinarySize(in));
+		for (T & val : vec)
+			BinaryIO<T>::read(in, val);
+	}
+};
+
+/*! Vectors of numbers are written/read as one memory block. */
+template <typename T>
+struct BinaryVectorIO<T, true> {
+	static void write(std::ostream & out, const std::vector<T> & vec) { IBK::write_vector_binary(out, vec); }
+	static void read(std::istream & in, std::vector<T> & vec) {
+		vec.clear();
+		vec.resize(readBinarySize(in));
+		if (!vec.empty()) {
+			in.read(reinterpret_cast<char *>(vec.data()), sizeof(T)*vec.size());
+			checkBinaryStream(in);
+		}
+	}
+};
+
+template <typename T>
+struct BinaryIO<std::vector<T> > : public BinaryVectorIO<T> {
+};
+
+template <typename T, std::size_t N>
+struct BinaryIO<T[N]> {
+	static void write(std::ostream & out, const T (&arr)[N]) {
+		for (std::size_t i=0; i<N; ++i)
+			BinaryIO<T>::write(out, arr[i]);
+	}
+	static void read(std::istream & in, T (&arr)[N]) {
+		for (std::size_t i=0; i<N; ++i)
+			BinaryIO<T>::read(in, arr[i]);
+	}
+};
+
+template <typename T1, typename T2>
+struct BinaryIO<std::pair<T1, T2> > {
+	static void write(std::ostream & out, const std::pair<T1, T2> & p) {
+		BinaryIO<T1>::write(out, p.first);
+		BinaryIO<T2>::write(out, p.second);
+	}
+	static void read(std::istream & in, std::pair<T1, T2> & p) {
+		BinaryIO<T1>::read(in, p.first);
+		BinaryIO<T2>::read(in, p.second);
+	}
+};
+
+template <typename T>
+struct BinaryIO<std::set<T> > {
+	static void write(std::ostream & out, const std::set<T> & s) {
+		writeBinarySize(out, s.size());
+		for (const T & val : s)
+			BinaryIO<T>::write(out, val);
+	}
+	static void read(std::istream & in, std::set<T> & s) {
+		s.clear();
+		uint32_t n = readBinarySize(in);
+		for (uint32_t i=0; i<n; ++i) {
+			T val;
+			BinaryIO<T>::read(in, val);
+			s.insert(s.end(), val); // data is sorted already
+		}
+	}
+};
+
+template <typename K, typename V>
+struct BinaryIO<std::map<K, V> > {
+	static void write(std::ostream & out, const std::map<K, V> & m) {
+		writeBinarySize(out, m.size());
+		for (const std::pair<const K, V> & val : m) {
+			BinaryIO<K>::write(out, val.first);
+			BinaryIO<V>::write(out, val.second);
+		}
+	}
+	static void read(std::istream & in, std::map<K, V> & m) {
+		m.clear();
+		uint32_t n = readBinarySize(in);
+		for (uint32_t i=0; i<n; ++i) {
+			K key;
+			BinaryIO<K>::read(in, key);
+			// read value in place, avoids copying of large values
+			BinaryIO<V>::read(in, m.emplace_hint(m.end(), key, V())->second);
+		}
+	}
+};
+
+
+// *** IBK types ***
+
+/*! Multi-language strings are written as encoded string (same as in XML). */
+template <>
+struct BinaryIO<IBK::MultiLanguageString> {
+	static void write(std::ostream & out, const IBK::MultiLanguageString & str);
+	static void read(std::istream & in, IBK::MultiLanguageString & str);
+};
+
+/*! Parameters are written with IBK::Parameter::writeBinary(), empty parameters do not overwrite existing values. */
+template <>
+struct BinaryIO<IBK::Parameter> {
+	static void write(std::ostream & out, const IBK::Parameter & p);
+	static void read(std::istream & in, IBK::Parameter & p);
+};
+
+/*! Integer parameters are written with IBK::IntPara::writeBinary(), empty parameters do not overwrite existing values. */
+template <>
+struct BinaryIO<IBK::IntPara> {
+	static void write(std::ostream & out, const IBK::IntPara & p);
+	static void read(std::istream & in, IBK::IntPara & p);
+};
+
+template <>
+struct BinaryIO<IBK::Path> {
+	static void write(std::ostream & out, const IBK::Path & p);
+	static void read(std::istream & in, IBK::Path & p);
+};
+
+/*! Units are stored by ID, readBinaryHeader() ensures that the same unit list was used for writing.
+	Unit IDs are checked against the unit list when being read.
+*/
+template <>
+struct BinaryIO<IBK::Unit> {
+	static void write(std::ostream & out, const IBK::Unit & u);
+	static void read(std::istream & in, IBK::Unit & u);
+};
+
+/*! Empty flags do not overwrite existing values. */
+template <>
+struct BinaryIO<IBK::Flag> {
+	static void write(std::ostream & out, const IBK::Flag & f);
+	static void read(std::istream & in, IBK::Flag & f);
+};
+
+template <>
+struct BinaryIO<IBK::Time> {
+	static void write(std::ostream & out, const IBK::Time & t);
+	static void read(std::istream & in, IBK::Time & t);
+};
+
+/*! Linear splines are written with x and y values and extrapolation method, the spline is re-initialized
+	when being read (same as when read from XML).
+*/
+template <>
+struct BinaryIO<IBK::LinearSpline> {
+	static void write(std::ostream & out, const IBK::LinearSpline & spl);
+	static void read(std::istream & in, IBK::LinearSpline & spl);
+};
+
+template <typename T>
+struct BinaryIO<IBK::point2D<T> > {
+	static void write(std::ostream & out, const IBK::point2D<T> & p) {
+		BinaryIO<T>::write(out, p.m_x);
+		BinaryIO<T>::write(out, p.m_y);
+	}
+	static void read(std::istream & in, IBK::point2D<T> & p) {
+		BinaryIO<T>::read(in, p.m_x);
+		BinaryIO<T>::read(in, p.m_y);
+	}
+};
+
+} // namespace NANDRAD
+
+#endif // NANDRAD_BinaryIOH
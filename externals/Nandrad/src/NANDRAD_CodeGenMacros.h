@@ -22,6 +22,8 @@
 #ifndef NANDRAD_CodeGenMacrosH
 #define NANDRAD_CodeGenMacrosH
 
+#include <iosfwd>
+
 class TiXmlElement;
 
 // IDType is used instead of unsigned int for special serialization feature
@@ -29,19 +31,27 @@ typedef unsigned int IDType;
 
 #define NANDRAD_READWRITE \
 	void readXML(const TiXmlElement * element); \
-	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	TiXmlElement * writeXML(TiXmlElement * parent) const; \
+	void readBinary(std::istream & in); \
+	void writeBinary(std::ostream & out) const;
 
 #define NANDRAD_READWRITE_IFNOTEMPTY(X) \
 	void readXML(const TiXmlElement * element) { readXMLPrivate(element); } \
-	TiXmlElement * writeXML(TiXmlElement * parent) const { if (*this != X()) return writeXMLPrivate(parent); else return nullptr; }
+	TiXmlElement * writeXML(TiXmlElement * parent) const { if (*this != X()) return writeXMLPrivate(parent); else return nullptr; } \
+	void readBinary(std::istream & in) { readBinaryPrivate(in); } \
+	void writeBinary(std::ostream & out) const { writeBinaryPrivate(out); }
 
 #define NANDRAD_READWRITE_IFNOT_INVALID_ID \
 	void readXML(const TiXmlElement * element) { readXMLPrivate(element); } \
-	TiXmlElement * writeXML(TiXmlElement * parent) const { if (m_id != INVALID_ID) return writeXMLPrivate(parent); else return nullptr; }
+	TiXmlElement * writeXML(TiXmlElement * parent) const { if (m_id != INVALID_ID) return writeXMLPrivate(parent); else return nullptr; } \
+	void readBinary(std::istream & in) { readBinaryPrivate(in); } \
+	void writeBinary(std::ostream & out) const { writeBinaryPrivate(out); }
 
 #define NANDRAD_READWRITE_PRIVATE \
 	void readXMLPrivate(const TiXmlElement * element); \
-	TiXmlElement * writeXMLPrivate(TiXmlElement * parent) const;
+	TiXmlElement * writeXMLPrivate(TiXmlElement * parent) const; \
+	void readBinaryPrivate(std::istream & in); \
+	void writeBinaryPrivate(std::ostream & out) const;
 
 #define NANDRAD_COMP(X) \
 	bool operator!=(const X & other) const; \
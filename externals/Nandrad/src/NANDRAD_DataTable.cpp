@@ -26,6 +26,8 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 
+#include "NANDRAD_BinaryIO.h"
+
 namespace NANDRAD {
 
 
@@ -89,4 +91,14 @@ const std::vector<double> & DataTable::valueVector(const std::string & parameter
 }
 
 
+void DataTable::readBinary(std::istream & in) {
+	NANDRAD::readBinary(in, m_values);
+}
+
+
+void DataTable::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_values);
+}
+
+
 } // namespace NANDRAD
@@ -25,6 +25,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <iosfwd>
 
 namespace NANDRAD {
 
@@ -59,6 +60,12 @@ public:
 	*/
 	const std::vector<double> & valueVector(const std::string & parameterName) const;
 
+	/*! Reads content of data table in binary format. */
+	void readBinary(std::istream & in);
+
+	/*! Writes content of data table in binary format. */
+	void writeBinary(std::ostream & out) const;
+
 
 	/*! The actual data member. */
 	std::map<std::string, std::vector<double> >		m_values;
@@ -8,6 +8,8 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 
+#include "NANDRAD_BinaryIO.h"
+
 
 
 namespace NANDRAD {
@@ -84,6 +86,12 @@ public:
 		return strm.str();
 	}
 
+	/*! Reads content of vector map in binary format. */
+	void readBinary(std::istream & in) { NANDRAD::readBinary(in, m_values); }
+
+	/*! Writes content of vector map in binary format. */
+	void writeBinary(std::ostream & out) const { NANDRAD::writeBinary(out, m_values); }
+
 
 	/*! The actual data member.
 		\warning Do not expect vectors to have the same size!
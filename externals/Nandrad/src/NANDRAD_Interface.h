@@ -55,6 +55,8 @@ public:
 
 	void readXML(const TiXmlElement * element);
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	void readBinary(std::istream & in) { readBinaryPrivate(in); }
+	void writeBinary(std::ostream & out) const { writeBinaryPrivate(out); }
 
 	NANDRAD_COMPARE_WITH_ID
 
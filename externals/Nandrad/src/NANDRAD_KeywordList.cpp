@@ -649,6 +649,7 @@ namespace NANDRAD {
 				case 13 : return "KinsolAbsTol";
 				case 14 : return "HydraulicNetworkAbsTol";
 				case 15 : return "HydraulicNetworkMassFluxScale";
+				case 16 : return "RestartBackupInterval";
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -659,6 +660,7 @@ namespace NANDRAD {
 				case 3 : return "MaxOrder";
 				case 4 : return "KinsolMaxNonlinIter";
 				case 5 : return "DiscMaxElementsPerLayer";
+				case 6 : return "RestartBackupCount";
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -666,6 +668,13 @@ namespace NANDRAD {
 				case 0 : return "DetectMaxTimeStep";
 				case 1 : return "KinsolDisableLineSearch";
 				case 2 : return "KinsolStrictNewton";
+				case 3 : return "IncrementalModelEvaluation";
+				case 4 : return "ProfileTimeDependentModels";
+				case 5 : return "HydraulicNetworkJacobianReuse";
+				case 6 : return "HydraulicNetworkAnalyticJacobian";
+				case 7 : return "HydraulicNetworkVerifyJacobian";
+				case 8 : return "LeanFMUStates";
+				case 9 : return "IncrementalRestartWriting";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -1309,6 +1318,7 @@ namespace NANDRAD {
 				case 13 : return "KinsolAbsTol";
 				case 14 : return "HydraulicNetworkAbsTol";
 				case 15 : return "HydraulicNetworkMassFluxScale";
+				case 16 : return "RestartBackupInterval";
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -1319,6 +1329,7 @@ namespace NANDRAD {
 				case 3 : return "MaxOrder";
 				case 4 : return "KinsolMaxNonlinIter";
 				case 5 : return "DiscMaxElementsPerLayer";
+				case 6 : return "RestartBackupCount";
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -1326,6 +1337,13 @@ namespace NANDRAD {
 				case 0 : return "DetectMaxTimeStep";
 				case 1 : return "KinsolDisableLineSearch";
 				case 2 : return "KinsolStrictNewton";
+				case 3 : return "IncrementalModelEvaluation";
+				case 4 : return "ProfileTimeDependentModels";
+				case 5 : return "HydraulicNetworkJacobianReuse";
+				case 6 : return "HydraulicNetworkAnalyticJacobian";
+				case 7 : return "HydraulicNetworkVerifyJacobian";
+				case 8 : return "LeanFMUStates";
+				case 9 : return "IncrementalRestartWriting";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -1970,6 +1988,7 @@ namespace NANDRAD {
 				case 13 : return "Absolute tolerance for Kinsol solver.";
 				case 14 : return "Absolute tolerance (WRMS threshold) for Newton method in hydraulic network.";
 				case 15 : return "Scale factor for mass fluxes in solution vector of hydraulic network.";
+				case 16 : return "Minimum real time between creation of backup copies of restart data.";
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -1980,6 +1999,7 @@ namespace NANDRAD {
 				case 3 : return "Maximum order allowed for multi-step solver.";
 				case 4 : return "Maximum nonlinear iterations for Kinsol solver.";
 				case 5 : return "Maximum number of elements per layer.";
+				case 6 : return "Number of backup copies of restart data that are kept.";
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -1987,6 +2007,13 @@ namespace NANDRAD {
 				case 0 : return "Check schedules to determine minimum distances between steps and adjust MaxTimeStep.";
 				case 1 : return "Disable line search for steady state cycles.";
 				case 2 : return "Enable strict Newton for steady state cycles.";
+				case 3 : return "Re-evaluate only models affected by changed states.";
+				case 4 : return "Measure setTime() duration of each time-dependent model and write timing table to log directory.";
+				case 5 : return "Keep hydraulic network Jacobian across Newton iterations and time steps and refactorize with stored pivot ordering.";
+				case 6 : return "Assemble hydraulic network Jacobian from analytic partial derivatives of flow elements.";
+				case 7 : return "Compare analytic hydraulic network Jacobian with finite-difference Jacobian and report deviations.";
+				case 8 : return "Do not store Jacobian and preconditioner data in FMU states, rebuild them after restoring a state.";
+				case 9 : return "Write only changed parts of restart data into the restart file.";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -2630,6 +2657,7 @@ namespace NANDRAD {
 				case 13 : return "---";
 				case 14 : return "---";
 				case 15 : return "---";
+				case 16 : return "min";
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -2640,6 +2668,7 @@ namespace NANDRAD {
 				case 3 : return "";
 				case 4 : return "";
 				case 5 : return "";
+				case 6 : return "";
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -2647,6 +2676,13 @@ namespace NANDRAD {
 				case 0 : return "";
 				case 1 : return "";
 				case 2 : return "";
+				case 3 : return "";
+				case 4 : return "";
+				case 5 : return "";
+				case 6 : return "";
+				case 7 : return "";
+				case 8 : return "";
+				case 9 : return "";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -3290,6 +3326,7 @@ namespace NANDRAD {
 				case 13 : return "#FFFFFF";
 				case 14 : return "#FFFFFF";
 				case 15 : return "#FFFFFF";
+				case 16 : return "#FFFFFF";
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -3300,6 +3337,7 @@ namespace NANDRAD {
 				case 3 : return "#FFFFFF";
 				case 4 : return "#FFFFFF";
 				case 5 : return "#FFFFFF";
+				case 6 : return "#FFFFFF";
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -3307,6 +3345,13 @@ namespace NANDRAD {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
 				case 2 : return "#FFFFFF";
+				case 3 : return "#FFFFFF";
+				case 4 : return "#FFFFFF";
+				case 5 : return "#FFFFFF";
+				case 6 : return "#FFFFFF";
+				case 7 : return "#FFFFFF";
+				case 8 : return "#FFFFFF";
+				case 9 : return "#FFFFFF";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -3950,6 +3995,7 @@ namespace NANDRAD {
 				case 13 : return std::numeric_limits<double>::quiet_NaN();
 				case 14 : return std::numeric_limits<double>::quiet_NaN();
 				case 15 : return std::numeric_limits<double>::quiet_NaN();
+				case 16 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// SolverParameter::intPara_t
 			case 67 :
@@ -3960,6 +4006,7 @@ namespace NANDRAD {
 				case 3 : return std::numeric_limits<double>::quiet_NaN();
 				case 4 : return std::numeric_limits<double>::quiet_NaN();
 				case 5 : return std::numeric_limits<double>::quiet_NaN();
+				case 6 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// SolverParameter::flag_t
 			case 68 :
@@ -3967,6 +4014,13 @@ namespace NANDRAD {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
+				case 3 : return std::numeric_limits<double>::quiet_NaN();
+				case 4 : return std::numeric_limits<double>::quiet_NaN();
+				case 5 : return std::numeric_limits<double>::quiet_NaN();
+				case 6 : return std::numeric_limits<double>::quiet_NaN();
+				case 7 : return std::numeric_limits<double>::quiet_NaN();
+				case 8 : return std::numeric_limits<double>::quiet_NaN();
+				case 9 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -4231,11 +4285,11 @@ namespace NANDRAD {
 			// SolarLoadsDistributionModel::para_t
 			case 65 : return 4;
 			// SolverParameter::para_t
-			case 66 : return 16;
+			case 66 : return 17;
 			// SolverParameter::intPara_t
-			case 67 : return 6;
+			case 67 : return 7;
 			// SolverParameter::flag_t
-			case 68 : return 3;
+			case 68 : return 10;
 			// SolverParameter::integrator_t
 			case 69 : return 4;
 			// SolverParameter::lesSolver_t
@@ -4411,11 +4465,11 @@ namespace NANDRAD {
 			// SolarLoadsDistributionModel::para_t
 			case 65 : return 3;
 			// SolverParameter::para_t
-			case 66 : return 15;
+			case 66 : return 16;
 			// SolverParameter::intPara_t
-			case 67 : return 5;
+			case 67 : return 6;
 			// SolverParameter::flag_t
-			case 68 : return 2;
+			case 68 : return 9;
 			// SolverParameter::integrator_t
 			case 69 : return 3;
 			// SolverParameter::lesSolver_t
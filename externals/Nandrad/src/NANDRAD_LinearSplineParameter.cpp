@@ -29,6 +29,7 @@
 #include <NANDRAD_Constants.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -136,6 +137,28 @@ TiXmlElement * LinearSplineParameter::writeXML(TiXmlElement * parent) const {
 }
 
 
+void LinearSplineParameter::readBinary(std::istream & in) {
+	NANDRAD::readBinary(in, m_name);
+	NANDRAD::readBinary(in, m_interpolationMethod);
+	NANDRAD::readBinary(in, m_wrapMethod);
+	NANDRAD::readBinary(in, m_values);
+	NANDRAD::readBinary(in, m_xUnit);
+	NANDRAD::readBinary(in, m_yUnit);
+	NANDRAD::readBinary(in, m_tsvFile);
+}
+
+
+void LinearSplineParameter::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_name);
+	NANDRAD::writeBinary(out, m_interpolationMethod);
+	NANDRAD::writeBinary(out, m_wrapMethod);
+	NANDRAD::writeBinary(out, m_values);
+	NANDRAD::writeBinary(out, m_xUnit);
+	NANDRAD::writeBinary(out, m_yUnit);
+	NANDRAD::writeBinary(out, m_tsvFile);
+}
+
+
 void LinearSplineParameter::checkAndInitialize(const std::string & expectedName, const IBK::Unit & targetXUnit, const IBK::Unit & targetYUnit,
 											   const IBK::Unit & limitYUnit, double minYVal, bool isGreaterEqual,
 											   double maxYVal, bool isLessEqual, const char * const errmsg, bool skipUnitChecks)
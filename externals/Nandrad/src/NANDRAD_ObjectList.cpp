@@ -22,6 +22,7 @@
 #include "NANDRAD_ObjectList.h"
 #include "NANDRAD_Constants.h"
 #include "NANDRAD_KeywordList.h"
+#include "NANDRAD_BinaryIO.h"
 
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
@@ -92,5 +93,23 @@ TiXmlElement * ObjectList::writeXML(TiXmlElement * parent) const {
 }
 
 
+void ObjectList::readBinary(std::istream & in) {
+	readBinaryPrivate(in);
+	NANDRAD::readBinary(in, m_filterID.m_allIDs);
+	NANDRAD::readBinary(in, m_filterID.m_ids);
+	NANDRAD::readBinary(in, m_filterID.m_idIntervals);
+	NANDRAD::readBinary(in, m_referenceType);
+}
+
+
+void ObjectList::writeBinary(std::ostream & out) const {
+	writeBinaryPrivate(out);
+	NANDRAD::writeBinary(out, m_filterID.m_allIDs);
+	NANDRAD::writeBinary(out, m_filterID.m_ids);
+	NANDRAD::writeBinary(out, m_filterID.m_idIntervals);
+	NANDRAD::writeBinary(out, m_referenceType);
+}
+
+
 } // namespace NANDRAD
 
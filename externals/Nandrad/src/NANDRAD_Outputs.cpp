@@ -27,6 +27,8 @@ bool Outputs::operator!=(const Outputs & other) const {
 	if (m_definitions != other.m_definitions) return true;
 	if (m_grids != other.m_grids) return true;
 	if (m_binaryFormat != other.m_binaryFormat) return true;
+	if (m_columnarFormat != other.m_columnarFormat) return true;
+	if (m_compressColumns != other.m_compressColumns) return true;
 	if (m_timeUnit != other.m_timeUnit) return true;
 
 	return false;
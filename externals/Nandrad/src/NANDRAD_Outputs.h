@@ -61,6 +61,12 @@ public:
 	/*! (optional) If true, output files are written in binary format (the default, if flag is missing). */
 	IBK::Flag									m_binaryFormat;				// XML:E
 
+	/*! (optional) If true, output files are written in binary columnar format (takes precedence over BinaryFormat). */
+	IBK::Flag									m_columnarFormat;			// XML:E
+
+	/*! (optional) If true, the columns of output files in binary columnar format are compressed. */
+	IBK::Flag									m_compressColumns;			// XML:E
+
 };
 
 
@@ -24,16 +24,30 @@
 
 #include <algorithm>
 #include <set>
+#include <fstream>
 
 #include <IBK_messages.h>
 #include <IBK_assert.h>
+#include <IBK_FileUtils.h>
 
 #include <tinyxml.h>
 
 #include "NANDRAD_Utilities.h"
+#include "NANDRAD_XMLListReader.h"
+#include "NANDRAD_BinaryIO.h"
 
 namespace NANDRAD {
 
+/*! Magic string at the begin of binary project files. */
+static const char * const BINARY_FILE_MAGIC = "NANDRADB";
+
+/*! Version of the binary project file format.
+	Changes of the data layout of classes with generated binary code are detected through the layout signatures
+	written by the generated code. This version number must be increased whenever hand-written binary code
+	(readBinary()/writeBinary() functions of classes with hand-written XML code, or BinaryIO specializations) changes.
+*/
+static const unsigned int BINARY_FORMAT_VERSION = 2;
+
 
 /*! Test function that checks that all objects in the given vector have different m_id parameters. */
 template <typename T>
@@ -85,9 +99,16 @@ void checkForUniqueNames(const std::vector<T> & vec, const char * const typeIDSt
 void Project::readXML(const IBK::Path & filename) {
 	FUNCID(Project::readXML);
 
+	// long element lists are read in parallel, without parsing the entire file into a single document
+	XMLListReader reader;
+	unsigned int zonesPath = reader.addListPath("NandradProject/Project/Zones");
+	unsigned int constructionInstancesPath = reader.addListPath("NandradProject/Project/ConstructionInstances");
+	unsigned int constructionTypesPath = reader.addListPath("NandradProject/Project/ConstructionTypes");
+	unsigned int materialsPath = reader.addListPath("NandradProject/Project/Materials");
+
 	TiXmlDocument doc;
 	IBK::Path filenamePath(filename);
-	TiXmlElement * xmlElem = openXMLFile(m_placeholders, filenamePath, "NandradProject", doc);
+	TiXmlElement * xmlElem = reader.openXMLFile(m_placeholders, filenamePath, "NandradProject", doc);
 	if (!xmlElem)
 		return; // empty project, this means we are using only defaults
 
@@ -113,84 +134,25 @@ void Project::readXML(const IBK::Path & filename) {
 		if (xmlElem) {
 			readXMLPrivate(xmlElem);
 		}
-	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
-	}
-
-	// check uniqueness of all IDs in all separate id spaces
-	// Note: all objects in the ID-based object lists have an m_id data member. Hence, we can implement
-	//       the check in a template function.
-
-	checkForUniqueIDs(m_materials, "Material");
-	checkForUniqueIDs(m_constructionTypes, "ConstructionType");
-	checkForUniqueIDs(m_zones, "Zone");
-	checkForUniqueIDs(m_constructionInstances, "ConstructionInstance");
-
-	if(!m_hydraulicNetworks.empty()) {
-		// put all flow elements into a common id space
-		std::vector<HydraulicNetworkElement> flowElems;
-		// check all networks
-		for(const HydraulicNetwork &nw : m_hydraulicNetworks) {
-			checkForUniqueIDs(nw.m_components, "HydraulicNetworkComponent");
-			checkForUniqueIDs(nw.m_pipeProperties, "HydraulicNetworkPipeProperties");
-			// at the moment just store elements into vector
-			if(!flowElems.empty())
-				flowElems.insert(flowElems.end(), nw.m_elements.begin(), nw.m_elements.end());
-			else
-				flowElems = nw.m_elements;
+		// the list elements read above were empty, now read their content
+		try {
+			reader.readElements(zonesPath, "Zone", m_zones);
+			reader.readElements(constructionInstancesPath, "ConstructionInstance", m_constructionInstances);
+			reader.readElements(constructionTypesPath, "ConstructionType", m_constructionTypes);
+			reader.readElements(materialsPath, "Material", m_materials);
 		}
-		// enforce a unique id for flow elements of all networks
-		checkForUniqueIDs(flowElems,"HydraulicNetworkElement");
-	}
-
-	// we check for duplicate object lists here, because these are referenced by name, rather than ID
-	checkForUniqueNames(m_outputs.m_grids, "OutputGrid");
-	checkForUniqueNames(m_objectLists, "ObjectList");
-
-
-	// The following objects share a common ID space and must be unique:
-	// - Zone
-	// - ConstructionInstance
-	// - EmbeddedObjects
-	// - Location.Sensors
-	std::set<unsigned int> usedIDs;
-
-	try {
-		// check all zone ids against each other and against
-		// all entries in usedIDs container
-		checkForUniqueGeometryIDs(m_zones, usedIDs);
-	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, "Zone ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
-	}
-	try {
-		// check all constructionInstances for unique ids and store
-		// it in usedIDs container
-		checkForUniqueGeometryIDs(m_constructionInstances, usedIDs);
-		// loop through all constructions and check for unique ids of
-		// embedded objects
-		for(const ConstructionInstance &conInstance : m_constructionInstances) {
-			checkForUniqueGeometryIDs(conInstance.m_embeddedObjects, usedIDs);
+		catch (IBK::Exception & ex) {
+			throw IBK::Exception( ex, IBK::FormatString("Error reading 'Project' element."), FUNC_ID);
+		}
+		catch (std::exception & ex2) {
+			throw IBK::Exception( IBK::FormatString("%1\nError reading 'Project' element.").arg(ex2.what()), FUNC_ID);
 		}
 	}
 	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, "Construction ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
-	}
-	try {
-		// check all sensor ids against each other and against
-		// all entries in usedIDs container
-		checkForUniqueGeometryIDs(m_location.m_sensors, usedIDs);
-	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, "Sensor ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
 	}
 
-	// Note:
-	// - the check for duplicate output definitions is done during output initialization
-
-	// uniqueness check for models
-	m_models.checkForUniqueIDs();
+	checkUniqueIDs();
 }
 
 
@@ -217,6 +179,61 @@ void Project::writeXML(const IBK::Path & filename) const {
 }
 
 
+void Project::readBinary(const IBK::Path & filename) {
+	FUNCID(Project::readBinary);
+
+	IBK::Path filenamePath = filename.withReplacedPlaceholders(m_placeholders);
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, filenamePath, std::ios_base::in | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Cannot open project file '%1'.").arg(filenamePath), FUNC_ID);
+
+	try {
+		readBinaryHeader(in, BINARY_FILE_MAGIC, BINARY_FORMAT_VERSION);
+
+		// Directory Placeholders - existing placeholders are only overwritten by those in the file
+		std::map<std::string, IBK::Path> placeholders;
+		NANDRAD::readBinary(in, placeholders);
+		for (const std::pair<const std::string, IBK::Path> & p : placeholders)
+			m_placeholders[p.first] = p.second;
+
+		readBinaryPrivate(in);
+		if (!in)
+			throw IBK::Exception("Unexpected end of file.", FUNC_ID);
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
+	}
+	catch (std::exception & ex2) {
+		throw IBK::Exception(IBK::FormatString("%1\nError reading project '%2'.").arg(ex2.what()).arg(filename), FUNC_ID);
+	}
+
+	// add the project directory to the placeholders map
+	m_placeholders[IBK::PLACEHOLDER_PROJECT_DIR] = filenamePath.parentPath();
+
+	checkUniqueIDs();
+}
+
+
+void Project::writeBinary(const IBK::Path & filename) const {
+	FUNCID(Project::writeBinary);
+
+	std::ofstream out;
+	if (!IBK::open_ofstream(out, filename, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Cannot create project file '%1'.").arg(filename), FUNC_ID);
+
+	writeBinaryHeader(out, BINARY_FILE_MAGIC, BINARY_FORMAT_VERSION);
+
+	// the project directory placeholder is set when reading the file
+	std::map<std::string, IBK::Path> placeholders(m_placeholders);
+	placeholders.erase(IBK::PLACEHOLDER_PROJECT_DIR);
+	NANDRAD::writeBinary(out, placeholders);
+
+	writeBinaryPrivate(out);
+	if (!out)
+		throw IBK::Exception(IBK::FormatString("Error writing project file '%1'.").arg(filename), FUNC_ID);
+}
+
+
 void Project::initDefaults() {
 	m_solverParameter.initDefaults();
 	m_simulationParameter.initDefaults();
@@ -277,6 +294,85 @@ void Project::writeDirectoryPlaceholdersXML(TiXmlElement * parent) const {
 }
 
 
+void Project::checkUniqueIDs() const {
+	FUNCID(Project::checkUniqueIDs);
+
+	// check uniqueness of all IDs in all separate id spaces
+	// Note: all objects in the ID-based object lists have an m_id data member. Hence, we can implement
+	//       the check in a template function.
+
+	checkForUniqueIDs(m_materials, "Material");
+	checkForUniqueIDs(m_constructionTypes, "ConstructionType");
+	checkForUniqueIDs(m_zones, "Zone");
+	checkForUniqueIDs(m_constructionInstances, "ConstructionInstance");
+
+	if(!m_hydraulicNetworks.empty()) {
+		// put all flow elements into a common id space
+		std::vector<HydraulicNetworkElement> flowElems;
+		// check all networks
+		for(const HydraulicNetwork &nw : m_hydraulicNetworks) {
+			checkForUniqueIDs(nw.m_components, "HydraulicNetworkComponent");
+			checkForUniqueIDs(nw.m_pipeProperties, "HydraulicNetworkPipeProperties");
+			// at the moment just store elements into vector
+			if(!flowElems.empty())
+				flowElems.insert(flowElems.end(), nw.m_elements.begin(), nw.m_elements.end());
+			else
+				flowElems = nw.m_elements;
+		}
+		// enforce a unique id for flow elements of all networks
+		checkForUniqueIDs(flowElems,"HydraulicNetworkElement");
+	}
+
+	// we check for duplicate object lists here, because these are referenced by name, rather than ID
+	checkForUniqueNames(m_outputs.m_grids, "OutputGrid");
+	checkForUniqueNames(m_objectLists, "ObjectList");
+
+
+	// The following objects share a common ID space and must be unique:
+	// - Zone
+	// - ConstructionInstance
+	// - EmbeddedObjects
+	// - Location.Sensors
+	std::set<unsigned int> usedIDs;
+
+	try {
+		// check all zone ids against each other and against
+		// all entries in usedIDs container
+		checkForUniqueGeometryIDs(m_zones, usedIDs);
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, "Zone ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
+	}
+	try {
+		// check all constructionInstances for unique ids and store
+		// it in usedIDs container
+		checkForUniqueGeometryIDs(m_constructionInstances, usedIDs);
+		// loop through all constructions and check for unique ids of
+		// embedded objects
+		for(const ConstructionInstance &conInstance : m_constructionInstances) {
+			checkForUniqueGeometryIDs(conInstance.m_embeddedObjects, usedIDs);
+		}
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, "Construction ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
+	}
+	try {
+		// check all sensor ids against each other and against
+		// all entries in usedIDs container
+		checkForUniqueGeometryIDs(m_location.m_sensors, usedIDs);
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, "Sensor ID was previously used (Zones, Constructions, Sensors share same ID space).", FUNC_ID);
+	}
+
+	// Note:
+	// - the check for duplicate output definitions is done during output initialization
+
+	// uniqueness check for models
+	m_models.checkForUniqueIDs();
+}
+
+
 void Project::mergeSameConstructions() {
 	FUNCID(Project::mergeSameConstructions);
 
@@ -68,6 +68,19 @@ public:
 	*/
 	void writeXML(const IBK::Path & filename) const;
 
+	/*! Reads the project data from a binary project file (usually with extension 'nandradb').
+		Binary project files hold the same data as XML project files, but can be read and written much faster.
+		They are meant for passing projects to the solver and for temporary copies, not as archive format: reading
+		fails, if the file was written with another version of the data model.
+		\param filename  The full path to the project file.
+	*/
+	void readBinary(const IBK::Path & filename);
+
+	/*! Writes the project data to a binary project file.
+		\param filename  The full path to the project file.
+	*/
+	void writeBinary(const IBK::Path & filename) const;
+
 	/*! Initializes project defaults.
 		This function is called during solver run before readXML(). Hence, default values can be overwritten during
 		project file reading.
@@ -158,6 +171,11 @@ private:
 	*/
 	void writeDirectoryPlaceholdersXML(TiXmlElement * parent) const;
 
+	/*! Checks uniqueness of all IDs in all separate id spaces and of all names of objects referenced by name.
+		Throws an IBK::Exception in case of duplicates.
+	*/
+	void checkUniqueIDs() const;
+
 };
 
 
@@ -25,6 +25,7 @@
 #include "NANDRAD_KeywordList.h"
 #include "NANDRAD_Utilities.h"
 #include "NANDRAD_Constants.h"
+#include "NANDRAD_BinaryIO.h"
 
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
@@ -323,6 +324,26 @@ TiXmlElement * Schedules::writeXML(TiXmlElement * parent) const {
 }
 
 
+void Schedules::readBinary(std::istream & in) {
+	NANDRAD::readBinary(in, m_holidays);
+	NANDRAD::readBinary(in, m_weekEndDays);
+	NANDRAD::readBinary(in, m_firstDayOfYear);
+	NANDRAD::readBinary(in, m_flags);
+	NANDRAD::readBinary(in, m_scheduleGroups);
+	NANDRAD::readBinary(in, m_annualSchedules);
+}
+
+
+void Schedules::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_holidays);
+	NANDRAD::writeBinary(out, m_weekEndDays);
+	NANDRAD::writeBinary(out, m_firstDayOfYear);
+	NANDRAD::writeBinary(out, m_flags);
+	NANDRAD::writeBinary(out, m_scheduleGroups);
+	NANDRAD::writeBinary(out, m_annualSchedules);
+}
+
+
 bool Schedules::operator!=(const Schedules & other) const {
 	if (m_holidays != other.m_holidays) return true;
 	if (m_weekEndDays != other.m_weekEndDays) return true;
@@ -58,6 +58,9 @@ void SolverParameter::initDefaults() {
 	m_para[P_HydraulicNetworkAbsTol].set( KeywordList::Keyword("SolverParameter::para_t", P_HydraulicNetworkAbsTol),				0.001, IBK::Unit("---"));
 	m_para[P_HydraulicNetworkMassFluxScale].set( KeywordList::Keyword("SolverParameter::para_t", P_HydraulicNetworkMassFluxScale),	1000, IBK::Unit("---"));
 
+	m_para[P_RestartBackupInterval].set( KeywordList::Keyword("SolverParameter::para_t", P_RestartBackupInterval),				10, IBK::Unit("min"));
+	m_intPara[IP_RestartBackupCount].set( KeywordList::Keyword("SolverParameter::intPara_t", IP_RestartBackupCount),				1);
+
 	m_flag[F_DetectMaxTimeStep].set( KeywordList::Keyword("SolverParameter::flag_t", F_DetectMaxTimeStep), true );
 	m_flag[F_KinsolDisableLineSearch].set(KeywordList::Keyword("SolverParameter::flag_t", F_KinsolDisableLineSearch), false);
 }
@@ -64,6 +64,8 @@ public:
 		P_KinsolAbsTol,						// Keyword: KinsolAbsTol					[---]	'Absolute tolerance for Kinsol solver.'
 		P_HydraulicNetworkAbsTol,			// Keyword: HydraulicNetworkAbsTol			[---]	'Absolute tolerance (WRMS threshold) for Newton method in hydraulic network.'
 		P_HydraulicNetworkMassFluxScale,	// Keyword: HydraulicNetworkMassFluxScale	[---]	'Scale factor for mass fluxes in solution vector of hydraulic network.'
+		/*! Minimum real time between creation of backup copies of restart data, default 10 min. */
+		P_RestartBackupInterval,			// Keyword: RestartBackupInterval			[min]	'Minimum real time between creation of backup copies of restart data.'
 		NUM_P
 	};
 
@@ -75,6 +77,8 @@ public:
 		IP_MaxOrder,						// Keyword: MaxOrder								'Maximum order allowed for multi-step solver.'
 		IP_KinsolMaxNonlinIter,				// Keyword: KinsolMaxNonlinIter						'Maximum nonlinear iterations for Kinsol solver.'
 		IP_DiscMaxElementsPerLayer,			// Keyword: DiscMaxElementsPerLayer					'Maximum number of elements per layer.'
+		/*! Number of backup copies of restart data (restart.bin.bak, restart.bin.bak2, ...), default 1. */
+		IP_RestartBackupCount,				// Keyword: RestartBackupCount						'Number of backup copies of restart data that are kept.'
 		NUM_IP
 	};
 
@@ -83,6 +87,13 @@ public:
 		F_DetectMaxTimeStep,				// Keyword: DetectMaxTimeStep			'Check schedules to determine minimum distances between steps and adjust MaxTimeStep.'
 		F_KinsolDisableLineSearch,			// Keyword: KinsolDisableLineSearch		'Disable line search for steady state cycles.'
 		F_KinsolStrictNewton,				// Keyword: KinsolStrictNewton			'Enable strict Newton for steady state cycles.'
+		F_IncrementalModelEvaluation,		// Keyword: IncrementalModelEvaluation	'Re-evaluate only models affected by changed states.'
+		F_ProfileTimeDependentModels,		// Keyword: ProfileTimeDependentModels	'Measure setTime() duration of each time-dependent model and write timing table to log directory.'
+		F_HydraulicNetworkJacobianReuse,	// Keyword: HydraulicNetworkJacobianReuse	'Keep hydraulic network Jacobian across Newton iterations and time steps and refactorize with stored pivot ordering.'
+		F_HydraulicNetworkAnalyticJacobian,	// Keyword: HydraulicNetworkAnalyticJacobian	'Assemble hydraulic network Jacobian from analytic partial derivatives of flow elements.'
+		F_HydraulicNetworkVerifyJacobian,	// Keyword: HydraulicNetworkVerifyJacobian	'Compare analytic hydraulic network Jacobian with finite-difference Jacobian and report deviations.'
+		F_LeanFMUStates,					// Keyword: LeanFMUStates					'Do not store Jacobian and preconditioner data in FMU states, rebuild them after restoring a state.'
+		F_IncrementalRestartWriting,		// Keyword: IncrementalRestartWriting		'Write only changed parts of restart data into the restart file.'
 		NUM_F
 	};
 
@@ -0,0 +1,319 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NANDRAD_XMLListReader.h"
+
+#include <fstream>
+#include <algorithm>
+
+#include <IBK_StringUtils.h>
+#include <IBK_FileUtils.h>
+#include <IBK_UnitList.h>
+
+namespace NANDRAD {
+
+/*! Minimum size of text chunks in bytes. Lists smaller than this are read in a single chunk. */
+const std::size_t XML_LIST_CHUNK_SIZE = 256*1024;
+
+
+unsigned int XMLListReader::addListPath(const std::string & path) {
+	m_paths.push_back(IBK::explode(path, '/'));
+	return (unsigned int)m_paths.size() - 1;
+}
+
+
+TiXmlElement * XMLListReader::openXMLFile(const std::map<std::string,IBK::Path> & pathPlaceHolders, const IBK::Path & filename,
+	const std::string & parentXmlTag, TiXmlDocument & doc)
+{
+	FUNCID(XMLListReader::openXMLFile);
+	// replace path placeholders
+	IBK::Path fname = filename.withReplacedPlaceholders( pathPlaceHolders );
+
+	if ( !fname.isFile() )
+		throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
+				.arg(fname), FUNC_ID);
+
+	std::string text;
+	{
+		std::ifstream in;
+		if (!IBK::open_ifstream(in, fname, std::ios_base::in | std::ios_base::binary))
+			throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
+					.arg(fname), FUNC_ID);
+		in.seekg(0, std::ios_base::end);
+		text.resize((std::size_t)in.tellg());
+		in.seekg(0, std::ios_base::beg);
+		in.read(&text[0], (std::streamsize)text.size());
+		if (!in)
+			throw IBK::Exception(IBK::FormatString("Error reading file '%1'.").arg(fname), FUNC_ID);
+	}
+
+	// normalize line breaks (CR+LF and CR to LF) like TiXmlDocument::LoadFile()
+	std::size_t q = 0;
+	for (std::size_t p = 0; p < text.size(); ++p) {
+		if (text[p] == '\r') {
+			text[q++] = '\n';
+			if (p+1 < text.size() && text[p+1] == '\n')
+				++p;
+		}
+		else
+			text[q++] = text[p];
+	}
+	text.resize(q);
+
+	m_filename = filename;
+	std::string remainingText;
+	cutLists(text, remainingText);
+	std::string().swap(text);
+
+	return parseRemainingText(remainingText, parentXmlTag, doc);
+}
+
+
+TiXmlElement * XMLListReader::openXMLText(const std::string & xmltext, const std::string & parentXmlTag, TiXmlDocument & doc) {
+	m_filename.clear();
+	std::string remainingText;
+	cutLists(xmltext, remainingText);
+	return parseRemainingText(remainingText, parentXmlTag, doc);
+}
+
+
+void XMLListReader::cutLists(const std::string & text, std::string & remainingText) {
+	m_lists.assign(m_paths.size(), std::vector<List>());
+	remainingText.clear();
+
+	// unit list is initialized on first use, make sure this does not happen in the parallel section
+	IBK::UnitList::instance();
+
+	const char * s = text.c_str();
+	const std::size_t n = text.size();
+
+	std::vector<std::string>	names;			// names of all open elements
+	std::vector<unsigned int>	indexes;		// index of each open element among its parent's element children
+	std::vector<unsigned int>	childCounts(1, 0); // number of element children of each open element (first is document)
+
+	// state of list currently being cut
+	int							listPath = -1;
+	std::size_t					listDepth = 0;
+	std::size_t					contentStart = 0;
+	std::size_t					childStart = 0;
+	std::vector<std::pair<std::size_t, std::size_t> > children;
+
+	std::size_t copiedUntil = 0;	// text up to this position has been processed for remainingText
+	std::size_t rowPos = 0;			// position up to which rows have been counted
+	int row = 0;					// number of line breaks before rowPos
+
+	bool malformed = false;
+	std::size_t pos = 0;
+	while ((pos = text.find('<', pos)) != std::string::npos) {
+		// skip comments, CDATA sections, declarations and DOCTYPE
+		std::size_t end;
+		if (text.compare(pos, 4, "<!--") == 0)
+			end = text.find("-->", pos + 4);
+		else if (text.compare(pos, 9, "<![CDATA[") == 0)
+			end = text.find("]]>", pos + 9);
+		else if (text.compare(pos, 2, "<?") == 0)
+			end = text.find("?>", pos + 2);
+		else if (text.compare(pos, 2, "<!") == 0)
+			end = text.find('>', pos + 2);
+		else if (text.compare(pos, 2, "</") == 0) {
+			// end tag
+			end = text.find('>', pos + 2);
+			if (end == std::string::npos || names.empty()) {
+				malformed = true;
+				break;
+			}
+			std::size_t nameEnd = pos + 2;
+			while (nameEnd < end && s[nameEnd] != ' ' && s[nameEnd] != '\t' && s[nameEnd] != '\n' && s[nameEnd] != '\r')
+				++nameEnd;
+			if (text.compare(pos + 2, nameEnd - pos - 2, names.back()) != 0) {
+				malformed = true;
+				break;
+			}
+			if (listPath != -1) {
+				if (names.size() == listDepth + 1) {
+					// end of child element of list
+					children.push_back(std::make_pair(childStart, end + 1));
+				}
+				else if (names.size() == listDepth) {
+					// end of list element, replace list content by line breaks
+					remainingText.append(text, copiedUntil, contentStart - copiedUntil);
+					row += (int)std::count(s + rowPos, s + contentStart, '\n');
+					rowPos = contentStart;
+					int rowsBefore = row;
+					copiedUntil = pos;
+
+					// move children into chunks
+					List list;
+					list.m_indexes = indexes;
+					std::size_t chunkStart = std::string::npos;
+					std::size_t chunkEnd = 0;
+					for (unsigned int i=0; i<=children.size(); ++i) {
+						// add current chunk when large enough or at the end
+						if (chunkStart != std::string::npos &&
+							(i == children.size() || chunkEnd - chunkStart >= XML_LIST_CHUNK_SIZE))
+						{
+							row += (int)std::count(s + rowPos, s + chunkStart, '\n');
+							rowPos = chunkStart;
+							list.m_chunks.push_back(text.substr(chunkStart, chunkEnd - chunkStart));
+							list.m_chunkRows.push_back(row);
+							chunkStart = std::string::npos;
+						}
+						if (i == children.size())
+							break;
+						if (chunkStart == std::string::npos)
+							chunkStart = children[i].first;
+						chunkEnd = children[i].second;
+					}
+					m_lists[listPath].push_back(list);
+
+					row += (int)std::count(s + rowPos, s + pos, '\n');
+					rowPos = pos;
+					remainingText.append((std::size_t)(row - rowsBefore), '\n');
+
+					listPath = -1;
+					children.clear();
+				}
+			}
+			names.pop_back();
+			indexes.pop_back();
+			childCounts.pop_back();
+			pos = end + 1;
+			continue;
+		}
+		else {
+			// start tag, find end of tag (attribute values may contain '>')
+			char quote = 0;
+			end = pos + 1;
+			for (; end < n; ++end) {
+				char c = s[end];
+				if (quote != 0) {
+					if (c == quote)
+						quote = 0;
+				}
+				else if (c == '"' || c == '\'')
+					quote = c;
+				else if (c == '>')
+					break;
+			}
+			if (end == n) {
+				malformed = true;
+				break;
+			}
+			std::size_t nameEnd = pos + 1;
+			while (nameEnd < end && s[nameEnd] != ' ' && s[nameEnd] != '\t' && s[nameEnd] != '\n' && s[nameEnd] != '\r' && s[nameEnd] != '/')
+				++nameEnd;
+
+			if (listPath != -1 && names.size() == listDepth)
+				childStart = pos;
+			unsigned int index = childCounts.back()++;
+
+			if (s[end-1] == '/') {
+				// empty element
+				if (listPath != -1 && names.size() == listDepth)
+					children.push_back(std::make_pair(pos, end + 1));
+			}
+			else {
+				names.push_back(std::string(s + pos + 1, nameEnd - pos - 1));
+				indexes.push_back(index);
+				childCounts.push_back(0);
+				// check if this is a list element to be cut
+				if (listPath == -1) {
+					for (unsigned int i=0; i<m_paths.size(); ++i) {
+						if (m_paths[i] == names) {
+							listPath = (int)i;
+							listDepth = names.size();
+							contentStart = end + 1;
+							break;
+						}
+					}
+				}
+			}
+			pos = end + 1;
+			continue;
+		}
+		if (end == std::string::npos) {
+			malformed = true;
+			break;
+		}
+		pos = end + 1;
+	}
+
+	// in case of malformed XML text we parse the entire text, so that the TiXml parser reports the error
+	if (malformed || !names.empty()) {
+		m_lists.assign(m_paths.size(), std::vector<List>());
+		remainingText = text;
+		return;
+	}
+	remainingText.append(text, copiedUntil, std::string::npos);
+}
+
+
+const TiXmlElement * XMLListReader::parseChunk(List & list, unsigned int chunkIdx, TiXmlDocument & doc) const {
+	FUNCID(XMLListReader::parseChunk);
+
+	doc.ParseFragment(list.m_chunks[chunkIdx].c_str(), list.m_chunkRows[chunkIdx], TIXML_ENCODING_UTF8);
+	std::string().swap(list.m_chunks[chunkIdx]);
+	if (doc.Error()) {
+		if (m_filename.isValid())
+			throw IBK::Exception(IBK::FormatString("Error in line %1 of project file '%2':\n%3")
+					.arg(doc.ErrorRow())
+					.arg(m_filename)
+					.arg(doc.ErrorDesc()), FUNC_ID);
+		else
+			throw IBK::Exception(IBK::FormatString("Error in line %1 of project text \n%2")
+					.arg(doc.ErrorRow())
+					.arg(doc.ErrorDesc()), FUNC_ID);
+	}
+	return doc.FirstChildElement();
+}
+
+
+TiXmlElement * XMLListReader::parseRemainingText(const std::string & text, const std::string & parentXmlTag, TiXmlDocument & doc) const {
+	FUNCID(XMLListReader::parseRemainingText);
+
+	doc.Parse(text.c_str(), nullptr, TIXML_ENCODING_UTF8);
+	if (doc.Error()) {
+		if (m_filename.isValid())
+			throw IBK::Exception(IBK::FormatString("Error in line %1 of project file '%2':\n%3")
+					.arg(doc.ErrorRow())
+					.arg(m_filename)
+					.arg(doc.ErrorDesc()), FUNC_ID);
+		else
+			throw IBK::Exception(IBK::FormatString("Error in line %1 of project text \n%2")
+					.arg(doc.ErrorRow())
+					.arg(doc.ErrorDesc()), FUNC_ID);
+	}
+
+	// we use a handle so that NULL pointer checks are done during the query functions
+	TiXmlHandle xmlHandleDoc(&doc);
+
+	// read root element
+	TiXmlElement * xmlElem = xmlHandleDoc.FirstChildElement().Element();
+	if (!xmlElem)
+		return nullptr; // empty file?
+	std::string rootnode = xmlElem->Value();
+	if (rootnode != parentXmlTag)
+		throw IBK::Exception( IBK::FormatString("Expected '%1' as root node in XML file.").arg(parentXmlTag), FUNC_ID);
+
+	return xmlElem;
+}
+
+} // namespace NANDRAD
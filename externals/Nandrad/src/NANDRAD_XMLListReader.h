@@ -0,0 +1,203 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NANDRAD_XMLListReaderH
+#define NANDRAD_XMLListReaderH
+
+#include <string>
+#include <vector>
+#include <map>
+#include <exception>
+#include <iterator>
+
+#include <tinyxml.h>
+
+#include <IBK_Path.h>
+#include <IBK_messages.h>
+#include <IBK_FormatString.h>
+#include <IBK_Exception.h>
+
+#include "NANDRAD_Constants.h"
+
+namespace NANDRAD {
+
+/*! Reads XML project files with long element lists in parallel.
+
+	Large project files consist mostly of long lists of similar elements (construction instances, rooms,
+	database elements). Instead of parsing the entire file into a single DOM, the child elements of selected
+	list elements are cut out of the XML text before parsing. The remaining text (with empty list elements) is
+	parsed and read as usual, the cut-out elements are parsed in chunks into small documents and read
+	in parallel (with OpenMP). Each chunk document is discarded as soon as its elements have been read, so that
+	the DOM of the complete file is never held in memory.
+
+	Usage:
+	\code
+	XMLListReader reader;
+	unsigned int zonesPath = reader.addListPath("NandradProject/Project/Zones");
+	TiXmlDocument doc;
+	TiXmlElement * xmlElem = reader.openXMLFile(placeholders, filename, "NandradProject", doc);
+	// ... read remaining document, Zones element is empty ...
+	reader.readElements(zonesPath, "Zone", m_zones); // appends zones
+	\endcode
+
+	Row numbers in warnings and error messages refer to the original text. Messages issued while reading the
+	chunks are collected (see IBK::MessageCollector) and passed on in order of the elements after all chunks
+	have been read.
+*/
+class XMLListReader {
+public:
+	/*! Children of a list element that have been cut out of the XML text. */
+	struct List {
+		/*! Position of each element in the list path among the element children of its parent element.
+			For example, for path "VicusProject/Project/Buildings/Building/BuildingLevels/BuildingLevel/Rooms"
+			m_indexes[3] is the index of the building and m_indexes[5] the index of the building level.
+		*/
+		std::vector<unsigned int>	m_indexes;
+		/*! Text of the child elements, split into chunks of complete elements. */
+		std::vector<std::string>	m_chunks;
+		/*! Row (0-based) of the first character of each chunk in the original text. */
+		std::vector<int>			m_chunkRows;
+	};
+
+	/*! Adds the path of list elements whose children shall be read in parallel.
+		Path elements are separated by '/' and start with the root element. Lists inside lists that have already
+		been cut out are not considered.
+		Must be called before openXMLFile() or openXMLText().
+		\return Returns index of path, to be used in readElements() and lists().
+	*/
+	unsigned int addListPath(const std::string & path);
+
+	/*! Reads an XML file, cuts out all lists and parses the remaining text into doc.
+		Same arguments and error handling as NANDRAD::openXMLFile().
+	*/
+	TiXmlElement * openXMLFile(const std::map<std::string,IBK::Path>  &pathPlaceHolders, const IBK::Path & filename,
+		const std::string & parentXmlTag, TiXmlDocument & doc);
+
+	/*! Cuts out all lists of an XML text and parses the remaining text into doc.
+		Same arguments and error handling as NANDRAD::openXMLText().
+	*/
+	TiXmlElement * openXMLText(const std::string & xmltext, const std::string & parentXmlTag, TiXmlDocument & doc);
+
+	/*! Returns all lists found for the path with given index, in order of appearance. */
+	const std::vector<List> & lists(unsigned int pathIdx) const { return m_lists[pathIdx]; }
+
+	/*! Reads the elements of all lists found for the path with given index and appends them to vec.
+		\param pathIdx Index of path as returned by addListPath().
+		\param elementName Expected name of the child elements (other elements are read as well, but yield a warning).
+		\param vec Vector to append the elements to.
+	*/
+	template <typename T>
+	void readElements(unsigned int pathIdx, const std::string & elementName, std::vector<T> & vec) {
+		std::vector<std::vector<T> > listElements;
+		readElementLists(pathIdx, elementName, listElements);
+		for (std::vector<T> & elements : listElements)
+			vec.insert(vec.end(), std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+	}
+
+	/*! Reads the elements of all lists found for the path with given index, each list separately.
+		All chunks of all lists are parsed and read in parallel. The chunk texts are released afterwards.
+		\param pathIdx Index of path as returned by addListPath().
+		\param elementName Expected name of the child elements (other elements are read as well, but yield a warning).
+		\param listElements Elements of each list, same size and order as lists(pathIdx).
+	*/
+	template <typename T>
+	void readElementLists(unsigned int pathIdx, const std::string & elementName, std::vector<std::vector<T> > & listElements) {
+		FUNCID(XMLListReader::readElementLists);
+
+		std::vector<List> & pathLists = m_lists[pathIdx];
+		listElements.clear();
+		listElements.resize(pathLists.size());
+
+		// flat vector of all chunks, each chunk is read into its own vector to keep the order of elements
+		std::vector<std::pair<unsigned int, unsigned int> > chunks; // list index, chunk index
+		for (unsigned int i=0; i<pathLists.size(); ++i)
+			for (unsigned int j=0; j<pathLists[i].m_chunks.size(); ++j)
+				chunks.push_back(std::make_pair(i, j));
+		std::vector<std::vector<T> > chunkElements(chunks.size());
+		std::vector<std::exception_ptr> errors(chunks.size());
+		// messages of each chunk, IBK::IBK_Message() drops messages of worker threads
+		std::vector<std::vector<IBK::MessageCollector::Message> > messages(chunks.size());
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+		for (int i=0; i<(int)chunks.size(); ++i) {
+			IBK::MessageCollector collector;
+			try {
+				TiXmlDocument doc;
+				const TiXmlElement * c = parseChunk(pathLists[chunks[i].first], chunks[i].second, doc);
+				while (c) {
+					const std::string & cName = c->ValueStr();
+					if (cName != elementName)
+						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(cName).arg(c->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+					chunkElements[i].push_back(T());
+					chunkElements[i].back().readXML(c);
+					c = c->NextSiblingElement();
+				}
+			}
+			catch (...) {
+				errors[i] = std::current_exception();
+			}
+			messages[i].swap(collector.m_messages);
+		}
+
+		// pass on messages, in order of chunks
+		for (const std::vector<IBK::MessageCollector::Message> & msgs : messages)
+			IBK::MessageCollector::passOn(msgs);
+
+		// re-throw first error
+		for (const std::exception_ptr & e : errors)
+			if (e)
+				std::rethrow_exception(e);
+
+		for (unsigned int i=0; i<chunks.size(); ++i) {
+			std::vector<T> & elements = listElements[chunks[i].first];
+			if (elements.empty())
+				elements.swap(chunkElements[i]);
+			else
+				elements.insert(elements.end(), std::make_move_iterator(chunkElements[i].begin()),
+								std::make_move_iterator(chunkElements[i].end()));
+		}
+	}
+
+private:
+	/*! Scans the XML text, moves the children of all list elements into chunks and composes the remaining text.
+		The list content is replaced by line breaks in the remaining text, so that row numbers are kept.
+	*/
+	void cutLists(const std::string & text, std::string & remainingText);
+
+	/*! Parses a chunk of a list into doc (chunk text is released) and returns the first element. */
+	const TiXmlElement * parseChunk(List & list, unsigned int chunkIdx, TiXmlDocument & doc) const;
+
+	/*! Parses the remaining text into doc and checks the root element. */
+	TiXmlElement * parseRemainingText(const std::string & text, const std::string & parentXmlTag, TiXmlDocument & doc) const;
+
+	/*! Element names of all list paths. */
+	std::vector<std::vector<std::string> >	m_paths;
+	/*! Lists found for each path. */
+	std::vector<std::vector<List> >			m_lists;
+	/*! Name of file being read, used in error messages (empty when reading text). */
+	IBK::Path								m_filename;
+};
+
+} // namespace NANDRAD
+
+#endif // NANDRAD_XMLListReaderH
@@ -22,6 +22,7 @@
 #include "NANDRAD_Zone.h"
 
 #include "NANDRAD_KeywordList.h"
+#include "NANDRAD_BinaryIO.h"
 #include <IBK_messages.h>
 
 #include <tinyxml.h>
@@ -172,4 +173,16 @@ TiXmlElement * Zone::writeXML(TiXmlElement * parent) const {
 }
 
 
+void Zone::readBinary(std::istream & in) {
+	readBinaryPrivate(in);
+	NANDRAD::readBinary(in, m_viewFactors);
+}
+
+
+void Zone::writeBinary(std::ostream & out) const {
+	writeBinaryPrivate(out);
+	NANDRAD::writeBinary(out, m_viewFactors);
+}
+
+
 } // namespace NANDRAD
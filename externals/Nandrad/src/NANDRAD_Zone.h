@@ -81,6 +81,12 @@ public:
 	/*! Calls the generated writeXMLPrivate and additionally reads the view factors */
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
 
+	/*! Calls the generated readBinaryPrivate and additionally reads the view factors */
+	void readBinary(std::istream & in);
+
+	/*! Calls the generated writeBinaryPrivate and additionally writes the view factors */
+	void writeBinary(std::ostream & out) const;
+
 	// *** PUBLIC MEMBER VARIABLES ***
 
 	/*! Unique ID of the zone. */
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -152,4 +153,26 @@ TiXmlElement * ConstructionInstance::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ConstructionInstance::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x658dd818u, "ConstructionInstance");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_constructionTypeId);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_interfaceA);
+	NANDRAD::readBinary(in, m_interfaceB);
+	NANDRAD::readBinary(in, m_embeddedObjects);
+}
+
+void ConstructionInstance::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x658dd818u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_constructionTypeId);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_interfaceA);
+	NANDRAD::writeBinary(out, m_interfaceB);
+	NANDRAD::writeBinary(out, m_embeddedObjects);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -113,4 +114,20 @@ TiXmlElement * ConstructionType::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ConstructionType::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x0c28489cu, "ConstructionType");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_activeLayerIndex);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_materialLayers);
+}
+
+void ConstructionType::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x0c28489cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_activeLayerIndex);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_materialLayers);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -90,4 +91,18 @@ TiXmlElement * DailyCycle::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void DailyCycle::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xebe138fdu, "DailyCycle");
+	NANDRAD::readBinaryEnum(in, m_interpolation, NUM_IT);
+	NANDRAD::readBinary(in, m_timePoints);
+	NANDRAD::readBinary(in, m_values);
+}
+
+void DailyCycle::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xebe138fdu);
+	NANDRAD::writeBinary(out, m_interpolation);
+	NANDRAD::writeBinary(out, m_timePoints);
+	NANDRAD::writeBinary(out, m_values);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -112,4 +113,20 @@ TiXmlElement * EmbeddedObject::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void EmbeddedObject::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xffc409e9u, "EmbeddedObject");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_window);
+}
+
+void EmbeddedObject::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xffc409e9u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_window);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -104,4 +105,20 @@ TiXmlElement * EmbeddedObjectWindow::writeXMLPrivate(TiXmlElement * parent) cons
 	return e;
 }
 
+void EmbeddedObjectWindow::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x2c8e52b8u, "EmbeddedObjectWindow");
+	NANDRAD::readBinary(in, m_glazingSystemId);
+	NANDRAD::readBinary(in, m_frame);
+	NANDRAD::readBinary(in, m_divider);
+	NANDRAD::readBinary(in, m_shading);
+}
+
+void EmbeddedObjectWindow::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x2c8e52b8u);
+	NANDRAD::writeBinary(out, m_glazingSystemId);
+	NANDRAD::writeBinary(out, m_frame);
+	NANDRAD::writeBinary(out, m_divider);
+	NANDRAD::writeBinary(out, m_shading);
+}
+
 } // namespace NANDRAD
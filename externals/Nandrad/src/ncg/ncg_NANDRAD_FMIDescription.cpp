@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -113,4 +114,18 @@ TiXmlElement * FMIDescription::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void FMIDescription::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1bdd5a77u, "FMIDescription");
+	NANDRAD::readBinary(in, m_modelName);
+	NANDRAD::readBinary(in, m_inputVariables);
+	NANDRAD::readBinary(in, m_outputVariables);
+}
+
+void FMIDescription::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1bdd5a77u);
+	NANDRAD::writeBinary(out, m_modelName);
+	NANDRAD::writeBinary(out, m_inputVariables);
+	NANDRAD::writeBinary(out, m_outputVariables);
+}
+
 } // namespace NANDRAD
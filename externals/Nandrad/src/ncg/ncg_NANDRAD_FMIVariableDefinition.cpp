@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -131,4 +132,30 @@ TiXmlElement * FMIVariableDefinition::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void FMIVariableDefinition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x9d9ec1c3u, "FMIVariableDefinition");
+	NANDRAD::readBinary(in, m_fmiVarName);
+	NANDRAD::readBinary(in, m_fmiVarDescription);
+	NANDRAD::readBinary(in, m_unit);
+	NANDRAD::readBinary(in, m_fmiTypeName);
+	NANDRAD::readBinary(in, m_fmiValueRef);
+	NANDRAD::readBinary(in, m_fmiStartValue);
+	NANDRAD::readBinary(in, m_varName);
+	NANDRAD::readBinary(in, m_objectId);
+	NANDRAD::readBinary(in, m_vectorIndex);
+}
+
+void FMIVariableDefinition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x9d9ec1c3u);
+	NANDRAD::writeBinary(out, m_fmiVarName);
+	NANDRAD::writeBinary(out, m_fmiVarDescription);
+	NANDRAD::writeBinary(out, m_unit);
+	NANDRAD::writeBinary(out, m_fmiTypeName);
+	NANDRAD::writeBinary(out, m_fmiValueRef);
+	NANDRAD::writeBinary(out, m_fmiStartValue);
+	NANDRAD::writeBinary(out, m_varName);
+	NANDRAD::writeBinary(out, m_objectId);
+	NANDRAD::writeBinary(out, m_vectorIndex);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -118,4 +119,20 @@ TiXmlElement * HVACControlModel::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void HVACControlModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x5a4ca24au, "HVACControlModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinaryEnum(in, m_operatingMode, NUM_OM);
+	NANDRAD::readBinary(in, m_zoneObjectList);
+}
+
+void HVACControlModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x5a4ca24au);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_operatingMode);
+	NANDRAD::writeBinary(out, m_zoneObjectList);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -97,4 +98,20 @@ TiXmlElement * HeatLoadSummationModel::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void HeatLoadSummationModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x7e8f14ffu, "HeatLoadSummationModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_zoneCoolingLoad);
+	NANDRAD::readBinary(in, m_objectList);
+}
+
+void HeatLoadSummationModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x7e8f14ffu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_zoneCoolingLoad);
+	NANDRAD::writeBinary(out, m_objectList);
+}
+
 } // namespace NANDRAD
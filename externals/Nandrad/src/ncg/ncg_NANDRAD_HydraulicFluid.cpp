@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -109,4 +110,18 @@ TiXmlElement * HydraulicFluid::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void HydraulicFluid::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xc6dddc15u, "HydraulicFluid");
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_kinematicViscosity);
+}
+
+void HydraulicFluid::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xc6dddc15u);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_kinematicViscosity);
+}
+
 } // namespace NANDRAD
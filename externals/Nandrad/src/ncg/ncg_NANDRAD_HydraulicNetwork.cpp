@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -255,4 +256,34 @@ TiXmlElement * HydraulicNetwork::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void HydraulicNetwork::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x60982647u, "HydraulicNetwork");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_referenceElementId);
+	NANDRAD::readBinary(in, m_fluid);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_pipeProperties);
+	NANDRAD::readBinary(in, m_components);
+	NANDRAD::readBinary(in, m_nodes);
+	NANDRAD::readBinary(in, m_elements);
+	NANDRAD::readBinary(in, m_controlElements);
+}
+
+void HydraulicNetwork::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x60982647u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_referenceElementId);
+	NANDRAD::writeBinary(out, m_fluid);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_pipeProperties);
+	NANDRAD::writeBinary(out, m_components);
+	NANDRAD::writeBinary(out, m_nodes);
+	NANDRAD::writeBinary(out, m_elements);
+	NANDRAD::writeBinary(out, m_controlElements);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -123,4 +124,22 @@ TiXmlElement * HydraulicNetworkComponent::writeXML(TiXmlElement * parent) const
 	return e;
 }
 
+void HydraulicNetworkComponent::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x728c04d4u, "HydraulicNetworkComponent");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_polynomCoefficients);
+}
+
+void HydraulicNetworkComponent::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x728c04d4u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_polynomCoefficients);
+}
+
 } // namespace NANDRAD
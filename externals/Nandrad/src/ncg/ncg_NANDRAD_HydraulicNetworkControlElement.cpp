@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -156,4 +157,26 @@ TiXmlElement * HydraulicNetworkControlElement::writeXML(TiXmlElement * parent) c
 	return e;
 }
 
+void HydraulicNetworkControlElement::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x9d512db3u, "HydraulicNetworkControlElement");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinaryEnum(in, m_controllerType, NUM_CT);
+	NANDRAD::readBinaryEnum(in, m_controlledProperty, NUM_CP);
+	NANDRAD::readBinary(in, m_idReferences);
+	NANDRAD::readBinary(in, m_maximumControllerResultValue);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void HydraulicNetworkControlElement::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x9d512db3u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_controllerType);
+	NANDRAD::writeBinary(out, m_controlledProperty);
+	NANDRAD::writeBinary(out, m_idReferences);
+	NANDRAD::writeBinary(out, m_maximumControllerResultValue);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
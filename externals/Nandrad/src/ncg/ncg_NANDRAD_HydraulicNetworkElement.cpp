@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -158,4 +159,38 @@ TiXmlElement * HydraulicNetworkElement::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void HydraulicNetworkElement::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb6d34a30u, "HydraulicNetworkElement");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_inletNodeId);
+	NANDRAD::readBinary(in, m_outletNodeId);
+	NANDRAD::readBinary(in, m_inletZoneId);
+	NANDRAD::readBinary(in, m_outletZoneId);
+	NANDRAD::readBinary(in, m_componentId);
+	NANDRAD::readBinary(in, m_pipePropertiesId);
+	NANDRAD::readBinary(in, m_controlElementId);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+	NANDRAD::readBinary(in, m_heatExchange);
+	NANDRAD::readBinary(in, m_observedPressureDiffElementIds);
+}
+
+void HydraulicNetworkElement::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb6d34a30u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_inletNodeId);
+	NANDRAD::writeBinary(out, m_outletNodeId);
+	NANDRAD::writeBinary(out, m_inletZoneId);
+	NANDRAD::writeBinary(out, m_outletZoneId);
+	NANDRAD::writeBinary(out, m_componentId);
+	NANDRAD::writeBinary(out, m_pipePropertiesId);
+	NANDRAD::writeBinary(out, m_controlElementId);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+	NANDRAD::writeBinary(out, m_heatExchange);
+	NANDRAD::writeBinary(out, m_observedPressureDiffElementIds);
+}
+
 } // namespace NANDRAD
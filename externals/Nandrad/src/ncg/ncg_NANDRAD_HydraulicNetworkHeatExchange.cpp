@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -134,4 +135,20 @@ TiXmlElement * HydraulicNetworkHeatExchange::writeXML(TiXmlElement * parent) con
 	return e;
 }
 
+void HydraulicNetworkHeatExchange::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x201040ebu, "HydraulicNetworkHeatExchange");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_T);
+	NANDRAD::readBinary(in, m_idReferences);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_splPara);
+}
+
+void HydraulicNetworkHeatExchange::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x201040ebu);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_idReferences);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_splPara);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -74,4 +75,16 @@ TiXmlElement * HydraulicNetworkNode::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void HydraulicNetworkNode::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb803c226u, "HydraulicNetworkNode");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_height);
+}
+
+void HydraulicNetworkNode::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb803c226u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_height);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -100,4 +101,16 @@ TiXmlElement * HydraulicNetworkPipeProperties::writeXML(TiXmlElement * parent) c
 	return e;
 }
 
+void HydraulicNetworkPipeProperties::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x658c90b0u, "HydraulicNetworkPipeProperties");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void HydraulicNetworkPipeProperties::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x658c90b0u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
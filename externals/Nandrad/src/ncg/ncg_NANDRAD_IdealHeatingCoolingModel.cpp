@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -112,4 +113,20 @@ TiXmlElement * IdealHeatingCoolingModel::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void IdealHeatingCoolingModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xca2b7409u, "IdealHeatingCoolingModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_zoneObjectList);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void IdealHeatingCoolingModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xca2b7409u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_zoneObjectList);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -161,4 +162,28 @@ TiXmlElement * IdealPipeRegisterModel::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void IdealPipeRegisterModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa7f46bb0u, "IdealPipeRegisterModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_fluid);
+	NANDRAD::readBinary(in, m_constructionObjectList);
+	NANDRAD::readBinary(in, m_thermostatZoneId);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+}
+
+void IdealPipeRegisterModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa7f46bb0u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_fluid);
+	NANDRAD::writeBinary(out, m_constructionObjectList);
+	NANDRAD::writeBinary(out, m_thermostatZoneId);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+}
+
 } // namespace NANDRAD
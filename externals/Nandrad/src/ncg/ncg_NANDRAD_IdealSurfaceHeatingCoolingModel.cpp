@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -120,4 +121,22 @@ TiXmlElement * IdealSurfaceHeatingCoolingModel::writeXML(TiXmlElement * parent)
 	return e;
 }
 
+void IdealSurfaceHeatingCoolingModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x5483a4fcu, "IdealSurfaceHeatingCoolingModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_constructionObjectList);
+	NANDRAD::readBinary(in, m_thermostatZoneId);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void IdealSurfaceHeatingCoolingModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x5483a4fcu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_constructionObjectList);
+	NANDRAD::writeBinary(out, m_thermostatZoneId);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -109,4 +110,26 @@ TiXmlElement * Interface::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Interface::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8db9d9dcu, "Interface");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_zoneId);
+	NANDRAD::readBinary(in, m_heatConduction);
+	NANDRAD::readBinary(in, m_solarAbsorption);
+	NANDRAD::readBinary(in, m_longWaveEmission);
+	NANDRAD::readBinary(in, m_vaporDiffusion);
+	NANDRAD::readBinary(in, m_airFlow);
+}
+
+void Interface::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8db9d9dcu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_zoneId);
+	NANDRAD::writeBinary(out, m_heatConduction);
+	NANDRAD::writeBinary(out, m_solarAbsorption);
+	NANDRAD::writeBinary(out, m_longWaveEmission);
+	NANDRAD::writeBinary(out, m_vaporDiffusion);
+	NANDRAD::writeBinary(out, m_airFlow);
+}
+
 } // namespace NANDRAD
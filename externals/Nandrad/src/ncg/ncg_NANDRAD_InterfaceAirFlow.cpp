@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 
 #include <tinyxml.h>
@@ -76,4 +77,14 @@ TiXmlElement * InterfaceAirFlow::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void InterfaceAirFlow::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x0f556668u, "InterfaceAirFlow");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+}
+
+void InterfaceAirFlow::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x0f556668u);
+	NANDRAD::writeBinary(out, m_modelType);
+}
+
 } // namespace NANDRAD
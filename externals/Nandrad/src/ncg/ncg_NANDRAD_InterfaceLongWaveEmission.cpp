@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -106,4 +107,16 @@ TiXmlElement * InterfaceLongWaveEmission::writeXMLPrivate(TiXmlElement * parent)
 	return e;
 }
 
+void InterfaceLongWaveEmission::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xe32ba1bfu, "InterfaceLongWaveEmission");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void InterfaceLongWaveEmission::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xe32ba1bfu);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
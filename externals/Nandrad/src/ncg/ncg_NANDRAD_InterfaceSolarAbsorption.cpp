@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -106,4 +107,16 @@ TiXmlElement * InterfaceSolarAbsorption::writeXMLPrivate(TiXmlElement * parent)
 	return e;
 }
 
+void InterfaceSolarAbsorption::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x9f0584abu, "InterfaceSolarAbsorption");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void InterfaceSolarAbsorption::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x9f0584abu);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
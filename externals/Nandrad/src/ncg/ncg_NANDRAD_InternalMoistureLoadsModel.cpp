@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -127,4 +128,22 @@ TiXmlElement * InternalMoistureLoadsModel::writeXML(TiXmlElement * parent) const
 	return e;
 }
 
+void InternalMoistureLoadsModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x906b66b5u, "InternalMoistureLoadsModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_zoneObjectList);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void InternalMoistureLoadsModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x906b66b5u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_zoneObjectList);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
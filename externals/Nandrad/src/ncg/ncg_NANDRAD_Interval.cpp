@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -81,4 +82,14 @@ TiXmlElement * Interval::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Interval::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x9d744613u, "Interval");
+	NANDRAD::readBinary(in, m_para);
+}
+
+void Interval::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x9d744613u);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -134,4 +135,24 @@ TiXmlElement * Location::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Location::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb9b73f95u, "Location");
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_flags);
+	NANDRAD::readBinary(in, m_timeZone);
+	NANDRAD::readBinary(in, m_climateFilePath);
+	NANDRAD::readBinary(in, m_shadingFactorFilePath);
+	NANDRAD::readBinary(in, m_sensors);
+}
+
+void Location::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb9b73f95u);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_flags);
+	NANDRAD::writeBinary(out, m_timeZone);
+	NANDRAD::writeBinary(out, m_climateFilePath);
+	NANDRAD::writeBinary(out, m_shadingFactorFilePath);
+	NANDRAD::writeBinary(out, m_sensors);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -104,4 +105,18 @@ TiXmlElement * Material::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Material::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1d9c2cadu, "Material");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void Material::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1d9c2cadu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
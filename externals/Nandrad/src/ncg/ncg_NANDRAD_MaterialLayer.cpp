@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -77,4 +78,16 @@ TiXmlElement * MaterialLayer::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void MaterialLayer::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa397c77bu, "MaterialLayer");
+	NANDRAD::readBinary(in, m_thickness);
+	NANDRAD::readBinary(in, m_matId);
+}
+
+void MaterialLayer::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa397c77bu);
+	NANDRAD::writeBinary(out, m_thickness);
+	NANDRAD::writeBinary(out, m_matId);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -301,4 +302,32 @@ TiXmlElement * Models::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Models::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb6001825u, "Models");
+	NANDRAD::readBinary(in, m_naturalVentilationModels);
+	NANDRAD::readBinary(in, m_internalLoadsModels);
+	NANDRAD::readBinary(in, m_internalMoistureLoadsModels);
+	NANDRAD::readBinary(in, m_shadingControlModels);
+	NANDRAD::readBinary(in, m_thermostats);
+	NANDRAD::readBinary(in, m_idealHeatingCoolingModels);
+	NANDRAD::readBinary(in, m_idealSurfaceHeatingCoolingModels);
+	NANDRAD::readBinary(in, m_idealPipeRegisterModels);
+	NANDRAD::readBinary(in, m_heatLoadSummationModels);
+	NANDRAD::readBinary(in, m_networkInterfaceAdapterModels);
+}
+
+void Models::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb6001825u);
+	NANDRAD::writeBinary(out, m_naturalVentilationModels);
+	NANDRAD::writeBinary(out, m_internalLoadsModels);
+	NANDRAD::writeBinary(out, m_internalMoistureLoadsModels);
+	NANDRAD::writeBinary(out, m_shadingControlModels);
+	NANDRAD::writeBinary(out, m_thermostats);
+	NANDRAD::writeBinary(out, m_idealHeatingCoolingModels);
+	NANDRAD::writeBinary(out, m_idealSurfaceHeatingCoolingModels);
+	NANDRAD::writeBinary(out, m_idealPipeRegisterModels);
+	NANDRAD::writeBinary(out, m_heatLoadSummationModels);
+	NANDRAD::writeBinary(out, m_networkInterfaceAdapterModels);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -109,4 +110,20 @@ TiXmlElement * NetworkInterfaceAdapterModel::writeXML(TiXmlElement * parent) con
 	return e;
 }
 
+void NetworkInterfaceAdapterModel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xdad3e7beu, "NetworkInterfaceAdapterModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_fluidHeatCapacity);
+	NANDRAD::readBinary(in, m_summationModelId);
+}
+
+void NetworkInterfaceAdapterModel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xdad3e7beu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_fluidHeatCapacity);
+	NANDRAD::writeBinary(out, m_summationModelId);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -69,4 +70,14 @@ TiXmlElement * ObjectList::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void ObjectList::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1cb23830u, "ObjectList");
+	NANDRAD::readBinary(in, m_name);
+}
+
+void ObjectList::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1cb23830u);
+	NANDRAD::writeBinary(out, m_name);
+}
+
 } // namespace NANDRAD
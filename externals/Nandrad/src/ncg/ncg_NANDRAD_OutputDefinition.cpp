@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 
 #include <tinyxml.h>
@@ -102,4 +103,22 @@ TiXmlElement * OutputDefinition::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void OutputDefinition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x749da868u, "OutputDefinition");
+	NANDRAD::readBinary(in, m_fileName);
+	NANDRAD::readBinary(in, m_quantity);
+	NANDRAD::readBinaryEnum(in, m_timeType, NUM_OTT);
+	NANDRAD::readBinary(in, m_objectListName);
+	NANDRAD::readBinary(in, m_gridName);
+}
+
+void OutputDefinition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x749da868u);
+	NANDRAD::writeBinary(out, m_fileName);
+	NANDRAD::writeBinary(out, m_quantity);
+	NANDRAD::writeBinary(out, m_timeType);
+	NANDRAD::writeBinary(out, m_objectListName);
+	NANDRAD::writeBinary(out, m_gridName);
+}
+
 } // namespace NANDRAD
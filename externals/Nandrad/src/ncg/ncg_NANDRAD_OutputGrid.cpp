@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -99,4 +100,16 @@ TiXmlElement * OutputGrid::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void OutputGrid::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xd41c134cu, "OutputGrid");
+	NANDRAD::readBinary(in, m_name);
+	NANDRAD::readBinary(in, m_intervals);
+}
+
+void OutputGrid::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xd41c134cu);
+	NANDRAD::writeBinary(out, m_name);
+	NANDRAD::writeBinary(out, m_intervals);
+}
+
 } // namespace NANDRAD
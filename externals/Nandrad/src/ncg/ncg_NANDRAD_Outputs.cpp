@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -74,6 +75,12 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 				if (f.name() == "BinaryFormat") {
 					m_binaryFormat = f; success=true;
 				}
+				else if (f.name() == "ColumnarFormat") {
+					m_columnarFormat = f; success=true;
+				}
+				else if (f.name() == "CompressColumns") {
+					m_compressColumns = f; success=true;
+				}
 				if (!success)
 					IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_NAME).arg(f.name()).arg(cName).arg(c->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
 			}
@@ -125,7 +132,35 @@ TiXmlElement * Outputs::writeXMLPrivate(TiXmlElement * parent) const {
 		IBK_ASSERT("BinaryFormat" == m_binaryFormat.name());
 		TiXmlElement::appendSingleAttributeElement(e, "IBK:Flag", "name", "BinaryFormat", m_binaryFormat.isEnabled() ? "true" : "false");
 	}
+	if (!m_columnarFormat.name().empty()) {
+		IBK_ASSERT("ColumnarFormat" == m_columnarFormat.name());
+		TiXmlElement::appendSingleAttributeElement(e, "IBK:Flag", "name", "ColumnarFormat", m_columnarFormat.isEnabled() ? "true" : "false");
+	}
+	if (!m_compressColumns.name().empty()) {
+		IBK_ASSERT("CompressColumns" == m_compressColumns.name());
+		TiXmlElement::appendSingleAttributeElement(e, "IBK:Flag", "name", "CompressColumns", m_compressColumns.isEnabled() ? "true" : "false");
+	}
 	return e;
 }
 
+void Outputs::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xd9335b83u, "Outputs");
+	NANDRAD::readBinary(in, m_definitions);
+	NANDRAD::readBinary(in, m_grids);
+	NANDRAD::readBinary(in, m_timeUnit);
+	NANDRAD::readBinary(in, m_binaryFormat);
+	NANDRAD::readBinary(in, m_columnarFormat);
+	NANDRAD::readBinary(in, m_compressColumns);
+}
+
+void Outputs::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xd9335b83u);
+	NANDRAD::writeBinary(out, m_definitions);
+	NANDRAD::writeBinary(out, m_grids);
+	NANDRAD::writeBinary(out, m_timeUnit);
+	NANDRAD::writeBinary(out, m_binaryFormat);
+	NANDRAD::writeBinary(out, m_columnarFormat);
+	NANDRAD::writeBinary(out, m_compressColumns);
+}
+
 } // namespace NANDRAD
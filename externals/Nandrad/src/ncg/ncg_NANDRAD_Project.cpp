@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -261,4 +262,42 @@ TiXmlElement * Project::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Project::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1a60f494u, "Project");
+	NANDRAD::readBinary(in, m_projectInfo);
+	NANDRAD::readBinary(in, m_location);
+	NANDRAD::readBinary(in, m_simulationParameter);
+	NANDRAD::readBinary(in, m_solverParameter);
+	NANDRAD::readBinary(in, m_zones);
+	NANDRAD::readBinary(in, m_constructionInstances);
+	NANDRAD::readBinary(in, m_hydraulicNetworks);
+	NANDRAD::readBinary(in, m_constructionTypes);
+	NANDRAD::readBinary(in, m_materials);
+	NANDRAD::readBinary(in, m_windowGlazingSystems);
+	NANDRAD::readBinary(in, m_schedules);
+	NANDRAD::readBinary(in, m_models);
+	NANDRAD::readBinary(in, m_outputs);
+	NANDRAD::readBinary(in, m_objectLists);
+	NANDRAD::readBinary(in, m_fmiDescription);
+}
+
+void Project::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1a60f494u);
+	NANDRAD::writeBinary(out, m_projectInfo);
+	NANDRAD::writeBinary(out, m_location);
+	NANDRAD::writeBinary(out, m_simulationParameter);
+	NANDRAD::writeBinary(out, m_solverParameter);
+	NANDRAD::writeBinary(out, m_zones);
+	NANDRAD::writeBinary(out, m_constructionInstances);
+	NANDRAD::writeBinary(out, m_hydraulicNetworks);
+	NANDRAD::writeBinary(out, m_constructionTypes);
+	NANDRAD::writeBinary(out, m_materials);
+	NANDRAD::writeBinary(out, m_windowGlazingSystems);
+	NANDRAD::writeBinary(out, m_schedules);
+	NANDRAD::writeBinary(out, m_models);
+	NANDRAD::writeBinary(out, m_outputs);
+	NANDRAD::writeBinary(out, m_objectLists);
+	NANDRAD::writeBinary(out, m_fmiDescription);
+}
+
 } // namespace NANDRAD
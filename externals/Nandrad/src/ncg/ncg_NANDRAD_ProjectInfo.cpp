@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -73,4 +74,18 @@ TiXmlElement * ProjectInfo::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ProjectInfo::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x65e41d31u, "ProjectInfo");
+	NANDRAD::readBinary(in, m_comment);
+	NANDRAD::readBinary(in, m_created);
+	NANDRAD::readBinary(in, m_lastEdited);
+}
+
+void ProjectInfo::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x65e41d31u);
+	NANDRAD::writeBinary(out, m_comment);
+	NANDRAD::writeBinary(out, m_created);
+	NANDRAD::writeBinary(out, m_lastEdited);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -119,4 +120,20 @@ TiXmlElement * Schedule::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Schedule::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xfa82f115u, "Schedule");
+	NANDRAD::readBinaryEnum(in, m_type, NUM_ST);
+	NANDRAD::readBinary(in, m_startDayOfTheYear);
+	NANDRAD::readBinary(in, m_endDayOfTheYear);
+	NANDRAD::readBinary(in, m_dailyCycles);
+}
+
+void Schedule::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xfa82f115u);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_startDayOfTheYear);
+	NANDRAD::writeBinary(out, m_endDayOfTheYear);
+	NANDRAD::writeBinary(out, m_dailyCycles);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -108,4 +109,20 @@ TiXmlElement * Sensor::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Sensor::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x0345b547u, "Sensor");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_quantity);
+	NANDRAD::readBinary(in, m_orientation);
+	NANDRAD::readBinary(in, m_inclination);
+}
+
+void Sensor::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x0345b547u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_quantity);
+	NANDRAD::writeBinary(out, m_orientation);
+	NANDRAD::writeBinary(out, m_inclination);
+}
+
 } // namespace NANDRAD
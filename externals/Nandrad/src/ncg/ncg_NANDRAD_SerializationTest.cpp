@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -385,4 +386,96 @@ TiXmlElement * SerializationTest::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SerializationTest::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf944d38fu, "SerializationTest");
+	NANDRAD::readBinary(in, m_id1);
+	NANDRAD::readBinary(in, m_id2);
+	NANDRAD::readBinary(in, m_flag1);
+	NANDRAD::readBinary(in, m_val1);
+	NANDRAD::readBinaryEnum(in, m_testBla, NUM_test);
+	NANDRAD::readBinary(in, m_str1);
+	NANDRAD::readBinary(in, m_path1);
+	NANDRAD::readBinary(in, m_u1);
+	NANDRAD::readBinary(in, m_id3);
+	NANDRAD::readBinary(in, m_id4);
+	NANDRAD::readBinary(in, m_flag2);
+	NANDRAD::readBinary(in, m_val2);
+	NANDRAD::readBinaryEnum(in, m_testBlo, NUM_test);
+	NANDRAD::readBinary(in, m_str2);
+	NANDRAD::readBinary(in, m_path2);
+	NANDRAD::readBinary(in, m_path22);
+	NANDRAD::readBinary(in, m_u2);
+	NANDRAD::readBinary(in, m_x5);
+	NANDRAD::readBinary(in, m_f);
+	NANDRAD::readBinary(in, m_f2);
+	NANDRAD::readBinary(in, m_time1);
+	NANDRAD::readBinary(in, m_time2);
+	NANDRAD::readBinary(in, m_table);
+	NANDRAD::readBinary(in, m_table2);
+	NANDRAD::readBinary(in, m_dblVec);
+	NANDRAD::readBinary(in, m_interfaces);
+	NANDRAD::readBinary(in, m_interfaceA);
+	NANDRAD::readBinary(in, m_singlePara);
+	NANDRAD::readBinary(in, m_singleIntegerPara);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+	NANDRAD::readBinary(in, m_flags);
+	NANDRAD::readBinary(in, m_someStuffIDAsAttrib);
+	NANDRAD::readBinary(in, m_someStuffIDAsElement);
+	NANDRAD::readBinary(in, m_idReferences);
+	NANDRAD::readBinary(in, m_linSpl);
+	NANDRAD::readBinary(in, m_splineParameter);
+	NANDRAD::readBinary(in, m_anotherSplineParameter);
+	NANDRAD::readBinary(in, m_splinePara);
+	NANDRAD::readBinary(in, m_sched);
+	NANDRAD::readBinary(in, m_sched2);
+	NANDRAD::readBinary(in, m_coordinate2D);
+}
+
+void SerializationTest::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf944d38fu);
+	NANDRAD::writeBinary(out, m_id1);
+	NANDRAD::writeBinary(out, m_id2);
+	NANDRAD::writeBinary(out, m_flag1);
+	NANDRAD::writeBinary(out, m_val1);
+	NANDRAD::writeBinary(out, m_testBla);
+	NANDRAD::writeBinary(out, m_str1);
+	NANDRAD::writeBinary(out, m_path1);
+	NANDRAD::writeBinary(out, m_u1);
+	NANDRAD::writeBinary(out, m_id3);
+	NANDRAD::writeBinary(out, m_id4);
+	NANDRAD::writeBinary(out, m_flag2);
+	NANDRAD::writeBinary(out, m_val2);
+	NANDRAD::writeBinary(out, m_testBlo);
+	NANDRAD::writeBinary(out, m_str2);
+	NANDRAD::writeBinary(out, m_path2);
+	NANDRAD::writeBinary(out, m_path22);
+	NANDRAD::writeBinary(out, m_u2);
+	NANDRAD::writeBinary(out, m_x5);
+	NANDRAD::writeBinary(out, m_f);
+	NANDRAD::writeBinary(out, m_f2);
+	NANDRAD::writeBinary(out, m_time1);
+	NANDRAD::writeBinary(out, m_time2);
+	NANDRAD::writeBinary(out, m_table);
+	NANDRAD::writeBinary(out, m_table2);
+	NANDRAD::writeBinary(out, m_dblVec);
+	NANDRAD::writeBinary(out, m_interfaces);
+	NANDRAD::writeBinary(out, m_interfaceA);
+	NANDRAD::writeBinary(out, m_singlePara);
+	NANDRAD::writeBinary(out, m_singleIntegerPara);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+	NANDRAD::writeBinary(out, m_flags);
+	NANDRAD::writeBinary(out, m_someStuffIDAsAttrib);
+	NANDRAD::writeBinary(out, m_someStuffIDAsElement);
+	NANDRAD::writeBinary(out, m_idReferences);
+	NANDRAD::writeBinary(out, m_linSpl);
+	NANDRAD::writeBinary(out, m_splineParameter);
+	NANDRAD::writeBinary(out, m_anotherSplineParameter);
+	NANDRAD::writeBinary(out, m_splinePara);
+	NANDRAD::writeBinary(out, m_sched);
+	NANDRAD::writeBinary(out, m_sched2);
+	NANDRAD::writeBinary(out, m_coordinate2D);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -112,4 +113,20 @@ TiXmlElement * ShadingControlModel::writeXMLPrivate(TiXmlElement * parent) const
 	return e;
 }
 
+void ShadingControlModel::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa72851f6u, "ShadingControlModel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_sensorId);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void ShadingControlModel::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa72851f6u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_sensorId);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -125,4 +126,22 @@ TiXmlElement * SimulationParameter::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SimulationParameter::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x72ece7b2u, "SimulationParameter");
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+	NANDRAD::readBinary(in, m_flags);
+	NANDRAD::readBinary(in, m_interval);
+	NANDRAD::readBinary(in, m_solarLoadsDistributionModel);
+}
+
+void SimulationParameter::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x72ece7b2u);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+	NANDRAD::writeBinary(out, m_flags);
+	NANDRAD::writeBinary(out, m_interval);
+	NANDRAD::writeBinary(out, m_solarLoadsDistributionModel);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -94,4 +95,16 @@ TiXmlElement * SolarLoadsDistributionModel::writeXMLPrivate(TiXmlElement * paren
 	return e;
 }
 
+void SolarLoadsDistributionModel::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xcd435c4fu, "SolarLoadsDistributionModel");
+	NANDRAD::readBinaryEnum(in, m_distributionType, NUM_SWR);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void SolarLoadsDistributionModel::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xcd435c4fu);
+	NANDRAD::writeBinary(out, m_distributionType);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -154,4 +155,24 @@ TiXmlElement * SolverParameter::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SolverParameter::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x6b6a594fu, "SolverParameter");
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+	NANDRAD::readBinary(in, m_flag);
+	NANDRAD::readBinaryEnum(in, m_integrator, NUM_I);
+	NANDRAD::readBinaryEnum(in, m_lesSolver, NUM_LES);
+	NANDRAD::readBinaryEnum(in, m_preconditioner, NUM_PRE);
+}
+
+void SolverParameter::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x6b6a594fu);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+	NANDRAD::writeBinary(out, m_flag);
+	NANDRAD::writeBinary(out, m_integrator);
+	NANDRAD::writeBinary(out, m_lesSolver);
+	NANDRAD::writeBinary(out, m_preconditioner);
+}
+
 } // namespace NANDRAD
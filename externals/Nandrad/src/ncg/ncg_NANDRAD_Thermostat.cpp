@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -155,4 +156,28 @@ TiXmlElement * Thermostat::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Thermostat::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x3ecb2fdeu, "Thermostat");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_zoneObjectList);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_referenceZoneId);
+	NANDRAD::readBinaryEnum(in, m_temperatureType, NUM_TT);
+	NANDRAD::readBinaryEnum(in, m_controllerType, NUM_CT);
+}
+
+void Thermostat::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x3ecb2fdeu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_zoneObjectList);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_referenceZoneId);
+	NANDRAD::writeBinary(out, m_temperatureType);
+	NANDRAD::writeBinary(out, m_controllerType);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -103,4 +104,18 @@ TiXmlElement * WindowDivider::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowDivider::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf0ef24d0u, "WindowDivider");
+	NANDRAD::readBinary(in, m_materialId);
+	NANDRAD::readBinary(in, m_area);
+	NANDRAD::readBinary(in, m_thickness);
+}
+
+void WindowDivider::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf0ef24d0u);
+	NANDRAD::writeBinary(out, m_materialId);
+	NANDRAD::writeBinary(out, m_area);
+	NANDRAD::writeBinary(out, m_thickness);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
@@ -103,4 +104,18 @@ TiXmlElement * WindowFrame::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowFrame::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf956d800u, "WindowFrame");
+	NANDRAD::readBinary(in, m_materialId);
+	NANDRAD::readBinary(in, m_area);
+	NANDRAD::readBinary(in, m_thickness);
+}
+
+void WindowFrame::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf956d800u);
+	NANDRAD::writeBinary(out, m_materialId);
+	NANDRAD::writeBinary(out, m_area);
+	NANDRAD::writeBinary(out, m_thickness);
+}
+
 } // namespace NANDRAD
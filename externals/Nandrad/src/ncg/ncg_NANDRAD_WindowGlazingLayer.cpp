@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -137,4 +138,22 @@ TiXmlElement * WindowGlazingLayer::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowGlazingLayer::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf74c7a50u, "WindowGlazingLayer");
+	NANDRAD::readBinaryEnum(in, m_type, NUM_T);
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_splinePara);
+}
+
+void WindowGlazingLayer::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf74c7a50u);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_splinePara);
+}
+
 } // namespace NANDRAD
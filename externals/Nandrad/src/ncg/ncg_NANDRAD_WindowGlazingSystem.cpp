@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -161,4 +162,24 @@ TiXmlElement * WindowGlazingSystem::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowGlazingSystem::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x3afd137au, "WindowGlazingSystem");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_splinePara);
+	NANDRAD::readBinary(in, m_layers);
+}
+
+void WindowGlazingSystem::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x3afd137au);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_splinePara);
+	NANDRAD::writeBinary(out, m_layers);
+}
+
 } // namespace NANDRAD
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -124,4 +125,20 @@ TiXmlElement * WindowShading::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowShading::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xd3660f56u, "WindowShading");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_controlModelId);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_precomputedReductionFactor);
+}
+
+void WindowShading::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xd3660f56u);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_controlModelId);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_precomputedReductionFactor);
+}
+
 } // namespace NANDRAD
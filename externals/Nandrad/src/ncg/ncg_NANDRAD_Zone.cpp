@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_BinaryIO.h>
 #include <NANDRAD_KeywordList.h>
 #include <NANDRAD_Utilities.h>
 
@@ -119,4 +120,20 @@ TiXmlElement * Zone::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Zone::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8ba1020eu, "Zone");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_ZT);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void Zone::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8ba1020eu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace NANDRAD
@@ -270,15 +270,24 @@ KeywordListQt::KeywordListQt() {
 	tr("Absolute tolerance for Kinsol solver.");
 	tr("Absolute tolerance (WRMS threshold) for Newton method in hydraulic network.");
 	tr("Scale factor for mass fluxes in solution vector of hydraulic network.");
+	tr("Minimum real time between creation of backup copies of restart data.");
 	tr("Maximum level of fill-in to be used for ILU preconditioner.");
 	tr("Maximum dimension of Krylov subspace.");
 	tr("Maximum number of nonlinear iterations.");
 	tr("Maximum order allowed for multi-step solver.");
 	tr("Maximum nonlinear iterations for Kinsol solver.");
 	tr("Maximum number of elements per layer.");
+	tr("Number of backup copies of restart data that are kept.");
 	tr("Check schedules to determine minimum distances between steps and adjust MaxTimeStep.");
 	tr("Disable line search for steady state cycles.");
 	tr("Enable strict Newton for steady state cycles.");
+	tr("Re-evaluate only models affected by changed states.");
+	tr("Measure setTime() duration of each time-dependent model and write timing table to log directory.");
+	tr("Keep hydraulic network Jacobian across Newton iterations and time steps and refactorize with stored pivot ordering.");
+	tr("Assemble hydraulic network Jacobian from analytic partial derivatives of flow elements.");
+	tr("Compare analytic hydraulic network Jacobian with finite-difference Jacobian and report deviations.");
+	tr("Do not store Jacobian and preconditioner data in FMU states, rebuild them after restoring a state.");
+	tr("Write only changed parts of restart data into the restart file.");
 	tr("CVODE based solver");
 	tr("Explicit Euler solver");
 	tr("Implicit Euler solver");
@@ -0,0 +1,374 @@
+/*	Comparison of the surface pair search in RC::VicusClipper::findParallelSurfaces() with a brute-force search.
+
+	findParallelSurfaces() only tests pairs of surfaces whose (enlarged) bounding boxes overlap, see
+	RC::SurfaceIndex. The brute-force search tests all pairs of surfaces, like the former implementation,
+	with the same criteria: surfaces belong to different rooms, are not yet coupled by a component instance,
+	normals deviate by no more than the maximum angle and the distance is within the maximum distance in at
+	least one direction (the former implementation applied the distance check later in findSurfacesInRange()).
+
+	The distance is measured along the surface normal only, so the brute-force search also returns pairs of
+	surfaces in (nearly) the same plane that are far apart. These pairs are skipped by the spatial index.
+	Clipping such a pair in clipSurfaces() gives no intersection and the surface keeps its id and geometry, so skipping
+	them does not change the clipping result. Hence, the comparison requires:
+	- all pairs found by findParallelSurfaces() are found by the brute-force search, and
+	- for all pairs found by the brute-force search only, the polygons do not overlap when projected onto
+	  each other like in clipSurfaces() (in the direction where they are in range).
+
+	The check is done for generated buildings (rooms in a grid, with random sizes, gaps and rotations) and for
+	the buildings of the given VICUS projects, each with several combinations of maximum distance and angle.
+	Times are reported for both searches.
+
+	Usage: SurfacePairSearchComparison [<project1.vicus> <project2.vicus> ...]
+
+	To check all example projects:
+
+		find data -name "*.vicus" -print0 | xargs -0 SurfacePairSearchComparison
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <set>
+#include <map>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <limits>
+
+#include <IBK_Path.h>
+#include <IBK_Exception.h>
+#include <IBK_StopWatch.h>
+#include <IBK_messages.h>
+#include <IBK_MessageHandler.h>
+#include <IBK_MessageHandlerRegistry.h>
+
+#include <IBKMK_3DCalculations.h>
+
+#include <clipper.hpp>
+
+#include <VICUS_Project.h>
+
+#include <RC_VicusClipping.h>
+#include <RC_Constants.h>
+
+typedef std::map<unsigned int, std::set<unsigned int> > Connections;
+
+
+/*! Notification handler that ignores all progress notifications. */
+class SilentNotification : public RC::Notification {
+public:
+	void notify() override {}
+};
+
+
+/*! Message handler that skips progress messages (the clipper writes one message per surface) and warnings. */
+class QuietMessageHandler : public IBK::MessageHandler {
+public:
+	void msg(const std::string& msg, IBK::msg_type_t t, const char * func_id, int verbose_level) override {
+		if (t != IBK::MSG_PROGRESS && t != IBK::MSG_WARNING)
+			IBK::MessageHandler::msg(msg, t, func_id, verbose_level);
+	}
+};
+
+
+/*! Adds surface with all child surfaces to list of surfaces, except for already coupled surfaces. */
+void collectSurfaces(const VICUS::Surface & s, const std::set<unsigned int> & alreadyCoupledSurfaces,
+					 std::vector<const VICUS::Surface*> & surfaces)
+{
+	if (alreadyCoupledSurfaces.find(s.m_id) == alreadyCoupledSurfaces.end())
+		surfaces.push_back(&s);
+	for (const VICUS::Surface & cs : s.childSurfaces())
+		collectSurfaces(cs, alreadyCoupledSurfaces, surfaces);
+}
+
+
+/*! Returns distance of surface s2 from surface s1, measured along the normal of s1 (see findSurfacesInRange()). */
+double surfaceDistance(const VICUS::Surface & s1, const VICUS::Surface & s2) {
+	double distance;
+	IBKMK::Vector3D rayEndPoint;
+	IBKMK::lineToPointDistance(s1.geometry().offset(), s1.geometry().normal().normalized(),
+							   s2.geometry().offset(), distance, rayEndPoint);
+	return distance;
+}
+
+
+/*! Returns true, if the polygon of s2, projected onto the plane of s1 like in VicusClipper::clipSurfaces(),
+	overlaps the polygon of s1 (intersection area larger than RC::MIN_AREA).
+*/
+bool projectionOverlaps(const VICUS::Surface & s1, const VICUS::Surface & s2, double distance) {
+	const std::vector<IBKMK::Vector2D> & vertexes1 = s1.geometry().polygon2D().vertexes();
+	const std::vector<IBKMK::Vector3D> & vertexes2 = s2.geometry().polygon3D().vertexes();
+	if (vertexes1.empty() || vertexes2.empty())
+		return true;
+
+	ClipperLib::Paths path1(1), path2(1);
+	for (const IBKMK::Vector2D & v : vertexes1)
+		path1[0] << ClipperLib::IntPoint(static_cast<long long>(v.m_x * RC::SCALE_FACTOR),
+										 static_cast<long long>(v.m_y * RC::SCALE_FACTOR));
+	for (const IBKMK::Vector3D & p : vertexes2) {
+		IBKMK::Vector3D pNew = p - distance*s1.geometry().normal();
+		double x, y;
+		if (!IBKMK::planeCoordinates(s1.geometry().offset(), s1.geometry().localX(), s1.geometry().localY(),
+									 pNew, x, y, std::numeric_limits<double>::max()))
+			return true;
+		path2[0] << ClipperLib::IntPoint(static_cast<long long>(x * RC::SCALE_FACTOR),
+										 static_cast<long long>(y * RC::SCALE_FACTOR));
+	}
+
+	ClipperLib::Clipper clipper;
+	clipper.AddPaths(path1, ClipperLib::ptSubject, true);
+	clipper.AddPaths(path2, ClipperLib::ptClip, true);
+	ClipperLib::Paths intersection;
+	clipper.Execute(ClipperLib::ctIntersection, intersection, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+	double area = 0;
+	for (const ClipperLib::Path & path : intersection)
+		area += std::fabs(ClipperLib::Area(path));
+	return area/((double)RC::SCALE_FACTOR*RC::SCALE_FACTOR) > RC::MIN_AREA;
+}
+
+
+/*! Brute-force search of all clipping connections, tests all pairs of surfaces.
+	Parent pointers of the buildings must be up-to-date.
+*/
+void bruteForceConnections(const std::vector<VICUS::Building> & buildings, const std::vector<VICUS::ComponentInstance> & cis,
+						   double normalDeviationInDeg, double maxDistanceOfSurfaces, Connections & connections,
+						   std::map<unsigned int, const VICUS::Surface*> & surfaceMap)
+{
+	std::set<unsigned int> alreadyCoupledSurfaces;
+	for (const VICUS::ComponentInstance & ci : cis) {
+		if (ci.m_idSideASurface != VICUS::INVALID_ID && ci.m_idSideBSurface != VICUS::INVALID_ID) {
+			alreadyCoupledSurfaces.insert(ci.m_idSideASurface);
+			alreadyCoupledSurfaces.insert(ci.m_idSideBSurface);
+		}
+	}
+
+	std::vector<const VICUS::Surface*> surfaces;
+	for (const VICUS::Building & b : buildings)
+		for (const VICUS::BuildingLevel & bl : b.m_buildingLevels)
+			for (const VICUS::Room & r : bl.m_rooms)
+				for (const VICUS::Surface & s : r.m_surfaces)
+					collectSurfaces(s, alreadyCoupledSurfaces, surfaces);
+
+	connections.clear();
+	surfaceMap.clear();
+	for (unsigned int i=0; i<surfaces.size(); ++i) {
+		const VICUS::Surface & s1 = *surfaces[i];
+		surfaceMap[s1.m_id] = &s1;
+		for (unsigned int j=0; j<surfaces.size(); ++j) {
+			const VICUS::Surface & s2 = *surfaces[j];
+			if (i == j || s1.m_parent->m_id == s2.m_parent->m_id)
+				continue; // only surfaces of different rooms are clipped
+
+			double angle = IBKMK::angleBetweenVectorsDeg(-1 * s1.geometry().normal(), s2.geometry().normal());
+			if (angle > normalDeviationInDeg)
+				continue;
+
+			double distance1 = surfaceDistance(s1, s2);
+			double distance2 = surfaceDistance(s2, s1);
+			if ((distance1 > maxDistanceOfSurfaces + RC::EPSILON || distance1 < 0) &&
+				(distance2 > maxDistanceOfSurfaces + RC::EPSILON || distance2 < 0))
+				continue;
+
+			connections[s1.m_id].insert(s2.m_id);
+		}
+	}
+}
+
+
+/*! Creates a box shaped room with outward pointing normals, rotated by angle [Deg] around the z axis. */
+VICUS::Room createRoom(unsigned int & nextId, const IBKMK::Vector3D & origin, double dx, double dy, double dz, double angle) {
+	VICUS::Room r;
+	r.m_id = nextId++;
+	r.m_displayName = QString("Room %1").arg(r.m_id);
+
+	double c = std::cos(angle*IBK::DEG2RAD);
+	double s = std::sin(angle*IBK::DEG2RAD);
+	IBKMK::Vector3D corners[8];
+	for (unsigned int k=0; k<8; ++k) {
+		double x = (k & 1) ? dx : 0;
+		double y = (k & 2) ? dy : 0;
+		double z = (k & 4) ? dz : 0;
+		corners[k] = origin + IBKMK::Vector3D(c*x - s*y, s*x + c*y, z);
+	}
+	IBKMK::Vector3D center = origin + IBKMK::Vector3D(c*dx/2 - s*dy/2, s*dx/2 + c*dy/2, dz/2);
+
+	const unsigned int faces[6][4] = {
+		{0, 1, 3, 2}, {4, 5, 7, 6},	// floor, ceiling
+		{0, 1, 5, 4}, {2, 3, 7, 6},	// walls in x direction
+		{0, 2, 6, 4}, {1, 3, 7, 5}	// walls in y direction
+	};
+	for (const unsigned int (&f)[4] : faces) {
+		std::vector<IBKMK::Vector3D> vertexes;
+		for (unsigned int k : f)
+			vertexes.push_back(corners[k]);
+		IBKMK::Polygon3D poly(vertexes);
+		// flip polygon if normal points into the room
+		if (poly.normal().scalarProduct(poly.centerPoint() - center) < 0) {
+			std::reverse(vertexes.begin(), vertexes.end());
+			poly = IBKMK::Polygon3D(vertexes);
+		}
+		VICUS::Surface surf;
+		surf.m_id = nextId++;
+		surf.m_displayName = QString("Surface %1").arg(surf.m_id);
+		surf.setPolygon3D(poly);
+		r.m_surfaces.push_back(surf);
+	}
+	return r;
+}
+
+
+/*! Creates a building with nx * ny * nz rooms in a grid.
+	Room sizes, gaps between rooms (wall thicknesses) and rotations of the rooms vary randomly.
+*/
+VICUS::Building createBuilding(std::mt19937 & rng, unsigned int nx, unsigned int ny, unsigned int nz, double maxAngle) {
+	std::uniform_real_distribution<double> size(2, 8);
+	std::uniform_real_distribution<double> gap(0, 1);
+	std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+	std::uniform_real_distribution<double> rotation(-maxAngle, maxAngle);
+
+	std::vector<double> x(nx), y(ny), z(nz);
+	for (double & v : x) v = size(rng);
+	for (double & v : y) v = size(rng);
+	for (double & v : z) v = size(rng)/2;
+
+	unsigned int nextId = 1;
+	VICUS::Building b;
+	b.m_id = nextId++;
+	double oz = 0;
+	for (unsigned int k=0; k<nz; ++k) {
+		VICUS::BuildingLevel bl;
+		bl.m_id = nextId++;
+		double ox = 0;
+		for (unsigned int i=0; i<nx; ++i) {
+			double oy = 0;
+			for (unsigned int j=0; j<ny; ++j) {
+				IBKMK::Vector3D origin(ox + jitter(rng), oy + jitter(rng), oz + jitter(rng));
+				bl.m_rooms.push_back(createRoom(nextId, origin, x[i], y[j], z[k], rotation(rng)));
+				oy += y[j] + gap(rng);
+			}
+			ox += x[i] + gap(rng);
+		}
+		b.m_buildingLevels.push_back(bl);
+		oz += z[k] + gap(rng);
+	}
+	return b;
+}
+
+
+/*! Runs both searches, prints results and returns true, if the searches give the same clipping results.
+	Pairs found by the brute-force search only must not overlap when projected onto each other, pairs found
+	by findParallelSurfaces() only must not exist.
+*/
+bool compare(const std::string & name, const std::vector<VICUS::Building> & buildings,
+			 const std::vector<VICUS::ComponentInstance> & cis, double maxDistance, double maxAngle)
+{
+	RC::VicusClipper clipper(buildings, cis, maxAngle, maxDistance, 1000000);
+	SilentNotification notify;
+	IBK::StopWatch w;
+	clipper.findParallelSurfaces(&notify);
+	double tIndex = w.stop();
+	const Connections & indexConnections = clipper.surfaceConnections();
+
+	std::vector<VICUS::Building> bs(buildings);
+	for (VICUS::Building & b : bs)
+		b.updateParents();
+	Connections connections;
+	std::map<unsigned int, const VICUS::Surface*> surfaceMap;
+	w.start();
+	bruteForceConnections(bs, cis, maxAngle, maxDistance, connections, surfaceMap);
+	double tBruteForce = w.stop();
+
+	unsigned int pairs = 0;
+	unsigned int missing = 0;
+	unsigned int failures = 0;
+	for (const Connections::value_type & c : connections) {
+		pairs += c.second.size();
+		Connections::const_iterator it = indexConnections.find(c.first);
+		for (unsigned int id2 : c.second) {
+			if (it != indexConnections.end() && it->second.find(id2) != it->second.end())
+				continue;
+			++missing;
+			// surfaces are clipped onto each other in direction where they are in range, see findSurfacesInRange()
+			const VICUS::Surface & s1 = *surfaceMap[c.first];
+			const VICUS::Surface & s2 = *surfaceMap[id2];
+			double distance = surfaceDistance(s1, s2);
+			if (distance <= maxDistance + RC::EPSILON && distance >= 0 && projectionOverlaps(s1, s2, distance))
+				++failures;
+		}
+	}
+	for (const Connections::value_type & c : indexConnections) {
+		Connections::const_iterator it = connections.find(c.first);
+		for (unsigned int id2 : c.second) {
+			if (it == connections.end() || it->second.find(id2) == it->second.end())
+				++failures;
+		}
+	}
+
+	std::cout << std::left << std::setw(46) << name.substr(0, 45) << std::right
+			  << std::setw(6) << maxDistance << " m" << std::setw(4) << maxAngle << " Deg"
+			  << std::setw(9) << pairs/2 << std::setw(9) << missing/2
+			  << std::setw(10) << std::fixed << std::setprecision(1) << tIndex << " ms"
+			  << std::setw(10) << tBruteForce << " ms" << std::setprecision(6) << std::defaultfloat
+			  << (failures == 0 ? "" : "   DIFFERENT") << std::endl;
+	return failures == 0;
+}
+
+
+int main(int argc, char * argv[]) {
+	QuietMessageHandler msgHandler;
+	IBK::MessageHandlerRegistry::instance().setMessageHandler(&msgHandler);
+
+	const double parameters[][2] = { {0.5, 5}, {0.1, 1}, {2, 15}, {0, 0} }; // max distance [m], max angle [Deg]
+
+	std::cout << std::left << std::setw(46) << "Building" << std::right << std::setw(8) << "dist"
+			  << std::setw(8) << "angle" << std::setw(9) << "pairs" << std::setw(9) << "skipped"
+			  << std::setw(13) << "index" << std::setw(13) << "brute-force" << std::endl;
+
+	unsigned int differences = 0;
+	try {
+		// *** generated buildings ***
+
+		std::mt19937 rng(42);
+		const unsigned int sizes[][3] = { {2, 2, 1}, {3, 4, 2}, {5, 5, 3}, {10, 10, 4}, {20, 20, 5} };
+		for (const unsigned int (&n)[3] : sizes) {
+			for (double maxRotation : { 0.0, 3.0 }) {
+				std::vector<VICUS::Building> buildings(1, createBuilding(rng, n[0], n[1], n[2], maxRotation));
+				std::string name = IBK::FormatString("Generated %1x%2x%3 rooms, rotation %4 Deg")
+						.arg(n[0]).arg(n[1]).arg(n[2]).arg(maxRotation).str();
+				for (const double (&p)[2] : parameters) {
+					if (!compare(name, buildings, std::vector<VICUS::ComponentInstance>(), p[0], p[1]))
+						++differences;
+				}
+			}
+		}
+
+		// *** buildings of projects ***
+
+		for (int i=1; i<argc; ++i) {
+			IBK::Path projectFile(argv[i]);
+			VICUS::Project prj;
+			try {
+				prj.readXML(projectFile);
+			}
+			catch (IBK::Exception & ex) {
+				ex.writeMsgStackToError();
+				std::cout << projectFile.filename().str() << ": cannot read project, skipped" << std::endl;
+				continue;
+			}
+			if (prj.m_buildings.empty())
+				continue;
+			for (const double (&p)[2] : parameters) {
+				if (!compare(projectFile.filename().str(), prj.m_buildings, prj.m_componentInstances, p[0], p[1]))
+					++differences;
+			}
+		}
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		return EXIT_FAILURE;
+	}
+
+	std::cout << differences << " differences" << std::endl;
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -34,12 +34,14 @@ DEPENDPATH = $${INCLUDEPATH}
 
 SOURCES += \
 ../../src/RC_Constants.cpp \
+	../../src/RC_SurfaceIndex.cpp \
 	../../src/RC_VicusClipping.cpp
 
 HEADERS += \
 ../../src/RC_ClippingPolygon.h \
 	../../src/RC_ClippingSurface.h \
 	../../src/RC_Constants.h \
+	../../src/RC_SurfaceIndex.h \
 	../../src/RC_VicusClipping.h
 
 
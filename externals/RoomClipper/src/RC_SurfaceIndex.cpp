@@ -0,0 +1,169 @@
+/*	The RoomClipper data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Stephan Hirth     <stephan.hirth -[at]- tu-dresden.de>
+	  Dirk Weiß         <dirk.weis     -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "RC_SurfaceIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+#include <IBK_openMP.h>
+
+namespace RC {
+
+/*! Boxes covering more grid cells than this are not sorted into the grid, but tested against all other boxes. */
+const unsigned int MAX_CELLS_PER_BOX = 512;
+
+/*! Maximum number of grid cells per direction, so that cell coordinates fit into 21 bits of the hash key. */
+const double MAX_CELLS_PER_DIRECTION = 1 << 20;
+
+
+void SurfaceIndex::build(const std::vector<Box> & boxes) {
+	m_boxes = boxes;
+	m_cells.clear();
+	m_largeBoxes.clear();
+	if (boxes.empty())
+		return;
+
+	// bounding box of all boxes, needed to get non-negative cell coordinates
+	Box all = boxes[0];
+	std::vector<double> extents(boxes.size());
+	for (unsigned int i=0; i<boxes.size(); ++i) {
+		const Box & b = boxes[i];
+		all.m_min = IBKMK::Vector3D(std::min(all.m_min.m_x, b.m_min.m_x), std::min(all.m_min.m_y, b.m_min.m_y), std::min(all.m_min.m_z, b.m_min.m_z));
+		all.m_max = IBKMK::Vector3D(std::max(all.m_max.m_x, b.m_max.m_x), std::max(all.m_max.m_y, b.m_max.m_y), std::max(all.m_max.m_z, b.m_max.m_z));
+		extents[i] = std::max(b.m_max.m_x - b.m_min.m_x, std::max(b.m_max.m_y - b.m_min.m_y, b.m_max.m_z - b.m_min.m_z));
+	}
+	m_all = all;
+
+	// cell size is the median box extent, so that a typical box covers only a few cells
+	std::nth_element(extents.begin(), extents.begin() + extents.size()/2, extents.end());
+	m_cellSize = extents[extents.size()/2];
+	double allExtent = std::max(all.m_max.m_x - all.m_min.m_x, std::max(all.m_max.m_y - all.m_min.m_y, all.m_max.m_z - all.m_min.m_z));
+	m_cellSize = std::max(m_cellSize, allExtent/MAX_CELLS_PER_DIRECTION);
+	if (m_cellSize <= 0)
+		m_cellSize = 1; // all boxes are points at the same location
+
+	// sort boxes into cells; cells are stored in a vector for parallel processing, the hash map
+	// gives the vector index of each cell
+	std::unordered_map<uint64_t, unsigned int> cellIndexes;
+	for (unsigned int i=0; i<m_boxes.size(); ++i) {
+		Cell first, last;
+		cellRange(m_boxes[i], first, last);
+		double cellCount = 1;
+		for (unsigned int k=0; k<3; ++k)
+			cellCount *= last.m_i[k] - first.m_i[k] + 1;
+		if (cellCount > MAX_CELLS_PER_BOX) {
+			m_largeBoxes.push_back(i);
+			continue;
+		}
+		Cell c;
+		for (c.m_i[0] = first.m_i[0]; c.m_i[0] <= last.m_i[0]; ++c.m_i[0])
+			for (c.m_i[1] = first.m_i[1]; c.m_i[1] <= last.m_i[1]; ++c.m_i[1])
+				for (c.m_i[2] = first.m_i[2]; c.m_i[2] <= last.m_i[2]; ++c.m_i[2]) {
+					uint64_t key = (uint64_t)c.m_i[0] | ((uint64_t)c.m_i[1] << 21) | ((uint64_t)c.m_i[2] << 42);
+					std::unordered_map<uint64_t, unsigned int>::iterator it = cellIndexes.find(key);
+					if (it == cellIndexes.end()) {
+						it = cellIndexes.insert(std::make_pair(key, (unsigned int)m_cells.size())).first;
+						m_cells.push_back(CellContent());
+						m_cells.back().m_cell = c;
+					}
+					m_cells[it->second].m_boxIndexes.push_back(i);
+				}
+	}
+}
+
+
+void SurfaceIndex::overlappingPairs(std::vector<std::pair<unsigned int, unsigned int> > & pairs) const {
+	pairs.clear();
+
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+	{
+		std::vector<std::pair<unsigned int, unsigned int> > localPairs;
+
+		// pairs of boxes in the same cell
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, 16)
+#endif
+		for (int c=0; c<(int)m_cells.size(); ++c) {
+			const CellContent & cell = m_cells[(unsigned int)c];
+			for (unsigned int a=0; a<cell.m_boxIndexes.size(); ++a) {
+				unsigned int i = cell.m_boxIndexes[a];
+				Cell firstI, lastI;
+				cellRange(m_boxes[i], firstI, lastI);
+				for (unsigned int b=a+1; b<cell.m_boxIndexes.size(); ++b) {
+					unsigned int j = cell.m_boxIndexes[b];
+					if (!m_boxes[i].overlaps(m_boxes[j]))
+						continue;
+					// two overlapping boxes share several cells, report pair only for the first common cell
+					Cell firstJ, lastJ;
+					cellRange(m_boxes[j], firstJ, lastJ);
+					bool firstCommonCell = true;
+					for (unsigned int k=0; k<3; ++k)
+						if (std::max(firstI.m_i[k], firstJ.m_i[k]) != cell.m_cell.m_i[k])
+							firstCommonCell = false;
+					if (firstCommonCell)
+						localPairs.push_back(std::make_pair(i, j)); // i < j, since boxes are inserted in ascending order
+				}
+			}
+		}
+
+		// pairs with large boxes
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, 1)
+#endif
+		for (int l=0; l<(int)m_largeBoxes.size(); ++l) {
+			unsigned int i = m_largeBoxes[(unsigned int)l];
+			for (unsigned int j=0; j<m_boxes.size(); ++j) {
+				if (j == i)
+					continue;
+				// pairs of two large boxes are only reported by the large box with the lower index
+				if (j < i && std::binary_search(m_largeBoxes.begin(), m_largeBoxes.end(), j))
+					continue;
+				if (m_boxes[i].overlaps(m_boxes[j]))
+					localPairs.push_back(std::make_pair(std::min(i, j), std::max(i, j)));
+			}
+		}
+
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+		pairs.insert(pairs.end(), localPairs.begin(), localPairs.end());
+	}
+
+	// sort pairs so that the result does not depend on thread scheduling
+	std::sort(pairs.begin(), pairs.end());
+}
+
+
+void SurfaceIndex::cellRange(const Box & b, Cell & first, Cell & last) const {
+	const double minCoords[3] = {b.m_min.m_x - m_all.m_min.m_x, b.m_min.m_y - m_all.m_min.m_y, b.m_min.m_z - m_all.m_min.m_z};
+	const double maxCoords[3] = {b.m_max.m_x - m_all.m_min.m_x, b.m_max.m_y - m_all.m_min.m_y, b.m_max.m_z - m_all.m_min.m_z};
+	for (unsigned int k=0; k<3; ++k) {
+		first.m_i[k] = (int)std::floor(minCoords[k]/m_cellSize);
+		last.m_i[k] = (int)std::floor(maxCoords[k]/m_cellSize);
+	}
+}
+
+} // namespace RC
@@ -0,0 +1,94 @@
+/*	The RoomClipper data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Stephan Hirth     <stephan.hirth -[at]- tu-dresden.de>
+	  Dirk Weiß         <dirk.weis     -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef RC_SurfaceIndexH
+#define RC_SurfaceIndexH
+
+#include <vector>
+#include <utility>
+
+#include <IBKMK_Vector3D.h>
+
+namespace RC {
+
+/*! Spatial index over axis-aligned bounding boxes of surfaces.
+	Boxes are sorted into the cells of a uniform grid (stored in a hash map, so only occupied cells need memory).
+	Only boxes sharing a grid cell are tested for overlap, so that all overlapping pairs are found in
+	near-linear time instead of testing all n*n pairs.
+*/
+class SurfaceIndex {
+public:
+	/*! Axis-aligned bounding box. */
+	struct Box {
+		Box() {}
+		Box(const IBKMK::Vector3D & minPoint, const IBKMK::Vector3D & maxPoint) :
+			m_min(minPoint), m_max(maxPoint)
+		{}
+
+		/*! Returns true, if this box overlaps the other box (touching counts as overlapping). */
+		bool overlaps(const Box & other) const {
+			return m_min.m_x <= other.m_max.m_x && other.m_min.m_x <= m_max.m_x &&
+					m_min.m_y <= other.m_max.m_y && other.m_min.m_y <= m_max.m_y &&
+					m_min.m_z <= other.m_max.m_z && other.m_min.m_z <= m_max.m_z;
+		}
+
+		IBKMK::Vector3D		m_min;	///< Lower corner
+		IBKMK::Vector3D		m_max;	///< Upper corner
+	};
+
+	/*! Builds the index for the given boxes. */
+	void build(const std::vector<Box> & boxes);
+
+	/*! Returns indexes (i < j) of all pairs of overlapping boxes, sorted in ascending order.
+		Cells are processed in parallel, if compiled with OpenMP.
+	*/
+	void overlappingPairs(std::vector<std::pair<unsigned int, unsigned int> > & pairs) const;
+
+private:
+	/*! Integer coordinates of a grid cell. */
+	struct Cell {
+		int				m_i[3];
+	};
+
+	/*! A grid cell with all boxes reaching into it. */
+	struct CellContent {
+		Cell						m_cell;
+		std::vector<unsigned int>	m_boxIndexes;
+	};
+
+	/*! Computes range of grid cells covered by box. */
+	void cellRange(const Box & b, Cell & first, Cell & last) const;
+
+	/*! All boxes, as passed to build(). */
+	std::vector<Box>				m_boxes;
+	/*! Bounding box of all boxes, lower corner is origin of grid. */
+	Box								m_all;
+	/*! Edge length of grid cells in [m]. */
+	double							m_cellSize = 1;
+	/*! All occupied grid cells. */
+	std::vector<CellContent>		m_cells;
+	/*! Indexes of boxes that cover too many cells, these are tested against all other boxes. */
+	std::vector<unsigned int>		m_largeBoxes;
+};
+
+} // namespace RC
+
+#endif // RC_SurfaceIndexH
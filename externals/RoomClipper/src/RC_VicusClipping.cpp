@@ -28,6 +28,7 @@
 #include "RC_VicusClipping.h"
 #include "RC_ClippingSurface.h"
 #include "RC_Constants.h"
+#include "RC_SurfaceIndex.h"
 
 
 namespace RC {
@@ -95,68 +96,145 @@ void VicusClipper::findParallelSurfaces(Notification *notify) {
 	}
 
 	std::set<unsigned int> alreadyCoupledSurfaces;
+	std::map<unsigned int, unsigned int> compInstIds;
 	for (const VICUS::ComponentInstance &ci : m_vicusCompInstances) {
 		if (ci.m_idSideASurface != VICUS::INVALID_ID && ci.m_idSideBSurface != VICUS::INVALID_ID) {
 			alreadyCoupledSurfaces.insert(ci.m_idSideASurface);
 			alreadyCoupledSurfaces.insert(ci.m_idSideBSurface);
 		}
+		// side B assignment wins over side A, same as for the last matching component instance
+		if (ci.m_idSideASurface != VICUS::INVALID_ID)
+			compInstIds[ci.m_idSideASurface] = ci.m_idComponent;
+		if (ci.m_idSideBSurface != VICUS::INVALID_ID)
+			compInstIds[ci.m_idSideBSurface] = ci.m_idComponent;
 	}
 
-	unsigned int Count = surfaces.size() * surfaces.size();
-	unsigned int currentCount = 0;
+	// collect all surfaces that are not yet coupled, together with their geometry data
+	// (geometry is computed here and not within the parallel section below)
+	std::vector<const VICUS::Surface*> candidates;
+	std::vector<IBKMK::Vector3D> offsets, normals;
+	std::vector<unsigned int> parentIds;
+	std::vector<SurfaceIndex::Box> boxes;
+	std::vector<unsigned int> unboundedSurfaces; // surfaces without polygon, tested against all other surfaces
+	for (const VICUS::Surface *s : surfaces) {
+		std::map<unsigned int, unsigned int>::const_iterator ciIt = compInstIds.find(s->m_id);
+		if (ciIt != compInstIds.end())
+			m_compInstOriginSurfId[s->m_id] = ciIt->second;
+
+		// Skip already coupled surfaces
+		if (alreadyCoupledSurfaces.find(s->m_id) != alreadyCoupledSurfaces.end())
+			continue;
+
+		const std::vector<IBKMK::Vector3D> & vertexes = s->geometry().polygon3D().vertexes();
+		if (vertexes.empty())
+			unboundedSurfaces.push_back(candidates.size());
 
-	for (const VICUS::Surface *s1 : surfaces){
+		candidates.push_back(s);
+		offsets.push_back(s->geometry().offset());
+		normals.push_back(s->geometry().normal());
+		parentIds.push_back(s->m_parent->m_id);
 
-		for (const VICUS::ComponentInstance &ci : m_vicusCompInstances) {
-			if (ci.m_idSideASurface == s1->m_id)
-				m_compInstOriginSurfId[s1->m_id] = ci.m_idComponent;
-			if (ci.m_idSideBSurface == s1->m_id)
-				m_compInstOriginSurfId[s1->m_id] = ci.m_idComponent;
+		SurfaceIndex::Box b;
+		if (!vertexes.empty()) {
+			b.m_min = b.m_max = vertexes[0];
+			for (const IBKMK::Vector3D &v : vertexes)
+				IBKMK::enlargeBoundingBox(v, b.m_min, b.m_max);
+		}
+		else {
+			b.m_min = b.m_max = offsets.back();
 		}
+		boxes.push_back(b);
+	}
+
+	// Surfaces can only be clipped if their polygons come closer than the maximum distance. Since normals may deviate
+	// by the given angle, the distance measured at the offset points may be smaller than the distance at the farthest
+	// vertexes. Hence, we enlarge the bounding boxes such that boxes of any two surfaces in range overlap.
+	double sinTol = std::sin(std::min(m_normalDeviationInDeg, 90.0)*IBK::DEG2RAD);
+	for (SurfaceIndex::Box &b : boxes) {
+		double margin = 0.5*(m_maxDistanceOfSurfaces + EPSILON + (b.m_max - b.m_min).magnitude()*sinTol);
+		IBKMK::Vector3D m(margin, margin, margin);
+		b.m_min -= m;
+		b.m_max += m;
+	}
 
+	SurfaceIndex surfaceIndex;
+	surfaceIndex.build(boxes);
+	std::vector<std::pair<unsigned int, unsigned int> > pairs;
+	surfaceIndex.overlappingPairs(pairs);
 
-		// Skip already coupled surfaces
-		if (alreadyCoupledSurfaces.find(s1->m_id) != alreadyCoupledSurfaces.end())
+	// pairs with surfaces without polygon cannot be sorted out by bounding box
+	for (unsigned int i : unboundedSurfaces) {
+		for (unsigned int j=0; j<candidates.size(); ++j) {
+			if (i != j)
+				pairs.push_back(std::make_pair(std::min(i, j), std::max(i, j)));
+		}
+	}
+	if (!unboundedSurfaces.empty()) {
+		std::sort(pairs.begin(), pairs.end());
+		pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+	}
+
+	notify->notify(0.1);
+	if (notify->m_aborted)
+		throw IBK::Exception("Clipping canceled.", FUNC_ID);
+
+	// check all candidate pairs, with the same criteria as in findSurfacesInRange()
+	std::vector<char> parallel(pairs.size(), 0);
+	int pairCount = (int)pairs.size();
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+	for (int k=0; k<pairCount; ++k) {
+		unsigned int i = pairs[k].first;
+		unsigned int j = pairs[k].second;
+
+		if (parentIds[i] == parentIds[j])
+			continue; // only surfaces of different rooms are clipped
+
+		// calculation of normal deviation
+		double angle = IBKMK::angleBetweenVectorsDeg(-1 * normals[i], normals[j]);
+
+		// check if deviation is inside limits
+		if (angle > m_normalDeviationInDeg)
 			continue;
 
-		for (const VICUS::Surface *s2 : surfaces){
+		// check if distance is inside limits for at least one direction
+		double distance1, distance2;
+		IBKMK::Vector3D rayEndPoint;
+		IBKMK::lineToPointDistance(offsets[i], normals[i].normalized(), offsets[j], distance1, rayEndPoint);
+		IBKMK::lineToPointDistance(offsets[j], normals[j].normalized(), offsets[i], distance2, rayEndPoint);
+		if ((distance1 > m_maxDistanceOfSurfaces + EPSILON || distance1 < 0) &&
+			(distance2 > m_maxDistanceOfSurfaces + EPSILON || distance2 < 0))
+			continue;
 
-			++currentCount;
-			// only notify every second or so
-			if (!notify->m_aborted && m_stopWatch.difference() > STOPWATCH_INTERVAL) {
-				notify->notify(0.25 * double(currentCount+1) / Count);
-				m_stopWatch.start();
-			}
+		parallel[k] = 1;
+	}
 
-			if (notify->m_aborted)
-				throw IBK::Exception("Clipping canceled.", FUNC_ID);
+	// store parallel surfaces; pairs are sorted by first surface
+	unsigned int k = 0;
+	for (unsigned int i=0; i<candidates.size(); ++i) {
 
-			// Skip already coupled surfaces
-			if (alreadyCoupledSurfaces.find(s2->m_id) != alreadyCoupledSurfaces.end())
-				continue;
+		// only notify every second or so
+		if (!notify->m_aborted && m_stopWatch.difference() > STOPWATCH_INTERVAL) {
+			notify->notify(0.1 + 0.15 * double(i+1) / candidates.size());
+			m_stopWatch.start();
+		}
 
-			// skip same surfaces
-			if (s1 == s2)
-				continue;
+		if (notify->m_aborted)
+			throw IBK::Exception("Clipping canceled.", FUNC_ID);
 
-			const VICUS::Surface &surf1 = *s1;
-			const VICUS::Surface &surf2 = *s2;
+		for (; k<pairs.size() && pairs[k].first == i; ++k) {
+			if (!parallel[k])
+				continue;
 
-			if (surf1.m_parent->m_id == surf2.m_parent->m_id)
-				continue; // only surfaces of different rooms are clipped
+			const VICUS::Surface &surf1 = *candidates[i];
+			const VICUS::Surface &surf2 = *candidates[pairs[k].second];
 
 			// skip already handled surfaces
 			if (m_surfaceConnections.find(surf1.m_id) != m_surfaceConnections.end())
 				if (m_surfaceConnections[surf1.m_id].find(surf2.m_id) != m_surfaceConnections[surf1.m_id].end())
 					continue;
 
-			// calculation of normal deviation
-			double angle = IBKMK::angleBetweenVectorsDeg(-1 * surf1.geometry().normal(), surf2.geometry().normal());
-
-			// check if deviation is inside limits
-			if (angle > m_normalDeviationInDeg)
-				continue;
-
 			// save parallel surfaces
 			ClippingSurface &cs = findClippingSurface(surf1.m_id, m_vicusBuildings);
 			cs.m_clippingObjects.push_back(ClippingObject(surf2.m_id, surf2, 999) );
@@ -165,17 +243,13 @@ void VicusClipper::findParallelSurfaces(Notification *notify) {
 			ClippingSurface &cs2 = findClippingSurface(surf2.m_id, m_vicusBuildings);
 			cs2.m_clippingObjects.push_back(ClippingObject(surf1.m_id, surf1, 999) );
 
-			// qDebug() << s1->m_id << ": " << s1->m_displayName << " | " << s2->m_id << ": "<< s2->m_displayName ;
-
 			m_surfaceConnections[surf1.m_id].insert(surf2.m_id);
 			m_surfaceConnections[surf2.m_id].insert(surf1.m_id);
-
-
 		}
 
 		IBK::IBK_Message(IBK::FormatString("Found connections for '%1 | %2'")
-						 .arg(s1->m_parent->m_displayName.toStdString())
-						 .arg(s1->m_displayName.toStdString()), IBK::MSG_PROGRESS);
+						 .arg(candidates[i]->m_parent->m_displayName.toStdString())
+						 .arg(candidates[i]->m_displayName.toStdString()), IBK::MSG_PROGRESS);
 	}
 }
 
@@ -275,6 +349,10 @@ const std::vector<VICUS::ComponentInstance>* VicusClipper::vicusCompInstances()
 	return &m_vicusCompInstances;
 }
 
+const std::map<unsigned int, std::set<unsigned int>> &VicusClipper::surfaceConnections() const {
+	return m_surfaceConnections;
+}
+
 const std::vector<VICUS::Building> VicusClipper::vicusBuildings() const {
 	return m_vicusBuildings;
 }
@@ -312,6 +390,9 @@ void VicusClipper::clipSurfaces(Notification * notify) {
 
 		++currentConnectionCount;
 
+		// surfaces of rooms are replaced below, so surface pointers stored in map may be invalid
+		m_vicusSurfaceMap.clear();
+
 		// look for clipping surface
 		ClippingSurface &cs = findClippingSurface(it->first, m_vicusBuildings);
 
@@ -1027,52 +1108,42 @@ void VicusClipper::createComponentInstances(Notification *notify, bool createCon
 
 
 ClippingSurface & VicusClipper::findClippingSurface(unsigned int id, const std::vector<VICUS::Building> &buildings) {
-	unsigned int idx = 0 ;
-	bool found = false;
-	for (;idx<m_clippingSurfaces.size(); ++idx) {
-		if (id == m_clippingSurfaces[idx].m_vicusId) {
-			found = true;
-			break;
-		}
-	}
-	if (!found) {
+	std::unordered_map<unsigned int, unsigned int>::const_iterator it = m_clippingSurfaceIndexes.find(id);
+	if (it == m_clippingSurfaceIndexes.end()) {
 		const VICUS::Surface &s = findVicusSurface(id, buildings);
+		m_clippingSurfaceIndexes[id] = m_clippingSurfaces.size();
 		m_clippingSurfaces.push_back(ClippingSurface(id, s));
 		return m_clippingSurfaces.back();
 	}
 
-	return m_clippingSurfaces[idx];
+	return m_clippingSurfaces[it->second];
 }
 
 
-void findChildSurfaces(unsigned int id, const VICUS::Surface &s, const VICUS::Surface* &surf) {
+void insertChildSurfaces(std::unordered_map<unsigned int, const VICUS::Surface*> &surfaceMap, const VICUS::Surface &s) {
 	for (const VICUS::Surface &cs : s.childSurfaces()) {
-		if (id == cs.m_id) {
-			surf = &cs;
-			break;
-		}
-		findChildSurfaces(id, cs, surf);
+		surfaceMap.insert(std::make_pair(cs.m_id, &cs));
+		insertChildSurfaces(surfaceMap, cs);
 	}
 }
 
 
 const VICUS::Surface &VicusClipper::findVicusSurface(unsigned int id, const std::vector<VICUS::Building> &buildings) {
-	const VICUS::Surface *surf = nullptr;
-	for (const VICUS::Building & b : buildings) {
-		for (const VICUS::BuildingLevel & bl : b.m_buildingLevels) {
-			for (const VICUS::Room & r : bl.m_rooms) {
-				for (const VICUS::Surface & s : r.m_surfaces) {
-					if (s.m_id == id) {
-						surf = &s;
-						break;
+	if (m_vicusSurfaceMap.empty()) {
+		for (const VICUS::Building & b : buildings) {
+			for (const VICUS::BuildingLevel & bl : b.m_buildingLevels) {
+				for (const VICUS::Room & r : bl.m_rooms) {
+					for (const VICUS::Surface & s : r.m_surfaces) {
+						m_vicusSurfaceMap.insert(std::make_pair(s.m_id, &s));
+						insertChildSurfaces(m_vicusSurfaceMap, s);
 					}
-					findChildSurfaces(id, s, surf);
 				}
 			}
 		}
 	}
-	Q_ASSERT(surf != nullptr);
-	return *surf;
+	std::unordered_map<unsigned int, const VICUS::Surface*>::const_iterator it = m_vicusSurfaceMap.find(id);
+	Q_ASSERT(it != m_vicusSurfaceMap.end());
+	return *it->second;
 }
 
 
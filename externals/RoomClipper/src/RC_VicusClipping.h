@@ -22,6 +22,8 @@
 #ifndef RCProjectH
 #define RCProjectH
 
+#include <unordered_map>
+
 #include <VICUS_Project.h>
 
 #include <clipper.hpp>
@@ -108,10 +110,16 @@ public:
 	/*! Returns all clipped vicus buildings. */
 	const std::vector<VICUS::SubSurfaceComponentInstance> *vicusSubSurfCompInstances() const;
 
+	/*! Returns all clipping connections found by findParallelSurfaces(). */
+	const std::map<unsigned int, std::set<unsigned int>> &surfaceConnections() const;
+
 private:
 	/*! Returns the containing Clipping Surface with VICUS Surface from m_clippingSurfaces. */
 	ClippingSurface & findClippingSurface(unsigned int id, const std::vector<VICUS::Building> &buildings);
 
+	/*! Returns the VICUS surface with given id.
+		Uses m_vicusSurfaceMap, which is created on first call for the given buildings.
+	*/
 	const VICUS::Surface &findVicusSurface(unsigned int id, const std::vector<VICUS::Building> &buildings);
 
 	/*! Performs the Clipping of the surfaces 'surf' and 'otherSurf' and returns intersection and difference polygons. */
@@ -159,6 +167,14 @@ private:
 	/*! holds all parallel surfaces by id; second element in pair is the distance in m. */
 	std::vector<ClippingSurface>					m_clippingSurfaces;
 
+	/*! Maps vicus surface id to index of clipping surface in m_clippingSurfaces. */
+	std::unordered_map<unsigned int, unsigned int>	m_clippingSurfaceIndexes;
+
+	/*! Maps vicus surface id to surface (including child surfaces) in the buildings passed to findVicusSurface().
+		Must be cleared whenever the surface vectors of these buildings are modified.
+	*/
+	std::unordered_map<unsigned int, const VICUS::Surface*>	m_vicusSurfaceMap;
+
 	/*! Take only selected polygons. */
 	bool											m_onlySelected = false;
 
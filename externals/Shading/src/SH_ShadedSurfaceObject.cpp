@@ -81,37 +81,74 @@ void ShadedSurfaceObject::setPolygon(unsigned int id, std::string name, const IB
 }
 
 
-double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles) const {
+double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles,
+															const IBKMK::BoundingVolumeHierarchy & obstacleTree, const std::vector<bool> & visibleObstacles) const
+{
+	IBK_ASSERT(obstacleTree.size() == obstacles.size());
+	IBK_ASSERT(visibleObstacles.size() == obstacles.size());
+
+	// number of neighboring grid points processed together in one tree traversal
+	const unsigned int PACKET_SIZE = 64;
+
 	unsigned int counterShadedPoints=0;
 
-	unsigned int sizeMiddlePoints = m_gridPoints.size();
-	// process all grid points
-	for (size_t i=0; i<sizeMiddlePoints; ++i) {
+	std::vector<unsigned int> treeCandidates;
+	std::vector<unsigned int> candidates;
 
-		// process all obstacles
-		for (size_t j=0; j<obstacles.size(); ++j) {
+	unsigned int sizeMiddlePoints = m_gridPoints.size();
+	// process all grid points in packets; grid points are generated column by column, so consecutive
+	// grid points are also close to each other
+	for (size_t packetStart=0; packetStart<sizeMiddlePoints; packetStart += PACKET_SIZE) {
+		size_t packetEnd = std::min<size_t>(packetStart + PACKET_SIZE, sizeMiddlePoints);
+
+		// bounding box of grid points in packet
+		IBKMK::Vector3D pMin = m_gridPoints[packetStart];
+		IBKMK::Vector3D pMax = m_gridPoints[packetStart];
+		for (size_t i=packetStart+1; i<packetEnd; ++i) {
+			const IBKMK::Vector3D & p = m_gridPoints[i];
+			pMin = IBKMK::Vector3D(std::min(pMin.m_x, p.m_x), std::min(pMin.m_y, p.m_y), std::min(pMin.m_z, p.m_z));
+			pMax = IBKMK::Vector3D(std::max(pMax.m_x, p.m_x), std::max(pMax.m_y, p.m_y), std::max(pMax.m_z, p.m_z));
+		}
 
-			if (m_id == obstacles[j].m_idVicus)
+		// collect obstacles whose bounding box may be hit by any of the sun beams in the packet
+		obstacleTree.collectCandidates(pMin, pMax, sunNormal, treeCandidates);
+		candidates.clear();
+		for (unsigned int j : treeCandidates) {
+			if (!visibleObstacles[j] || m_id == obstacles[j].m_idVicus)
 				continue;
+			candidates.push_back(j);
+		}
+		if (candidates.empty())
+			continue;
 
-			// compute intersection point of sun beam onto obstacle's plane
-			const IBKMK::Vector3D & offset = obstacles[j].m_polygon.vertexes()[0];
-			IBKMK::Vector3D intersectionPoint;
-			double dist;
-			if (!IBKMK::linePlaneIntersectionWithNormalCheck(offset, obstacles[j].m_polygon.normal(), // plane
-											  m_gridPoints[i], sunNormal, // line
-											  intersectionPoint, dist, !obstacles[j].m_isObstacle))
-				continue; // no intersection, next obstacle plane
-
-			// compute local coordinates of intersection point with obstacle
-			double x,y;
-			if (!IBKMK::planeCoordinates(offset, obstacles[j].m_polygon.localX(), obstacles[j].m_polygon.localY(), intersectionPoint, x, y))
-				continue; // projection not possible - this shouldn't happen, really!
-
-			// now test if x,y coordinates are inside obstacle's polyline
-			if (IBKMK::pointInPolygon(obstacles[j].m_polygon.polyline().vertexes(), IBK::point2D<double>(x,y)) >= 0) {
-				++counterShadedPoints;
-				break; // we are shaded, stop searching
+		for (size_t i=packetStart; i<packetEnd; ++i) {
+
+			// process all candidate obstacles
+			for (unsigned int j : candidates) {
+
+				// quick check against bounding box of obstacle
+				if (!obstacleTree.lineHitsBox(j, m_gridPoints[i], sunNormal))
+					continue;
+
+				// compute intersection point of sun beam onto obstacle's plane
+				const IBKMK::Vector3D & offset = obstacles[j].m_polygon.vertexes()[0];
+				IBKMK::Vector3D intersectionPoint;
+				double dist;
+				if (!IBKMK::linePlaneIntersectionWithNormalCheck(offset, obstacles[j].m_polygon.normal(), // plane
+												  m_gridPoints[i], sunNormal, // line
+												  intersectionPoint, dist, !obstacles[j].m_isObstacle))
+					continue; // no intersection, next obstacle plane
+
+				// compute local coordinates of intersection point with obstacle
+				double x,y;
+				if (!IBKMK::planeCoordinates(offset, obstacles[j].m_polygon.localX(), obstacles[j].m_polygon.localY(), intersectionPoint, x, y))
+					continue; // projection not possible - this shouldn't happen, really!
+
+				// now test if x,y coordinates are inside obstacle's polyline
+				if (IBKMK::pointInPolygon(obstacles[j].m_polygon.polyline().vertexes(), IBK::point2D<double>(x,y)) >= 0) {
+					++counterShadedPoints;
+					break; // we are shaded, stop searching
+				}
 			}
 		}
 	}
@@ -2,6 +2,7 @@
 #define SH_ShadedSurfaceObjectH
 
 #include <IBKMK_Polygon3D.h>
+#include <IBKMK_BoundingVolumeHierarchy.h>
 
 #include <IBK_NotificationHandler.h>
 
@@ -20,8 +21,16 @@ public:
 	void setPolygon(unsigned int id, std::string name, const IBKMK::Polygon3D & surface, const std::vector<IBKMK::Polygon2D> &holes,
 					unsigned int idParent = INVALID_ID, double gridWidth = 0.1, bool useClipping = false);
 
-	/*! Computes and returns shading factor for the given sun normal vector. */
-	double calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles) const;
+	/*! Computes and returns shading factor for the given sun normal vector.
+		Grid points are processed in packets of neighboring points. For each packet the obstacle tree is
+		traversed once to collect candidate obstacles, only these are tested against the sun beams of the packet.
+		\param sunNormal Sun normal vector (pointing to the sun).
+		\param obstacles All obstacles, as passed to StructuralShading::setGeometry().
+		\param obstacleTree Bounding volume hierarchy built for the obstacles.
+		\param visibleObstacles Flags for each obstacle, only obstacles with true flag are considered.
+	*/
+	double calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles,
+										   const IBKMK::BoundingVolumeHierarchy & obstacleTree, const std::vector<bool> & visibleObstacles) const;
 
 	/*! Computes and returns shading factor for the given sun normal vector. */
 	double calcShadingFactorWithClipping(unsigned int idxSun, const IBKMK::Vector3D & sunNormal,
@@ -49,6 +49,11 @@
 
 namespace SH {
 
+/*! Bounding boxes of obstacles are enlarged by this distance in [m] in all directions, so that flat polygons get a
+	non-zero box volume and intersection points on polygon boundaries are never culled due to round-off.
+*/
+const double SH_BVH_BOX_TOLERANCE = 1e-4;
+
 QVector4D convertIBKMKVector3D2QVector4D(const IBKMK::Vector3D &v3d) {
 	return QVector4D((float)v3d.m_x,
 					 (float)v3d.m_y,
@@ -114,6 +119,12 @@ void StructuralShading::setGeometry(const std::vector<ShadingObject> & surfaces,
 				throw IBK::Exception(IBK::FormatString("Polygon is not valid."), FUNC_ID);
 		}
 
+		// build bounding volume hierarchy for ray tracing
+		std::vector<IBKMK::BoundingVolumeHierarchy::Box> obstacleBoxes;
+		for (const ShadingObject &so : m_obstacles)
+			obstacleBoxes.push_back(IBKMK::BoundingVolumeHierarchy::boundingBox(so.m_polygon.vertexes(), SH_BVH_BOX_TOLERANCE));
+		m_obstacleTree.build(obstacleBoxes);
+
 	}
 	catch (IBK::Exception &ex) {
 		throw IBK::Exception(ex, IBK::FormatString("Could not set geometry for calculation!"), FUNC_ID);
@@ -209,11 +220,18 @@ void StructuralShading::calculateShadingFactors(Notification * notify, double gr
 			surfaceObject.setPolygon(so.m_idVicus, so.m_name, so.m_polygon, so.m_holes, so.m_idParent, m_gridWidth, useClippingMethod);
 
 			std::vector<ShadingObject> shadingObstacles;
+			// flags for visible obstacles (ray tracing uses all obstacles together with the obstacle tree)
+			std::vector<bool> visibleObstacles(m_obstacles.size(), false);
 
 			// must only use read-only access to shared-memory variables
-			for (const ShadingObject &shading : m_obstacles)
-				if (so.m_visibleSurfaces.find(shading.m_id) != so.m_visibleSurfaces.end())
-					shadingObstacles.push_back(shading);
+			for (unsigned int j=0; j<m_obstacles.size(); ++j) {
+				if (so.m_visibleSurfaces.find(m_obstacles[j].m_id) == so.m_visibleSurfaces.end())
+					continue;
+				if (useClippingMethod)
+					shadingObstacles.push_back(m_obstacles[j]);
+				else
+					visibleObstacles[j] = true;
+			}
 
 
 			// 2. for each center point perform intersection tests again _all_ obstacle polygons
@@ -245,7 +263,7 @@ void StructuralShading::calculateShadingFactors(Notification * notify, double gr
 
 				double sf;
 				if (!useClippingMethod)
-					sf = surfaceObject.calcShadingFactorWithRayTracing(m_sunConeNormals[i], shadingObstacles);
+					sf = surfaceObject.calcShadingFactorWithRayTracing(m_sunConeNormals[i], m_obstacles, m_obstacleTree, visibleObstacles);
 				else {
 					surfaceObject.setProjectedPolygonAndHoles(so.m_projectedPolys[i], so.m_projectedHoles[i]);
 #ifdef WRITE_OUTPUT
@@ -27,6 +27,7 @@
 
 #include <IBKMK_Vector3D.h>
 #include <IBKMK_Polygon3D.h>
+#include <IBKMK_BoundingVolumeHierarchy.h>
 
 #include "SH_Constants.h"
 
@@ -124,7 +125,8 @@ public:
 					 const IBK::Time & startTime, unsigned int duration, unsigned int samplingPeriod,
 					 double sunConeDeg = 3);
 
-	/*! Initializes all variables for shading calculation such as obstacles and sun positions
+	/*! Initializes all variables for shading calculation such as obstacles and sun positions.
+		Also builds the bounding volume hierarchy of all obstacles used in ray-tracing mode.
 		\param obstacles vector with all obstacle interfaces
 	*/
 	void setGeometry(const std::vector<ShadingObject> &surfaces, const std::vector<ShadingObject> &obstacles);
@@ -187,6 +189,8 @@ private:
 	unsigned int										m_samplingPeriod = 3600;			/// Sampling peroid/step size in [s]
 
 	std::vector<ShadingObject>							m_obstacles;						///< Shading obstacles
+	/*! Bounding volume hierarchy over m_obstacles, built in setGeometry(). */
+	IBKMK::BoundingVolumeHierarchy						m_obstacleTree;
 
 	std::vector<ShadingObject>							m_surfaces;							///< Shading surface
 
@@ -1803,6 +1803,14 @@ public:
 	*/
 	virtual const char* Parse( const char* p, TiXmlParsingData* data = 0, TiXmlEncoding encoding = TIXML_DEFAULT_ENCODING );
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+	/*! Parses a fragment of a larger XML text (for example, a sequence of sibling elements). Row numbers
+		of the nodes and errors are counted from \a firstRow (0-based), so that they refer to the larger text.
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	const char* ParseFragment( const char* p, int firstRow, TiXmlEncoding encoding = TIXML_DEFAULT_ENCODING );
+#endif // TIXML_USE_IBK_EXTENSIONS
+
 	/** Get the root element -- the only top level element -- of the document.
 		In well formed XML, there should only be one. TinyXml is tolerant of
 		multiple elements at the document level.
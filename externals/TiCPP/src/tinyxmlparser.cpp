@@ -798,6 +798,15 @@ const char* TiXmlDocument::Parse( const char* p, TiXmlParsingData* prevData, TiX
 	return p;
 }
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+const char* TiXmlDocument::ParseFragment( const char* p, int firstRow, TiXmlEncoding encoding )
+{
+	// the parsing data only serves as start location
+	TiXmlParsingData data( p ? p : "", TabSize(), firstRow, 0 );
+	return Parse( p, &data, encoding );
+}
+#endif // TIXML_USE_IBK_EXTENSIONS
+
 void TiXmlDocument::SetError( int err, const char* pError, TiXmlParsingData* data, TiXmlEncoding encoding )
 {
 	// The first error in a chain is more accurate - don't set again!
@@ -0,0 +1,137 @@
+/*	Load-time benchmark and round-trip check for VICUS::Project::readXML() and VICUS::Project::readBinary().
+
+	Reads each project file several times and reports the fastest load time. The project is then written as
+	binary project file and read again several times from the binary file, the fastest binary load time is
+	reported as well. The projects read from XML and from the binary file are written back to XML and compared
+	(must be identical). Projects that cannot be read from XML are skipped.
+
+	Usage: VicusProjectLoadBenchmark [-r <repetitions>] <project file> [<project file> ...]
+
+	Example (all example projects):
+
+		find data -name "*.vicus" | xargs VicusProjectLoadBenchmark -r 5
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+#include <IBK_StopWatch.h>
+#include <IBK_Path.h>
+#include <IBK_FileUtils.h>
+#include <IBK_messages.h>
+#include <IBK_Exception.h>
+
+#include <VICUS_Project.h>
+
+/*! Reads the project repeatedly and returns fastest load time in [ms].
+	The project of the last repetition is written to xmlFile and binaryFile.
+*/
+double loadProject(const IBK::Path & projectFile, unsigned int repetitions, const IBK::Path & xmlFile,
+				   const IBK::Path & binaryFile)
+{
+	double tMin = 0;
+	for (unsigned int i=0; i<repetitions; ++i) {
+		VICUS::Project prj;
+		IBK::StopWatch w;
+		prj.readXML(projectFile);
+		double t = w.stop();
+		if (i == 0 || t < tMin)
+			tMin = t;
+		if (i+1 == repetitions) {
+			prj.writeXML(xmlFile);
+			prj.writeBinary(binaryFile);
+		}
+	}
+	return tMin;
+}
+
+
+/*! Reads the binary project file repeatedly and returns fastest load time in [ms].
+	The project of the last repetition is written to xmlFile.
+*/
+double loadBinaryProject(const IBK::Path & binaryFile, unsigned int repetitions, const IBK::Path & xmlFile) {
+	double tMin = 0;
+	for (unsigned int i=0; i<repetitions; ++i) {
+		VICUS::Project prj;
+		IBK::StopWatch w;
+		prj.readBinary(binaryFile);
+		double t = w.stop();
+		if (i == 0 || t < tMin)
+			tMin = t;
+		if (i+1 == repetitions)
+			prj.writeXML(xmlFile);
+	}
+	return tMin;
+}
+
+
+int main(int argc, char * argv[]) {
+	unsigned int repetitions = 3;
+	std::vector<IBK::Path> projectFiles;
+	for (int i=1; i<argc; ++i) {
+		if (std::string(argv[i]) == "-r" && i+1 < argc)
+			repetitions = (unsigned int)std::max(1, std::atoi(argv[++i]));
+		else
+			projectFiles.push_back(IBK::Path(argv[i]));
+	}
+	if (projectFiles.empty()) {
+		std::cerr << "Usage: VicusProjectLoadBenchmark [-r <repetitions>] <project file> [<project file> ...]" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// warnings of the example projects are not of interest here
+	IBK::MessageHandlerRegistry::instance().messageHandler()->setConsoleVerbosityLevel(0);
+
+	std::cout << "Repetitions: " << repetitions << std::endl;
+
+	const IBK::Path xmlFile("VicusProjectLoadBenchmark.xml");
+	const IBK::Path xmlBinary("VicusProjectLoadBenchmark_binary.xml");
+	const IBK::Path binaryFile("VicusProjectLoadBenchmark.vicusb");
+
+	double tXmlTotal = 0;
+	double tBinaryTotal = 0;
+	unsigned int differences = 0;
+	unsigned int failures = 0;
+	std::cout << std::fixed << std::setprecision(1);
+	for (const IBK::Path & projectFile : projectFiles) {
+		double tXml;
+		try {
+			tXml = loadProject(projectFile, repetitions, xmlFile, binaryFile);
+		}
+		catch (IBK::Exception & ex) {
+			std::cout << "  failed      " << projectFile.filename() << " (" << ex.what() << ")" << std::endl;
+			++failures;
+			continue;
+		}
+		// errors when reading the binary file are round-trip errors
+		double tBinary = 0;
+		bool identical = false;
+		try {
+			tBinary = loadBinaryProject(binaryFile, repetitions, xmlBinary);
+			identical = IBK::file2String(xmlFile) == IBK::file2String(xmlBinary);
+		}
+		catch (IBK::Exception & ex) {
+			ex.writeMsgStackToError();
+		}
+		tXmlTotal += tXml;
+		tBinaryTotal += tBinary;
+		if (!identical)
+			++differences;
+		std::cout << std::setw(10) << tXml << " ms " << std::setw(10) << tBinary << " ms  "
+				  << (identical ? "" : "DIFFERENT  ") << projectFile.filename() << std::endl;
+	}
+	IBK::Path::remove(xmlFile, true);
+	IBK::Path::remove(xmlBinary, true);
+	IBK::Path::remove(binaryFile, true);
+
+	std::cout << "Total XML    " << std::setw(10) << tXmlTotal << " ms" << std::endl;
+	std::cout << "Total binary " << std::setw(10) << tBinaryTotal << " ms" << std::endl;
+	std::cout << "Projects: " << projectFiles.size() << ", failed to read: " << failures
+			  << ", different results: " << differences << std::endl;
+
+	return differences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -44,6 +44,7 @@ HEADERS += \
 	../../src/VICUS_AcousticTemplate.h \
 	../../src/VICUS_ArgsParser.h \
 	../../src/VICUS_BTFReader.h \
+	../../src/VICUS_BinaryIO.h \
 	../../src/VICUS_BoundaryCondition.h \
 	../../src/VICUS_Building.h \
 	../../src/VICUS_BuildingLevel.h \
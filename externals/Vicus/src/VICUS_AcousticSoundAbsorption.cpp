@@ -1,4 +1,5 @@
 #include "VICUS_AcousticSoundAbsorption.h"
+#include "VICUS_BinaryIO.h"
 #include "tinyxml.h"
 #include <IBK_math.h>
 
@@ -98,4 +99,16 @@ TiXmlElement * AcousticSoundAbsorption::writeXML(TiXmlElement * parent) const {
 }
 
 
+void AcousticSoundAbsorption::readBinary(std::istream & in) {
+	readBinaryPrivate(in);
+	NANDRAD::readBinary(in, m_soundAbsorption);
+}
+
+
+void AcousticSoundAbsorption::writeBinary(std::ostream & out) const {
+	writeBinaryPrivate(out);
+	NANDRAD::writeBinary(out, m_soundAbsorption);
+}
+
+
 } // namespace VICUS
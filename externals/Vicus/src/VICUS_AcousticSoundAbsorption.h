@@ -27,6 +27,8 @@ public:
 
 	void readXML(const TiXmlElement * element);
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	void readBinary(std::istream & in);
+	void writeBinary(std::ostream & out) const;
 
 	/*! Checks if all parameters are valid. */
 	bool isValid() const;
@@ -0,0 +1,98 @@
+/*	The SIM-VICUS data model library.
+
+	Copyright (c) 2020-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Dirk Weiss  <dirk.weiss -[at]- tu-dresden.de>
+	  Stephan Hirth  <stephan.hirth -[at]- tu-dresden.de>
+	  Hauke Hirsch  <hauke.hirsch -[at]- tu-dresden.de>
+
+	  ... all the others from the SIM-VICUS team ... :-)
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef VICUS_BinaryIOH
+#define VICUS_BinaryIOH
+
+#include <NANDRAD_BinaryIO.h>
+
+#include <IBKMK_Vector2D.h>
+#include <IBKMK_Vector3D.h>
+
+#include <QString>
+#include <QColor>
+
+// Binary write/read functions for value types used in VICUS data classes, see NANDRAD_BinaryIO.h.
+// The specializations must be placed in namespace NANDRAD, the generated code calls NANDRAD::readBinary()
+// and NANDRAD::writeBinary().
+
+namespace NANDRAD {
+
+/*! Strings are stored UTF8-encoded. */
+template <>
+struct BinaryIO<QString> {
+	static void write(std::ostream & out, const QString & str) { BinaryIO<std::string>::write(out, str.toStdString()); }
+	static void read(std::istream & in, QString & str) {
+		std::string s;
+		BinaryIO<std::string>::read(in, s);
+		str = QString::fromStdString(s);
+	}
+};
+
+/*! Colors are stored as ARGB value (including alpha value, unlike XML), invalid colors are stored as such. */
+template <>
+struct BinaryIO<QColor> {
+	static void write(std::ostream & out, const QColor & c) {
+		BinaryIO<bool>::write(out, c.isValid());
+		BinaryIO<uint32_t>::write(out, c.isValid() ? (uint32_t)c.rgba() : 0u);
+	}
+	static void read(std::istream & in, QColor & c) {
+		bool valid = false;
+		BinaryIO<bool>::read(in, valid);
+		uint32_t rgba = 0;
+		BinaryIO<uint32_t>::read(in, rgba);
+		c = valid ? QColor::fromRgba(rgba) : QColor();
+	}
+};
+
+template <>
+struct BinaryIO<IBKMK::Vector2D> {
+	static void write(std::ostream & out, const IBKMK::Vector2D & v) {
+		BinaryIO<double>::write(out, v.m_x);
+		BinaryIO<double>::write(out, v.m_y);
+	}
+	static void read(std::istream & in, IBKMK::Vector2D & v) {
+		BinaryIO<double>::read(in, v.m_x);
+		BinaryIO<double>::read(in, v.m_y);
+	}
+};
+
+template <>
+struct BinaryIO<IBKMK::Vector3D> {
+	static void write(std::ostream & out, const IBKMK::Vector3D & v) {
+		BinaryIO<double>::write(out, v.m_x);
+		BinaryIO<double>::write(out, v.m_y);
+		BinaryIO<double>::write(out, v.m_z);
+	}
+	static void read(std::istream & in, IBKMK::Vector3D & v) {
+		BinaryIO<double>::read(in, v.m_x);
+		BinaryIO<double>::read(in, v.m_y);
+		BinaryIO<double>::read(in, v.m_z);
+	}
+};
+
+} // namespace NANDRAD
+
+#endif // VICUS_BinaryIOH
@@ -26,6 +26,8 @@
 #ifndef VICUS_CodeGenMacrosH
 #define VICUS_CodeGenMacrosH
 
+#include <iosfwd>
+
 class TiXmlElement;
 
 // IDType is used instead of unsigned int for special serialization feature
@@ -33,23 +35,33 @@ typedef unsigned int IDType;
 
 #define VICUS_READWRITE \
 	void readXML(const TiXmlElement * element); \
-	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	TiXmlElement * writeXML(TiXmlElement * parent) const; \
+	void readBinary(std::istream & in); \
+	void writeBinary(std::ostream & out) const;
 
 #define VICUS_READWRITE_OVERRIDE \
 	void readXML(const TiXmlElement * element) override; \
-	TiXmlElement * writeXML(TiXmlElement * parent) const override;
+	TiXmlElement * writeXML(TiXmlElement * parent) const override; \
+	void readBinary(std::istream & in); \
+	void writeBinary(std::ostream & out) const;
 
 #define VICUS_READWRITE_IFNOTEMPTY(X) \
 	void readXML(const TiXmlElement * element) { readXMLPrivate(element); } \
-	TiXmlElement * writeXML(TiXmlElement * parent) const { if (*this != X()) return writeXMLPrivate(parent); else return nullptr; }
+	TiXmlElement * writeXML(TiXmlElement * parent) const { if (*this != X()) return writeXMLPrivate(parent); else return nullptr; } \
+	void readBinary(std::istream & in) { readBinaryPrivate(in); } \
+	void writeBinary(std::ostream & out) const { writeBinaryPrivate(out); }
 
 #define VICUS_READWRITE_IFNOT_INVALID_ID \
 	void readXML(const TiXmlElement * element) override { readXMLPrivate(element); } \
-	TiXmlElement * writeXML(TiXmlElement * parent) const { if (m_id != INVALID_ID) return writeXMLPrivate(parent); else return nullptr; }
+	TiXmlElement * writeXML(TiXmlElement * parent) const { if (m_id != INVALID_ID) return writeXMLPrivate(parent); else return nullptr; } \
+	void readBinary(std::istream & in) { readBinaryPrivate(in); } \
+	void writeBinary(std::ostream & out) const { writeBinaryPrivate(out); }
 
 #define VICUS_READWRITE_PRIVATE \
 	void readXMLPrivate(const TiXmlElement * element); \
-	TiXmlElement * writeXMLPrivate(TiXmlElement * parent) const;
+	TiXmlElement * writeXMLPrivate(TiXmlElement * parent) const; \
+	void readBinaryPrivate(std::istream & in); \
+	void writeBinaryPrivate(std::ostream & out) const;
 
 #define VICUS_COMP(X) \
 	bool operator!=(const X & other) const; \
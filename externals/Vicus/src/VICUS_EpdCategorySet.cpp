@@ -26,6 +26,7 @@
 #include "VICUS_EpdCategorySet.h"
 #include "IBK_messages.h"
 #include "VICUS_KeywordList.h"
+#include "VICUS_BinaryIO.h"
 
 #include <IBK_MessageHandler.h>
 
@@ -78,4 +79,14 @@ TiXmlElement * EpdCategorySet::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+
+void EpdCategorySet::readBinary(std::istream & in) {
+	NANDRAD::readBinary(in, m_idCategory);
+}
+
+
+void EpdCategorySet::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_idCategory);
+}
+
 }
@@ -72,6 +72,8 @@ public:
 
 	void readXML(const TiXmlElement * element); \
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	void readBinary(std::istream & in);
+	void writeBinary(std::ostream & out) const;
 
 	/* Id of Category .*/
 	IDType				m_idCategory[NUM_C];
@@ -30,6 +30,7 @@
 #include <IBK_StringUtils.h>
 
 #include <VICUS_KeywordList.h>
+#include <VICUS_BinaryIO.h>
 
 #include <NANDRAD_Utilities.h>
 
@@ -172,4 +173,16 @@ TiXmlElement * EpdModuleDataset::writeXML(TiXmlElement * parent) const {
 
 }
 
+
+void EpdModuleDataset::readBinary(std::istream & in) {
+	NANDRAD::readBinary(in, m_modules);
+	NANDRAD::readBinary(in, m_para);
+}
+
+
+void EpdModuleDataset::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_modules);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 }
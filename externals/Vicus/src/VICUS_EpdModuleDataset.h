@@ -112,6 +112,8 @@ public:
 
 	void readXML(const TiXmlElement * element);
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	void readBinary(std::istream & in);
+	void writeBinary(std::ostream & out) const;
 
 
 	/*! Category type A1, A2, ... */
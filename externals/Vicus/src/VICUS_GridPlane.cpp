@@ -60,6 +60,17 @@ TiXmlElement * GridPlane::writeXML(TiXmlElement * parent) const {
 }
 
 
+void GridPlane::readBinary(std::istream & in) {
+	readBinaryPrivate(in);
+	updateLocalY();
+}
+
+
+void GridPlane::writeBinary(std::ostream & out) const {
+	writeBinaryPrivate(out);
+}
+
+
 bool GridPlane::operator!=(const GridPlane & other) const {
 	if (m_isVisible != other.m_isVisible) return true;
 	if (m_isActive != other.m_isActive) return true;
@@ -62,6 +62,8 @@ public:
 
 	void readXML(const TiXmlElement * element);
 	TiXmlElement * writeXML(TiXmlElement * parent) const;
+	void readBinary(std::istream & in);
+	void writeBinary(std::ostream & out) const;
 
 	VICUS_COMP(GridPlane)
 
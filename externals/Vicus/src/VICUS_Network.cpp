@@ -48,6 +48,7 @@
 
 #include <fstream>
 #include <algorithm>
+#include <queue>
 
 
 
@@ -621,14 +622,23 @@ void Network::findShortestPathForBuildings(std::map<unsigned int, std::vector<Ne
 	FUNCID(Network::findShortestPathForBuildings);
 
 	// check for source
-	std::vector<NetworkNode> sources;
-	findSourceNodes(sources);
-	if (sources.size() < 1)
+	std::vector<unsigned int> sourceIndexes;
+	for (unsigned int i=0; i<m_nodes.size(); ++i) {
+		if (m_nodes[i].m_type == NetworkNode::NT_Source)
+			sourceIndexes.push_back(i);
+	}
+	if (sourceIndexes.size() < 1)
 		throw IBK::Exception("Network has no source node. Set one node to type source.", FUNC_ID);
 
+	// shortest paths from all sources at once, each node is reached from its closest source
+	std::vector<double> distances;
+	std::vector<NetworkEdge*> predecessorEdges;
+	shortestPathTree(sourceIndexes, distances, predecessorEdges);
+
 	// iterate over all buildings
 	minPathMap.clear();
-	for (const NetworkNode &node: m_nodes) {
+	for (unsigned int i=0; i<m_nodes.size(); ++i) {
+		const NetworkNode &node = m_nodes[i];
 
 		if (node.m_type != NetworkNode::NT_SubStation)
 			continue;
@@ -637,25 +647,18 @@ void Network::findShortestPathForBuildings(std::map<unsigned int, std::vector<Ne
 		if (node.m_maxHeatingDemand.value <= 0)
 			throw IBK::Exception(IBK::FormatString("Maximum heating demand of node '%1' must be >0").arg(node.m_id), FUNC_ID);
 
-		// for each source find the shortest path to current node. Finally select the shortest of these paths
-		std::vector<NetworkEdge * > minPath;
-		double minPathLength = std::numeric_limits<double>::max();
-		for (const NetworkNode &source: sources){
-			std::vector<NetworkEdge * > path;
-			// shortest path between source and node
-			dijkstraShortestPathToSource(node, source, path);
-			double pathLength = 0;
-			// length of this path
-			for (NetworkEdge *edge: path)
-				pathLength += edge->length();
-			// minumum length of paths for each source to current building
-			if (pathLength < minPathLength){
-				minPathLength = pathLength;
-				minPath = path;
-			}
+		if (distances[i] == std::numeric_limits<double>::max())
+			throw IBK::Exception(IBK::FormatString("Node '%1' is not connected to any source node.").arg(node.m_id), FUNC_ID);
+
+		// go along predecessor edges from building to source, then reverse so that path starts at source
+		std::vector<NetworkEdge * > & minPath = minPathMap[node.m_id];
+		const NetworkNode * n = &node;
+		while (predecessorEdges[(unsigned int)(n - m_nodes.data())] != nullptr) {
+			NetworkEdge * e = predecessorEdges[(unsigned int)(n - m_nodes.data())];
+			minPath.push_back(e);
+			n = e->neighbourNode(n);
 		}
-		// finally store the shortest path
-		minPathMap[node.m_id] = minPath;
+		std::reverse(minPath.begin(), minPath.end());
 	}
 }
 
@@ -860,37 +863,59 @@ void Network::findSourceNodes(std::vector<NetworkNode> &sources) const {
 }
 
 
-void Network::dijkstraShortestPathToSource(const NetworkNode &startNode, const NetworkNode &endNode,
-										   std::vector<NetworkEdge*> &pathEndToStart) const {
+void Network::shortestPathTree(const std::vector<unsigned int> & startNodeIndexes,
+							   std::vector<double> & distances, std::vector<NetworkEdge*> & predecessorEdges) const
+{
+	unsigned int nodeCount = m_nodes.size();
+
+	// adjacency array: neighbours of node i are stored in [adjacencyOffsets[i], adjacencyOffsets[i+1])
+	std::vector<unsigned int> adjacencyOffsets(nodeCount + 1, 0);
+	for (unsigned int i=0; i<nodeCount; ++i)
+		adjacencyOffsets[i+1] = adjacencyOffsets[i] + m_nodes[i].m_edges.size();
+	std::vector<unsigned int> neighbours(adjacencyOffsets[nodeCount]);
+	std::vector<double> lengths(adjacencyOffsets[nodeCount]);
+	std::vector<NetworkEdge*> edges(adjacencyOffsets[nodeCount]);
+	for (unsigned int i=0; i<nodeCount; ++i) {
+		unsigned int k = adjacencyOffsets[i];
+		for (NetworkEdge * e : m_nodes[i].m_edges) {
+			neighbours[k] = (unsigned int)(e->neighbourNode(&m_nodes[i]) - m_nodes.data());
+			IBK_ASSERT(neighbours[k] < nodeCount);
+			lengths[k] = e->length();
+			edges[k] = e;
+			++k;
+		}
+	}
 
-	// init: all nodes have infinte distance to start node and no predecessor
-	for (const NetworkNode &n: m_nodes){
-		n.m_distanceToStart = std::numeric_limits<double>::max();
-		n.m_predecessor = nullptr;
+	// init: all nodes have infinte distance to start nodes and no predecessor
+	distances.assign(nodeCount, std::numeric_limits<double>::max());
+	predecessorEdges.assign(nodeCount, nullptr);
+
+	// min-heap of (distance, node index); nodes are re-inserted when their distance decreases,
+	// outdated entries are skipped when popped
+	typedef std::pair<double, unsigned int> HeapEntry;
+	std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry> > heap;
+	for (unsigned int i : startNodeIndexes) {
+		distances[i] = 0;
+		heap.push(HeapEntry(0, i));
 	}
-	startNode.m_distanceToStart = 0;
-	std::set<unsigned> visitedNodes;
-
-	// go through all not-visited nodes
-	while (visitedNodes.size() <= m_nodes.size()){
-		// find node with currently smallest distance to start, which has not yet been visited:
-		double minDistance = std::numeric_limits<double>::max();
-		const NetworkNode *nMin = nullptr;
-		for (const NetworkNode &n: m_nodes){
-			if (visitedNodes.find(n.m_id) == visitedNodes.end() && n.m_distanceToStart < minDistance){
-				minDistance = n.m_distanceToStart;
-				nMin = &n;
+
+	while (!heap.empty()) {
+		HeapEntry entry = heap.top();
+		heap.pop();
+		unsigned int i = entry.second;
+		if (entry.first > distances[i])
+			continue; // outdated entry
+
+		// update distance from start to neighbours of node i
+		for (unsigned int k=adjacencyOffsets[i]; k<adjacencyOffsets[i+1]; ++k) {
+			double alternativeDistance = distances[i] + lengths[k];
+			unsigned int j = neighbours[k];
+			if (alternativeDistance < distances[j]) {
+				distances[j] = alternativeDistance;
+				predecessorEdges[j] = edges[k];
+				heap.push(HeapEntry(alternativeDistance, j));
 			}
 		}
-		IBK_ASSERT(nMin != nullptr);
-		// if endNode reached: return path
-		if (nMin->m_id == endNode.m_id){
-			nMin->pathToNull(pathEndToStart);
-			return;
-		}
-		// update distance from start to neighbours of nMin
-		visitedNodes.insert(nMin->m_id);
-		nMin->updateNeighbourDistances();
 	}
 }
 
@@ -144,7 +144,8 @@ public:
 	void removeShortEdges(const double &thresholdLength);
 
 	/*! For each building node: Find shortest path to the closest source node and store the pointers to the edges
-	 * along that path. The result is a map with keys being the ids of the building nodes */
+	 * along that path (starting at the source node). The result is a map with keys being the ids of the building nodes.
+	 * The shortest paths of all buildings are obtained from a single search starting at all source nodes. */
 	void findShortestPathForBuildings(std::map<unsigned int, std::vector<NetworkEdge *> > &minPathMap) const;
 
 	/*! calculate pipe dimensions using a maximum pressure loss per length and fixed temperature difference
@@ -169,12 +170,6 @@ public:
 
 	void writeBuildingsCSV(const IBK::Path &file) const;
 
-	/*! find shortest Path from given startNode (e.g. a building) to Node with type source
-	 * using dijkstra-algorithm, implemented according to Wikipedia and return path as vector of edges
-	 */
-	void dijkstraShortestPathToSource(const NetworkNode &startNode, const NetworkNode &endNode,
-									  std::vector<NetworkEdge*> &pathEndToStart) const;
-
 	/*! Recomputes the min/max coordinates of the network and updates m_extends. */
 	void updateExtends();
 
@@ -304,6 +299,14 @@ private:
 	 * does only copy position, type and maxHeatingDemand */
 	unsigned int addNode(unsigned int preferedId, const NetworkNode & nodeById, const bool considerCoordinates=true);
 
+	/*! Computes the tree of shortest paths from the given start nodes (indexes in m_nodes) using dijkstra-algorithm
+	 * with a binary heap. For each node predecessorEdges holds the edge leading towards the closest start node,
+	 * nullptr for start nodes and nodes that are not connected to any start node.
+	 * Requires valid node/edge connection pointers, see updateNodeEdgeConnectionPointers().
+	 */
+	void shortestPathTree(const std::vector<unsigned int> & startNodeIndexes,
+						  std::vector<double> & distances, std::vector<NetworkEdge*> & predecessorEdges) const;
+
 };
 
 
@@ -141,31 +141,6 @@ bool NetworkNode::findPathToSource(std::set<NetworkEdge*> &path, std::set<Networ
 }
 
 
-void NetworkNode::updateNeighbourDistances() const{
-	// calculate alternative distance to neighbour.
-	// If it is shorter than current one: set it as its current distance
-	for (const NetworkEdge *e :m_edges){
-		NetworkNode * neighbour = e->neighbourNode(this);
-		double alternativeDistance = m_distanceToStart + e->length();
-		if (alternativeDistance < neighbour->m_distanceToStart){
-			neighbour->m_distanceToStart = alternativeDistance;
-			neighbour->m_predecessor = this;
-		}
-	}
-}
-
-
-void NetworkNode::pathToNull(std::vector<NetworkEdge*> &path) const{
-	if (m_predecessor == nullptr)
-		return;
-	for (NetworkEdge * e: m_edges){
-		if (e->neighbourNode(this) == m_predecessor){
-			path.push_back(e);
-			e->neighbourNode(this)->pathToNull(path);
-		}
-	}
-}
-
 double NetworkNode::adjacentHeatingDemand(std::set<NetworkEdge *> visitedEdges){
 	for (NetworkEdge *e: m_edges){
 		if (visitedEdges.find(e)==visitedEdges.end()){
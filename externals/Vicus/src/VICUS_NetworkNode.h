@@ -99,15 +99,6 @@ public:
 	 * The path is stored as a set of edges */
 	bool findPathToSource(std::set<NetworkEdge*> &path, std::set<NetworkEdge*> &visitedEdges, std::set<unsigned> &visitedNodes);
 
-	/*! used for dijkstra algorithm. Look at all neighbour nodes: if the m_distanceToStart of this node + the distance to the neighbour
-	 * is shorter than the current m_distanceToStart of the neighbour, update it. This makes sure the neighbour nodes have assigned
-	 * the currently smallest distance from start */
-	void updateNeighbourDistances() const;
-
-	/*! used for dijkstra algorithm. appends the edge which leads to the predecessor node to path and calls itself for the predecessor node
-	 * until a node without predecessor is reached. this way the path from a building to the source can be created, if the predecessors have been set */
-	void pathToNull(std::vector<NetworkEdge * > & path) const;
-
 	/*! looks at all adjacent nodes to find a node which has a heating demand >0 and returns it. */
 	double adjacentHeatingDemand(std::set<NetworkEdge*> visitedEdges);
 
@@ -144,10 +135,6 @@ public:
 	/*! Color to be used for displaying (visible) nodes. */
 	mutable QColor								m_color;
 
-	/*! Used in dijkstra algorithm. */
-	mutable double								m_distanceToStart = (std::numeric_limits<double>::max)();
-	mutable const NetworkNode *					m_predecessor = nullptr;
-
 	/*! Defines wether this node is a dead end. */
 	mutable bool								m_isDeadEnd = false;
 
@@ -66,4 +66,12 @@ TiXmlElement * PlainGeometry::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void PlainGeometry::readBinary(std::istream & in) {
+	readBinaryPrivate(in);
+}
+
+void PlainGeometry::writeBinary(std::ostream & out) const {
+	writeBinaryPrivate(out);
+}
+
 } // namespace VICUS
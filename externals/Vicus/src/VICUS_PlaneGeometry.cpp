@@ -51,6 +51,9 @@
 
 #include <tinyxml.h>
 
+#include <map>
+#include <functional>
+
 namespace VICUS {
 
 // *** PlaneGeometry ***
@@ -114,6 +117,14 @@ double PlaneGeometry::area(int digits) const {
 
 
 void PlaneGeometry::triangulate() const {
+	// generic triangulation of polygons with holes
+	if (m_polygon.isValid() && needsGenericTriangulation()) {
+		Triangulation2D res;
+		triangulate2D(m_polygon.polyline(), m_holes, res);
+		applyTriangulation(res);
+		return;
+	}
+
 	m_triangulationData.clear();
 	m_triangulationDataWithoutHoles.clear();
 	m_holeTriangulationData.clear();
@@ -123,47 +134,47 @@ void PlaneGeometry::triangulate() const {
 	if (!m_polygon.isValid())
 		return;
 
-	// Create a copy of the vertex error of the outer polygon (we are going to add vertexes of the holes later on)
-	// Note: do not access m_vertexes herea as we may regenerate the vertexes.
-	std::vector<IBKMK::Vector3D> vertexes = m_polygon.vertexes();
-
 	// We have special handling for type triangle and rectangle, but only if
 	// we have no holes. This will save some work for quite a lot of planes.
-	if (m_holes.empty() && m_polygon.type() != VICUS::Polygon2D::T_Polygon) {
-		switch (m_polygon.type()) {
+	switch (m_polygon.type()) {
 
-		case Polygon2D::T_Triangle :
-			m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(0, 1, 2) );
-			break;
+	case Polygon2D::T_Triangle :
+		m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(0, 1, 2) );
+		break;
 
-		case Polygon2D::T_Rectangle :
-			m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(0, 1, 2) );
-			m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(2, 3, 0) );
-			break;
+	case Polygon2D::T_Rectangle :
+		m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(0, 1, 2) );
+		m_triangulationData.m_triangles.push_back( IBKMK::Triangulation::triangle_t(2, 3, 0) );
+		break;
 
-		default: ;
-		}
-		m_triangulationData.m_vertexes.swap(vertexes);
-		m_triangulationData.m_normal = m_polygon.normal(); // cache normal for easy access
+	default: ;
+	}
+	// Note: do not access m_vertexes here as we may regenerate the vertexes.
+	m_triangulationData.m_vertexes = m_polygon.vertexes();
+	m_triangulationData.m_normal = m_polygon.normal(); // cache normal for easy access
 
-		// no holes, copy data
-		m_triangulationDataWithoutHoles.m_vertexes = m_triangulationData.m_vertexes;
-		m_triangulationDataWithoutHoles.m_normal = m_polygon.normal();
+	// no holes, copy data
+	m_triangulationDataWithoutHoles.m_vertexes = m_triangulationData.m_vertexes;
+	m_triangulationDataWithoutHoles.m_normal = m_polygon.normal();
+}
 
-		return; // done
-	}
+
+bool PlaneGeometry::needsGenericTriangulation() const {
+	return !m_holes.empty() || m_polygon.type() == VICUS::Polygon2D::T_Polygon;
+}
 
 
-	// now the generic code
+void PlaneGeometry::triangulate2D(const IBKMK::Polygon2D & polyline, const std::vector<Hole> & holes, Triangulation2D & res) {
+	res = Triangulation2D();
 
-	const std::vector<IBKMK::Vector2D> &parentPoly = m_polygon.polyline().vertexes();
+	const std::vector<IBKMK::Vector2D> &parentPoly = polyline.vertexes();
 	// process all holes and check if they are valid (i.e. their polygons do not intersect our polygons
 
 	// here we store the state of the sub-surface polygon: 0 - invalid, 1 - partially valid, 2 - completely valid
 	// polygons with status 1 are drawn but not used in triangulation of polygon3D
-	std::vector<unsigned int> polygonStatus(m_holes.size(), 0);
-	for (unsigned int i=0; i<m_holes.size(); ++i) {
-		const Polygon2D & p2 = m_holes[i].m_holeGeometry;
+	std::vector<unsigned int> polygonStatus(holes.size(), 0);
+	for (unsigned int i=0; i<holes.size(); ++i) {
+		const Polygon2D & p2 = holes[i].m_holeGeometry;
 		const std::vector<IBKMK::Vector2D> &subSurfacePoly = p2.vertexes();
 
 		// check if any of the holes are invalid
@@ -230,13 +241,11 @@ void PlaneGeometry::triangulate() const {
 		polygonStatus[i] = 2;
 	}
 
-	// now populate global vertex vector and generate 2D polygon
-	// we have then two vectors, one with the 3D vertexes, and one with the 2D vertexes inside the plane
+	// now populate global 2D vertex vector; the 3D vertexes are computed in applyTriangulation()
 
 	// first add the polygon points
-	std::vector<IBKMK::Vector2D> points = m_polygon.polyline().vertexes();
-
-	// Vector 'points' contains now the 2D coordinates for all 3D coordinates in 'vertexes' with same order.
+	std::vector<IBKMK::Vector2D> points = parentPoly;
+	const unsigned int outerPointCount = points.size();
 
 	// now generate the edges for this polygon
 	std::vector<std::pair<unsigned int, unsigned int> > edges;
@@ -248,7 +257,8 @@ void PlaneGeometry::triangulate() const {
 
 
 	// now process holes/windows
-	m_holeTriangulationData.resize(m_holes.size()); // create an (empty) data structure for each hole
+	res.m_holeVertexIndexes.resize(holes.size()); // create an (empty) data structure for each hole
+	res.m_holeTriangles.resize(holes.size());
 
 	// loop all holes/windows
 	for (unsigned int holeIdx = 0; holeIdx < polygonStatus.size(); ++holeIdx) {
@@ -258,12 +268,11 @@ void PlaneGeometry::triangulate() const {
 		if (polygonStatus[holeIdx] == 0)
 			continue;
 
-		const Polygon2D & p2 = m_holes[holeIdx].m_holeGeometry; // polygon of currently processed hole
+		const Polygon2D & p2 = holes[holeIdx].m_holeGeometry; // polygon of currently processed hole
 
-		std::vector<unsigned int> vertexIndexes; // mapping table, relates hole index to global index in 'points' vector
-		// process all vertexes and compose vector with 2D and 3D coordinates of the hole polygon
+		std::vector<unsigned int> & vertexIndexes = res.m_holeVertexIndexes[holeIdx]; // mapping table, relates hole index to global index in 'points' vector
+		// process all vertexes and compose vector with 2D coordinates of the hole polygon
 		std::vector<IBKMK::Vector2D> matchedHolePoints;
-		std::vector<IBKMK::Vector3D> matchedHolePoints3D;
 		const std::vector<IBKMK::Vector2D> & holePoints = p2.vertexes();
 		for (const IBKMK::Vector2D & v : holePoints) {
 			// for each vertex in window do:
@@ -275,14 +284,9 @@ void PlaneGeometry::triangulate() const {
 					break;
 			// store index (either of existing vertex or next vertex to be added)
 			vertexIndexes.push_back(j);
-			if (j == points.size()) {
+			if (j == points.size())
 				points.push_back(v);
-				// compute the matching 3D vertex and add to list of vertexes
-				IBKMK::Vector3D v3 = offset() + localX()*v.m_x + localY()*v.m_y;
-				vertexes.push_back(v3);
-			}
 			matchedHolePoints.push_back(points[j]);
-			matchedHolePoints3D.push_back(vertexes[j]);
 		}
 
 		// now the 'points' vector holds vertexes of the outer polygon and all the holes
@@ -321,14 +325,12 @@ void PlaneGeometry::triangulate() const {
 		//       IBK::point2D<double> is a IBKMK::Vector2D
 		triangu.setPoints(reinterpret_cast< const std::vector<IBK::point2D<double> > & >(matchedHolePoints), holeOnlyEdges);
 
-		// and copy the triangle data and remap the points
+		// and copy the triangle data
 		for (auto tri : triangu.m_triangles) {
 			if (tri.isDegenerated()) // protect against -1 vertex indexes
 				continue;
-			m_holeTriangulationData[holeIdx].m_triangles.push_back(tri);
+			res.m_holeTriangles[holeIdx].push_back(tri);
 		}
-		m_holeTriangulationData[holeIdx].m_vertexes.swap(matchedHolePoints3D);
-		m_holeTriangulationData[holeIdx].m_normal = m_polygon.normal(); // cache normal for easy access
 	}
 
 	// now generate the triangulation data for the entire surface, without subsurface polygons
@@ -350,11 +352,46 @@ void PlaneGeometry::triangulate() const {
 		// skip degenerated triangles
 		if (tri.isDegenerated())
 			continue;
-		m_triangulationData.m_triangles.push_back(tri);
+		res.m_triangles.push_back(tri);
 		//		IBK::IBK_Message(IBK::FormatString("%1, %2, %3\n").arg(tri.i1).arg(tri.i2).arg(tri.i3), IBK::MSG_PROGRESS, "");
 	}
 
+	// remember the points added for the holes
+	res.m_addedPoints.assign(points.begin() + outerPointCount, points.end());
+}
+
+
+void PlaneGeometry::applyTriangulation(const Triangulation2D & res) const {
+	m_triangulationData.clear();
+	m_triangulationDataWithoutHoles.clear();
+	m_holeTriangulationData.clear();
+	m_dirty = false;
+
+	// Create a copy of the vertexes of the outer polygon and add the vertexes of the holes
+	// Note: do not access m_vertexes here as we may regenerate the vertexes.
+	std::vector<IBKMK::Vector3D> vertexes = m_polygon.vertexes();
+	vertexes.reserve(vertexes.size() + res.m_addedPoints.size());
+	for (const IBKMK::Vector2D & v : res.m_addedPoints) {
+		// compute the matching 3D vertex and add to list of vertexes
+		IBKMK::Vector3D v3 = offset() + localX()*v.m_x + localY()*v.m_y;
+		vertexes.push_back(v3);
+	}
+
+	m_holeTriangulationData.resize(m_holes.size()); // create an (empty) data structure for each hole
+	for (unsigned int holeIdx = 0; holeIdx < m_holes.size(); ++holeIdx) {
+		// invalid holes have no vertexes
+		const std::vector<unsigned int> & vertexIndexes = res.m_holeVertexIndexes[holeIdx];
+		if (vertexIndexes.empty())
+			continue;
+		PlaneTriangulationData & holeData = m_holeTriangulationData[holeIdx];
+		holeData.m_triangles = res.m_holeTriangles[holeIdx];
+		for (unsigned int idx : vertexIndexes)
+			holeData.m_vertexes.push_back(vertexes[idx]);
+		holeData.m_normal = m_polygon.normal(); // cache normal for easy access
+	}
+
 	// store vertexes for triangles
+	m_triangulationData.m_triangles = res.m_triangles;
 	m_triangulationData.m_vertexes.swap(vertexes);
 	m_triangulationData.m_normal = m_polygon.normal(); // cache normal for easy access
 
@@ -362,6 +399,96 @@ void PlaneGeometry::triangulate() const {
 }
 
 
+/*! Hash of the 2D polygon and the hole polygons, used to find planes with equal triangulation input. */
+static std::size_t triangulationInputHash(const IBKMK::Polygon2D & polyline, const std::vector<PlaneGeometry::Hole> & holes) {
+	std::size_t h = 0;
+	std::hash<double> hasher;
+	auto combine = [&h, &hasher](double v) {
+		h ^= hasher(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+	};
+	for (const IBKMK::Vector2D & v : polyline.vertexes()) {
+		combine(v.m_x);
+		combine(v.m_y);
+	}
+	for (const PlaneGeometry::Hole & hole : holes) {
+		combine(hole.m_holeGeometry.vertexes().size());
+		for (const IBKMK::Vector2D & v : hole.m_holeGeometry.vertexes()) {
+			combine(v.m_x);
+			combine(v.m_y);
+		}
+	}
+	return h;
+}
+
+
+/*! Returns true, if both point vectors are exactly equal. */
+static bool equalPoints(const std::vector<IBKMK::Vector2D> & a, const std::vector<IBKMK::Vector2D> & b) {
+	if (a.size() != b.size())
+		return false;
+	for (unsigned int i=0; i<a.size(); ++i)
+		if (a[i].m_x != b[i].m_x || a[i].m_y != b[i].m_y)
+			return false;
+	return true;
+}
+
+
+void PlaneGeometry::updateTriangulations(const std::vector<const PlaneGeometry*> & planes) {
+	// Planes with equal 2D polygon and holes get the same 2D triangulation, only the 3D vertexes differ.
+	// So we first collect the distinct inputs, triangulate these and then compose the 3D data of all planes.
+
+	std::vector<const PlaneGeometry*>	genericPlanes;		// planes that need the generic triangulation
+	std::vector<unsigned int>			inputIndexes;		// index of triangulation input for each generic plane
+	std::vector<const PlaneGeometry*>	inputs;				// first plane with the respective input
+	std::map<std::size_t, std::vector<unsigned int> > inputsByHash;
+
+	for (const PlaneGeometry * p : planes) {
+		if (!p->m_dirty)
+			continue;
+		// simple planes are triangulated right away, this is cheap
+		if (!p->m_polygon.isValid() || !p->needsGenericTriangulation()) {
+			p->triangulate();
+			continue;
+		}
+		std::vector<unsigned int> & candidates = inputsByHash[triangulationInputHash(p->m_polygon.polyline(), p->m_holes)];
+		unsigned int inputIdx = 0;
+		for (; inputIdx<candidates.size(); ++inputIdx) {
+			const PlaneGeometry * other = inputs[candidates[inputIdx]];
+			if (!equalPoints(other->m_polygon.polyline().vertexes(), p->m_polygon.polyline().vertexes()) ||
+				other->m_holes.size() != p->m_holes.size())
+				continue;
+			unsigned int i=0;
+			for (; i<p->m_holes.size(); ++i)
+				if (!equalPoints(other->m_holes[i].m_holeGeometry.vertexes(), p->m_holes[i].m_holeGeometry.vertexes()))
+					break;
+			if (i == p->m_holes.size())
+				break;
+		}
+		if (inputIdx == candidates.size()) {
+			candidates.push_back(inputs.size());
+			inputs.push_back(p);
+		}
+		inputIndexes.push_back(candidates[inputIdx]);
+		genericPlanes.push_back(p);
+	}
+
+	std::vector<Triangulation2D> results(inputs.size());
+
+	// triangulate all distinct inputs
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+	for (int i=0; i<(int)inputs.size(); ++i)
+		triangulate2D(inputs[i]->m_polygon.polyline(), inputs[i]->m_holes, results[i]);
+
+	// compose 3D triangulation data of all planes
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+	for (int i=0; i<(int)genericPlanes.size(); ++i)
+		genericPlanes[i]->applyTriangulation(results[inputIndexes[i]]);
+}
+
+
 bool PlaneGeometry::intersectsLine(const IBKMK::Vector3D & p1, const IBKMK::Vector3D & d, IBKMK::Vector3D & intersectionPoint,
 								   double & dist, int & holeIndex, bool hitBackfacingPlanes, bool endlessPlane) const
 {
@@ -147,6 +147,15 @@ public:
 	/*! Returns the triangulation data for each of the holes. */
 	const std::vector<PlaneTriangulationData> & holeTriangulationData() const;
 
+	/*! Updates the triangulation data of all dirty planes in the vector at once.
+		Triangulation of planes with equal 2D polygons and holes (for example, repeated floors or identical
+		windows) is computed only once, and the triangulation runs in parallel when compiled with OpenMP.
+		Each plane may appear only once in the vector.
+		\note Call this function before accessing the triangulation data of many planes, for example after
+			reading a project. Afterwards, the planes must not be modified while other threads access them.
+	*/
+	static void updateTriangulations(const std::vector<const PlaneGeometry*> & planes);
+
 	// Utility functions
 
 	/*! Tests if a line (with equation p = p1 + t * d) hits this plane. Returns true if
@@ -178,6 +187,33 @@ private:
 	*/
 	void triangulate() const;
 
+	/*! Result of the triangulation in the 2D plane coordinate system, independent of the plane's position. */
+	struct Triangulation2D {
+		/*! Points of the holes that are not already vertexes of the outer polygon, their vertex indexes
+			follow the vertexes of the outer polygon.
+		*/
+		std::vector<IBKMK::Vector2D>								m_addedPoints;
+		/*! Triangles of the outer polygon, excluding the valid holes. */
+		std::vector<IBKMK::Triangulation::triangle_t>				m_triangles;
+		/*! Vertex indexes of each hole (index of outer polygon vertex or added point), empty for invalid holes. */
+		std::vector<std::vector<unsigned int> >						m_holeVertexIndexes;
+		/*! Triangles of each hole, referencing the hole's vertexes in m_holeVertexIndexes. */
+		std::vector<std::vector<IBKMK::Triangulation::triangle_t> >	m_holeTriangles;
+	};
+
+	/*! Returns true, if the generic triangulation (triangulate2D()) is needed, i.e. the plane has holes
+		or is neither triangle nor rectangle.
+	*/
+	bool needsGenericTriangulation() const;
+
+	/*! Triangulates the outer polygon with holes in the 2D plane coordinate system.
+		This function only reads its arguments and may be called concurrently.
+	*/
+	static void triangulate2D(const IBKMK::Polygon2D & polyline, const std::vector<Hole> & holes, Triangulation2D & res);
+
+	/*! Composes the triangulation data (3D vertexes) from the 2D triangulation and clears the dirty flag. */
+	void applyTriangulation(const Triangulation2D & res) const;
+
 
 	// *** PRIVATE MEMBER VARIABLES ***
 
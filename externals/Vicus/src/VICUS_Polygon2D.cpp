@@ -38,6 +38,7 @@
 
 #include <VICUS_Constants.h>
 #include <VICUS_KeywordList.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -102,6 +103,21 @@ TiXmlElement * Polygon2D::writeXML(TiXmlElement * parent) const {
 }
 
 
+void Polygon2D::readBinary(std::istream & in) {
+	std::vector<IBKMK::Vector2D> vertexes;
+	NANDRAD::readBinary(in, vertexes);
+	if (vertexes.empty())
+		clear();
+	else
+		setVertexes(vertexes); // also checks the polygon
+}
+
+
+void Polygon2D::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, m_vertexes);
+}
+
+
 // Comparison operator !=
 bool Polygon2D::operator!=(const Polygon2D &other) const {
 	return IBKMK::Polygon2D::operator!=(other);
@@ -27,6 +27,7 @@
 
 #include <VICUS_Constants.h>
 #include <VICUS_KeywordList.h>
+#include <VICUS_BinaryIO.h>
 
 #include <NANDRAD_Utilities.h>
 
@@ -161,6 +162,30 @@ TiXmlElement * Polygon3D::writeXML(TiXmlElement * parent) const {
 }
 
 
+void Polygon3D::readBinary(std::istream & in) {
+	// same data as in XML format: local coordinate system and 2D polyline
+	IBKMK::Vector3D offset, normal, localX;
+	std::vector<IBKMK::Vector2D> verts;
+	NANDRAD::readBinary(in, offset);
+	NANDRAD::readBinary(in, normal);
+	NANDRAD::readBinary(in, localX);
+	NANDRAD::readBinary(in, verts);
+	// Note: a VICUS::Polyon3D _is a_ IBKMK::Polygon3D, so we can cast them into each other
+	if (verts.empty())
+		dynamic_cast<IBKMK::Polygon3D&>(*this) = IBKMK::Polygon3D();
+	else
+		dynamic_cast<IBKMK::Polygon3D&>(*this) = IBKMK::Polygon3D(verts, offset, normal, localX);
+}
+
+
+void Polygon3D::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, offset());
+	NANDRAD::writeBinary(out, normal());
+	NANDRAD::writeBinary(out, localX());
+	NANDRAD::writeBinary(out, polyline().vertexes());
+}
+
+
 // Comparison operator !=
 bool Polygon3D::operator!=(const Polygon3D &other) const {
 	return IBKMK::Polygon3D::operator!=(other);
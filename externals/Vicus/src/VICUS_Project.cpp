@@ -41,12 +41,14 @@
 
 #include <NANDRAD_Utilities.h>
 #include <NANDRAD_Project.h>
+#include <NANDRAD_XMLListReader.h>
 
 #include <tinyxml.h>
 
 #include "VICUS_Constants.h"
 #include "VICUS_utilities.h"
 #include "VICUS_Drawing.h"
+#include "VICUS_BinaryIO.h"
 
 
 #define PI				3.141592653589793238
@@ -54,6 +56,41 @@
 
 namespace VICUS {
 
+/*! File magic of binary project files. */
+static const char * const BINARY_FILE_MAGIC = "VICUSB";
+/*! Version of the hand-written binary project file code, must be increased whenever this code changes
+	(data layout changes of the classes are detected by the generated code).
+*/
+static const unsigned int BINARY_FORMAT_VERSION = 2;
+
+/*! Indexes of list paths read in parallel, see addXMLListPaths(). */
+enum XMLListPath {
+	LP_Rooms,
+	LP_ComponentInstances,
+	LP_SubSurfaceComponentInstances,
+	LP_PlainGeometrySurfaces,
+	LP_Materials,
+	LP_Constructions,
+	LP_Components,
+	LP_SubSurfaceComponents,
+	LP_Schedules
+};
+
+
+/*! Registers the long lists of a VICUS project, in the order of the XMLListPath enumeration. */
+static void addXMLListPaths(NANDRAD::XMLListReader & listReader) {
+	listReader.addListPath("VicusProject/Project/Buildings/Building/BuildingLevels/BuildingLevel/Rooms");
+	listReader.addListPath("VicusProject/Project/ComponentInstances");
+	listReader.addListPath("VicusProject/Project/SubSurfaceComponentInstances");
+	listReader.addListPath("VicusProject/Project/PlainGeometry/Surfaces");
+	listReader.addListPath("VicusProject/Project/EmbeddedDatabase/Materials");
+	listReader.addListPath("VicusProject/Project/EmbeddedDatabase/Constructions");
+	listReader.addListPath("VicusProject/Project/EmbeddedDatabase/Components");
+	listReader.addListPath("VicusProject/Project/EmbeddedDatabase/SubSurfaceComponents");
+	listReader.addListPath("VicusProject/Project/EmbeddedDatabase/Schedules");
+}
+
+
 Project::Project() {
 
 	m_location.initDefaults();
@@ -261,11 +298,14 @@ void Project::readXML(const IBK::Path & filename) {
 	TiXmlDocument doc;
 	IBK::Path filenamePath(filename);
 	std::map<std::string,IBK::Path> pathPlaceHolders; // only dummy for now, filenamePath does not contain placeholders
-	TiXmlElement * xmlElem = NANDRAD::openXMLFile(pathPlaceHolders, filenamePath, "VicusProject", doc); // NOTE: Throws exception in case of error
+	// long lists (rooms, component instances, ...) are cut out and read in parallel
+	NANDRAD::XMLListReader listReader;
+	addXMLListPaths(listReader);
+	TiXmlElement * xmlElem = listReader.openXMLFile(pathPlaceHolders, filenamePath, "VicusProject", doc); // NOTE: Throws exception in case of error
 	if (!xmlElem)
 		return; // empty project, this means we are using only defaults
 
-	readXMLDocument(xmlElem);
+	readXMLDocument(xmlElem, listReader);
 }
 
 
@@ -321,11 +361,13 @@ void Project::readImportedXML(const QString & projectText, IBK::NotificationHand
 
 	notifyer->notify(0.1, "Read imported project");
 	TiXmlDocument doc;
-	TiXmlElement * xmlElem = NANDRAD::openXMLText(projectText.toStdString(), "VicusProject", doc);
+	NANDRAD::XMLListReader listReader;
+	addXMLListPaths(listReader);
+	TiXmlElement * xmlElem = listReader.openXMLText(projectText.toStdString(), "VicusProject", doc);
 	if (!xmlElem)
 		return; // empty project, this means we are using only defaults
 
-	readXMLDocument(xmlElem);
+	readXMLDocument(xmlElem, listReader);
 
 	notifyer->notify(0.3, "Read imported project");
 
@@ -374,7 +416,7 @@ void Project::readImportedXML(const QString & projectText, IBK::NotificationHand
 }
 
 
-void Project::readXMLDocument(TiXmlElement * rootElement) {
+void Project::readXMLDocument(TiXmlElement * rootElement, NANDRAD::XMLListReader & listReader) {
 	FUNCID(Project::readXML);
 
 	// we read our subsections from this handle
@@ -400,54 +442,82 @@ void Project::readXMLDocument(TiXmlElement * rootElement) {
 			readXML(xmlElem);
 		}
 
-		// if we do not have a default grid, create it
-		if (m_viewSettings.m_gridPlanes.empty()) {
-			m_viewSettings.m_gridPlanes.push_back( VICUS::GridPlane(IBKMK::Vector3D(0,0,0), IBKMK::Vector3D(0,0,1),
-																	IBKMK::Vector3D(1,0,0), QColor("white"), 200, 10 ) );
-		}
+		// now read the lists that were cut out of the document, lists are empty in the document so we
+		// can simply append the elements
+		std::vector<std::vector<Room> > rooms;
+		listReader.readElementLists(LP_Rooms, "Room", rooms);
+		for (unsigned int i=0; i<rooms.size(); ++i) {
+			// m_indexes holds the element positions along the path, 3 = Building, 5 = BuildingLevel
+			const std::vector<unsigned int> & indexes = listReader.lists(LP_Rooms)[i].m_indexes;
+			if (indexes.size() < 6 || indexes[3] >= m_buildings.size() || indexes[5] >= m_buildings[indexes[3]].m_buildingLevels.size())
+				throw IBK::Exception("Rooms list outside of a building level.", FUNC_ID);
+			m_buildings[indexes[3]].m_buildingLevels[indexes[5]].m_rooms.swap(rooms[i]);
+		}
+		listReader.readElements(LP_ComponentInstances, "ComponentInstance", m_componentInstances);
+		listReader.readElements(LP_SubSurfaceComponentInstances, "SubSurfaceComponentInstance", m_subSurfaceComponentInstances);
+		listReader.readElements(LP_PlainGeometrySurfaces, "Surface", m_plainGeometry.m_surfaces);
+		listReader.readElements(LP_Materials, "Material", m_embeddedDB.m_materials);
+		listReader.readElements(LP_Constructions, "Construction", m_embeddedDB.m_constructions);
+		listReader.readElements(LP_Components, "Component", m_embeddedDB.m_components);
+		listReader.readElements(LP_SubSurfaceComponents, "SubSurfaceComponent", m_embeddedDB.m_subSurfaceComponents);
+		listReader.readElements(LP_Schedules, "Schedule", m_embeddedDB.m_schedules);
+
+		initAfterReading();
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project from text."), FUNC_ID);
+	}
+
+}
 
-		// update internal pointer-based links and alongside check for data consistency
-		updatePointers();
 
-		// update the colors
-		// if project has invalid colors nothing is drawn ...
-		for (VICUS::Building &b : m_buildings) {
-			for (VICUS::BuildingLevel & bl : b.m_buildingLevels) {
-				for (VICUS::Room &r : bl.m_rooms) {
-					for (VICUS::Surface &s : r.m_surfaces) {
-						if (!s.m_displayColor.isValid())
-							s.initializeColorBasedOnInclination();
-						s.m_color = s.m_displayColor;
-						for (const VICUS::SubSurface &sub : s.subSurfaces()) {
-							const_cast<VICUS::SubSurface &>(sub).updateColor();
-						}
+void Project::initAfterReading() {
+	// if we do not have a default grid, create it
+	if (m_viewSettings.m_gridPlanes.empty()) {
+		m_viewSettings.m_gridPlanes.push_back( VICUS::GridPlane(IBKMK::Vector3D(0,0,0), IBKMK::Vector3D(0,0,1),
+																IBKMK::Vector3D(1,0,0), QColor("white"), 200, 10 ) );
+	}
+
+	// update internal pointer-based links and alongside check for data consistency
+	updatePointers();
+
+	// triangulate all surfaces at once, rather than one by one when the scene is generated
+	updateTriangulations();
+
+	// update the colors
+	// if project has invalid colors nothing is drawn ...
+	for (VICUS::Building &b : m_buildings) {
+		for (VICUS::BuildingLevel & bl : b.m_buildingLevels) {
+			for (VICUS::Room &r : bl.m_rooms) {
+				for (VICUS::Surface &s : r.m_surfaces) {
+					if (!s.m_displayColor.isValid())
+						s.initializeColorBasedOnInclination();
+					s.m_color = s.m_displayColor;
+					for (const VICUS::SubSurface &sub : s.subSurfaces()) {
+						const_cast<VICUS::SubSurface &>(sub).updateColor();
 					}
 				}
 			}
 		}
+	}
 
-		// plain geometry surfaces will be silver
-		for (VICUS::Surface &s : m_plainGeometry.m_surfaces) {
-			if (s.m_color == QColor::Invalid) {
-				s.m_color = QColor("#C0C0C0");
-			}
-		}
-
-		// set default colors for network objects
-		for (VICUS::Network & net : m_geometricNetworks) {
-			// updateColor is a const-function, this is possible since
-			// the m_color property of edges and nodes is mutable
-			net.setDefaultColors();
+	// plain geometry surfaces will be silver
+	for (VICUS::Surface &s : m_plainGeometry.m_surfaces) {
+		if (s.m_color == QColor::Invalid) {
+			s.m_color = QColor("#C0C0C0");
 		}
-
-		// in case there is no active id set, but networks exist, choose the first network as active
-		if (m_activeNetworkId == INVALID_ID && !m_geometricNetworks.empty())
-			m_activeNetworkId = m_geometricNetworks[0].m_id;
 	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, IBK::FormatString("Error reading project from text."), FUNC_ID);
+
+	// set default colors for network objects
+	for (VICUS::Network & net : m_geometricNetworks) {
+		// updateColor is a const-function, this is possible since
+		// the m_color property of edges and nodes is mutable
+		net.setDefaultColors();
 	}
 
+	// in case there is no active id set, but networks exist, choose the first network as active
+	if (m_activeNetworkId == INVALID_ID && !m_geometricNetworks.empty())
+		m_activeNetworkId = m_geometricNetworks[0].m_id;
 }
 
 
@@ -515,6 +585,64 @@ void Project::writeDrawingXML(const IBK::Path & filename) const {
 }
 
 
+bool Project::isBinaryFile(const IBK::Path & filename) {
+	return NANDRAD::isBinaryFile(filename, BINARY_FILE_MAGIC);
+}
+
+
+void Project::readBinary(const IBK::Path & filename) {
+	FUNCID(Project::readBinary);
+
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, filename, std::ios_base::in | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Cannot open project file '%1'.").arg(filename), FUNC_ID);
+
+	try {
+		NANDRAD::readBinaryHeader(in, BINARY_FILE_MAGIC, BINARY_FORMAT_VERSION);
+		NANDRAD::readBinary(in, m_projectInfo);
+
+		// Directory Placeholders - existing placeholders are only overwritten by those in the file
+		std::map<std::string, IBK::Path> placeholders;
+		NANDRAD::readBinary(in, placeholders);
+		for (const std::pair<const std::string, IBK::Path> & p : placeholders)
+			m_placeholders[p.first] = p.second;
+
+		readBinary(in);
+		if (!in)
+			throw IBK::Exception("Unexpected end of file.", FUNC_ID);
+
+		initAfterReading();
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
+	}
+	catch (std::exception & ex2) {
+		throw IBK::Exception(IBK::FormatString("%1\nError reading project '%2'.").arg(ex2.what()).arg(filename), FUNC_ID);
+	}
+}
+
+
+void Project::writeBinary(const IBK::Path & filename) const {
+	FUNCID(Project::writeBinary);
+
+	std::ofstream out;
+	if (!IBK::open_ofstream(out, filename, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Cannot create project file '%1'.").arg(filename), FUNC_ID);
+
+	NANDRAD::writeBinaryHeader(out, BINARY_FILE_MAGIC, BINARY_FORMAT_VERSION);
+	NANDRAD::writeBinary(out, m_projectInfo);
+
+	// the project directory placeholder is never stored in project files
+	std::map<std::string, IBK::Path> placeholders(m_placeholders);
+	placeholders.erase(IBK::PLACEHOLDER_PROJECT_DIR);
+	NANDRAD::writeBinary(out, placeholders);
+
+	writeBinary(out);
+	if (!out)
+		throw IBK::Exception(IBK::FormatString("Error writing project file '%1'.").arg(filename), FUNC_ID);
+}
+
+
 void Project::readDirectoryPlaceholdersXML(const TiXmlElement * element) {
 
 	// loop over all elements in this XML element
@@ -605,6 +733,27 @@ void Project::addChildSurface(const VICUS::Surface &s) {
 }
 
 
+/*! Adds plane geometries of surface and all its child surfaces to vector. */
+static void collectPlaneGeometries(const VICUS::Surface & s, std::vector<const VICUS::PlaneGeometry*> & planes) {
+	planes.push_back(&s.geometry());
+	for (const VICUS::Surface & childSurf : s.childSurfaces())
+		collectPlaneGeometries(childSurf, planes);
+}
+
+
+void Project::updateTriangulations() const {
+	std::vector<const VICUS::PlaneGeometry*> planes;
+	for (const VICUS::Building & b : m_buildings)
+		for (const VICUS::BuildingLevel & bl : b.m_buildingLevels)
+			for (const VICUS::Room & r : bl.m_rooms)
+				for (const VICUS::Surface & s : r.m_surfaces)
+					collectPlaneGeometries(s, planes);
+	for (const VICUS::Surface & s : m_plainGeometry.m_surfaces)
+		collectPlaneGeometries(s, planes);
+	VICUS::PlaneGeometry::updateTriangulations(planes);
+}
+
+
 void Project::updatePointers() {
 	FUNCID(Project::updatePointers);
 
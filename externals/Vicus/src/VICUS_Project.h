@@ -63,6 +63,10 @@ namespace IBK {
 	class NotificationHandler;
 }
 
+namespace NANDRAD {
+	class XMLListReader;
+}
+
 namespace VICUS {
 
 /*! The project data structure for the SIM-VICUS user interface.
@@ -123,8 +127,11 @@ public:
 	*/
 	void readImportedXML(const QString & projectText, IBK::NotificationHandler *notifyer);
 
-	/*! Actual read function, called from both variants of readXML(). */
-	void readXMLDocument(TiXmlElement * rootElement);
+	/*! Actual read function, called from both variants of readXML().
+		\param rootElement Root element of the document with all list elements cut out.
+		\param listReader Reader holding the cut-out lists (see addXMLListPaths()), which are read in parallel.
+	*/
+	void readXMLDocument(TiXmlElement * rootElement, NANDRAD::XMLListReader & listReader);
 
 	/*! Writes the project file to an XML file.
 		\param filename  The full path to the project file.
@@ -138,6 +145,22 @@ public:
 
 	void writeDrawingXML(const IBK::Path & filename) const;
 
+	/*! Checks if the given file is a binary project file (written by writeBinary()). */
+	static bool isBinaryFile(const IBK::Path & filename);
+
+	/*! Reads the project data from a binary project file (usually with extension 'vicusb').
+		Binary project files hold the same data as XML project files (drawings are stored in separate drawing files
+		in both cases), but are read and written much faster. They are meant for autosave files and temporary copies,
+		not as archive format: reading fails, if the file was written with another version of the data model.
+		\param filename  The full path to the project file.
+	*/
+	void readBinary(const IBK::Path & filename);
+
+	/*! Writes the project data to a binary project file.
+		\param filename  The full path to the project file.
+	*/
+	void writeBinary(const IBK::Path & filename) const;
+
 	/*! Reads the placeholder section into m_placeholders map. */
 	void readDirectoryPlaceholdersXML(const TiXmlElement * element);
 
@@ -156,6 +179,12 @@ public:
 	/*! Adds child surfaces to pointers of project. */
 	void addChildSurface(const VICUS::Surface &s);
 
+	/*! Triangulates all surfaces of the project (room surfaces with their child surfaces and plain geometry)
+		in a single parallel pass, see PlaneGeometry::updateTriangulations().
+		Called after reading a project, so that the surfaces are not triangulated one by one on first access.
+	*/
+	void updateTriangulations() const;
+
 	/*! Searches through all objects and determines the largest object ID (not unique ID!) used for buildings, buildingLevels, rooms, surface,
 		subsurfaces, networks, etc and returns the next ID to be used for new data elements. For example, if IDs 10, 11, 14 have been used already,
 		the function returns 15.
@@ -400,6 +429,11 @@ public:
 
 
 private:
+	/*! Updates pointers, triangulations and colors and adds defaults after the project has been read
+		(from XML or binary file).
+	*/
+	void initAfterReading();
+
 	// Functions below are implemented in VICUS_ProjectGenerator.cpp
 
 	void generateBuildingProjectData(const QString &modelName,
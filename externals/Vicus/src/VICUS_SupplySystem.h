@@ -80,6 +80,8 @@ public:
 
 	void readXML(const TiXmlElement * element) override;
 	TiXmlElement * writeXML(TiXmlElement * parent) const override;
+	void readBinary(std::istream & in);
+	void writeBinary(std::ostream & out) const;
 
 	VICUS_COMPARE_WITH_ID
 
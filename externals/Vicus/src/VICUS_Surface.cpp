@@ -84,27 +84,8 @@ void Surface::readXML(const TiXmlElement * element) {
 	}
 
 	readXMLPrivate(element);
-	// copy polygon to plane geometry
-	std::vector<PlaneGeometry::Hole> holes;
-	for(const SubSurface & s : m_subSurfaces)
-		holes.push_back(PlaneGeometry::Hole(s.m_id, s.m_polygon2D, false));
-
-	for(const Surface & s : m_childSurfaces) {
-		const IBKMK::Vector3D &offset = poly3D.offset();
-		const IBKMK::Vector3D &localX = poly3D.localX();
-		const IBKMK::Vector3D &localY = poly3D.localY();
-
-		const std::vector<IBKMK::Vector3D> &vertexes = s.polygon3D().vertexes();
-		std::vector<IBKMK::Vector2D> holePoints(vertexes.size());
-
-		for(unsigned int j=0; j<vertexes.size(); ++j) {
-			IBKMK::planeCoordinates(offset, localX, localY, vertexes[j], holePoints[j].m_x, holePoints[j].m_y);
-		}
-
-		holes.push_back(PlaneGeometry::Hole(s.m_id, holePoints, true) );
-	}
 	// if we didn't get a Polygon3D element, the next call will throw an exception
-	m_geometry.setGeometry( poly3D, holes);
+	setGeometry(poly3D);
 }
 
 
@@ -126,6 +107,21 @@ TiXmlElement * Surface::writeXML(TiXmlElement * parent) const {
 }
 
 
+void Surface::readBinary(std::istream & in) {
+	// polygon is written first, same as in XML
+	VICUS::Polygon3D poly3D;
+	poly3D.readBinary(in);
+	readBinaryPrivate(in);
+	setGeometry(poly3D);
+}
+
+
+void Surface::writeBinary(std::ostream & out) const {
+	m_geometry.polygon3D().writeBinary(out);
+	writeBinaryPrivate(out);
+}
+
+
 void Surface::setPolygon3D(const IBKMK::Polygon3D & polygon) {
 	m_geometry.setPolygon((VICUS::Polygon3D)polygon);
 }
@@ -176,5 +172,28 @@ double Surface::areaWithoutSubsurfaces() const {
 }
 
 
+void Surface::setGeometry(const Polygon3D & poly3D) {
+	// copy polygon to plane geometry
+	std::vector<PlaneGeometry::Hole> holes;
+	for(const SubSurface & s : m_subSurfaces)
+		holes.push_back(PlaneGeometry::Hole(s.m_id, s.m_polygon2D, false));
+
+	for(const Surface & s : m_childSurfaces) {
+		const IBKMK::Vector3D &offset = poly3D.offset();
+		const IBKMK::Vector3D &localX = poly3D.localX();
+		const IBKMK::Vector3D &localY = poly3D.localY();
+
+		const std::vector<IBKMK::Vector3D> &vertexes = s.polygon3D().vertexes();
+		std::vector<IBKMK::Vector2D> holePoints(vertexes.size());
+
+		for(unsigned int j=0; j<vertexes.size(); ++j) {
+			IBKMK::planeCoordinates(offset, localX, localY, vertexes[j], holePoints[j].m_x, holePoints[j].m_y);
+		}
+
+		holes.push_back(PlaneGeometry::Hole(s.m_id, holePoints, true) );
+	}
+	m_geometry.setGeometry( poly3D, holes);
+}
+
 
 } // namespace VICUS
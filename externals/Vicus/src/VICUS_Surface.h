@@ -119,6 +119,11 @@ public:
 	NANDRAD::IDVectorMap<double>		m_viewFactors;				// XML:E
 
 private:
+	/*! Sets the polygon and the holes of subsurfaces and child surfaces in the geometry object.
+		Called after reading, throws an exception if the polygon is invalid.
+	*/
+	void setGeometry(const Polygon3D & poly3D);
+
 	/*! Subsurfaces of the surface. */
 	std::vector<SubSurface>				m_subSurfaces;				// XML:E
 
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -113,4 +114,20 @@ TiXmlElement * AcousticBoundaryCondition::writeXML(TiXmlElement * parent) const
 	return e;
 }
 
+void AcousticBoundaryCondition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x0b11d53du, "AcousticBoundaryCondition");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_acousticSoundAbsorptionPartitions);
+}
+
+void AcousticBoundaryCondition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x0b11d53du);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_acousticSoundAbsorptionPartitions);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -99,4 +100,20 @@ TiXmlElement * AcousticBuildingTemplate::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void AcousticBuildingTemplate::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x7a5618f7u, "AcousticBuildingTemplate");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_buildingType, NUM_ABT);
+	NANDRAD::readBinary(in, m_idsSoundProtectionTemplate);
+}
+
+void AcousticBuildingTemplate::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x7a5618f7u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_buildingType);
+	NANDRAD::writeBinary(out, m_idsSoundProtectionTemplate);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -125,4 +126,26 @@ TiXmlElement * AcousticComponent::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void AcousticComponent::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa149f3f6u, "AcousticComponent");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_impactSoundValue);
+	NANDRAD::readBinary(in, m_airSoundResistenceValue);
+	NANDRAD::readBinaryEnum(in, m_sizeMethod, NUM_SM);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void AcousticComponent::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa149f3f6u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_impactSoundValue);
+	NANDRAD::writeBinary(out, m_airSoundResistenceValue);
+	NANDRAD::writeBinary(out, m_sizeMethod);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -136,4 +137,36 @@ TiXmlElement * AcousticReferenceComponent::writeXML(TiXmlElement * parent) const
 	return e;
 }
 
+void AcousticReferenceComponent::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x03bba61cu, "AcousticReferenceComponent");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_buildingType);
+	NANDRAD::readBinaryEnum(in, m_requirementType, NUM_RT);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_CT);
+	NANDRAD::readBinary(in, m_impactSoundOneStructureUnit);
+	NANDRAD::readBinary(in, m_impactSoundDifferentStructureUnit);
+	NANDRAD::readBinary(in, m_airborneSoundOneStructureUnit);
+	NANDRAD::readBinary(in, m_airborneSoundDifferentStructureUnit);
+	NANDRAD::readBinary(in, m_idAcousticTemplateA);
+	NANDRAD::readBinary(in, m_idAcousticTemplateB);
+}
+
+void AcousticReferenceComponent::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x03bba61cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_buildingType);
+	NANDRAD::writeBinary(out, m_requirementType);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_impactSoundOneStructureUnit);
+	NANDRAD::writeBinary(out, m_impactSoundDifferentStructureUnit);
+	NANDRAD::writeBinary(out, m_airborneSoundOneStructureUnit);
+	NANDRAD::writeBinary(out, m_airborneSoundDifferentStructureUnit);
+	NANDRAD::writeBinary(out, m_idAcousticTemplateA);
+	NANDRAD::writeBinary(out, m_idAcousticTemplateB);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -75,4 +76,16 @@ TiXmlElement * AcousticSoundAbsorption::writeXMLPrivate(TiXmlElement * parent) c
 	return e;
 }
 
+void AcousticSoundAbsorption::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x6ea42f66u, "AcousticSoundAbsorption");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+}
+
+void AcousticSoundAbsorption::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x6ea42f66u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -99,4 +100,16 @@ TiXmlElement * AcousticSoundAbsorptionPartition::writeXML(TiXmlElement * parent)
 	return e;
 }
 
+void AcousticSoundAbsorptionPartition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x905bd86fu, "AcousticSoundAbsorptionPartition");
+	NANDRAD::readBinary(in, m_idSoundAbsorption);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void AcousticSoundAbsorptionPartition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x905bd86fu);
+	NANDRAD::writeBinary(out, m_idSoundAbsorption);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -107,4 +108,24 @@ TiXmlElement * AcousticSoundProtectionTemplate::writeXML(TiXmlElement * parent)
 	return e;
 }
 
+void AcousticSoundProtectionTemplate::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xc1cb01e8u, "AcousticSoundProtectionTemplate");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_note);
+	NANDRAD::readBinaryEnum(in, m_buildingType, NUM_ABT);
+	NANDRAD::readBinary(in, m_idsTemplate);
+}
+
+void AcousticSoundProtectionTemplate::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xc1cb01e8u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_note);
+	NANDRAD::writeBinary(out, m_buildingType);
+	NANDRAD::writeBinary(out, m_idsTemplate);
+}
+
 } // namespace VICUS
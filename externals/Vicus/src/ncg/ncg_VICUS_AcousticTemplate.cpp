@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -121,4 +122,28 @@ TiXmlElement * AcousticTemplate::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void AcousticTemplate::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xc9ff87e0u, "AcousticTemplate");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_note);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_evaluationOffset);
+	NANDRAD::readBinary(in, m_evaluationFactor);
+	NANDRAD::readBinary(in, m_splinePara);
+}
+
+void AcousticTemplate::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xc9ff87e0u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_note);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_evaluationOffset);
+	NANDRAD::writeBinary(out, m_evaluationFactor);
+	NANDRAD::writeBinary(out, m_splinePara);
+}
+
 } // namespace VICUS
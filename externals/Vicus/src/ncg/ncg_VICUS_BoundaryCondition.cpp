@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -109,4 +110,28 @@ TiXmlElement * BoundaryCondition::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void BoundaryCondition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x86cdc384u, "BoundaryCondition");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_heatConduction);
+	NANDRAD::readBinary(in, m_solarAbsorption);
+	NANDRAD::readBinary(in, m_longWaveEmission);
+	NANDRAD::readBinary(in, m_vaporDiffusion);
+	NANDRAD::readBinary(in, m_airFlow);
+}
+
+void BoundaryCondition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x86cdc384u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_heatConduction);
+	NANDRAD::writeBinary(out, m_solarAbsorption);
+	NANDRAD::writeBinary(out, m_longWaveEmission);
+	NANDRAD::writeBinary(out, m_vaporDiffusion);
+	NANDRAD::writeBinary(out, m_airFlow);
+}
+
 } // namespace VICUS
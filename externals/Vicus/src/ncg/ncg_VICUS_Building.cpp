@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -117,4 +118,22 @@ TiXmlElement * Building::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Building::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8fbb717cu, "Building");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_ifcGUID);
+	NANDRAD::readBinary(in, m_buildingLevels);
+}
+
+void Building::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8fbb717cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_ifcGUID);
+	NANDRAD::writeBinary(out, m_buildingLevels);
+}
+
 } // namespace VICUS
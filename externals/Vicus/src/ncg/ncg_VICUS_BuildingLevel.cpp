@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -123,4 +124,26 @@ TiXmlElement * BuildingLevel::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void BuildingLevel::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xcba587d0u, "BuildingLevel");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_ifcGUID);
+	NANDRAD::readBinary(in, m_elevation);
+	NANDRAD::readBinary(in, m_height);
+	NANDRAD::readBinary(in, m_rooms);
+}
+
+void BuildingLevel::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xcba587d0u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_ifcGUID);
+	NANDRAD::writeBinary(out, m_elevation);
+	NANDRAD::writeBinary(out, m_height);
+	NANDRAD::writeBinary(out, m_rooms);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -146,4 +147,40 @@ TiXmlElement * Component::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Component::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8871ebd1u, "Component");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_manufacturer);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_CT);
+	NANDRAD::readBinary(in, m_idConstruction);
+	NANDRAD::readBinary(in, m_idSideABoundaryCondition);
+	NANDRAD::readBinary(in, m_idSideBBoundaryCondition);
+	NANDRAD::readBinary(in, m_idSideAAcousticBoundaryCondition);
+	NANDRAD::readBinary(in, m_idSideBAcousticBoundaryCondition);
+	NANDRAD::readBinary(in, m_idSurfaceProperty);
+	NANDRAD::readBinary(in, m_activeLayerIndex);
+}
+
+void Component::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8871ebd1u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_manufacturer);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_idConstruction);
+	NANDRAD::writeBinary(out, m_idSideABoundaryCondition);
+	NANDRAD::writeBinary(out, m_idSideBBoundaryCondition);
+	NANDRAD::writeBinary(out, m_idSideAAcousticBoundaryCondition);
+	NANDRAD::writeBinary(out, m_idSideBAcousticBoundaryCondition);
+	NANDRAD::writeBinary(out, m_idSurfaceProperty);
+	NANDRAD::writeBinary(out, m_activeLayerIndex);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -105,4 +106,26 @@ TiXmlElement * ComponentInstance::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ComponentInstance::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa9486982u, "ComponentInstance");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_idComponent);
+	NANDRAD::readBinary(in, m_idSideASurface);
+	NANDRAD::readBinary(in, m_idSideBSurface);
+	NANDRAD::readBinary(in, m_idSurfaceHeating);
+	NANDRAD::readBinary(in, m_idSurfaceHeatingControlZone);
+	NANDRAD::readBinary(in, m_idSupplySystem);
+}
+
+void ComponentInstance::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa9486982u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_idComponent);
+	NANDRAD::writeBinary(out, m_idSideASurface);
+	NANDRAD::writeBinary(out, m_idSideBSurface);
+	NANDRAD::writeBinary(out, m_idSurfaceHeating);
+	NANDRAD::writeBinary(out, m_idSurfaceHeatingControlZone);
+	NANDRAD::writeBinary(out, m_idSupplySystem);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -173,4 +174,30 @@ TiXmlElement * Construction::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Construction::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x2db66961u, "Construction");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinaryEnum(in, m_usageType, NUM_UT);
+	NANDRAD::readBinaryEnum(in, m_insulationKind, NUM_IK);
+	NANDRAD::readBinaryEnum(in, m_materialKind, NUM_MK);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_acousticPara);
+	NANDRAD::readBinary(in, m_materialLayers);
+}
+
+void Construction::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x2db66961u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_usageType);
+	NANDRAD::writeBinary(out, m_insulationKind);
+	NANDRAD::writeBinary(out, m_materialKind);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_acousticPara);
+	NANDRAD::writeBinary(out, m_materialLayers);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -71,4 +72,18 @@ TiXmlElement * DailyCycle::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void DailyCycle::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xe5b6fed1u, "DailyCycle");
+	NANDRAD::readBinary(in, m_dayTypes);
+	NANDRAD::readBinary(in, m_timePoints);
+	NANDRAD::readBinary(in, m_values);
+}
+
+void DailyCycle::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xe5b6fed1u);
+	NANDRAD::writeBinary(out, m_dayTypes);
+	NANDRAD::writeBinary(out, m_timePoints);
+	NANDRAD::writeBinary(out, m_values);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -90,4 +91,24 @@ TiXmlElement * DrawingLayer::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void DrawingLayer::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x5fcb6baau, "DrawingLayer");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_lineWeight);
+	NANDRAD::readBinary(in, m_idBlock);
+}
+
+void DrawingLayer::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x5fcb6baau);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_lineWeight);
+	NANDRAD::writeBinary(out, m_idBlock);
+}
+
 } // namespace VICUS
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -685,4 +686,64 @@ TiXmlElement * EmbeddedDatabase::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void EmbeddedDatabase::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x027239e1u, "EmbeddedDatabase");
+	NANDRAD::readBinary(in, m_materials);
+	NANDRAD::readBinary(in, m_constructions);
+	NANDRAD::readBinary(in, m_windows);
+	NANDRAD::readBinary(in, m_windowGlazingSystems);
+	NANDRAD::readBinary(in, m_acousticBoundaryConditions);
+	NANDRAD::readBinary(in, m_acousticSoundAbsorptions);
+	NANDRAD::readBinary(in, m_boundaryConditions);
+	NANDRAD::readBinary(in, m_components);
+	NANDRAD::readBinary(in, m_subSurfaceComponents);
+	NANDRAD::readBinary(in, m_surfaceHeatings);
+	NANDRAD::readBinary(in, m_supplySystems);
+	NANDRAD::readBinary(in, m_pipes);
+	NANDRAD::readBinary(in, m_fluids);
+	NANDRAD::readBinary(in, m_networkComponents);
+	NANDRAD::readBinary(in, m_networkControllers);
+	NANDRAD::readBinary(in, m_subNetworks);
+	NANDRAD::readBinary(in, m_EPDDatasets);
+	NANDRAD::readBinary(in, m_schedules);
+	NANDRAD::readBinary(in, m_internalLoads);
+	NANDRAD::readBinary(in, m_zoneControlThermostats);
+	NANDRAD::readBinary(in, m_zoneControlShading);
+	NANDRAD::readBinary(in, m_zoneIdealHeatingCooling);
+	NANDRAD::readBinary(in, m_zoneControlVentilationNatural);
+	NANDRAD::readBinary(in, m_ventilationNatural);
+	NANDRAD::readBinary(in, m_infiltration);
+	NANDRAD::readBinary(in, m_zoneTemplates);
+}
+
+void EmbeddedDatabase::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x027239e1u);
+	NANDRAD::writeBinary(out, m_materials);
+	NANDRAD::writeBinary(out, m_constructions);
+	NANDRAD::writeBinary(out, m_windows);
+	NANDRAD::writeBinary(out, m_windowGlazingSystems);
+	NANDRAD::writeBinary(out, m_acousticBoundaryConditions);
+	NANDRAD::writeBinary(out, m_acousticSoundAbsorptions);
+	NANDRAD::writeBinary(out, m_boundaryConditions);
+	NANDRAD::writeBinary(out, m_components);
+	NANDRAD::writeBinary(out, m_subSurfaceComponents);
+	NANDRAD::writeBinary(out, m_surfaceHeatings);
+	NANDRAD::writeBinary(out, m_supplySystems);
+	NANDRAD::writeBinary(out, m_pipes);
+	NANDRAD::writeBinary(out, m_fluids);
+	NANDRAD::writeBinary(out, m_networkComponents);
+	NANDRAD::writeBinary(out, m_networkControllers);
+	NANDRAD::writeBinary(out, m_subNetworks);
+	NANDRAD::writeBinary(out, m_EPDDatasets);
+	NANDRAD::writeBinary(out, m_schedules);
+	NANDRAD::writeBinary(out, m_internalLoads);
+	NANDRAD::writeBinary(out, m_zoneControlThermostats);
+	NANDRAD::writeBinary(out, m_zoneControlShading);
+	NANDRAD::writeBinary(out, m_zoneIdealHeatingCooling);
+	NANDRAD::writeBinary(out, m_zoneControlVentilationNatural);
+	NANDRAD::writeBinary(out, m_ventilationNatural);
+	NANDRAD::writeBinary(out, m_infiltration);
+	NANDRAD::writeBinary(out, m_zoneTemplates);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -169,4 +170,40 @@ TiXmlElement * EpdDataset::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void EpdDataset::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb3b61df6u, "EpdDataset");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_uuid);
+	NANDRAD::readBinary(in, m_category);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_manufacturer);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_expireYear);
+	NANDRAD::readBinary(in, m_referenceUnit);
+	NANDRAD::readBinary(in, m_referenceQuantity);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_T);
+	NANDRAD::readBinary(in, m_modules);
+	NANDRAD::readBinary(in, m_epdModuleDataset);
+}
+
+void EpdDataset::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb3b61df6u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_uuid);
+	NANDRAD::writeBinary(out, m_category);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_manufacturer);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_expireYear);
+	NANDRAD::writeBinary(out, m_referenceUnit);
+	NANDRAD::writeBinary(out, m_referenceQuantity);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_modules);
+	NANDRAD::writeBinary(out, m_epdModuleDataset);
+}
+
 } // namespace VICUS
@@ -28,6 +28,7 @@
 #include <VICUS_Constants.h>
 #include <IBKMK_Vector3D.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -122,4 +123,30 @@ TiXmlElement * GridPlane::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void GridPlane::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x3ae763b2u, "GridPlane");
+	NANDRAD::readBinary(in, m_name);
+	NANDRAD::readBinary(in, m_isVisible);
+	NANDRAD::readBinary(in, m_isActive);
+	NANDRAD::readBinary(in, m_offset);
+	NANDRAD::readBinary(in, m_normal);
+	NANDRAD::readBinary(in, m_localX);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_width);
+	NANDRAD::readBinary(in, m_spacing);
+}
+
+void GridPlane::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x3ae763b2u);
+	NANDRAD::writeBinary(out, m_name);
+	NANDRAD::writeBinary(out, m_isVisible);
+	NANDRAD::writeBinary(out, m_isActive);
+	NANDRAD::writeBinary(out, m_offset);
+	NANDRAD::writeBinary(out, m_normal);
+	NANDRAD::writeBinary(out, m_localX);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_width);
+	NANDRAD::writeBinary(out, m_spacing);
+}
+
 } // namespace VICUS
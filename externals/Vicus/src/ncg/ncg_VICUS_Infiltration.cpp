@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -121,4 +122,22 @@ TiXmlElement * Infiltration::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Infiltration::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x39a25e30u, "Infiltration");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_airChangeType, NUM_AC);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void Infiltration::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x39a25e30u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_airChangeType);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
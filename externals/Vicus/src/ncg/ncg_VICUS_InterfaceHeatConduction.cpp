@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -122,4 +123,20 @@ TiXmlElement * InterfaceHeatConduction::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void InterfaceHeatConduction::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xd5ff576au, "InterfaceHeatConduction");
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinaryEnum(in, m_otherZoneType, NUM_OZ);
+	NANDRAD::readBinary(in, m_idSchedule);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void InterfaceHeatConduction::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xd5ff576au);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_otherZoneType);
+	NANDRAD::writeBinary(out, m_idSchedule);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
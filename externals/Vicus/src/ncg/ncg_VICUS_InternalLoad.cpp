@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -168,4 +169,36 @@ TiXmlElement * InternalLoad::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void InternalLoad::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x50ca10a6u, "InternalLoad");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_category, NUM_MC);
+	NANDRAD::readBinaryEnum(in, m_personCountMethod, NUM_PCM);
+	NANDRAD::readBinaryEnum(in, m_powerMethod, NUM_PM);
+	NANDRAD::readBinary(in, m_idOccupancySchedule);
+	NANDRAD::readBinary(in, m_idActivitySchedule);
+	NANDRAD::readBinary(in, m_idMoistureProductionRatePerAreaSchedule);
+	NANDRAD::readBinary(in, m_idPowerManagementSchedule);
+	NANDRAD::readBinary(in, m_activateCO2Production);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void InternalLoad::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x50ca10a6u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_category);
+	NANDRAD::writeBinary(out, m_personCountMethod);
+	NANDRAD::writeBinary(out, m_powerMethod);
+	NANDRAD::writeBinary(out, m_idOccupancySchedule);
+	NANDRAD::writeBinary(out, m_idActivitySchedule);
+	NANDRAD::writeBinary(out, m_idMoistureProductionRatePerAreaSchedule);
+	NANDRAD::writeBinary(out, m_idPowerManagementSchedule);
+	NANDRAD::writeBinary(out, m_activateCO2Production);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
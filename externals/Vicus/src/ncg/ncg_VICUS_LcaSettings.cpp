@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -138,4 +139,22 @@ TiXmlElement * LcaSettings::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void LcaSettings::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x22e55d52u, "LcaSettings");
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_flags);
+	NANDRAD::readBinaryEnum(in, m_calculationMode, NUM_CM);
+	NANDRAD::readBinaryEnum(in, m_certificationSystem, NUM_CS);
+	NANDRAD::readBinary(in, m_idUsage);
+}
+
+void LcaSettings::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x22e55d52u);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_flags);
+	NANDRAD::writeBinary(out, m_calculationMode);
+	NANDRAD::writeBinary(out, m_certificationSystem);
+	NANDRAD::writeBinary(out, m_idUsage);
+}
+
 } // namespace VICUS
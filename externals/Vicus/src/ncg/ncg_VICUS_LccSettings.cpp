@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -99,4 +100,16 @@ TiXmlElement * LccSettings::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void LccSettings::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x35849c94u, "LccSettings");
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_intPara);
+}
+
+void LccSettings::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x35849c94u);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_intPara);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -141,4 +142,30 @@ TiXmlElement * Material::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Material::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xdcac9dbbu, "Material");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_manufacturer);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinaryEnum(in, m_category, NUM_MC);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_epdCategorySet);
+}
+
+void Material::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xdcac9dbbu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_manufacturer);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_category);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_epdCategorySet);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -113,4 +114,18 @@ TiXmlElement * MaterialLayer::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void MaterialLayer::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1f69a890u, "MaterialLayer");
+	NANDRAD::readBinary(in, m_idMaterial);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_cost);
+}
+
+void MaterialLayer::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1f69a890u);
+	NANDRAD::writeBinary(out, m_idMaterial);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_cost);
+}
+
 } // namespace VICUS
@@ -28,6 +28,7 @@
 #include <VICUS_Constants.h>
 #include <IBKMK_Vector3D.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -234,4 +235,46 @@ TiXmlElement * Network::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Network::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x70f77c4cu, "Network");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_idFluid);
+	NANDRAD::readBinary(in, m_nodes);
+	NANDRAD::readBinary(in, m_edges);
+	NANDRAD::readBinary(in, m_availablePipes);
+	NANDRAD::readBinary(in, m_origin);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_NET);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_scaleNodes);
+	NANDRAD::readBinary(in, m_scaleEdges);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_hasHeatExchangeWithGround);
+	NANDRAD::readBinary(in, m_buriedPipeProperties);
+	NANDRAD::readBinaryEnum(in, m_pipeModel, NUM_PM);
+	NANDRAD::readBinary(in, m_simultaneity);
+}
+
+void Network::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x70f77c4cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_idFluid);
+	NANDRAD::writeBinary(out, m_nodes);
+	NANDRAD::writeBinary(out, m_edges);
+	NANDRAD::writeBinary(out, m_availablePipes);
+	NANDRAD::writeBinary(out, m_origin);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_scaleNodes);
+	NANDRAD::writeBinary(out, m_scaleEdges);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_hasHeatExchangeWithGround);
+	NANDRAD::writeBinary(out, m_buriedPipeProperties);
+	NANDRAD::writeBinary(out, m_pipeModel);
+	NANDRAD::writeBinary(out, m_simultaneity);
+}
+
 } // namespace VICUS
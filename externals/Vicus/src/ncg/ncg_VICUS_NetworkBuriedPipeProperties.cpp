@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -98,4 +99,18 @@ TiXmlElement * NetworkBuriedPipeProperties::writeXML(TiXmlElement * parent) cons
 	return e;
 }
 
+void NetworkBuriedPipeProperties::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xc2d3afafu, "NetworkBuriedPipeProperties");
+	NANDRAD::readBinaryEnum(in, m_soilType, NUM_ST);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_numberOfSoilModels);
+}
+
+void NetworkBuriedPipeProperties::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xc2d3afafu);
+	NANDRAD::writeBinary(out, m_soilType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_numberOfSoilModels);
+}
+
 } // namespace VICUS
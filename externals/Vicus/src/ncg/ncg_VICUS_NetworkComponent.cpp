@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -164,4 +165,36 @@ TiXmlElement * NetworkComponent::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkComponent::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa70e1208u, "NetworkComponent");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_manufacturer);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_scheduleIds);
+	NANDRAD::readBinary(in, m_intPara);
+	NANDRAD::readBinary(in, m_pipePropertiesId);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_polynomCoefficients);
+}
+
+void NetworkComponent::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa70e1208u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_manufacturer);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_scheduleIds);
+	NANDRAD::writeBinary(out, m_intPara);
+	NANDRAD::writeBinary(out, m_pipePropertiesId);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_polynomCoefficients);
+}
+
 } // namespace VICUS
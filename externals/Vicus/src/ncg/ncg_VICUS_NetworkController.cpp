@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -164,4 +165,30 @@ TiXmlElement * NetworkController::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkController::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x7b9ace0cu, "NetworkController");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinaryEnum(in, m_controllerType, NUM_CT);
+	NANDRAD::readBinaryEnum(in, m_controlledProperty, NUM_CP);
+	NANDRAD::readBinary(in, m_idReferences);
+	NANDRAD::readBinary(in, m_maximumControllerResultValue);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void NetworkController::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x7b9ace0cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_controllerType);
+	NANDRAD::writeBinary(out, m_controlledProperty);
+	NANDRAD::writeBinary(out, m_idReferences);
+	NANDRAD::writeBinary(out, m_maximumControllerResultValue);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -111,4 +112,28 @@ TiXmlElement * NetworkEdge::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkEdge::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x4ad923b9u, "NetworkEdge");
+	NANDRAD::readBinary(in, m_supply);
+	NANDRAD::readBinary(in, m_idPipe);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_heatExchange);
+	NANDRAD::readBinary(in, m_idNode1);
+	NANDRAD::readBinary(in, m_idNode2);
+	NANDRAD::readBinary(in, m_length);
+}
+
+void NetworkEdge::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x4ad923b9u);
+	NANDRAD::writeBinary(out, m_supply);
+	NANDRAD::writeBinary(out, m_idPipe);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_heatExchange);
+	NANDRAD::writeBinary(out, m_idNode1);
+	NANDRAD::writeBinary(out, m_idNode2);
+	NANDRAD::writeBinary(out, m_length);
+}
+
 } // namespace VICUS
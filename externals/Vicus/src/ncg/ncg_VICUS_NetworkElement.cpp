@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -99,4 +100,24 @@ TiXmlElement * NetworkElement::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkElement::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x6e5371ddu, "NetworkElement");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_inletNodeId);
+	NANDRAD::readBinary(in, m_outletNodeId);
+	NANDRAD::readBinary(in, m_componentId);
+	NANDRAD::readBinary(in, m_controlElementId);
+	NANDRAD::readBinary(in, m_displayName);
+}
+
+void NetworkElement::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x6e5371ddu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_inletNodeId);
+	NANDRAD::writeBinary(out, m_outletNodeId);
+	NANDRAD::writeBinary(out, m_componentId);
+	NANDRAD::writeBinary(out, m_controlElementId);
+	NANDRAD::writeBinary(out, m_displayName);
+}
+
 } // namespace VICUS
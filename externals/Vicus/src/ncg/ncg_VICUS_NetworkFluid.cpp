@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -122,4 +123,22 @@ TiXmlElement * NetworkFluid::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkFluid::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x1d50b74cu, "NetworkFluid");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_kinematicViscosity);
+}
+
+void NetworkFluid::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x1d50b74cu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_kinematicViscosity);
+}
+
 } // namespace VICUS
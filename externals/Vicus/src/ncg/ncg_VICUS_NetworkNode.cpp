@@ -28,6 +28,7 @@
 #include <VICUS_Constants.h>
 #include <IBKMK_Vector3D.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -142,4 +143,28 @@ TiXmlElement * NetworkNode::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkNode::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xe6d92ceau, "NetworkNode");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_position);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_NT);
+	NANDRAD::readBinary(in, m_maxHeatingDemand);
+	NANDRAD::readBinary(in, m_idSubNetwork);
+	NANDRAD::readBinary(in, m_heatExchange);
+}
+
+void NetworkNode::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xe6d92ceau);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_position);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_maxHeatingDemand);
+	NANDRAD::writeBinary(out, m_idSubNetwork);
+	NANDRAD::writeBinary(out, m_heatExchange);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -112,4 +113,22 @@ TiXmlElement * NetworkPipe::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void NetworkPipe::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xdee2f3ccu, "NetworkPipe");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_categoryName);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void NetworkPipe::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xdee2f3ccu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_categoryName);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
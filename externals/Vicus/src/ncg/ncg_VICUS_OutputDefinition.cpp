@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -120,4 +121,24 @@ TiXmlElement * OutputDefinition::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void OutputDefinition::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8a668442u, "OutputDefinition");
+	NANDRAD::readBinary(in, m_quantity);
+	NANDRAD::readBinaryEnum(in, m_timeType, NUM_OTT);
+	NANDRAD::readBinary(in, m_sourceObjectType);
+	NANDRAD::readBinary(in, m_sourceObjectIds);
+	NANDRAD::readBinary(in, m_vectorIdMap);
+	NANDRAD::readBinary(in, m_gridName);
+}
+
+void OutputDefinition::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8a668442u);
+	NANDRAD::writeBinary(out, m_quantity);
+	NANDRAD::writeBinary(out, m_timeType);
+	NANDRAD::writeBinary(out, m_sourceObjectType);
+	NANDRAD::writeBinary(out, m_sourceObjectIds);
+	NANDRAD::writeBinary(out, m_vectorIdMap);
+	NANDRAD::writeBinary(out, m_gridName);
+}
+
 } // namespace VICUS
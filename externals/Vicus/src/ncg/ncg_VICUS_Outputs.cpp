@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -146,4 +147,22 @@ TiXmlElement * Outputs::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Outputs::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xdc133624u, "Outputs");
+	NANDRAD::readBinary(in, m_definitions);
+	NANDRAD::readBinary(in, m_grids);
+	NANDRAD::readBinary(in, m_checkSum);
+	NANDRAD::readBinary(in, m_timeUnit);
+	NANDRAD::readBinary(in, m_flags);
+}
+
+void Outputs::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xdc133624u);
+	NANDRAD::writeBinary(out, m_definitions);
+	NANDRAD::writeBinary(out, m_grids);
+	NANDRAD::writeBinary(out, m_checkSum);
+	NANDRAD::writeBinary(out, m_timeUnit);
+	NANDRAD::writeBinary(out, m_flags);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -100,4 +101,16 @@ TiXmlElement * PlainGeometry::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void PlainGeometry::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xa816534au, "PlainGeometry");
+	NANDRAD::readBinary(in, m_surfaces);
+	NANDRAD::readBinary(in, m_visible);
+}
+
+void PlainGeometry::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xa816534au);
+	NANDRAD::writeBinary(out, m_surfaces);
+	NANDRAD::writeBinary(out, m_visible);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -234,4 +235,48 @@ TiXmlElement * Project::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Project::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x523ef73au, "Project");
+	NANDRAD::readBinary(in, m_solverParameter);
+	NANDRAD::readBinary(in, m_simulationParameter);
+	NANDRAD::readBinary(in, m_location);
+	NANDRAD::readBinary(in, m_outputs);
+	NANDRAD::readBinary(in, m_viewSettings);
+	NANDRAD::readBinary(in, m_lcaSettings);
+	NANDRAD::readBinary(in, m_lccSettings);
+	NANDRAD::readBinary(in, m_activeNetworkId);
+	NANDRAD::readBinary(in, m_geometricNetworks);
+	NANDRAD::readBinary(in, m_buildings);
+	NANDRAD::readBinary(in, m_structuralUnits);
+	NANDRAD::readBinary(in, m_componentInstances);
+	NANDRAD::readBinary(in, m_subSurfaceComponentInstances);
+	NANDRAD::readBinary(in, m_plainGeometry);
+	NANDRAD::readBinary(in, m_embeddedDB);
+	NANDRAD::readBinary(in, m_fmiDescription);
+	NANDRAD::readBinary(in, m_ifcFilePath);
+	NANDRAD::readBinary(in, m_drawingFilePath);
+}
+
+void Project::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x523ef73au);
+	NANDRAD::writeBinary(out, m_solverParameter);
+	NANDRAD::writeBinary(out, m_simulationParameter);
+	NANDRAD::writeBinary(out, m_location);
+	NANDRAD::writeBinary(out, m_outputs);
+	NANDRAD::writeBinary(out, m_viewSettings);
+	NANDRAD::writeBinary(out, m_lcaSettings);
+	NANDRAD::writeBinary(out, m_lccSettings);
+	NANDRAD::writeBinary(out, m_activeNetworkId);
+	NANDRAD::writeBinary(out, m_geometricNetworks);
+	NANDRAD::writeBinary(out, m_buildings);
+	NANDRAD::writeBinary(out, m_structuralUnits);
+	NANDRAD::writeBinary(out, m_componentInstances);
+	NANDRAD::writeBinary(out, m_subSurfaceComponentInstances);
+	NANDRAD::writeBinary(out, m_plainGeometry);
+	NANDRAD::writeBinary(out, m_embeddedDB);
+	NANDRAD::writeBinary(out, m_fmiDescription);
+	NANDRAD::writeBinary(out, m_ifcFilePath);
+	NANDRAD::writeBinary(out, m_drawingFilePath);
+}
+
 } // namespace VICUS
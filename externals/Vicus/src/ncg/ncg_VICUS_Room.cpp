@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -152,4 +153,32 @@ TiXmlElement * Room::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Room::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x31e603e0u, "Room");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_ifcGUID);
+	NANDRAD::readBinary(in, m_idZoneTemplate);
+	NANDRAD::readBinary(in, m_idAcousticTemplate);
+	NANDRAD::readBinary(in, m_idSoundProtectionTemplate);
+	NANDRAD::readBinary(in, m_idAcousticBuildingType);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_surfaces);
+}
+
+void Room::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x31e603e0u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_ifcGUID);
+	NANDRAD::writeBinary(out, m_idZoneTemplate);
+	NANDRAD::writeBinary(out, m_idAcousticTemplate);
+	NANDRAD::writeBinary(out, m_idSoundProtectionTemplate);
+	NANDRAD::writeBinary(out, m_idAcousticBuildingType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_surfaces);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -90,4 +91,20 @@ TiXmlElement * RotationMatrix::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void RotationMatrix::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x2974ff32u, "RotationMatrix");
+	NANDRAD::readBinary(in, m_wp);
+	NANDRAD::readBinary(in, m_x);
+	NANDRAD::readBinary(in, m_y);
+	NANDRAD::readBinary(in, m_z);
+}
+
+void RotationMatrix::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x2974ff32u);
+	NANDRAD::writeBinary(out, m_wp);
+	NANDRAD::writeBinary(out, m_x);
+	NANDRAD::writeBinary(out, m_y);
+	NANDRAD::writeBinary(out, m_z);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -137,4 +138,28 @@ TiXmlElement * Schedule::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Schedule::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x71364633u, "Schedule");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_useLinearInterpolation);
+	NANDRAD::readBinary(in, m_haveAnnualSchedule);
+	NANDRAD::readBinary(in, m_annualSchedule);
+	NANDRAD::readBinary(in, m_periods);
+}
+
+void Schedule::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x71364633u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_useLinearInterpolation);
+	NANDRAD::writeBinary(out, m_haveAnnualSchedule);
+	NANDRAD::writeBinary(out, m_annualSchedule);
+	NANDRAD::writeBinary(out, m_periods);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -104,4 +105,18 @@ TiXmlElement * ScheduleInterval::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ScheduleInterval::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x854c1109u, "ScheduleInterval");
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_intervalStartDay);
+	NANDRAD::readBinary(in, m_dailyCycles);
+}
+
+void ScheduleInterval::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x854c1109u);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_intervalStartDay);
+	NANDRAD::writeBinary(out, m_dailyCycles);
+}
+
 } // namespace VICUS
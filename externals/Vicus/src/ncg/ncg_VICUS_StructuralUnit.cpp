@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -101,4 +102,20 @@ TiXmlElement * StructuralUnit::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void StructuralUnit::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x020f5327u, "StructuralUnit");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_roomIds);
+	NANDRAD::readBinary(in, m_color);
+}
+
+void StructuralUnit::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x020f5327u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_roomIds);
+	NANDRAD::writeBinary(out, m_color);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -117,4 +118,22 @@ TiXmlElement * SubNetwork::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SubNetwork::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xfee0a7dcu, "SubNetwork");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_elements);
+	NANDRAD::readBinary(in, m_idHeatExchangeElement);
+}
+
+void SubNetwork::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xfee0a7dcu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_elements);
+	NANDRAD::writeBinary(out, m_idHeatExchangeElement);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -97,4 +98,22 @@ TiXmlElement * SubSurface::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SubSurface::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x645e4301u, "SubSurface");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_polygon2D);
+	NANDRAD::readBinary(in, m_viewFactors);
+}
+
+void SubSurface::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x645e4301u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_polygon2D);
+	NANDRAD::writeBinary(out, m_viewFactors);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -141,4 +142,30 @@ TiXmlElement * SubSurfaceComponent::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SubSurfaceComponent::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8061a23bu, "SubSurfaceComponent");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_CT);
+	NANDRAD::readBinary(in, m_idWindow);
+	NANDRAD::readBinary(in, m_idConstruction);
+	NANDRAD::readBinary(in, m_idSideABoundaryCondition);
+	NANDRAD::readBinary(in, m_idSideBBoundaryCondition);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void SubSurfaceComponent::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8061a23bu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_idWindow);
+	NANDRAD::writeBinary(out, m_idConstruction);
+	NANDRAD::writeBinary(out, m_idSideABoundaryCondition);
+	NANDRAD::writeBinary(out, m_idSideBBoundaryCondition);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
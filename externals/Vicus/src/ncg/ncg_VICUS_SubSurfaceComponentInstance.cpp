@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -101,4 +102,24 @@ TiXmlElement * SubSurfaceComponentInstance::writeXML(TiXmlElement * parent) cons
 	return e;
 }
 
+void SubSurfaceComponentInstance::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x401c1d96u, "SubSurfaceComponentInstance");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_idSubSurfaceComponent);
+	NANDRAD::readBinary(in, m_idSideASurface);
+	NANDRAD::readBinary(in, m_idSideBSurface);
+	NANDRAD::readBinary(in, m_idShadingSystem);
+	NANDRAD::readBinary(in, m_idShadingControlModel);
+}
+
+void SubSurfaceComponentInstance::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x401c1d96u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_idSubSurfaceComponent);
+	NANDRAD::writeBinary(out, m_idSideASurface);
+	NANDRAD::writeBinary(out, m_idSideBSurface);
+	NANDRAD::writeBinary(out, m_idShadingSystem);
+	NANDRAD::writeBinary(out, m_idShadingControlModel);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -135,4 +136,28 @@ TiXmlElement * SupplySystem::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SupplySystem::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x3318c113u, "SupplySystem");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_supplyType, NUM_ST);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_supplyFMUPath);
+	NANDRAD::readBinary(in, m_idSupplyFMU);
+	NANDRAD::readBinary(in, m_idSubNetwork);
+}
+
+void SupplySystem::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x3318c113u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_supplyType);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_supplyFMUPath);
+	NANDRAD::writeBinary(out, m_idSupplyFMU);
+	NANDRAD::writeBinary(out, m_idSubNetwork);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -145,4 +146,26 @@ TiXmlElement * Surface::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void Surface::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x5e71586au, "Surface");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_visible);
+	NANDRAD::readBinary(in, m_displayColor);
+	NANDRAD::readBinary(in, m_viewFactors);
+	NANDRAD::readBinary(in, m_subSurfaces);
+	NANDRAD::readBinary(in, m_childSurfaces);
+}
+
+void Surface::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x5e71586au);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_visible);
+	NANDRAD::writeBinary(out, m_displayColor);
+	NANDRAD::writeBinary(out, m_viewFactors);
+	NANDRAD::writeBinary(out, m_subSurfaces);
+	NANDRAD::writeBinary(out, m_childSurfaces);
+}
+
 } // namespace VICUS
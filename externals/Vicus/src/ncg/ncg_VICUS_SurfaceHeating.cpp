@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -135,4 +136,28 @@ TiXmlElement * SurfaceHeating::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void SurfaceHeating::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x39c50626u, "SurfaceHeating");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_type, NUM_T);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_heatingCoolingCurvePoints);
+	NANDRAD::readBinary(in, m_idPipe);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void SurfaceHeating::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x39c50626u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_type);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_heatingCoolingCurvePoints);
+	NANDRAD::writeBinary(out, m_idPipe);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -28,6 +28,7 @@
 #include <VICUS_Constants.h>
 #include <IBKMK_Vector3D.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -103,4 +104,20 @@ TiXmlElement * ViewSettings::writeXMLPrivate(TiXmlElement * parent) const {
 	return e;
 }
 
+void ViewSettings::readBinaryPrivate(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x16102ea3u, "ViewSettings");
+	NANDRAD::readBinary(in, m_cameraTranslation);
+	NANDRAD::readBinary(in, m_cameraRotation);
+	NANDRAD::readBinary(in, m_farDistance);
+	NANDRAD::readBinary(in, m_gridPlanes);
+}
+
+void ViewSettings::writeBinaryPrivate(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x16102ea3u);
+	NANDRAD::writeBinary(out, m_cameraTranslation);
+	NANDRAD::writeBinary(out, m_cameraRotation);
+	NANDRAD::writeBinary(out, m_farDistance);
+	NANDRAD::writeBinary(out, m_gridPlanes);
+}
+
 } // namespace VICUS
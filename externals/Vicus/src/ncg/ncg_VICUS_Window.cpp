@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -149,4 +150,34 @@ TiXmlElement * Window::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void Window::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf003a7a1u, "Window");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_idGlazingSystem);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinaryEnum(in, m_methodFrame, NUM_M);
+	NANDRAD::readBinaryEnum(in, m_methodDivider, NUM_M);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_frame);
+	NANDRAD::readBinary(in, m_divider);
+}
+
+void Window::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf003a7a1u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_idGlazingSystem);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_methodFrame);
+	NANDRAD::writeBinary(out, m_methodDivider);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_frame);
+	NANDRAD::writeBinary(out, m_divider);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -104,4 +105,18 @@ TiXmlElement * WindowDivider::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowDivider::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xe6a82a0au, "WindowDivider");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_idMaterial);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void WindowDivider::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xe6a82a0au);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_idMaterial);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
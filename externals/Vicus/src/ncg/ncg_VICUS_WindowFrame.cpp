@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -104,4 +105,18 @@ TiXmlElement * WindowFrame::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowFrame::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x27d6ce7au, "WindowFrame");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_idMaterial);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void WindowFrame::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x27d6ce7au);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_idMaterial);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -153,4 +154,30 @@ TiXmlElement * WindowGlazingSystem::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void WindowGlazingSystem::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xb1495feeu, "WindowGlazingSystem");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinaryEnum(in, m_modelType, NUM_MT);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_manufacturer);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_para);
+	NANDRAD::readBinary(in, m_splinePara);
+}
+
+void WindowGlazingSystem::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xb1495feeu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_modelType);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_manufacturer);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_para);
+	NANDRAD::writeBinary(out, m_splinePara);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -130,4 +131,26 @@ TiXmlElement * ZoneControlNaturalVentilation::writeXML(TiXmlElement * parent) co
 	return e;
 }
 
+void ZoneControlNaturalVentilation::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x5fdab35fu, "ZoneControlNaturalVentilation");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_idSchedules);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void ZoneControlNaturalVentilation::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x5fdab35fu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_idSchedules);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -133,4 +134,26 @@ TiXmlElement * ZoneControlShading::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ZoneControlShading::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x8798d6b8u, "ZoneControlShading");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinaryEnum(in, m_category, NUM_C);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void ZoneControlShading::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x8798d6b8u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_category);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
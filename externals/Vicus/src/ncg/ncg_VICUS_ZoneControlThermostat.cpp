@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 #include <VICUS_KeywordList.h>
 
 #include <tinyxml.h>
@@ -157,4 +158,32 @@ TiXmlElement * ZoneControlThermostat::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ZoneControlThermostat::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x0d87970bu, "ZoneControlThermostat");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinaryEnum(in, m_controlValue, NUM_CV);
+	NANDRAD::readBinaryEnum(in, m_controllerType, NUM_CT);
+	NANDRAD::readBinary(in, m_idHeatingSetpointSchedule);
+	NANDRAD::readBinary(in, m_idCoolingSetpointSchedule);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void ZoneControlThermostat::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x0d87970bu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_controlValue);
+	NANDRAD::writeBinary(out, m_controllerType);
+	NANDRAD::writeBinary(out, m_idHeatingSetpointSchedule);
+	NANDRAD::writeBinary(out, m_idCoolingSetpointSchedule);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
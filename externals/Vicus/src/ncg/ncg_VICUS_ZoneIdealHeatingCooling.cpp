@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -116,4 +117,24 @@ TiXmlElement * ZoneIdealHeatingCooling::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ZoneIdealHeatingCooling::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0xf11e9aaeu, "ZoneIdealHeatingCooling");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_para);
+}
+
+void ZoneIdealHeatingCooling::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0xf11e9aaeu);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_para);
+}
+
 } // namespace VICUS
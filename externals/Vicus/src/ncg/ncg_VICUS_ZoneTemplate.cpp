@@ -27,6 +27,7 @@
 #include <IBK_StringUtils.h>
 #include <VICUS_Constants.h>
 #include <NANDRAD_Utilities.h>
+#include <VICUS_BinaryIO.h>
 
 #include <tinyxml.h>
 
@@ -111,4 +112,24 @@ TiXmlElement * ZoneTemplate::writeXML(TiXmlElement * parent) const {
 	return e;
 }
 
+void ZoneTemplate::readBinary(std::istream & in) {
+	NANDRAD::readBinaryLayout(in, 0x20439126u, "ZoneTemplate");
+	NANDRAD::readBinary(in, m_id);
+	NANDRAD::readBinary(in, m_displayName);
+	NANDRAD::readBinary(in, m_color);
+	NANDRAD::readBinary(in, m_notes);
+	NANDRAD::readBinary(in, m_dataSource);
+	NANDRAD::readBinary(in, m_idReferences);
+}
+
+void ZoneTemplate::writeBinary(std::ostream & out) const {
+	NANDRAD::writeBinary(out, 0x20439126u);
+	NANDRAD::writeBinary(out, m_id);
+	NANDRAD::writeBinary(out, m_displayName);
+	NANDRAD::writeBinary(out, m_color);
+	NANDRAD::writeBinary(out, m_notes);
+	NANDRAD::writeBinary(out, m_dataSource);
+	NANDRAD::writeBinary(out, m_idReferences);
+}
+
 } // namespace VICUS
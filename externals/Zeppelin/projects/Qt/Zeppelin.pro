@@ -17,6 +17,11 @@ unix|mac {
 	VERSION = $${VER_MAJ}.$${VER_MIN}.$${VER_PAT}
 }
 
+LIBS += -lIBK
+
+INCLUDEPATH = \
+	../../../IBK/src
+
 SOURCES += ../../src/ZEPPELIN_DependencyGroup.cpp \
 	../../src/ZEPPELIN_DependencyGraph.cpp
 
@@ -22,6 +22,10 @@ Lesser General Public License for more details.
 #include <assert.h>
 #include <iterator>
 #include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <IBK_Exception.h>
 
 namespace ZEPPELIN {
 
@@ -47,6 +51,289 @@ void DependencyGraph::setObjects(DependencyObject::DependencySequence & objects,
 
 #ifdef USE_EAS_ALGORITHM
 
+namespace {
+
+/*! Index based representation of a dependency graph (or a subgraph) used by the EAS algorithm.
+
+	Dependencies and parents of all nodes are stored in compressed row format, restricted to
+	nodes of the graph (references to oneself and to objects outside the graph are skipped).
+	For each remaining node the number of remaining parents and dependencies is counted. Nodes whose counters
+	drop to zero are registered as candidates for the next source/sink search, so that nodes can be
+	erased from the graph without searching the node vector.
+*/
+class IndexedGraph {
+public:
+	/*! Constructor, sets up connectivity for the given nodes (the vector must outlive the object). */
+	explicit IndexedGraph(const DependencyObject::DependencySequence & objects);
+
+	/*! Returns true if all nodes have been erased. */
+	bool empty() const { return m_remainingCount == 0; }
+
+	/*! Returns true if the object is a node of the graph that has not been erased, yet. */
+	bool isRemaining(const DependencyObject * o) const {
+		std::unordered_map<const DependencyObject*, unsigned int>::const_iterator it = m_indexes.find(o);
+		return it != m_indexes.end() && !m_erased[it->second];
+	}
+
+	/*! Erases all sources (nodes without parents in the remaining graph) and appends them in graph order.
+		\return Number of erased nodes.
+	*/
+	unsigned int popSources(DependencyObject::DependencySequence & sources) {
+		return popCandidates(m_sourceCandidates, sources);
+	}
+
+	/*! Erases all sinks (nodes without dependencies in the remaining graph) and appends them in graph order.
+		\return Number of erased nodes.
+	*/
+	unsigned int popSinks(DependencyObject::DependencySequence & sinks) {
+		return popCandidates(m_sinkCandidates, sinks);
+	}
+
+	/*! Erases the strongly connected component of the first remaining node from the graph.
+		Nodes are stored in the order of a backward (parent direction) search starting at the first node.
+	*/
+	void popNextCycle(DependencyObject::DependencySequence & cycle);
+
+private:
+	/*! Erases all nodes in candidates that have not been erased, yet. */
+	unsigned int popCandidates(std::vector<unsigned int> & candidates, DependencyObject::DependencySequence & nodes);
+
+	/*! Marks node as erased and updates counters of its neighbors. */
+	void erase(unsigned int i);
+
+	/*! Computes strongly connected components (iterative variant of Tarjan's algorithm). */
+	void computeComponents();
+
+	/*! All graph nodes. */
+	const DependencyObject::DependencySequence		&m_objects;
+	/*! Maps objects to node indexes. */
+	std::unordered_map<const DependencyObject*, unsigned int>	m_indexes;
+
+	/*! Start positions of dependencies of node i in m_dependencies (size n+1). */
+	std::vector<unsigned int>	m_dependencyStart;
+	/*! Dependencies of all nodes (node indexes). */
+	std::vector<unsigned int>	m_dependencies;
+	/*! Start positions of parents of node i in m_parents (size n+1). */
+	std::vector<unsigned int>	m_parentStart;
+	/*! Parents of all nodes (node indexes). */
+	std::vector<unsigned int>	m_parents;
+	/*! Start positions of nodes referencing node i as dependency in m_dependencyOf (size n+1). */
+	std::vector<unsigned int>	m_dependencyOfStart;
+	/*! Nodes referencing node i as dependency. */
+	std::vector<unsigned int>	m_dependencyOf;
+	/*! Start positions of nodes referencing node i as parent in m_parentOf (size n+1). */
+	std::vector<unsigned int>	m_parentOfStart;
+	/*! Nodes referencing node i as parent. */
+	std::vector<unsigned int>	m_parentOf;
+
+	/*! Number of parents of each node in remaining graph. */
+	std::vector<unsigned int>	m_parentCount;
+	/*! Number of dependencies of each node in remaining graph. */
+	std::vector<unsigned int>	m_dependencyCount;
+	/*! Nodes that have become sources. */
+	std::vector<unsigned int>	m_sourceCandidates;
+	/*! Nodes that have become sinks. */
+	std::vector<unsigned int>	m_sinkCandidates;
+	/*! Flag for each node, true if erased from graph. */
+	std::vector<char>			m_erased;
+	/*! Number of remaining nodes. */
+	unsigned int				m_remainingCount;
+	/*! All nodes before this index have been erased. */
+	unsigned int				m_firstRemaining;
+
+	/*! Index of strongly connected component for each node (computed on first call to popNextCycle()). */
+	std::vector<unsigned int>	m_component;
+};
+
+
+/*! Fills compressed row storage (start, values) with the reverse connections of (fromStart, from). */
+void reverseConnections(const std::vector<unsigned int> & fromStart, const std::vector<unsigned int> & from,
+						std::vector<unsigned int> & start, std::vector<unsigned int> & values)
+{
+	unsigned int n = fromStart.size() - 1;
+	start.assign(n + 1, 0);
+	for (unsigned int j : from)
+		++start[j + 1];
+	for (unsigned int i = 0; i < n; ++i)
+		start[i + 1] += start[i];
+	values.resize(from.size());
+	std::vector<unsigned int> pos(start.begin(), start.end() - 1);
+	for (unsigned int i = 0; i < n; ++i)
+		for (unsigned int k = fromStart[i]; k < fromStart[i + 1]; ++k)
+			values[pos[from[k]]++] = i;
+}
+
+
+IndexedGraph::IndexedGraph(const DependencyObject::DependencySequence & objects) :
+	m_objects(objects),
+	m_remainingCount(objects.size()),
+	m_firstRemaining(0)
+{
+	unsigned int n = objects.size();
+	m_indexes.reserve(n);
+	for (unsigned int i = 0; i < n; ++i)
+		m_indexes[objects[i]] = i;
+
+	// collect connections within graph, keep order of the objects' containers
+	m_dependencyStart.resize(n + 1);
+	m_parentStart.resize(n + 1);
+	m_dependencyStart[0] = m_parentStart[0] = 0;
+	for (unsigned int i = 0; i < n; ++i) {
+		for (const DependencyObject * o : objects[i]->dependencies()) {
+			std::unordered_map<const DependencyObject*, unsigned int>::const_iterator it = m_indexes.find(o);
+			if (it != m_indexes.end() && it->second != i)
+				m_dependencies.push_back(it->second);
+		}
+		m_dependencyStart[i + 1] = m_dependencies.size();
+		for (const DependencyObject * o : objects[i]->parents()) {
+			std::unordered_map<const DependencyObject*, unsigned int>::const_iterator it = m_indexes.find(o);
+			if (it != m_indexes.end() && it->second != i)
+				m_parents.push_back(it->second);
+		}
+		m_parentStart[i + 1] = m_parents.size();
+	}
+	reverseConnections(m_dependencyStart, m_dependencies, m_dependencyOfStart, m_dependencyOf);
+	reverseConnections(m_parentStart, m_parents, m_parentOfStart, m_parentOf);
+
+	m_parentCount.resize(n);
+	m_dependencyCount.resize(n);
+	for (unsigned int i = 0; i < n; ++i) {
+		m_parentCount[i] = m_parentStart[i + 1] - m_parentStart[i];
+		if (m_parentCount[i] == 0)
+			m_sourceCandidates.push_back(i);
+		m_dependencyCount[i] = m_dependencyStart[i + 1] - m_dependencyStart[i];
+		if (m_dependencyCount[i] == 0)
+			m_sinkCandidates.push_back(i);
+	}
+	m_erased.resize(n, false);
+}
+
+
+unsigned int IndexedGraph::popCandidates(std::vector<unsigned int> & candidates,
+	DependencyObject::DependencySequence & nodes)
+{
+	// take all current candidates, nodes becoming sources/sinks while erasing are candidates of the next call
+	std::vector<unsigned int> selected;
+	selected.swap(candidates);
+	selected.erase(std::remove_if(selected.begin(), selected.end(),
+		[this](unsigned int i) { return m_erased[i] != 0; }), selected.end());
+	// nodes are returned in graph order
+	std::sort(selected.begin(), selected.end());
+	for (unsigned int i : selected) {
+		erase(i);
+		nodes.push_back(m_objects[i]);
+	}
+	return selected.size();
+}
+
+
+void IndexedGraph::erase(unsigned int i) {
+	m_erased[i] = true;
+	--m_remainingCount;
+	// nodes that have us as parent
+	for (unsigned int k = m_parentOfStart[i]; k < m_parentOfStart[i + 1]; ++k) {
+		unsigned int j = m_parentOf[k];
+		if (!m_erased[j] && --m_parentCount[j] == 0)
+			m_sourceCandidates.push_back(j);
+	}
+	// nodes that have us as dependency
+	for (unsigned int k = m_dependencyOfStart[i]; k < m_dependencyOfStart[i + 1]; ++k) {
+		unsigned int j = m_dependencyOf[k];
+		if (!m_erased[j] && --m_dependencyCount[j] == 0)
+			m_sinkCandidates.push_back(j);
+	}
+}
+
+
+void IndexedGraph::popNextCycle(DependencyObject::DependencySequence & cycle) {
+	if (m_component.empty())
+		computeComponents();
+
+	while (m_firstRemaining < m_objects.size() && m_erased[m_firstRemaining])
+		++m_firstRemaining;
+	assert(m_firstRemaining < m_objects.size());
+
+	// the remaining graph consists of complete components (sources and sinks are never part of a cycle),
+	// so all nodes reachable forward and backward from the first node form its strongly connected component
+	unsigned int first = m_firstRemaining;
+	unsigned int component = m_component[first];
+	std::vector<unsigned int> nodes(1, first);
+	erase(first);
+	for (unsigned int pos = 0; pos < nodes.size(); ++pos) {
+		unsigned int i = nodes[pos];
+		for (unsigned int k = m_parentStart[i]; k < m_parentStart[i + 1]; ++k) {
+			unsigned int j = m_parents[k];
+			if (m_erased[j] || m_component[j] != component)
+				continue;
+			erase(j);
+			nodes.push_back(j);
+		}
+	}
+	for (unsigned int i : nodes)
+		cycle.push_back(m_objects[i]);
+}
+
+
+void IndexedGraph::computeComponents() {
+	const unsigned int UNVISITED = (unsigned int)-1;
+	unsigned int n = m_objects.size();
+	m_component.assign(n, UNVISITED);
+
+	std::vector<unsigned int> visitIndex(n, UNVISITED);
+	std::vector<unsigned int> lowLink(n);
+	std::vector<char> onStack(n, false);
+	std::vector<unsigned int> stack;
+	// depth-first search path: node and position of next dependency to visit
+	std::vector<std::pair<unsigned int, unsigned int> > path;
+	unsigned int counter = 0;
+	unsigned int componentCount = 0;
+
+	for (unsigned int root = 0; root < n; ++root) {
+		if (visitIndex[root] != UNVISITED)
+			continue;
+		path.push_back(std::make_pair(root, m_dependencyStart[root]));
+		visitIndex[root] = lowLink[root] = counter++;
+		stack.push_back(root);
+		onStack[root] = true;
+
+		while (!path.empty()) {
+			unsigned int i = path.back().first;
+			unsigned int & k = path.back().second;
+			if (k < m_dependencyStart[i + 1]) {
+				unsigned int j = m_dependencies[k++];
+				if (visitIndex[j] == UNVISITED) {
+					visitIndex[j] = lowLink[j] = counter++;
+					stack.push_back(j);
+					onStack[j] = true;
+					path.push_back(std::make_pair(j, m_dependencyStart[j]));
+				}
+				else if (onStack[j])
+					lowLink[i] = (std::min)(lowLink[i], visitIndex[j]);
+				continue;
+			}
+			// all dependencies visited, i is root of a component
+			if (lowLink[i] == visitIndex[i]) {
+				unsigned int j;
+				do {
+					j = stack.back();
+					stack.pop_back();
+					onStack[j] = false;
+					m_component[j] = componentCount;
+				} while (j != i);
+				++componentCount;
+			}
+			path.pop_back();
+			if (!path.empty()) {
+				unsigned int parent = path.back().first;
+				lowLink[parent] = (std::min)(lowLink[parent], lowLink[i]);
+			}
+		}
+	}
+}
+
+} // namespace
+
+
 void DependencyGraph::clusterGraph(std::list<DependencyGroup> &objectGroups) {
 
 	/********************* Identify sequential and cyclic groups ***************************************/
@@ -58,54 +345,46 @@ void DependencyGraph::clusterGraph(std::list<DependencyGroup> &objectGroups) {
 	for(unsigned int i = 0; i < sequences.size(); ++i) {
 		DependencyGroup group(DependencyGroup::SEQUENTIAL);
 		// add objects to group
-		DependencyObject::DependencySequence &sequence = sequences[i];
-
-		for(unsigned int j = 0; j < sequence.size(); ++j) {
-			group.insert(sequence[j]);
-		}
+		group.set(sequences[i]);
 		objectGroups.push_back(group);
 	}
 	for(unsigned int i = 0; i < cycles.size(); ++i) {
 		DependencyGroup group(DependencyGroup::CYCLIC);
 		// add objects to group
-		DependencyObject::DependencySequence &cycle = cycles[i];
-
-		for(unsigned int j = 0; j < cycle.size(); ++j) {
-			group.insert(cycle[j]);
-		}
+		group.set(cycles[i]);
 		objectGroups.push_back(group);
 	}
 	// recompose the graph vector as a vector of dependency groups
 	m_objects.clear();
+	// and remember the groups of each object
+	std::unordered_multimap<const DependencyObject*, unsigned int> groupsOfObject;
 	for (std::list<DependencyGroup>::iterator groupIt =
 		objectGroups.begin(); groupIt != objectGroups.end() ; ++groupIt) {
+		for (const DependencyObject * o : groupIt->depObjects())
+			groupsOfObject.insert(std::make_pair(o, (unsigned int)m_objects.size()));
 		m_objects.push_back(&(*groupIt));
 	}
+	// collect for each group all groups depending on one of its members (in graph order)
+	std::vector<std::vector<unsigned int> > parentGroups(m_objects.size());
+	for (unsigned int i = 0; i < m_objects.size(); ++i) {
+		for (const DependencyObject * o : m_objects[i]->dependencies()) {
+			typedef std::unordered_multimap<const DependencyObject*, unsigned int>::const_iterator GroupIt;
+			std::pair<GroupIt, GroupIt> range = groupsOfObject.equal_range(o);
+			for (GroupIt it = range.first; it != range.second; ++it) {
+				std::vector<unsigned int> & parents = parentGroups[it->second];
+				if (parents.empty() || parents.back() != i)
+					parents.push_back(i);
+			}
+		}
+	}
 	// update all dependencies:
 	// simply add a group as a dependency to all objects that depend
 	// on one group member
-	// we start with the last iterator position inside group vector
-	for (std::list<DependencyGroup>::iterator groupIt =
-		objectGroups.begin(); groupIt != objectGroups.end() ; ++groupIt) {
-		// sequential nodes are depObject-eleemnts of the groups
-		for (DependencyObject::DependencySequence::const_iterator nodeIt =
-			groupIt->depObjects().begin();  nodeIt != groupIt->depObjects().end();
-			++ nodeIt)
-		{
-			// manipulate dependency object dependencies
-			for (DependencyObject::DependencySequence::iterator parent
-				= m_objects.begin(); parent != m_objects.end(); ++parent)
-			{
-				// no parent node
-				if (std::find((*parent)->dependencies().begin(), (*parent)->dependencies().end(), *nodeIt)
-					== (*parent)->dependencies().end())
-					continue;
-				// add group as a new dependency
-				(*parent)->dependsOn(*groupIt);
-			}
-		}
+	for (unsigned int i = 0; i < m_objects.size(); ++i) {
+		for (unsigned int parent : parentGroups[i])
+			m_objects[parent]->dependsOn(*m_objects[i]);
 		// update parent connections
-		groupIt->updateParents();
+		m_objects[i]->updateParents();
 	}
 }
 
@@ -113,24 +392,20 @@ void DependencyGraph::clusterGraph(std::list<DependencyGroup> &objectGroups) {
 void DependencyGraph::findCyclesAndSequences(std::vector<DependencyObject::DependencySequence> &cycles,
 							std::vector<DependencyObject::DependencySequence> &sequences)
 {
-	DependencyObject::DependencySequence remainingGraph = m_objects;
-	// create a graph from all objects
+	IndexedGraph remainingGraph(m_objects);
 	// loop until graph is empty
 	while(!remainingGraph.empty()) {
 
 		DependencyObject::DependencySequence sources, sinks;
-		// store graph size to ensure whetehr iot changed or not
-		unsigned int graphSize = 10000;
-		// remove all sequential depdnencies
-		while(graphSize > remainingGraph.size() ) {
-			// overwrite size storage
-			graphSize = remainingGraph.size();
+		// remove all sequential dependencies, until graph does not change anylonger
+		unsigned int erasedNodes;
+		do {
 			// remove next sources and sinks
-			popSourcesFromGraph(sources, remainingGraph);
-			popSinksFromGraph(sinks, remainingGraph);
-		}
+			erasedNodes = remainingGraph.popSources(sources);
+			erasedNodes += remainingGraph.popSinks(sinks);
+		} while (erasedNodes > 0);
 
-		std::set<DependencyObject *> registeredSources;
+		std::unordered_set<DependencyObject *> registeredSources;
 		// create sequences from all sources: start with first sources
 		for(unsigned int i = 0; i < sources.size(); ++i) {
 			DependencyObject *source = sources[i];
@@ -158,8 +433,7 @@ void DependencyGraph::findCyclesAndSequences(std::vector<DependencyObject::Depen
 				// if source has only one parent it must be found by the source/sink search
 				// therefore it cannot be part of the remaining grapg any longer (if
 				// there are no programming errors)
-				assert(std::find(remainingGraph.begin(), remainingGraph.end(), source)
-					== remainingGraph.end() );
+				assert(!remainingGraph.isRemaining(source));
 				// add to container
 				sequence.push_back(source);
 				// store source as registered
@@ -169,7 +443,7 @@ void DependencyGraph::findCyclesAndSequences(std::vector<DependencyObject::Depen
 			std::reverse(sequence.begin(), sequence.end());
 		}
 		// and sinks
-		std::set<DependencyObject *> registeredSinks;
+		std::unordered_set<DependencyObject *> registeredSinks;
 		// create sequences from all sources: start with first sources
 		for(unsigned int i = 0; i < sinks.size(); ++i) {
 			DependencyObject *sink = sinks[i];
@@ -200,8 +474,7 @@ void DependencyGraph::findCyclesAndSequences(std::vector<DependencyObject::Depen
 				// if sink has only one child it must be found by the source/sink search
 				// therefore it cannot be part of the remaining graph any longer (if
 				// there are no programming errors)
-				assert(std::find(remainingGraph.begin(), remainingGraph.end(), sink)
-					== remainingGraph.end() );
+				assert(!remainingGraph.isRemaining(sink));
 				// we dont assume that current sink is inside sinks container - we allow
 				// a sink also to be a source and to be selected by the sources container
 
@@ -220,179 +493,31 @@ void DependencyGraph::findCyclesAndSequences(std::vector<DependencyObject::Depen
 
 		DependencyObject::DependencySequence cyclicObjects;
 		// remove the next cycle we find
-		popNextCycleFromGraph(cyclicObjects, remainingGraph);
+		remainingGraph.popNextCycle(cyclicObjects);
 		// there must! be a cycle
 		assert(!cyclicObjects.empty());
 		cycles.push_back(cyclicObjects);
 	}
-	assert(remainingGraph.empty());
-}
-
-void DependencyGraph::popSourcesFromGraph( DependencyObject::DependencySequence &sources,
-		DependencyObject::DependencySequence &graph)
-{
-	// erase all sinks and sources
-	for(unsigned int i = 0; i < graph.size(); ++i) {
-
-		DependencyObject *node = graph[i];
-		// count all dependencies that are part of the graph
-		unsigned int pars = 0;
-		for(DependencyObject::DependencySequence::const_iterator nodeIt =
-			node->parents().begin(); nodeIt != node->parents().end();
-			++nodeIt) {
-			// parent of onself
-			if(*nodeIt == node)
-				continue;
-			// skip nodes that are not part of the current graph
-			if (std::find(graph.begin(), graph.end(), *nodeIt)
-				== graph.end()) continue;
-			// otherwise count
-			++pars;
-			break;
-		}
-		// a source
-		if(pars == 0) {
-			sources.push_back(node);
-		}
-	}
-	// erase sources and sinks from graph
-	for(DependencyObject::DependencySequence::iterator nodeIt =
-		sources.begin(); nodeIt != sources.end();
-		++nodeIt) {
-
-		DependencyObject::DependencySequence::iterator
-			nodeInGraphIt = std::find(graph.begin(), graph.end(), *nodeIt);
-		if(nodeInGraphIt != graph.end() )
-			graph.erase(nodeInGraphIt);
-	}
-}
-
-
-
-void DependencyGraph::popSinksFromGraph(DependencyObject::DependencySequence &sinks,
-		DependencyObject::DependencySequence &graph)
-{
-	// erase all sinks and sources
-	for(unsigned int i = 0; i < graph.size(); ++i) {
-
-		DependencyObject *node = graph[i];
-		// count all dependencies that are part of the graph
-		unsigned int deps = 0;
-		for(DependencyObject::DependencySequence::const_iterator nodeIt =
-			node->dependencies().begin(); nodeIt != node->dependencies().end();
-			++nodeIt) {
-			// dependency of onself
-			if(*nodeIt == node)
-				continue;
-			// skip nodes that are not part of the current graph
-			if (std::find(graph.begin(), graph.end(), *nodeIt)
-				== graph.end()) continue;
-			// otherwise count
-			++deps;
-			break;
-		}
-		// a sink
-		if(deps == 0) {
-			sinks.push_back(node);
-		}
-	}
-	// erase sinks from graph
-	for(DependencyObject::DependencySequence::iterator nodeIt =
-		sinks.begin(); nodeIt != sinks.end();
-		++nodeIt) {
-
-		DependencyObject::DependencySequence::iterator
-			nodeInGraphIt = std::find(graph.begin(), graph.end(), *nodeIt);
-		if(nodeInGraphIt != graph.end() )
-			graph.erase(nodeInGraphIt);
-	}
-}
-
-
-void DependencyGraph::popNextCycleFromGraph( DependencyObject::DependencySequence &cycle,
-		DependencyObject::DependencySequence &graph)
-{
-	// cyclic dependencies cannot be removed as source or sink
-	// fidn first cycle beginning at the first reimaning graph element
-	// start with forward search
-	DependencyObject::DependencySequence connectedObjects;
-	findFirstConnectedNodesInGraph(connectedObjects, graph);
-	// now fidn all objects backward to ensure they really are cyclic
-	findFirstConnectedNodesInGraph(cycle, connectedObjects, false);
-	// erase fromm remaning graph
-	for(unsigned int c = 0; c < cycle.size(); ++c) {
-
-		DependencyObject::DependencySequence::iterator
-			nodeInGraphIt = std::find(graph.begin(), graph.end(),
-			cycle[c]);
-		assert(nodeInGraphIt != graph.end() );
-		graph.erase(nodeInGraphIt);
-	}
-}
-
-void DependencyGraph::findFirstConnectedNodesInGraph(DependencyObject::DependencySequence &connectedNodes,
-					const DependencyObject::DependencySequence &graph,
-					bool forwardSearch)
-{
-	if(!connectedNodes.empty())
-		connectedNodes.clear();
-
-	// no graph element
-	if(graph.empty())
-		return;
-
-	// add the first node to the connected graph
-	connectedNodes.push_back(graph[0]);
-
-	unsigned int lastPos = 0;
-	// loop until no changes are registered
-	while(lastPos < connectedNodes.size()) {
-		// set node to next element
-		DependencyObject *node = connectedNodes[lastPos];
-
-		DependencyObject::DependencySequence nextNodes;
-
-		if(forwardSearch)
-			nextNodes = node->dependencies();
-		else // backward search
-			nextNodes = node->parents();
-
-		// add all dependend objects
-		for(DependencyObject::DependencySequence::iterator nodeIt =
-			nextNodes.begin(); nodeIt != nextNodes.end();
-			++nodeIt) {
-			// skip nodes that are not part of the current graph
-			if (std::find(graph.begin(), graph.end(), *nodeIt)
-				== graph.end()) continue;
-
-			// skip nodes that registered already
-			if (std::find(connectedNodes.begin(), connectedNodes.end(), *nodeIt)
-				!= connectedNodes.end()) continue;
-
-			// recursively add eleemnts to connected graph
-			// add element to graph
-			connectedNodes.push_back(*nodeIt);
-		}
-		// update counter
-		++lastPos;
-	}
 }
 
 
 void DependencyGraph::orderGraph() {
+	FUNCID(DependencyGraph::orderGraph);
 
 	// create worker set and clear target vector
 	m_orderedObjects.clear();
 
-	// objectsLeft contains all unsorted graph nodes
-	DependencyObject::DependencySequence remainingGraph = m_objects;
+	// remainingGraph contains all unsorted graph nodes
+	IndexedGraph remainingGraph(m_objects);
 
 	while (!remainingGraph.empty()) {
 		// we store all found sinks in objCluster
 		DependencyObject::DependencySequence sinks;
 		// pop all sinks from reomaing graph
-		popSinksFromGraph(sinks, remainingGraph);
-		assert(!sinks.empty()); // didn't find any sinks, error in group initialisation
+		remainingGraph.popSinks(sinks);
+		// no sinks means that the remaining graph contains cycles, error in group initialisation
+		if (sinks.empty())
+			throw IBK::Exception("Cannot order dependency graph, remaining objects are part of cycles.", FUNC_ID);
 
 		// store all sinks inside a new ParallelObjects object
 		m_orderedParallelObjects.push_back(ParallelObjects());
@@ -108,49 +108,18 @@ protected:
 		iteratively erases all sources and sinks from the graph. These sources and
 		sinks are checked for sequential connections (only one child and one parent
 		per pair of nodes) and sorted into sequence container. The remaining graph nodes
-		are assumed to include a cyclic connection. This cycle is searched for and erased
-		from the graph. The described procedure is repeated until all nodes are sorted into one
-		container.
+		are assumed to include a cyclic connection. The strongly connected component of the first
+		remaining node is erased from the graph as next cycle. The described procedure is repeated
+		until all nodes are sorted into one container.
+		Nodes are addressed by index and strongly connected components are computed once
+		(Tarjan's algorithm), so that the effort grows linearly with the number of nodes and
+		connections.
 		\param cycles container including all cyclically connected nodes
 		\param sequences container including all sequentialally connected nodes
 	*/
 	void findCyclesAndSequences(std::vector<DependencyObject::DependencySequence> &cycles,
 							std::vector<DependencyObject::DependencySequence> &sequences);
 
-	/*! Erases all source nodes from a given graph or subgraph.
-		\param sources container including source nodes
-		\param graph subset of graph nodes excluding all sources
-	*/
-	static void popSourcesFromGraph( DependencyObject::DependencySequence &sources,
-		DependencyObject::DependencySequence &graph);
-
-	/*! Erases all sink nodes from a given graph or subgraph.
-		\param sinks container including sink nodes
-		\param graph subset of graph nodes excluding all sinks
-	*/
-	static void popSinksFromGraph( DependencyObject::DependencySequence &sinks,
-		DependencyObject::DependencySequence &graph);
-
-	/*! Erases the next cyclic connection from a graph or subgraph. The graph is assumed
-		to be free of sources and sinks. Starting from the first node all forward connections
-		are passed and all connected transitively nodes sorted into a subgraph. The same
-		search is performed backward in order to filter only cyclic connections.
-		\param cycle maximum subset of cyclic connected nodes that include the first graph node,
-			if no suitable cyclic connection is found an empty container is returned
-		\param graph subset of graph nodes excluding the cycle nodes
-	*/
-	static void popNextCycleFromGraph( DependencyObject::DependencySequence &cycle,
-		DependencyObject::DependencySequence &graph);
-
-	/*! Selects all nodes that are causaly connected to the first graph node.
-		\param connectedNodes subset of nodes causaly connected to the first graph node
-		\param graph graph nodes for search
-		\param forwardSearch causality, true if graph is searched in the direction of
-		dependencies (childs), false otherwise (parent direction)
-	*/
-	static void findFirstConnectedNodesInGraph( DependencyObject::DependencySequence &connectedNodes,
-					const DependencyObject::DependencySequence &graph,
-					bool forwardSearch = true);
 #else
 	/*! Recursive cycle search (starting from an arbirtary root node).
 		\param depth recursion depth
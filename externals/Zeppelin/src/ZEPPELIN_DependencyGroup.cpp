@@ -20,6 +20,7 @@ Lesser General Public License for more details.
 
 #include <cassert>
 #include <iterator>
+#include <unordered_set>
 
 namespace ZEPPELIN {
 
@@ -540,8 +541,37 @@ void DependencyGroup::set(const DependencyObject::DependencySequence & depObject
 	m_depObjects.clear();
 	m_parents.clear();
 
-	for (DependencyObject::DependencySequence::const_iterator it = depObjectVector.begin(); it != depObjectVector.end(); ++it)
-		insert(*it);
+	// groups need to be resolved, insert one after another
+	for (DependencyObject::DependencySequence::const_iterator it = depObjectVector.begin(); it != depObjectVector.end(); ++it) {
+		if (dynamic_cast<DependencyGroup *>(*it) != nullptr) {
+			for (it = depObjectVector.begin(); it != depObjectVector.end(); ++it)
+				insert(*it);
+			return;
+		}
+	}
+
+	// same result as inserting all objects one after another, but avoids updating
+	// dependencies and parents for all members on each insert
+	std::unordered_set<const DependencyObject*> members;
+	for (DependencyObject::DependencySequence::const_iterator it = depObjectVector.begin(); it != depObjectVector.end(); ++it) {
+		if (members.insert(*it).second)
+			m_depObjects.push_back(*it);
+	}
+	// collect dependencies and parents of all members in order of their first appearance,
+	// skip all group members
+	std::unordered_set<const DependencyObject*> childs, parents;
+	for (DependencyObject::DependencySequence::const_iterator it = m_depObjects.begin(); it != m_depObjects.end(); ++it) {
+		const DependencyObject::DependencySequence & objDeps = (*it)->dependencies();
+		for (unsigned int i = 0; i < objDeps.size(); ++i) {
+			if (members.find(objDeps[i]) == members.end() && childs.insert(objDeps[i]).second)
+				m_childs.push_back(objDeps[i]);
+		}
+		const DependencyObject::DependencySequence & objParents = (*it)->parents();
+		for (unsigned int i = 0; i < objParents.size(); ++i) {
+			if (members.find(objParents[i]) == members.end() && parents.insert(objParents[i]).second)
+				m_parents.push_back(objParents[i]);
+		}
+	}
 }
 
 void DependencyGroup::insert(DependencyObject* o) {
@@ -120,6 +120,10 @@ size_t CVSpilsSerializationSize(void *cvode_mem);
 size_t CVSpilsSerialize(void *cvode_mem, void ** storageDataPtr);
 size_t CVSpilsDeserialize(void *cvode_mem, void ** storageDataPtr);
 
+size_t CVSlsSerializationSize(void *cvode_mem);
+size_t CVSlsSerialize(void *cvode_mem, void ** storageDataPtr);
+size_t CVSlsDeserialize(void *cvode_mem, void ** storageDataPtr);
+
 
 #ifdef __cplusplus
 }
@@ -391,6 +391,7 @@ void *CVodeCreate(int lmm, int iter)
   cv_mem->cv_maxcor     = NLS_MAXCOR;
   cv_mem->cv_maxnef     = MXNEF;
   cv_mem->cv_maxncf     = MXNCF;
+  cv_mem->cv_msbp       = MSBP;
   cv_mem->cv_nlscoef    = CORTES;
 
   /* Initialize root finding variables */
@@ -1042,6 +1043,7 @@ int CVodeRootInit(void *cvode_mem, int nrtfn, CVRootFn g)
 #define lmem           (cv_mem->cv_lmem)
 #define qu             (cv_mem->cv_qu)
 #define nstlp          (cv_mem->cv_nstlp)
+#define msbp           (cv_mem->cv_msbp)
 #define h0u            (cv_mem->cv_h0u)
 #define hu             (cv_mem->cv_hu)
 #define saved_tq5      (cv_mem->cv_saved_tq5)
@@ -2689,7 +2691,7 @@ static int cvNlsNewton(CVodeMem cv_mem, int nflag)
   /* Decide whether or not to call setup routine (if one exists) */
   if (setupNonNull) {
     callSetup = (nflag == PREV_CONV_FAIL) || (nflag == PREV_ERR_FAIL) ||
-      (nst == 0) || (nst >= nstlp + MSBP) || (SUNRabs(gamrat-ONE) > DGMAX);
+      (nst == 0) || (nst >= nstlp + msbp) || (SUNRabs(gamrat-ONE) > DGMAX);
   } else {
     crate = ONE;
     callSetup = FALSE;
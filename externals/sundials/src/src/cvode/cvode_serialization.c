@@ -25,6 +25,7 @@
 #include "cvode_impl.h"
 #include "cvode_direct_impl.h"
 #include "cvode_spils_impl.h"
+#include "cvode_sparse_impl.h"
 #include <cvode/cvode_serialization.h>
 #include <sundials/sundials_serialization.h>
 
@@ -469,6 +470,41 @@ size_t CVSpilsSerializationPrivate(int op, void *spils_mem, void ** storageDataP
   return memSize;
 }
 
+size_t CVSlsSerializationPrivate(int op, void *sls_mem, void ** storageDataPtr) {
+  CVSlsMem cvsls_mem = (CVSlsMem)sls_mem;
+  /* Variable to count memory size if operation is SUNDIALS_SERIALIZATION_OPERATION_SIZE */
+  size_t memSize = 0;
+  void * storageDataPtrStart;
+  int i;
+
+  /*! Store start address of memory block, initialize always to make compiler happy */
+  if (storageDataPtr != NULL)
+      storageDataPtrStart = *storageDataPtr;
+  else
+      storageDataPtrStart = NULL;
+
+  /* The sparsity pattern and the factorization data of the sparse solver are not stored. The
+     pattern is constant, and the matrix is factorized anew in the next call to the linear solver
+     setup function. Only the saved Jacobian values are needed, since they are reused if the
+     Jacobian is not re-evaluated in the setup function. */
+
+  CVODE_SERIALIZE_A(op, long int, *storageDataPtr, cvsls_mem->s_nje, memSize);
+  CVODE_SERIALIZE_A(op, long int, *storageDataPtr, cvsls_mem->s_last_flag, memSize);
+  CVODE_SERIALIZE_A(op, int, *storageDataPtr, cvsls_mem->s_nstlj, memSize);
+
+  for (i = 0; i < cvsls_mem->s_savedJ->NNZ; ++i)
+    CVODE_SERIALIZE_A(op, realtype, *storageDataPtr, cvsls_mem->s_savedJ->data[i], memSize);
+
+  switch (op) {
+    case SUNDIALS_SERIALIZATION_OPERATION_SERIALIZE :
+    case SUNDIALS_SERIALIZATION_OPERATION_DESERIALIZE :
+      memSize = (size_t)((char *)*storageDataPtr - (char *)storageDataPtrStart); break;
+    default: ;
+  }
+
+  return memSize;
+}
+
 /*
  * =================================================================
  * EXPORTED FUNCTIONS IMPLEMENTATION
@@ -512,3 +548,16 @@ size_t CVSpilsSerialize(void *cvode_mem, void ** storageDataPtr) {
 size_t CVSpilsDeserialize(void *cvode_mem, void ** storageDataPtr) {
   return CVSpilsSerializationPrivate(SUNDIALS_SERIALIZATION_OPERATION_DESERIALIZE, ((CVodeMem)cvode_mem)->cv_lmem, storageDataPtr);
 }
+
+
+size_t CVSlsSerializationSize(void *cvode_mem) {
+  return CVSlsSerializationPrivate(SUNDIALS_SERIALIZATION_OPERATION_SIZE, ((CVodeMem)cvode_mem)->cv_lmem, NULL);
+}
+
+size_t CVSlsSerialize(void *cvode_mem, void ** storageDataPtr) {
+  return CVSlsSerializationPrivate(SUNDIALS_SERIALIZATION_OPERATION_SERIALIZE, ((CVodeMem)cvode_mem)->cv_lmem, storageDataPtr);
+}
+
+size_t CVSlsDeserialize(void *cvode_mem, void ** storageDataPtr) {
+  return CVSlsSerializationPrivate(SUNDIALS_SERIALIZATION_OPERATION_DESERIALIZE, ((CVodeMem)cvode_mem)->cv_lmem, storageDataPtr);
+}